@@ -33,6 +33,7 @@ LOCAL_SRC_FILES := \
         $(aacenc_sources:%=libAACenc/src/%) \
         $(pcmutils_sources:%=libPCMutils/src/%) \
         $(fdk_sources:%=libFDK/src/%) \
+        libFDK/src/x86/dispatch_x86.cpp \
         $(sys_sources:%=libSYS/src/%) \
         $(mpegtpdec_sources:%=libMpegTPDec/src/%) \
         $(mpegtpenc_sources:%=libMpegTPEnc/src/%) \
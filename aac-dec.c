@@ -0,0 +1,255 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2026 The fdk-aac project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libAACdec/include/aacdecoder_lib.h"
+#include "wavwriter.h"
+#include "benchutil.h"
+
+void usage(const char* name) {
+	fprintf(stderr, "%s [-c channels] in.aac out.wav\n", name);
+	fprintf(stderr, "%s --bench [-c channels] in.aac...\n", name);
+	fprintf(stderr, "ADTS, LOAS and ADIF streams are detected automatically.\n");
+	fprintf(stderr, "The output is mixed down to at most the given number of channels.\n");
+	fprintf(stderr, "The bench mode decodes each file in memory and discards the output.\n");
+}
+
+/* Largest output of one decoded frame in samples. */
+#define OUTPUT_SAMPLES (8*2048)
+
+static TRANSPORT_TYPE detect_transport(const uint8_t *data, int size) {
+	if (size >= 4 && !memcmp(data, "ADIF", 4))
+		return TT_MP4_ADIF;
+	if (size >= 2 && data[0] == 0x56 && (data[1] & 0xe0) == 0xe0)
+		return TT_MP4_LOAS;
+	return TT_MP4_ADTS;
+}
+
+static HANDLE_AACDECODER open_decoder(TRANSPORT_TYPE transport, int max_channels) {
+	HANDLE_AACDECODER handle = aacDecoder_Open(transport, 1);
+	if (!handle) {
+		fprintf(stderr, "Unable to open decoder\n");
+		return NULL;
+	}
+	if (max_channels > 0 && aacDecoder_SetParam(handle, AAC_PCM_MAX_OUTPUT_CHANNELS, max_channels) != AAC_DEC_OK) {
+		fprintf(stderr, "Unable to set the maximum number of output channels\n");
+		aacDecoder_Close(handle);
+		return NULL;
+	}
+	return handle;
+}
+
+static const char* config_name(const CStreamInfo *info) {
+	int sbr = info->sampleRate != info->aacSampleRate;
+	switch (info->aot) {
+	case AOT_ER_AAC_LD:
+		return "LD";
+	case AOT_ER_AAC_ELD:
+		return sbr ? "ELDSBR" : "ELD";
+	default:
+		if (info->aacNumChannels == 1 && info->numChannels == 2 && sbr)
+			return "HEv2";
+		return sbr ? "HE" : "LC";
+	}
+}
+
+/* Decodes one file in memory and prints the timing. */
+static int bench_file(const char *infile, int max_channels) {
+	HANDLE_AACDECODER handle;
+	struct bench_stats stats;
+	CStreamInfo *info;
+	INT_PCM *pcm;
+	uint8_t *data;
+	int size, ret = 0;
+	double output_samples = 0;
+	UINT valid;
+
+	data = bench_read_file(infile, &size);
+	if (!data) {
+		fprintf(stderr, "Unable to read %s\n", infile);
+		return 1;
+	}
+	handle = open_decoder(detect_transport(data, size), max_channels);
+	if (!handle) {
+		free(data);
+		return 1;
+	}
+	pcm = (INT_PCM*) malloc(OUTPUT_SAMPLES*sizeof(INT_PCM));
+
+	bench_start(&stats);
+	valid = size;
+	while (valid > 0 && !ret) {
+		UCHAR *ptr = data;
+		UINT buffer_size = size;
+
+		aacDecoder_Fill(handle, &ptr, &buffer_size, &valid);
+		while (1) {
+			AAC_DECODER_ERROR err;
+			double start = bench_time();
+
+			err = aacDecoder_DecodeFrame(handle, pcm, OUTPUT_SAMPLES, 0);
+			if (err == AAC_DEC_NOT_ENOUGH_BITS)
+				break;
+			if (err != AAC_DEC_OK) {
+				fprintf(stderr, "Decoding failed\n");
+				ret = 1;
+				break;
+			}
+			bench_add_frame(&stats, bench_time() - start);
+			info = aacDecoder_GetStreamInfo(handle);
+			output_samples += info->frameSize;
+		}
+	}
+	bench_stop(&stats);
+
+	info = aacDecoder_GetStreamInfo(handle);
+	if (info->sampleRate > 0)
+		bench_print(&stats, config_name(info), info->numChannels, infile, output_samples/info->sampleRate);
+	bench_free(&stats);
+
+	aacDecoder_Close(handle);
+	free(pcm);
+	free(data);
+	return ret;
+}
+
+/* One file of the bench mode, run by bench_run(). */
+struct bench_job {
+	const char *infile;
+	int max_channels;
+};
+
+static int bench_job_run(void *arg) {
+	const struct bench_job *job = (const struct bench_job*) arg;
+	return bench_file(job->infile, job->max_channels);
+}
+
+int main(int argc, char *argv[]) {
+	int ch;
+	const char *infile, *outfile;
+	FILE *in;
+	void *wav = NULL;
+	int max_channels = -1;
+	int bench = 0, ret = 0;
+	HANDLE_AACDECODER handle;
+	uint8_t input_buf[8192];
+	INT_PCM *decode_buf;
+	uint8_t *output_buf;
+	int read;
+
+	if (argc > 1 && !strcmp(argv[1], "--bench")) {
+		bench = 1;
+		argv[1] = argv[0];
+		argc--;
+		argv++;
+	}
+	while ((ch = getopt(argc, argv, "c:")) != -1) {
+		switch (ch) {
+		case 'c':
+			max_channels = atoi(optarg);
+			break;
+		case '?':
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (bench) {
+		int n;
+		if (argc - optind < 1) {
+			usage(argv[0]);
+			return 1;
+		}
+		bench_print_header();
+		for (n = optind; n < argc; n++) {
+			struct bench_job job = { argv[n], max_channels };
+			ret |= bench_run(bench_job_run, &job);
+		}
+		return ret;
+	}
+	if (argc - optind < 2) {
+		usage(argv[0]);
+		return 1;
+	}
+	infile = argv[optind];
+	outfile = argv[optind + 1];
+
+	in = fopen(infile, "rb");
+	if (!in) {
+		perror(infile);
+		return 1;
+	}
+	read = fread(input_buf, 1, sizeof(input_buf), in);
+	handle = open_decoder(detect_transport(input_buf, read), max_channels);
+	if (!handle)
+		return 1;
+
+	decode_buf = (INT_PCM*) malloc(OUTPUT_SAMPLES*sizeof(INT_PCM));
+	output_buf = (uint8_t*) malloc(OUTPUT_SAMPLES*2);
+
+	while (read > 0 && !ret) {
+		UCHAR *ptr = input_buf;
+		UINT buffer_size = read, valid = read;
+
+		while (valid > 0 && !ret) {
+			aacDecoder_Fill(handle, &ptr, &buffer_size, &valid);
+			while (1) {
+				CStreamInfo *info;
+				AAC_DECODER_ERROR err;
+				int i;
+
+				err = aacDecoder_DecodeFrame(handle, decode_buf, OUTPUT_SAMPLES, 0);
+				if (err == AAC_DEC_NOT_ENOUGH_BITS)
+					break;
+				if (err != AAC_DEC_OK) {
+					fprintf(stderr, "Decoding failed\n");
+					ret = 1;
+					break;
+				}
+				info = aacDecoder_GetStreamInfo(handle);
+				if (!wav) {
+					wav = wav_write_open(outfile, info->sampleRate, 16, info->numChannels);
+					if (!wav) {
+						perror(outfile);
+						ret = 1;
+						break;
+					}
+				}
+				for (i = 0; i < info->frameSize*info->numChannels; i++) {
+					uint8_t* out = &output_buf[2*i];
+					out[0] = decode_buf[i] & 0xff;
+					out[1] = decode_buf[i] >> 8;
+				}
+				wav_write_data(wav, output_buf, 2*info->frameSize*info->numChannels);
+			}
+		}
+		read = fread(input_buf, 1, sizeof(input_buf), in);
+	}
+	free(decode_buf);
+	free(output_buf);
+	if (wav)
+		wav_write_close(wav);
+	fclose(in);
+	aacDecoder_Close(handle);
+
+	return ret;
+}
@@ -20,21 +20,292 @@
 #include <stdint.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 #include "libAACenc/include/aacenc_lib.h"
 #include "wavreader.h"
+#include "benchutil.h"
 
 void usage(const char* name) {
-	fprintf(stderr, "%s [-r bitrate] [-t aot] [-a afterburner] [-s sbr] [-v vbr] in.wav out.aac\n", name);
+	fprintf(stderr, "%s [-r bitrate] [-t aot] [-a afterburner] [-s sbr] [-v vbr] [-j segments] in.wav out.aac\n", name);
+	fprintf(stderr, "%s --bench [-r bitrate] [-t aot] [-a afterburner] [-s sbr] [-v vbr] in.wav...\n", name);
 	fprintf(stderr, "Supported AOTs:\n");
 	fprintf(stderr, "\t2\tAAC-LC\n");
 	fprintf(stderr, "\t5\tHE-AAC\n");
 	fprintf(stderr, "\t29\tHE-AAC v2\n");
 	fprintf(stderr, "\t23\tAAC-LD\n");
 	fprintf(stderr, "\t39\tAAC-ELD\n");
+	fprintf(stderr, "LD and ELD are written as LOAS, all other AOTs as ADTS.\n");
+	fprintf(stderr, "Segments are encoded in parallel by that many encoder instances.\n");
+	fprintf(stderr, "The bench mode encodes each file in memory with all AOTs, or the given one,\n");
+	fprintf(stderr, "and discards the output.\n");
+}
+
+/* Frames per segment of one chunk in parallel segment encoding. */
+#define SEGMENT_FRAMES 512
+
+static int setup_encoder(HANDLE_AACENCODER handle, int aot, int eld_sbr, int sample_rate, CHANNEL_MODE mode, int vbr, int bitrate, int afterburner) {
+	if (aacEncoder_SetParam(handle, AACENC_AOT, aot) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the AOT\n");
+		return 1;
+	}
+	if (aot == 39 && eld_sbr) {
+		if (aacEncoder_SetParam(handle, AACENC_SBR_MODE, 1) != AACENC_OK) {
+			fprintf(stderr, "Unable to set SBR mode for ELD\n");
+			return 1;
+		}
+	}
+	if (aacEncoder_SetParam(handle, AACENC_SAMPLERATE, sample_rate) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the AOT\n");
+		return 1;
+	}
+	if (aacEncoder_SetParam(handle, AACENC_CHANNELMODE, mode) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the channel mode\n");
+		return 1;
+	}
+	if (aacEncoder_SetParam(handle, AACENC_CHANNELORDER, 1) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the wav channel order\n");
+		return 1;
+	}
+	if (vbr) {
+		if (aacEncoder_SetParam(handle, AACENC_BITRATEMODE, vbr) != AACENC_OK) {
+			fprintf(stderr, "Unable to set the VBR bitrate mode\n");
+			return 1;
+		}
+	} else {
+		if (aacEncoder_SetParam(handle, AACENC_BITRATE, bitrate) != AACENC_OK) {
+			fprintf(stderr, "Unable to set the bitrate\n");
+			return 1;
+		}
+	}
+	/* ADTS cannot signal the low delay AOTs */
+	if (aacEncoder_SetParam(handle, AACENC_TRANSMUX, (aot == 23 || aot == 39) ? 10 : 2) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the transmux\n");
+		return 1;
+	}
+	if (aacEncoder_SetParam(handle, AACENC_AFTERBURNER, afterburner) != AACENC_OK) {
+		fprintf(stderr, "Unable to set the afterburner mode\n");
+		return 1;
+	}
+	if (aacEncEncode(handle, NULL, NULL, NULL, NULL) != AACENC_OK) {
+		fprintf(stderr, "Unable to initialize the encoder\n");
+		return 1;
+	}
+	return 0;
+}
+
+static int encode_segments(HANDLE_AACENCODER *handles, int segments, void *wav, int channels, int frame_length, FILE *out) {
+	HANDLE_AACENC_SEGMENTS hsegments;
+	int chunk_samples = segments*SEGMENT_FRAMES*frame_length*channels;
+	uint8_t *input_buf = (uint8_t*) malloc(2*chunk_samples);
+	int16_t *convert_buf = (int16_t*) malloc(2*chunk_samples);
+	UINT output_size, output_bytes;
+	uint8_t *output_buf;
+	int last = 0, ret = 0;
+
+	if (aacEncSegmentsOpen(&hsegments, handles, segments, AACENC_SEGMENTS_PREROLL) != AACENC_OK) {
+		fprintf(stderr, "Unable to open the segment encoder\n");
+		return 1;
+	}
+	output_size = aacEncSegmentsGetOutBufferSize(hsegments, chunk_samples, 1);
+	output_buf = (uint8_t*) malloc(output_size);
+
+	while (!last) {
+		int read, i;
+
+		read = wav_read_data(wav, input_buf, 2*chunk_samples);
+		if (read < 0)
+			read = 0;
+		for (i = 0; i < read/2; i++) {
+			const uint8_t* in = &input_buf[2*i];
+			convert_buf[i] = in[0] | (in[1] << 8);
+		}
+		last = read < 2*chunk_samples;
+		if (aacEncSegmentsEncode(hsegments, convert_buf, read/2, last, output_buf, output_size, &output_bytes) != AACENC_OK) {
+			fprintf(stderr, "Encoding failed\n");
+			ret = 1;
+			break;
+		}
+		fwrite(output_buf, 1, output_bytes, out);
+	}
+	aacEncSegmentsClose(&hsegments);
+	free(input_buf);
+	free(convert_buf);
+	free(output_buf);
+	return ret;
+}
+
+static int get_channel_mode(int channels, CHANNEL_MODE *mode) {
+	switch (channels) {
+	case 1: *mode = MODE_1;       break;
+	case 2: *mode = MODE_2;       break;
+	case 3: *mode = MODE_1_2;     break;
+	case 4: *mode = MODE_1_2_1;   break;
+	case 5: *mode = MODE_1_2_2;   break;
+	case 6: *mode = MODE_1_2_2_1; break;
+	default:
+		fprintf(stderr, "Unsupported WAV channels %d\n", channels);
+		return 1;
+	}
+	return 0;
+}
+
+static const struct {
+	const char *name;
+	int aot;
+	int bitrate;	/* per channel */
+} bench_configs[] = {
+	{ "LC",   2,  64000 },
+	{ "HE",   5,  32000 },
+	{ "HEv2", 29, 16000 },
+	{ "LD",   23, 64000 },
+	{ "ELD",  39, 64000 },
+};
+
+/* Reads the whole WAV file into memory. */
+static int16_t* bench_read_wav(const char *infile, int *sample_rate, int *channels, int *samples) {
+	void *wav = wav_read_open(infile);
+	int format, bits_per_sample, alloc = 0;
+	int16_t *pcm = NULL;
+	uint8_t buf[8192];
+
+	if (!wav) {
+		fprintf(stderr, "Unable to open wav file %s\n", infile);
+		return NULL;
+	}
+	if (!wav_get_header(wav, &format, channels, sample_rate, &bits_per_sample, NULL) || format != 1 || bits_per_sample != 16) {
+		fprintf(stderr, "Unsupported wav file %s\n", infile);
+		wav_read_close(wav);
+		return NULL;
+	}
+	*samples = 0;
+	while (1) {
+		int read = wav_read_data(wav, buf, sizeof(buf)), i;
+		if (read <= 0)
+			break;
+		if (*samples + read/2 > alloc) {
+			int16_t *grown;
+			alloc = 2*alloc + read/2;
+			grown = (int16_t*) realloc(pcm, alloc*sizeof(int16_t));
+			if (!grown)
+				break;
+			pcm = grown;
+		}
+		for (i = 0; i < read/2; i++)
+			pcm[(*samples)++] = buf[2*i] | (buf[2*i + 1] << 8);
+	}
+	wav_read_close(wav);
+	return pcm;
+}
+
+/* One configuration of the bench mode, run by bench_run(). */
+struct bench_job {
+	const char *infile;
+	int16_t *pcm;
+	int sample_rate, channels, samples;
+	CHANNEL_MODE mode;
+	int config, bitrate, vbr, afterburner, eld_sbr;
+};
+
+/* Encodes the file in memory with one configuration and prints the timing. */
+static int bench_config(void *arg) {
+	const struct bench_job *job = (const struct bench_job*) arg;
+	int16_t *pcm = job->pcm;
+	int samples = job->samples, channels = job->channels, c = job->config;
+	HANDLE_AACENCODER handle;
+	struct bench_stats stats;
+	int pos = 0;
+
+	if (aacEncOpen(&handle, 0, channels) != AACENC_OK) {
+		fprintf(stderr, "Unable to open encoder\n");
+		return 1;
+	}
+	if (setup_encoder(handle, bench_configs[c].aot, job->eld_sbr, job->sample_rate, job->mode, job->vbr,
+	                  job->bitrate ? job->bitrate : channels*bench_configs[c].bitrate, job->afterburner)) {
+		fprintf(stderr, "Skipping %s for %s\n", bench_configs[c].name, job->infile);
+		aacEncClose(&handle);
+		return 0;
+	}
+
+	bench_start(&stats);
+	while (1) {
+		AACENC_BufDesc in_buf = { 0 }, out_buf = { 0 };
+		AACENC_InArgs in_args = { 0 };
+		AACENC_OutArgs out_args = { 0 };
+		int in_identifier = IN_AUDIO_DATA;
+		int in_size, in_elem_size = 2;
+		int out_identifier = OUT_BITSTREAM_DATA;
+		int out_size, out_elem_size = 1;
+		void *in_ptr = pcm + pos, *out_ptr;
+		uint8_t outbuf[20480];
+		AACENC_ERROR err;
+		double start;
+
+		if (pos < samples) {
+			in_args.numInSamples = samples - pos;
+			in_size = 2*in_args.numInSamples;
+			in_buf.numBufs = 1;
+			in_buf.bufs = &in_ptr;
+			in_buf.bufferIdentifiers = &in_identifier;
+			in_buf.bufSizes = &in_size;
+			in_buf.bufElSizes = &in_elem_size;
+		} else {
+			in_args.numInSamples = -1;
+		}
+		out_ptr = outbuf;
+		out_size = sizeof(outbuf);
+		out_buf.numBufs = 1;
+		out_buf.bufs = &out_ptr;
+		out_buf.bufferIdentifiers = &out_identifier;
+		out_buf.bufSizes = &out_size;
+		out_buf.bufElSizes = &out_elem_size;
+
+		start = bench_time();
+		err = aacEncEncode(handle, &in_buf, &out_buf, &in_args, &out_args);
+		if (err != AACENC_OK) {
+			if (err != AACENC_ENCODE_EOF)
+				fprintf(stderr, "Encoding failed\n");
+			break;
+		}
+		if (out_args.numOutBytes > 0)
+			bench_add_frame(&stats, bench_time() - start);
+		pos += out_args.numInSamples;
+	}
+	bench_stop(&stats);
+
+	bench_print(&stats, bench_configs[c].name, channels, job->infile, (double) samples/channels/job->sample_rate);
+	bench_free(&stats);
+	aacEncClose(&handle);
+	return 0;
+}
+
+/* Encodes one file in memory with every configuration, each in its own process. */
+static int bench_file(const char *infile, int aot, int bitrate, int vbr, int afterburner, int eld_sbr) {
+	struct bench_job job;
+	int ret = 0;
+
+	job.pcm = bench_read_wav(infile, &job.sample_rate, &job.channels, &job.samples);
+	if (!job.pcm || get_channel_mode(job.channels, &job.mode)) {
+		free(job.pcm);
+		return 1;
+	}
+	job.infile = infile;
+	job.bitrate = bitrate;
+	job.vbr = vbr;
+	job.afterburner = afterburner;
+	job.eld_sbr = eld_sbr;
+
+	for (job.config = 0; job.config < (int) (sizeof(bench_configs)/sizeof(bench_configs[0])) && !ret; job.config++) {
+		int config_aot = bench_configs[job.config].aot;
+		if (aot ? config_aot != aot : (config_aot == 29 && job.channels != 2))
+			continue;
+		ret = bench_run(bench_config, &job);
+	}
+	free(job.pcm);
+	return ret;
 }
 
 int main(int argc, char *argv[]) {
-	int bitrate = 64000;
+	int bitrate = 0;
 	int ch;
 	const char *infile, *outfile;
 	FILE *out;
@@ -43,20 +314,29 @@ int main(int argc, char *argv[]) {
 	int input_size;
 	uint8_t* input_buf;
 	int16_t* convert_buf;
-	int aot = 2;
+	int aot = 2, aot_set = 0;
 	int afterburner = 1;
 	int eld_sbr = 0;
 	int vbr = 0;
-	HANDLE_AACENCODER handle;
+	int segments = 1, n;
+	int bench = 0;
+	HANDLE_AACENCODER handle, handles[AACENC_SEGMENTS_MAX_ENCODERS];
 	CHANNEL_MODE mode;
 	AACENC_InfoStruct info = { 0 };
-	while ((ch = getopt(argc, argv, "r:t:a:s:v:")) != -1) {
+	if (argc > 1 && !strcmp(argv[1], "--bench")) {
+		bench = 1;
+		argv[1] = argv[0];
+		argc--;
+		argv++;
+	}
+	while ((ch = getopt(argc, argv, "r:t:a:s:v:j:")) != -1) {
 		switch (ch) {
 		case 'r':
 			bitrate = atoi(optarg);
 			break;
 		case 't':
 			aot = atoi(optarg);
+			aot_set = 1;
 			break;
 		case 'a':
 			afterburner = atoi(optarg);
@@ -67,16 +347,36 @@ int main(int argc, char *argv[]) {
 		case 'v':
 			vbr = atoi(optarg);
 			break;
+		case 'j':
+			segments = atoi(optarg);
+			if (segments < 1 || segments > AACENC_SEGMENTS_MAX_ENCODERS) {
+				usage(argv[0]);
+				return 1;
+			}
+			break;
 		case '?':
 		default:
 			usage(argv[0]);
 			return 1;
 		}
 	}
+	if (bench) {
+		int ret = 0;
+		if (argc - optind < 1) {
+			usage(argv[0]);
+			return 1;
+		}
+		bench_print_header();
+		for (n = optind; n < argc; n++)
+			ret |= bench_file(argv[n], aot_set ? aot : 0, bitrate, vbr, afterburner, eld_sbr);
+		return ret;
+	}
 	if (argc - optind < 2) {
 		usage(argv[0]);
 		return 1;
 	}
+	if (!bitrate)
+		bitrate = 64000;
 	infile = argv[optind];
 	outfile = argv[optind + 1];
 
@@ -97,66 +397,17 @@ int main(int argc, char *argv[]) {
 		fprintf(stderr, "Unsupported WAV sample depth %d\n", bits_per_sample);
 		return 1;
 	}
-	switch (channels) {
-	case 1: mode = MODE_1;       break;
-	case 2: mode = MODE_2;       break;
-	case 3: mode = MODE_1_2;     break;
-	case 4: mode = MODE_1_2_1;   break;
-	case 5: mode = MODE_1_2_2;   break;
-	case 6: mode = MODE_1_2_2_1; break;
-	default:
-		fprintf(stderr, "Unsupported WAV channels %d\n", channels);
-		return 1;
-	}
-	if (aacEncOpen(&handle, 0, channels) != AACENC_OK) {
-		fprintf(stderr, "Unable to open encoder\n");
-		return 1;
-	}
-	if (aacEncoder_SetParam(handle, AACENC_AOT, aot) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the AOT\n");
-		return 1;
-	}
-	if (aot == 39 && eld_sbr) {
-		if (aacEncoder_SetParam(handle, AACENC_SBR_MODE, 1) != AACENC_OK) {
-			fprintf(stderr, "Unable to set SBR mode for ELD\n");
-			return 1;
-		}
-	}
-	if (aacEncoder_SetParam(handle, AACENC_SAMPLERATE, sample_rate) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the AOT\n");
-		return 1;
-	}
-	if (aacEncoder_SetParam(handle, AACENC_CHANNELMODE, mode) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the channel mode\n");
+	if (get_channel_mode(channels, &mode))
 		return 1;
-	}
-	if (aacEncoder_SetParam(handle, AACENC_CHANNELORDER, 1) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the wav channel order\n");
-		return 1;
-	}
-	if (vbr) {
-		if (aacEncoder_SetParam(handle, AACENC_BITRATEMODE, vbr) != AACENC_OK) {
-			fprintf(stderr, "Unable to set the VBR bitrate mode\n");
+	for (n = 0; n < segments; n++) {
+		if (aacEncOpen(&handles[n], 0, channels) != AACENC_OK) {
+			fprintf(stderr, "Unable to open encoder\n");
 			return 1;
 		}
-	} else {
-		if (aacEncoder_SetParam(handle, AACENC_BITRATE, bitrate) != AACENC_OK) {
-			fprintf(stderr, "Unable to set the bitrate\n");
+		if (setup_encoder(handles[n], aot, eld_sbr, sample_rate, mode, vbr, bitrate, afterburner))
 			return 1;
-		}
-	}
-	if (aacEncoder_SetParam(handle, AACENC_TRANSMUX, 2) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the ADTS transmux\n");
-		return 1;
-	}
-	if (aacEncoder_SetParam(handle, AACENC_AFTERBURNER, afterburner) != AACENC_OK) {
-		fprintf(stderr, "Unable to set the afterburner mode\n");
-		return 1;
-	}
-	if (aacEncEncode(handle, NULL, NULL, NULL, NULL) != AACENC_OK) {
-		fprintf(stderr, "Unable to initialize the encoder\n");
-		return 1;
 	}
+	handle = handles[0];
 	if (aacEncInfo(handle, &info) != AACENC_OK) {
 		fprintf(stderr, "Unable to get the encoder info\n");
 		return 1;
@@ -168,6 +419,15 @@ int main(int argc, char *argv[]) {
 		return 1;
 	}
 
+	if (segments > 1) {
+		int ret = encode_segments(handles, segments, wav, channels, info.frameLength, out);
+		fclose(out);
+		wav_read_close(wav);
+		for (n = 0; n < segments; n++)
+			aacEncClose(&handles[n]);
+		return ret;
+	}
+
 	input_size = channels*2*info.frameLength;
 	input_buf = (uint8_t*) malloc(input_size);
 	convert_buf = (int16_t*) malloc(input_size);
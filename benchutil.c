@@ -0,0 +1,165 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2026 The fdk-aac project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+
+#include "benchutil.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+double bench_time(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+/* CPU time of all threads of the process. */
+static double cpu_time(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+/* Peak RSS of the calling process. Within bench_run() this is the peak of the
+ * child running one configuration, which starts at the RSS of the parent. */
+static double peak_rss_mb(void) {
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+#if defined(__APPLE__)
+	return usage.ru_maxrss/(1024.0*1024.0);
+#else
+	return usage.ru_maxrss/1024.0;
+#endif
+}
+
+int bench_run(int (*run)(void* arg), void* arg) {
+	pid_t pid;
+	int status;
+
+	fflush(stdout);
+	fflush(stderr);
+	pid = fork();
+	if (pid < 0)
+		return run(arg);
+	if (pid == 0) {
+		status = run(arg);
+		fflush(stdout);
+		fflush(stderr);
+		_exit(status ? 1 : 0);
+	}
+	if (waitpid(pid, &status, 0) != pid)
+		return 1;
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+}
+
+void bench_start(struct bench_stats* stats) {
+	memset(stats, 0, sizeof(*stats));
+	stats->wall_start = bench_time();
+	stats->cpu_start = cpu_time();
+}
+
+void bench_add_frame(struct bench_stats* stats, double seconds) {
+	if (stats->frames == stats->size) {
+		double *latency;
+		int size = stats->size ? 2*stats->size : 4096;
+		latency = (double*) realloc(stats->latency, size*sizeof(double));
+		if (!latency)
+			return;
+		stats->latency = latency;
+		stats->size = size;
+	}
+	stats->latency[stats->frames++] = seconds;
+}
+
+void bench_stop(struct bench_stats* stats) {
+	stats->wall = bench_time() - stats->wall_start;
+	stats->cpu = cpu_time() - stats->cpu_start;
+}
+
+void bench_free(struct bench_stats* stats) {
+	free(stats->latency);
+	stats->latency = NULL;
+	stats->frames = stats->size = 0;
+}
+
+static int compare_double(const void* a, const void* b) {
+	double x = *(const double*) a, y = *(const double*) b;
+	return (x > y) - (x < y);
+}
+
+/* Nearest rank percentile of the sorted latencies in us. */
+static double percentile(const struct bench_stats* stats, int p) {
+	int rank = (p*stats->frames + 99)/100;
+	if (stats->frames == 0)
+		return 0;
+	if (rank < 1)
+		rank = 1;
+	return 1e6*stats->latency[rank - 1];
+}
+
+void bench_print_header(void) {
+	printf("%-6s %3s %-24s %8s %10s %10s %8s %9s %9s %9s\n", "config", "ch", "file", "frames",
+	       "frames/s", "xRT/core", "RSS MB", "p50 us", "p99 us", "max us");
+}
+
+void bench_print(const struct bench_stats* stats, const char* config, int channels, const char* file, double audio_seconds) {
+	const char *name = strrchr(file, '/');
+	name = name ? name + 1 : file;
+
+	qsort(stats->latency, stats->frames, sizeof(double), compare_double);
+	printf("%-6s %3d %-24.24s %8d %10.1f %10.1f %8.1f %9.1f %9.1f %9.1f\n", config, channels, name, stats->frames,
+	       stats->wall > 0 ? stats->frames/stats->wall : 0,
+	       stats->cpu > 0 ? audio_seconds/stats->cpu : 0,
+	       peak_rss_mb(), percentile(stats, 50), percentile(stats, 99), percentile(stats, 100));
+	fflush(stdout);
+}
+
+unsigned char* bench_read_file(const char* filename, int* size) {
+	FILE *f = fopen(filename, "rb");
+	unsigned char *data = NULL;
+	int n = 0, alloc = 0;
+
+	if (!f)
+		return NULL;
+	while (1) {
+		int read;
+		if (n == alloc) {
+			unsigned char *grown;
+			alloc = alloc ? 2*alloc : 1 << 20;
+			grown = (unsigned char*) realloc(data, alloc);
+			if (!grown) {
+				free(data);
+				fclose(f);
+				return NULL;
+			}
+			data = grown;
+		}
+		read = fread(data + n, 1, alloc - n, f);
+		if (read <= 0)
+			break;
+		n += read;
+	}
+	fclose(f);
+	*size = n;
+	return data;
+}
+
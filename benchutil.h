@@ -0,0 +1,59 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2026 The fdk-aac project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Timing of one configuration in the --bench mode of the example programs. */
+struct bench_stats {
+	double *latency;	/* seconds per frame */
+	int frames;
+	int size;
+	double wall_start, cpu_start;
+	double wall, cpu;	/* seconds of the whole run */
+};
+
+double bench_time(void);
+
+/* Runs one configuration in a child process, so that the peak RSS printed by
+ * bench_print() belongs to that configuration and not to the ones before it.
+ * Runs it in the calling process if no child can be created. Returns 0 if
+ * run() returned 0. */
+int bench_run(int (*run)(void* arg), void* arg);
+
+void bench_start(struct bench_stats* stats);
+void bench_add_frame(struct bench_stats* stats, double seconds);
+void bench_stop(struct bench_stats* stats);
+void bench_free(struct bench_stats* stats);
+
+void bench_print_header(void);
+void bench_print(const struct bench_stats* stats, const char* config, int channels, const char* file, double audio_seconds);
+
+/* Reads a whole file into memory, returns NULL on failure. */
+unsigned char* bench_read_file(const char* filename, int* size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
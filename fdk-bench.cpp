@@ -0,0 +1,992 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: Micro benchmark of the hot signal processing kernels
+
+   Every kernel is timed in isolation on a synthetic white noise input and on
+   a real signal, which is read from a WAV file if one is given or generated
+   as a harmonic tone complex otherwise. The results are printed as ns per
+   call and as signal samples processed per second.
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "genericStds.h"
+#include "common_fix.h"
+#include "FDK_bitstream.h"
+#include "FDK_tools_rom.h"
+#include "fft.h"
+#include "dct.h"
+#include "mdct.h"
+#include "qmf.h"
+
+#include "block.h"
+#include "aac_rom.h"
+#include "bit_cnt.h"
+#include "quantize.h"
+#include "lpp_tran.h"
+#include "limiter.h"
+#include "pcmutils_lib.h"
+
+#include "wavreader.h"
+
+/* Number of mono samples of each input signal. */
+#define BENCH_SIGNAL_LEN     (1<<16)
+/* Frame length of the frame based kernels. */
+#define BENCH_FRAME          (1024)
+/* Headroom of the fixed point kernel inputs in bits. */
+#define BENCH_HEADROOM       (4)
+/* Number of data copies an in-place transform cycles through within one timed round. */
+#define BENCH_MAX_SLOTS      (64)
+/* Size of the bit buffer holding one Huffman coded spectrum (must be 2^n). */
+#define BENCH_BS_SIZE        (16384)
+
+/* QMF and LPP transposer set-up of a dual rate SBR decoder. */
+#define BENCH_QMF_COLS       (32)
+#define BENCH_QMF_ANA_BANDS  (32)
+#define BENCH_QMF_SYN_BANDS  (64)
+#define BENCH_LPP_OVERLAP    (6)
+
+typedef struct
+{
+  const char *name;
+  INT_PCM    *pcm;             /*!< BENCH_SIGNAL_LEN mono samples */
+} BENCH_INPUT;
+
+typedef struct
+{
+  double      minSeconds;      /*!< Minimum measurement time of each case */
+  const char *filter;          /*!< Only kernels containing this string are run, if not NULL */
+} BENCH_OPTS;
+
+/** One measurement: run() is timed, prepare() restores the input of in-place kernels outside of the
+    timed region. A case with several slots runs on as many independent data copies in one round. */
+typedef struct
+{
+  void (*prepare)(void *ctx, int slot);
+  void (*run)(void *ctx, int slot);
+  void  *ctx;
+  int    slots;
+} BENCH_CASE;
+
+
+static double benchSeconds(void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER t, f;
+  QueryPerformanceCounter(&t);
+  QueryPerformanceFrequency(&f);
+  return (double)t.QuadPart / (double)f.QuadPart;
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+#endif
+}
+
+/* Returns the mean time of one call in seconds. */
+static double benchMeasure(const BENCH_CASE *c, double minSeconds)
+{
+  double elapsed = 0.0, start;
+  UINT calls = 0, rounds = 1, r;
+  int s;
+
+  /* warm up caches and branch predictors */
+  for (s = 0; s < c->slots; s++) {
+    if (c->prepare != NULL) c->prepare(c->ctx, s);
+    c->run(c->ctx, s);
+  }
+
+  while (elapsed < minSeconds) {
+    if (c->prepare != NULL) {
+      for (r = 0; r < rounds; r++) {
+        for (s = 0; s < c->slots; s++) {
+          c->prepare(c->ctx, s);
+        }
+        start = benchSeconds();
+        for (s = 0; s < c->slots; s++) {
+          c->run(c->ctx, s);
+        }
+        elapsed += benchSeconds() - start;
+      }
+    }
+    else {
+      start = benchSeconds();
+      for (r = 0; r < rounds; r++) {
+        for (s = 0; s < c->slots; s++) {
+          c->run(c->ctx, s);
+        }
+      }
+      elapsed += benchSeconds() - start;
+    }
+    calls += rounds * c->slots;
+    if (rounds < (1<<16)) {
+      rounds <<= 1;
+    }
+  }
+
+  return elapsed / (double)calls;
+}
+
+static int benchSelected(const BENCH_OPTS *opts, const char *kernel)
+{
+  return (opts->filter == NULL) || (strstr(kernel, opts->filter) != NULL);
+}
+
+static void benchReport(const BENCH_OPTS *opts, const BENCH_INPUT *in, const char *kernel,
+                        const char *config, int samples, const BENCH_CASE *c)
+{
+  double t = benchMeasure(c, opts->minSeconds);
+
+  printf("%-26s %-12s %-10s %12.1f %12.2f\n", kernel, config, in->name,
+         1e9 * t, 1e-6 * (double)samples / t);
+  fflush(stdout);
+}
+
+/* Converts PCM samples into FIXP_DBL values with BENCH_HEADROOM bits of headroom. */
+static void benchToDbl(FIXP_DBL *dst, const INT_PCM *src, int n)
+{
+  int i;
+  for (i = 0; i < n; i++) {
+    dst[i] = FX_PCM2FX_DBL(src[i]) >> BENCH_HEADROOM;
+  }
+}
+
+/* Frequency domain representation of the first frame of an input signal. */
+static void benchSpectrum(FIXP_DBL *spec, const INT_PCM *pcm)
+{
+  int e = 0;
+  benchToDbl(spec, pcm, BENCH_FRAME);
+  dct_IV(spec, BENCH_FRAME, &e);
+}
+
+
+/*
+ * In-place transforms: fft() and dct_IV()
+ */
+typedef struct
+{
+  int       length;            /*!< Number of FIXP_DBL values of one slot */
+  int       size;              /*!< Transform size */
+  FIXP_DBL *src;
+  FIXP_DBL *slot[BENCH_MAX_SLOTS];
+} BENCH_TRANSFORM;
+
+static void benchTransformPrepare(void *ctx, int s)
+{
+  BENCH_TRANSFORM *b = (BENCH_TRANSFORM*)ctx;
+  FDKmemcpy(b->slot[s], b->src, b->length*sizeof(FIXP_DBL));
+}
+
+static void benchFftRun(void *ctx, int s)
+{
+  BENCH_TRANSFORM *b = (BENCH_TRANSFORM*)ctx;
+  INT scale = 0;
+  fft(b->size, b->slot[s], &scale);
+}
+
+static void benchDctRun(void *ctx, int s)
+{
+  BENCH_TRANSFORM *b = (BENCH_TRANSFORM*)ctx;
+  int e = 0;
+  dct_IV(b->slot[s], b->size, &e);
+}
+
+static void benchTransform(const BENCH_OPTS *opts, const BENCH_INPUT *in, const char *kernel,
+                           int size, int complex, void (*run)(void *, int))
+{
+  BENCH_TRANSFORM b;
+  BENCH_CASE c;
+  char config[32];
+  int s;
+
+  b.size   = size;
+  b.length = complex ? 2*size : size;
+  b.src    = (FIXP_DBL*)FDKaalloc(b.length*sizeof(FIXP_DBL), ALIGNMENT_DEFAULT);
+  benchToDbl(b.src, in->pcm, b.length);
+
+  /* Keep all copies of one round within 16 kB */
+  c.slots = fixMax(1, fixMin(BENCH_MAX_SLOTS, (int)(16384/(b.length*sizeof(FIXP_DBL)))));
+  for (s = 0; s < c.slots; s++) {
+    b.slot[s] = (FIXP_DBL*)FDKaalloc(b.length*sizeof(FIXP_DBL), ALIGNMENT_DEFAULT);
+  }
+  c.prepare = benchTransformPrepare;
+  c.run     = run;
+  c.ctx     = &b;
+
+  sprintf(config, "n=%d", size);
+  benchReport(opts, in, kernel, config, size, &c);
+
+  for (s = 0; s < c.slots; s++) {
+    FDKafree(b.slot[s]);
+  }
+  FDKafree(b.src);
+}
+
+static void benchFft(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  static const int lengths[] = { 3, 4, 5, 8, 15, 16, 32, 60, 64, 240, 256, 480, 512 };
+  int i;
+
+  for (i = 0; i < (int)(sizeof(lengths)/sizeof(lengths[0])); i++) {
+    benchTransform(opts, in, "fft", lengths[i], 1, benchFftRun);
+  }
+}
+
+static void benchDct(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  static const int sizes[] = { 1024, 960, 512, 480, 128, 120, 64, 32 };
+  int i;
+
+  for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+    benchTransform(opts, in, "dct_IV", sizes[i], 0, benchDctRun);
+  }
+}
+
+
+/*
+ * imdct_block()
+ */
+typedef struct
+{
+  mdct_t          mdct;
+  FIXP_DBL        overlap[2048];
+  FIXP_DBL        spec[BENCH_FRAME];
+  FIXP_DBL        work[BENCH_FRAME];
+  FIXP_DBL        out[BENCH_FRAME];
+  SHORT           scale[8];
+  int             nSpec;
+  int             tl;
+  const FIXP_WTP *window;
+} BENCH_IMDCT;
+
+static void benchImdctPrepare(void *ctx, int s)
+{
+  BENCH_IMDCT *b = (BENCH_IMDCT*)ctx;
+  FDKmemcpy(b->work, b->spec, sizeof(b->work));
+}
+
+static void benchImdctRun(void *ctx, int s)
+{
+  BENCH_IMDCT *b = (BENCH_IMDCT*)ctx;
+  imdct_block(&b->mdct, b->out, b->work, b->scale, b->nSpec, BENCH_FRAME,
+              b->tl, b->window, b->tl, b->window, b->tl, (FIXP_DBL)0);
+}
+
+static void benchImdct(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  BENCH_IMDCT *b = (BENCH_IMDCT*)FDKcalloc(1, sizeof(BENCH_IMDCT));
+  BENCH_CASE c;
+  int shortBlocks;
+
+  c.prepare = benchImdctPrepare;
+  c.run     = benchImdctRun;
+  c.ctx     = b;
+  c.slots   = 1;
+
+  for (shortBlocks = 0; shortBlocks <= 1; shortBlocks++) {
+    int w;
+
+    b->nSpec  = shortBlocks ? 8 : 1;
+    b->tl     = BENCH_FRAME / b->nSpec;
+    b->window = FDKgetWindowSlope(b->tl, 0);
+    for (w = 0; w < b->nSpec; w++) {
+      int e = 0;
+      benchToDbl(&b->spec[w*b->tl], &in->pcm[w*b->tl], b->tl);
+      dct_IV(&b->spec[w*b->tl], b->tl, &e);
+      b->scale[w] = (SHORT)e;
+    }
+    mdct_init(&b->mdct, b->overlap, 2048);
+
+    benchReport(opts, in, "imdct_block", shortBlocks ? "8x128" : "1x1024", BENCH_FRAME, &c);
+  }
+
+  FDKfree(b);
+}
+
+
+/*
+ * qmfAnalysisFiltering() and qmfSynthesisFiltering()
+ */
+typedef struct
+{
+  QMF_FILTER_BANK   ana;
+  QMF_FILTER_BANK   syn;
+  FIXP_DBL          anaStates[(2*QMF_NO_POLY-1)*BENCH_QMF_ANA_BANDS];
+  FIXP_QSS          synStates[(2*QMF_NO_POLY-1)*BENCH_QMF_SYN_BANDS];
+  FIXP_DBL          re[BENCH_QMF_COLS][BENCH_QMF_SYN_BANDS];
+  FIXP_DBL          im[BENCH_QMF_COLS][BENCH_QMF_SYN_BANDS];
+  FIXP_DBL         *pRe[BENCH_QMF_COLS];
+  FIXP_DBL         *pIm[BENCH_QMF_COLS];
+  QMF_SCALE_FACTOR  scale;
+  FIXP_DBL          work[2*(64)];
+  INT_PCM           out[BENCH_QMF_COLS*BENCH_QMF_SYN_BANDS];
+  const INT_PCM    *pcm;
+  int               pos;
+} BENCH_QMF;
+
+static void benchQmfAnalysisRun(void *ctx, int s)
+{
+  BENCH_QMF *b = (BENCH_QMF*)ctx;
+
+  qmfAnalysisFiltering(&b->ana, b->pRe, b->pIm, &b->scale, b->pcm + b->pos, 1);
+
+  /* stream through the signal */
+  b->pos += BENCH_QMF_COLS*BENCH_QMF_ANA_BANDS;
+  if (b->pos + BENCH_QMF_COLS*BENCH_QMF_ANA_BANDS > BENCH_SIGNAL_LEN) {
+    b->pos = 0;
+  }
+}
+
+static void benchQmfSynthesisRun(void *ctx, int s)
+{
+  BENCH_QMF *b = (BENCH_QMF*)ctx;
+  qmfSynthesisFiltering(&b->syn, b->pRe, b->pIm, &b->scale, 0, b->out, 1, b->work);
+}
+
+/* Fills the QMF buffers with the analysis of the input and a copy of the low band above it, as the
+   SBR decoder does. */
+static BENCH_QMF *benchQmfCreate(const BENCH_INPUT *in)
+{
+  BENCH_QMF *b = (BENCH_QMF*)FDKcalloc(1, sizeof(BENCH_QMF));
+  int col, band;
+
+  for (col = 0; col < BENCH_QMF_COLS; col++) {
+    b->pRe[col] = b->re[col];
+    b->pIm[col] = b->im[col];
+  }
+  b->pcm = in->pcm;
+
+  qmfInitAnalysisFilterBank(&b->ana, (FIXP_QAS*)b->anaStates, BENCH_QMF_COLS,
+                            BENCH_QMF_ANA_BANDS, BENCH_QMF_ANA_BANDS, BENCH_QMF_ANA_BANDS, 0);
+  qmfInitSynthesisFilterBank(&b->syn, b->synStates, BENCH_QMF_COLS,
+                             BENCH_QMF_ANA_BANDS, BENCH_QMF_SYN_BANDS, BENCH_QMF_SYN_BANDS, 0);
+
+  benchQmfAnalysisRun(b, 0);
+  b->pos = 0;
+  for (col = 0; col < BENCH_QMF_COLS; col++) {
+    for (band = BENCH_QMF_ANA_BANDS; band < BENCH_QMF_SYN_BANDS; band++) {
+      b->re[col][band] = b->re[col][band-BENCH_QMF_ANA_BANDS] >> 1;
+      b->im[col][band] = b->im[col][band-BENCH_QMF_ANA_BANDS] >> 1;
+    }
+  }
+  b->scale.hb_scale    = b->scale.lb_scale;
+  b->scale.ov_lb_scale = b->scale.lb_scale;
+  b->scale.ov_hb_scale = b->scale.lb_scale;
+
+  return b;
+}
+
+static void benchQmf(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  BENCH_QMF *b = benchQmfCreate(in);
+  BENCH_CASE c;
+
+  c.prepare = NULL;
+  c.ctx     = b;
+  c.slots   = 1;
+
+  if (benchSelected(opts, "qmfSynthesisFiltering")) {
+    c.run = benchQmfSynthesisRun;
+    benchReport(opts, in, "qmfSynthesisFiltering", "64 bands", BENCH_QMF_COLS*BENCH_QMF_SYN_BANDS, &c);
+  }
+  if (benchSelected(opts, "qmfAnalysisFiltering")) {
+    c.run = benchQmfAnalysisRun;
+    benchReport(opts, in, "qmfAnalysisFiltering", "32 bands", BENCH_QMF_COLS*BENCH_QMF_ANA_BANDS, &c);
+  }
+
+  FDKfree(b);
+}
+
+
+/*
+ * CBlock_DecodeHuffmanWord(), FDKaacEnc_bitCount() and FDKaacEnc_QuantizeSpectrum()
+ */
+typedef struct
+{
+  FIXP_DBL      spec[BENCH_FRAME];
+  SHORT         quant[BENCH_FRAME];
+  INT           sfbOffset[MAX_SFB_LONG+1];
+  INT           scf[MAX_SFB_LONG];
+  INT           sfbMax[MAX_SFB_LONG];
+  INT           bitCountLut[CODE_BOOK_ESC_NDX+1];
+  int           sfbCnt;
+  int           globalGain;
+
+  /* Huffman decoding */
+  UCHAR         bsBuffer[BENCH_BS_SIZE];
+  FDK_BITSTREAM bs;
+  UINT          bsBits;
+  int           codeBook;
+  SHORT         coded[BENCH_FRAME];
+  FIXP_DBL      decoded[BENCH_FRAME];
+} BENCH_CODING;
+
+static void benchQuantizeRun(void *ctx, int s)
+{
+  BENCH_CODING *b = (BENCH_CODING*)ctx;
+  FDKaacEnc_QuantizeSpectrum(b->sfbCnt, b->sfbCnt, b->sfbCnt, b->sfbOffset, b->spec,
+                             b->globalGain, b->scf, b->quant);
+}
+
+static void benchBitCountRun(void *ctx, int s)
+{
+  BENCH_CODING *b = (BENCH_CODING*)ctx;
+  int sfb;
+
+  for (sfb = 0; sfb < b->sfbCnt; sfb++) {
+    FDKaacEnc_bitCount(b->quant + b->sfbOffset[sfb], b->sfbOffset[sfb+1] - b->sfbOffset[sfb],
+                       b->sfbMax[sfb], b->bitCountLut);
+  }
+}
+
+/* Spectral data decoding loop of CBlock_ReadSpectralData() for one codebook. */
+static void benchHuffmanRun(void *ctx, int s)
+{
+  BENCH_CODING *b = (BENCH_CODING*)ctx;
+  const CodeBookDescription *hcb = &AACcodeBookDescriptionTable[b->codeBook];
+  int step = hcb->Dimension;
+  int offset = hcb->Offset;
+  int bits = hcb->numBits;
+  int mask = (1<<bits)-1;
+  int index, i;
+
+  FDKinitBitStream(&b->bs, b->bsBuffer, BENCH_BS_SIZE, b->bsBits, BS_READER);
+
+  for (index = 0; index < BENCH_FRAME; index += step)
+  {
+    int idx = CBlock_DecodeHuffmanWord(&b->bs, hcb);
+
+    if (offset != 0) {
+      for (i = 0; i < step; i++) {
+        b->decoded[index+i] = (FIXP_DBL)((idx & mask)-offset);
+        idx >>= bits;
+      }
+    }
+    else {
+      int numSign = 0;
+
+      for (i = 0; i < step; i++) {
+        int tmp = idx & mask;
+        idx >>= bits;
+
+        numSign += (tmp != 0);
+        b->decoded[index+i] = (FIXP_DBL)tmp;
+      }
+
+      if (numSign) {
+        UINT sign = FDKreadBits(&b->bs, numSign) << (32-numSign);
+
+        for (i = 0; i < step; i++) {
+          if (b->decoded[index+i] != FIXP_DBL(0)) {
+            if ((INT)sign < 0) {
+              b->decoded[index+i] = -b->decoded[index+i];
+            }
+            sign <<= 1;
+          }
+        }
+      }
+
+      if (b->codeBook == ESCBOOK) {
+        b->decoded[index+0] = (FIXP_DBL)CBlock_GetEscape(&b->bs, (LONG)b->decoded[index+0]);
+        b->decoded[index+1] = (FIXP_DBL)CBlock_GetEscape(&b->bs, (LONG)b->decoded[index+1]);
+      }
+    }
+  }
+}
+
+/* Largest absolute quantized value the global gain is adjusted to. Most of the spectral lines of
+   a real signal end up in the small value codebooks then. */
+#define BENCH_QUANT_PEAK  (40)
+
+static BENCH_CODING *benchCodingCreate(const BENCH_INPUT *in)
+{
+  BENCH_CODING *b = (BENCH_CODING*)FDKcalloc(1, sizeof(BENCH_CODING));
+  const SFB_INFO *sfbInfo = &sfbOffsetTables[0][4];  /* 44.1 kHz, 1024 lines */
+  int sfb, i;
+
+  b->sfbCnt = sfbInfo->numberOfSfbLong;
+  for (sfb = 0; sfb <= b->sfbCnt; sfb++) {
+    b->sfbOffset[sfb] = sfbInfo->sfbOffsetLong[sfb];
+  }
+  benchSpectrum(b->spec, in->pcm);
+
+  /* lower the global gain until the largest value reaches the peak */
+  for (b->globalGain = 120; b->globalGain > -120; b->globalGain--) {
+    int peak = 0;
+    benchQuantizeRun(b, 0);
+    for (i = 0; i < BENCH_FRAME; i++) {
+      peak = fixMax(peak, (int)fixp_abs(b->quant[i]));
+    }
+    if (peak >= BENCH_QUANT_PEAK) break;
+  }
+
+  for (sfb = 0; sfb < b->sfbCnt; sfb++) {
+    b->sfbMax[sfb] = 0;
+    for (i = b->sfbOffset[sfb]; i < b->sfbOffset[sfb+1]; i++) {
+      b->sfbMax[sfb] = fixMax(b->sfbMax[sfb], (INT)fixp_abs(b->quant[i]));
+    }
+  }
+
+  return b;
+}
+
+/* Codes the quantized spectrum, limited to the range of the given codebook, into the bit buffer. */
+static int benchHuffmanEncode(BENCH_CODING *b, int codeBook)
+{
+  static const SHORT lav[] = { 0, 1, 1, 2, 2, 4, 4, 7, 7, 12, 12, MAX_QUANT };
+  int i;
+
+  for (i = 0; i < BENCH_FRAME; i++) {
+    b->coded[i] = fixMax((SHORT)-lav[codeBook], fixMin(lav[codeBook], b->quant[i]));
+  }
+
+  FDKinitBitStream(&b->bs, b->bsBuffer, BENCH_BS_SIZE, 0, BS_WRITER);
+  FDKaacEnc_codeValues(b->coded, BENCH_FRAME, codeBook, &b->bs);
+  FDKsyncCache(&b->bs);
+  b->bsBits   = FDKgetValidBits(&b->bs);
+  b->codeBook = codeBook;
+
+  /* verify the round trip before timing it */
+  benchHuffmanRun(b, 0);
+  for (i = 0; i < BENCH_FRAME; i++) {
+    if (b->decoded[i] != (FIXP_DBL)b->coded[i]) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void benchCoding(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  BENCH_CODING *b = benchCodingCreate(in);
+  BENCH_CASE c;
+  char config[32];
+
+  c.prepare = NULL;
+  c.ctx     = b;
+  c.slots   = 1;
+
+  if (benchSelected(opts, "CBlock_DecodeHuffmanWord")) {
+    int cb;
+
+    c.run = benchHuffmanRun;
+    for (cb = 1; cb <= ESCBOOK; cb++) {
+      if (benchHuffmanEncode(b, cb) != 0) {
+        fprintf(stderr, "Huffman round trip of codebook %d failed\n", cb);
+        continue;
+      }
+      sprintf(config, "cb=%d", cb);
+      benchReport(opts, in, "CBlock_DecodeHuffmanWord", config, BENCH_FRAME, &c);
+    }
+  }
+  if (benchSelected(opts, "FDKaacEnc_bitCount")) {
+    sprintf(config, "%d sfb", b->sfbCnt);
+    c.run = benchBitCountRun;
+    benchReport(opts, in, "FDKaacEnc_bitCount", config, BENCH_FRAME, &c);
+  }
+  if (benchSelected(opts, "FDKaacEnc_QuantizeSpectrum")) {
+    sprintf(config, "%d sfb", b->sfbCnt);
+    c.run = benchQuantizeRun;
+    benchReport(opts, in, "FDKaacEnc_QuantizeSpectrum", config, BENCH_FRAME, &c);
+  }
+
+  FDKfree(b);
+}
+
+
+/*
+ * lppTransposer()
+ */
+typedef struct
+{
+  SBR_LPP_TRANS       lpp;
+  TRANSPOSER_SETTINGS settings;
+  FIXP_DBL            re[BENCH_QMF_COLS+BENCH_LPP_OVERLAP][(64)];
+  FIXP_DBL            im[BENCH_QMF_COLS+BENCH_LPP_OVERLAP][(64)];
+  FIXP_DBL           *pRe[BENCH_QMF_COLS+BENCH_LPP_OVERLAP];
+  FIXP_DBL           *pIm[BENCH_QMF_COLS+BENCH_LPP_OVERLAP];
+  FIXP_DBL            degreeAlias[(64)];
+  QMF_SCALE_FACTOR    scale;
+  INVF_MODE           invfMode[MAX_INVF_BANDS];
+  INVF_MODE           invfModePrev[MAX_INVF_BANDS];
+  int                 nInvfBands;
+} BENCH_LPP;
+
+static void benchLppRun(void *ctx, int s)
+{
+  BENCH_LPP *b = (BENCH_LPP*)ctx;
+  lppTransposer(&b->lpp, &b->scale, b->pRe, b->degreeAlias, b->pIm, 0, 2, 0, 0,
+                b->nInvfBands, b->invfMode, b->invfModePrev);
+}
+
+static void benchLpp(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  /* 44.1 kHz output, crossover at QMF band 16, SBR range up to band 48 */
+  UCHAR vkMaster[] = { 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48 };
+  UCHAR noiseBands[] = { 16, 24, 32, 48 };
+  BENCH_LPP *b = (BENCH_LPP*)FDKcalloc(1, sizeof(BENCH_LPP));
+  BENCH_QMF *qmf = benchQmfCreate(in);
+  BENCH_CASE c;
+  int col, i;
+
+  for (col = 0; col < BENCH_QMF_COLS+BENCH_LPP_OVERLAP; col++) {
+    b->pRe[col] = b->re[col];
+    b->pIm[col] = b->im[col];
+    FDKmemcpy(b->re[col], qmf->re[col % BENCH_QMF_COLS], BENCH_QMF_ANA_BANDS*sizeof(FIXP_DBL));
+    FDKmemcpy(b->im[col], qmf->im[col % BENCH_QMF_COLS], BENCH_QMF_ANA_BANDS*sizeof(FIXP_DBL));
+  }
+  b->scale = qmf->scale;
+  FDKfree(qmf);
+
+  b->nInvfBands = 3;
+  for (i = 0; i < MAX_INVF_BANDS; i++) {
+    b->invfMode[i] = b->invfModePrev[i] = INVF_MID_LEVEL;
+  }
+
+  if (createLppTransposer(&b->lpp, &b->settings, vkMaster[0], vkMaster, 16, vkMaster[16],
+                          BENCH_QMF_COLS/2, BENCH_QMF_COLS, noiseBands, b->nInvfBands,
+                          44100, 0, BENCH_LPP_OVERLAP) != SBRDEC_OK) {
+    fprintf(stderr, "lppTransposer set-up failed\n");
+  }
+  else {
+    c.prepare = NULL;
+    c.run     = benchLppRun;
+    c.ctx     = b;
+    c.slots   = 1;
+    benchReport(opts, in, "lppTransposer", "16..48", BENCH_QMF_COLS*(64), &c);
+  }
+
+  FDKfree(b);
+}
+
+
+/*
+ * applyLimiter() and pcmDmx_ApplyFrame()
+ */
+typedef struct
+{
+  TDLimiterPtr       limiter;
+  HANDLE_PCM_DOWNMIX dmx;
+  int                channels;
+  INT_PCM            src[8*BENCH_FRAME];
+  INT_PCM            buf[8*BENCH_FRAME];
+  AUDIO_CHANNEL_TYPE channelType[8];
+  UCHAR              channelIndices[8];
+  FIXP_DBL           gain;
+  INT                gainScale;
+} BENCH_PCM;
+
+/* Buffer order of a 5.1 signal in WAV channel mapping */
+static const AUDIO_CHANNEL_TYPE benchChannelType[6] = { ACT_FRONT, ACT_FRONT, ACT_FRONT, ACT_LFE, ACT_BACK, ACT_BACK };
+static const UCHAR benchChannelIndices[6] = { 1, 2, 0, 0, 0, 1 };
+
+static void benchPcmPrepare(void *ctx, int s)
+{
+  BENCH_PCM *b = (BENCH_PCM*)ctx;
+
+  FDKmemcpy(b->buf, b->src, b->channels*BENCH_FRAME*sizeof(INT_PCM));
+  FDKmemcpy(b->channelType, benchChannelType, sizeof(benchChannelType));
+  FDKmemcpy(b->channelIndices, benchChannelIndices, sizeof(benchChannelIndices));
+}
+
+static void benchLimiterRun(void *ctx, int s)
+{
+  BENCH_PCM *b = (BENCH_PCM*)ctx;
+  applyLimiter(b->limiter, b->buf, &b->gain, &b->gainScale, 1, 0, BENCH_FRAME, SAMPLE_BITS);
+}
+
+static void benchDmxRun(void *ctx, int s)
+{
+  BENCH_PCM *b = (BENCH_PCM*)ctx;
+  INT channels = b->channels;
+  pcmDmx_ApplyFrame(b->dmx, b->buf, BENCH_FRAME, &channels, 1, SAMPLE_BITS,
+                    b->channelType, b->channelIndices, channelMappingTableWAV, NULL);
+}
+
+/* Interleaves the given number of channels, each one a delayed copy of the input. */
+static void benchInterleave(BENCH_PCM *b, const BENCH_INPUT *in, int channels)
+{
+  int ch, i;
+
+  b->channels = channels;
+  for (ch = 0; ch < channels; ch++) {
+    for (i = 0; i < BENCH_FRAME; i++) {
+      b->src[i*channels+ch] = in->pcm[ch*BENCH_FRAME/2 + i];
+    }
+  }
+}
+
+static void benchPcm(const BENCH_OPTS *opts, const BENCH_INPUT *in)
+{
+  BENCH_PCM *b = (BENCH_PCM*)FDKcalloc(1, sizeof(BENCH_PCM));
+  BENCH_CASE c;
+
+  c.prepare = benchPcmPrepare;
+  c.ctx     = b;
+  c.slots   = 1;
+
+  if (benchSelected(opts, "applyLimiter")) {
+    /* a threshold 12 dB below full scale keeps the limiter busy */
+    b->limiter = createLimiter(TDL_ATTACK_DEFAULT_MS, TDL_RELEASE_DEFAULT_MS, SAMPLE_MAX>>2, 2, 48000);
+    if (b->limiter != NULL) {
+      b->gain      = FL2FXCONST_DBL(1.0f/(float)(1<<TDL_GAIN_SCALING));
+      b->gainScale = 0;
+      benchInterleave(b, in, 2);
+      c.run = benchLimiterRun;
+      benchReport(opts, in, "applyLimiter", "2 ch", 2*BENCH_FRAME, &c);
+      destroyLimiter(b->limiter);
+    }
+  }
+
+  if (benchSelected(opts, "pcmDmx_ApplyFrame")) {
+    if (pcmDmx_Open(&b->dmx) == PCMDMX_OK) {
+      pcmDmx_SetParam(b->dmx, MAX_NUMBER_OF_OUTPUT_CHANNELS, 2);
+      benchInterleave(b, in, 6);
+      c.run = benchDmxRun;
+      benchReport(opts, in, "pcmDmx_ApplyFrame", "5.1 to 2", 6*BENCH_FRAME, &c);
+      pcmDmx_Close(&b->dmx);
+    }
+  }
+
+  FDKfree(b);
+}
+
+
+/*
+ * Input signals
+ */
+static void benchNoise(INT_PCM *pcm)
+{
+  UINT seed = 0x12345678;
+  int i;
+
+  /* white noise 6 dB below full scale */
+  for (i = 0; i < BENCH_SIGNAL_LEN; i++) {
+    seed = seed * 1664525 + 1013904223;
+    pcm[i] = (INT_PCM)((INT)seed >> (DFRACT_BITS-SAMPLE_BITS+1));
+  }
+}
+
+/* Harmonic tone complex with a falling spectral envelope and a slow vibrato. */
+static void benchTone(INT_PCM *pcm)
+{
+  const double fs = 44100.0, f0 = 220.0, pi = 3.14159265358979323846;
+  double phase = 0.0;
+  int i, k;
+
+  for (i = 0; i < BENCH_SIGNAL_LEN; i++) {
+    double f = f0 * (1.0 + 0.01*sin(2.0*pi*5.0*i/fs));
+    double v = 0.0;
+
+    phase += 2.0*pi*f/fs;
+    for (k = 1; k <= 24; k++) {
+      v += sin(k*phase) / k;
+    }
+    pcm[i] = (INT_PCM)(0.25 * v * SAMPLE_MAX);
+  }
+}
+
+/* Reads the first channel of a 16 bit WAV file, repeated to fill the input. */
+static int benchReadWav(INT_PCM *pcm, const char *filename)
+{
+  void *wav = wav_read_open(filename);
+  int format, channels, sampleRate, bitsPerSample;
+  unsigned int dataLength;
+  int n = 0, i;
+
+  if (wav == NULL) {
+    fprintf(stderr, "Unable to open wav file %s\n", filename);
+    return -1;
+  }
+  if (!wav_get_header(wav, &format, &channels, &sampleRate, &bitsPerSample, &dataLength)
+    || format != 1 || bitsPerSample != 16) {
+    fprintf(stderr, "Unsupported WAV format, only 16 bit PCM is supported\n");
+    wav_read_close(wav);
+    return -1;
+  }
+
+  while (n < BENCH_SIGNAL_LEN) {
+    unsigned char frame[2*8];
+    if (channels > 8 || wav_read_data(wav, frame, 2*channels) < 2*channels) {
+      break;
+    }
+    pcm[n++] = (INT_PCM)(SHORT)(frame[0] | (frame[1] << 8));
+  }
+  wav_read_close(wav);
+
+  if (n == 0) {
+    fprintf(stderr, "No audio data in %s\n", filename);
+    return -1;
+  }
+  for (i = n; i < BENCH_SIGNAL_LEN; i++) {
+    pcm[i] = pcm[i-n];
+  }
+  return 0;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "%s [-t ms] [-k kernel] [in.wav]\n", name);
+  fprintf(stderr, "\t-t ms\tminimum measurement time of each case (default 100)\n");
+  fprintf(stderr, "\t-k name\tonly run kernels whose name contains the given string\n");
+  fprintf(stderr, "The real signal input is read from in.wav or generated if no file is given.\n");
+}
+
+int main(int argc, char *argv[])
+{
+  BENCH_INPUT inputs[2];
+  BENCH_OPTS opts;
+  const char *wavFile = NULL;
+  int i;
+
+  opts.minSeconds = 0.1;
+  opts.filter = NULL;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-t") && i+1 < argc) {
+      opts.minSeconds = 1e-3 * atof(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-k") && i+1 < argc) {
+      opts.filter = argv[++i];
+    }
+    else if (argv[i][0] != '-' && wavFile == NULL) {
+      wavFile = argv[i];
+    }
+    else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  inputs[0].name = "noise";
+  inputs[0].pcm  = (INT_PCM*)FDKaalloc(BENCH_SIGNAL_LEN*sizeof(INT_PCM), ALIGNMENT_DEFAULT);
+  benchNoise(inputs[0].pcm);
+
+  inputs[1].name = (wavFile != NULL) ? "wav" : "tone";
+  inputs[1].pcm  = (INT_PCM*)FDKaalloc(BENCH_SIGNAL_LEN*sizeof(INT_PCM), ALIGNMENT_DEFAULT);
+  if (wavFile != NULL) {
+    if (benchReadWav(inputs[1].pcm, wavFile) != 0) {
+      return 1;
+    }
+  }
+  else {
+    benchTone(inputs[1].pcm);
+  }
+
+  printf("%-26s %-12s %-10s %12s %12s\n", "kernel", "config", "input", "ns/call", "Msamples/s");
+
+  for (i = 0; i < 2; i++) {
+    if (benchSelected(&opts, "fft"))                        benchFft(&opts, &inputs[i]);
+    if (benchSelected(&opts, "dct_IV"))                     benchDct(&opts, &inputs[i]);
+    if (benchSelected(&opts, "imdct_block"))                benchImdct(&opts, &inputs[i]);
+    if (benchSelected(&opts, "qmfAnalysisFiltering")
+     || benchSelected(&opts, "qmfSynthesisFiltering"))      benchQmf(&opts, &inputs[i]);
+    if (benchSelected(&opts, "CBlock_DecodeHuffmanWord")
+     || benchSelected(&opts, "FDKaacEnc_bitCount")
+     || benchSelected(&opts, "FDKaacEnc_QuantizeSpectrum")) benchCoding(&opts, &inputs[i]);
+    if (benchSelected(&opts, "lppTransposer"))              benchLpp(&opts, &inputs[i]);
+    if (benchSelected(&opts, "applyLimiter")
+     || benchSelected(&opts, "pcmDmx_ApplyFrame"))          benchPcm(&opts, &inputs[i]);
+  }
+
+  FDKafree(inputs[0].pcm);
+  FDKafree(inputs[1].pcm);
+
+  return 0;
+}
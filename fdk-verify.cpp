@@ -0,0 +1,1014 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: Bit-exactness check of the encoder and decoder
+
+   A corpus of generated signals is encoded and decoded in memory with every
+   configuration. The bitstream and the PCM output of each run are hashed;
+   the hashes can be written to a golden file and compared against it later.
+   "make check" compares them with fdk-verify.golden, which holds the hashes
+   of the reference implementation. The precision mode checks that the 32 bit
+   decoder output carries more than 16 significant bits.
+   In A/B mode two instances run side by side, one on the plain C kernels and
+   one on the optimized kernels, and the first diverging frame is reported
+   together with the kernel that causes the difference.
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aacenc_lib.h"
+#include "aacdecoder_lib.h"
+#include "common_fix.h"
+#include "FDK_cpu.h"
+#if defined(FDK_X86_SIMD)
+#include "x86/dispatch_x86.h"
+#endif
+
+/* Length of each signal of the corpus in ms. */
+#define VERIFY_SIGNAL_MS     (1500)
+/* Maximum number of PCM samples of one decoded frame (all channels). */
+#define VERIFY_MAX_PCM       (8*2048)
+/* Size of the output buffer of one encoded access unit. */
+#define VERIFY_MAX_AU        (8*6144/8)
+/* Maximum number of corpus entries in a golden file. */
+#define VERIFY_MAX_GOLDEN    (256)
+
+typedef unsigned long long VERIFY_HASH;
+
+typedef struct
+{
+  const char *name;
+  INT         channels;
+  INT         sampleRate;
+  void      (*generate)(INT_PCM *pcm, INT samples, INT channels, INT sampleRate);
+} VERIFY_SIGNAL;
+
+typedef struct
+{
+  const char    *name;
+  AUDIO_OBJECT_TYPE aot;
+  INT            bitratePerChannel;
+  TRANSPORT_TYPE transport;
+  INT            maxChannels;    /*!< Highest number of channels the configuration supports */
+} VERIFY_CONFIG;
+
+typedef struct
+{
+  UCHAR *data;                   /*!< Concatenated access units */
+  INT    size;
+  INT    alloc;
+  INT    frames;
+} VERIFY_STREAM;
+
+typedef struct
+{
+  char        key[64];
+  VERIFY_HASH bitstream;
+  VERIFY_HASH pcm;
+} VERIFY_GOLDEN;
+
+
+/*
+ * Signal corpus. The signals are generated with integer arithmetic only, so
+ * that the hashes do not depend on the floating point library of the host.
+ */
+
+static UINT verifyRandom(UINT *seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed;
+}
+
+/* Sine approximation, the full phase range is one period. Returns Q15. */
+static INT verifySine(UINT phase)
+{
+  INT64 x = (INT)phase >> 16;
+  INT64 ax = (x < 0) ? -x : x;
+  INT64 y = (4 * x * (32768 - ax)) >> 15;
+  INT64 ay = (y < 0) ? -y : y;
+
+  y += (7373 * (((y * ay) >> 15) - y)) >> 15;
+  if (y > 32767) y = 32767;
+  if (y < -32767) y = -32767;
+  return (INT)y;
+}
+
+static UINT verifyPhaseInc(INT freq, INT sampleRate)
+{
+  return (UINT)(((unsigned long long)freq << 32) / (UINT)sampleRate);
+}
+
+static void verifyGenSines(INT_PCM *pcm, INT samples, INT channels, INT sampleRate)
+{
+  INT i, ch;
+
+  for (ch = 0; ch < channels; ch++) {
+    UINT phase1 = 0, phase2 = 0;
+    UINT inc1 = verifyPhaseInc(440 * (ch + 1) + 60, sampleRate);
+    UINT inc2 = verifyPhaseInc(3520 + 1100 * ch, sampleRate);
+    for (i = 0; i < samples; i++) {
+      pcm[i * channels + ch] = (INT_PCM)((12000 * verifySine(phase1) + 4000 * verifySine(phase2)) >> 15);
+      phase1 += inc1;
+      phase2 += inc2;
+    }
+  }
+}
+
+static void verifyGenNoise(INT_PCM *pcm, INT samples, INT channels, INT sampleRate)
+{
+  UINT seed = 1;
+  INT i;
+
+  for (i = 0; i < samples * channels; i++) {
+    pcm[i] = (INT_PCM)((INT)verifyRandom(&seed) >> 19);
+  }
+}
+
+/* Decaying noise bursts on silence, four per second. */
+static void verifyGenTransients(INT_PCM *pcm, INT samples, INT channels, INT sampleRate)
+{
+  INT period = sampleRate / 4, i, ch;
+  UINT seed = 7;
+
+  for (i = 0; i < samples; i++) {
+    INT t = i % period;
+    INT env = (t < sampleRate / 100) ? 30000 - (INT)(((INT64)t * 30000 * 100) / sampleRate) : 0;
+    for (ch = 0; ch < channels; ch++) {
+      pcm[i * channels + ch] = (INT_PCM)(((INT64)env * ((INT)verifyRandom(&seed) >> 16)) >> 15);
+    }
+  }
+}
+
+static void verifyGenSilence(INT_PCM *pcm, INT samples, INT channels, INT sampleRate)
+{
+  FDKmemclear(pcm, samples * channels * sizeof(INT_PCM));
+}
+
+/* A different tone per channel with a little noise, the LFE carries a low tone only. */
+static void verifyGenMultichannel(INT_PCM *pcm, INT samples, INT channels, INT sampleRate)
+{
+  UINT seed = 3;
+  INT i, ch;
+
+  verifyGenSines(pcm, samples, channels, sampleRate);
+  for (i = 0; i < samples; i++) {
+    for (ch = 0; ch < channels; ch++) {
+      if (ch == 3) {
+        pcm[i * channels + ch] = (INT_PCM)((16000 * verifySine((UINT)i * verifyPhaseInc(60, sampleRate))) >> 15);
+      } else {
+        pcm[i * channels + ch] += (INT_PCM)((INT)verifyRandom(&seed) >> 22);
+      }
+    }
+  }
+}
+
+static const VERIFY_SIGNAL verifySignals[] = {
+  { "sine",         2, 44100, verifyGenSines },
+  { "noise",        2, 44100, verifyGenNoise },
+  { "transient",    2, 44100, verifyGenTransients },
+  { "silence",      2, 44100, verifyGenSilence },
+  { "multichannel", 6, 48000, verifyGenMultichannel },
+};
+
+static const VERIFY_CONFIG verifyConfigs[] = {
+  { "LC",   AOT_AAC_LC,     64000, TT_MP4_ADTS, 8 },
+  { "HE",   AOT_SBR,        32000, TT_MP4_ADTS, 8 },
+  { "HEv2", AOT_PS,         16000, TT_MP4_ADTS, 2 },
+  { "LD",   AOT_ER_AAC_LD,  64000, TT_MP4_LOAS, 8 },
+  { "ELD",  AOT_ER_AAC_ELD, 48000, TT_MP4_LOAS, 8 },
+};
+
+#define VERIFY_NUM_SIGNALS  ((INT)(sizeof(verifySignals) / sizeof(verifySignals[0])))
+#define VERIFY_NUM_CONFIGS  ((INT)(sizeof(verifyConfigs) / sizeof(verifyConfigs[0])))
+
+
+/*
+ * Kernel sets of the A/B mode. Every entry of the dispatch table is a function
+ * pointer, which allows to treat the table as an array and to exchange single
+ * kernels.
+ */
+
+#if defined(FDK_X86_SIMD)
+
+typedef void (*VERIFY_FUNC)(void);
+
+typedef union
+{
+  FDK_X86_KERNELS table;
+  VERIFY_FUNC     func[sizeof(FDK_X86_KERNELS) / sizeof(VERIFY_FUNC)];
+} VERIFY_KERNELS;
+
+static const char *const verifyKernelNames[] = {
+  "scaleValues_SGL",
+  "scaleValues_DBL",
+  "scaleValues_DBLDBL",
+  "scaleValuesWithFactor_DBL",
+  "getScalefactor_DBL",
+  "getScalefactor_SGL",
+  "scramble",
+  "cplxMultVec_32x16",
+  "dctIV_preTwiddle",
+  "qmfForwardModulationHQ_butterfly",
+  "qmfSynPrototypeFirStates",
+  "qmfAnaPrototypeFirPart",
+  "inverseQuantizeBand",
+};
+
+#define VERIFY_NUM_KERNELS  ((INT)(sizeof(FDK_X86_KERNELS) / sizeof(VERIFY_FUNC)))
+
+/* The name table has to be extended together with FDK_X86_KERNELS. */
+typedef char verifyKernelNamesCheck[(sizeof(verifyKernelNames) / sizeof(verifyKernelNames[0]) == (size_t)VERIFY_NUM_KERNELS)
+                                    && (sizeof(FDK_X86_KERNELS) % sizeof(VERIFY_FUNC) == 0) ? 1 : -1];
+
+static void verifyGetKernels(VERIFY_KERNELS *k, UINT features)
+{
+  FDK_setCpuFeatures(features);
+  k->table = FDK_x86Kernels;
+}
+
+static void verifySelectKernels(const VERIFY_KERNELS *k)
+{
+  FDK_x86Kernels = k->table;
+}
+
+#else
+
+typedef struct
+{
+  UINT features;
+} VERIFY_KERNELS;
+
+#define VERIFY_NUM_KERNELS  (0)
+
+static void verifyGetKernels(VERIFY_KERNELS *k, UINT features)
+{
+  k->features = features;
+}
+
+static void verifySelectKernels(const VERIFY_KERNELS *k)
+{
+  FDK_setCpuFeatures(k->features);
+}
+
+#endif /* FDK_X86_SIMD */
+
+
+/*
+ * Hashing: 64 bit FNV-1a over the bitstream bytes and over the PCM samples
+ * serialized as 16 bit little endian.
+ */
+
+#define VERIFY_HASH_INIT  (0xcbf29ce484222325ULL)
+
+static VERIFY_HASH verifyHashBytes(VERIFY_HASH h, const UCHAR *p, INT n)
+{
+  INT i;
+  for (i = 0; i < n; i++) {
+    h = (h ^ p[i]) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+static VERIFY_HASH verifyHashPcm(VERIFY_HASH h, const INT_PCM *pcm, INT n)
+{
+  INT i;
+  for (i = 0; i < n; i++) {
+    UCHAR b[2];
+    b[0] = (UCHAR)(pcm[i] & 0xFF);
+    b[1] = (UCHAR)((pcm[i] >> 8) & 0xFF);
+    h = verifyHashBytes(h, b, 2);
+  }
+  return h;
+}
+
+static void verifyStreamAppend(VERIFY_STREAM *s, const UCHAR *au, INT size)
+{
+  if (s->size + size > s->alloc) {
+    s->alloc = 2 * s->alloc + size;
+    s->data = (UCHAR *)realloc(s->data, s->alloc);
+  }
+  FDKmemcpy(s->data + s->size, au, size);
+  s->size += size;
+  s->frames++;
+}
+
+
+/*
+ * Encoder and decoder instances which are stepped one frame at a time.
+ */
+
+typedef struct
+{
+  HANDLE_AACENCODER hEnc;
+  const INT_PCM    *pcm;
+  INT               samples;     /*!< Total number of input samples (all channels) */
+  INT               pos;
+  INT               frameSamples;
+  INT               flushed;
+} VERIFY_ENC;
+
+typedef struct
+{
+  HANDLE_AACDECODER hDec;
+  UCHAR            *data;
+  UINT              size;
+  UINT              valid;
+} VERIFY_DEC;
+
+static INT verifyEncOpen(VERIFY_ENC *e, const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg,
+                         const INT_PCM *pcm, INT samples, INT threads)
+{
+  AACENC_InfoStruct info;
+  CHANNEL_MODE mode = (sig->channels == 6) ? MODE_1_2_2_1 : (CHANNEL_MODE)sig->channels;
+
+  FDKmemclear(e, sizeof(VERIFY_ENC));
+  if (aacEncOpen(&e->hEnc, 0, sig->channels) != AACENC_OK) {
+    return -1;
+  }
+  if ( aacEncoder_SetParam(e->hEnc, AACENC_AOT, cfg->aot) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_SAMPLERATE, sig->sampleRate) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_CHANNELMODE, mode) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_CHANNELORDER, 1) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_BITRATE, cfg->bitratePerChannel * sig->channels) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_TRANSMUX, cfg->transport) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_AFTERBURNER, 1) != AACENC_OK
+    || aacEncoder_SetParam(e->hEnc, AACENC_NUM_THREADS, threads) != AACENC_OK
+    || aacEncEncode(e->hEnc, NULL, NULL, NULL, NULL) != AACENC_OK
+    || aacEncInfo(e->hEnc, &info) != AACENC_OK )
+  {
+    aacEncClose(&e->hEnc);
+    return -1;
+  }
+  e->pcm = pcm;
+  e->samples = samples;
+  e->frameSamples = info.frameLength * sig->channels;
+  return 0;
+}
+
+/* Feeds one frame of input. Returns 1 while the encoder runs, 0 at the end and -1 on error. */
+static INT verifyEncStep(VERIFY_ENC *e, UCHAR *au, INT *auSize)
+{
+  AACENC_BufDesc inBuf, outBuf;
+  AACENC_InArgs inArgs;
+  AACENC_OutArgs outArgs;
+  INT inId = IN_AUDIO_DATA, inElSize = sizeof(INT_PCM), inSize;
+  INT outId = OUT_BITSTREAM_DATA, outElSize = 1, outSize = VERIFY_MAX_AU;
+  void *inPtr = (void *)(e->pcm + e->pos), *outPtr = au;
+  AACENC_ERROR err;
+
+  FDKmemclear(&inBuf, sizeof(inBuf));
+  FDKmemclear(&inArgs, sizeof(inArgs));
+  FDKmemclear(&outArgs, sizeof(outArgs));
+  *auSize = 0;
+
+  if (e->pos < e->samples) {
+    inArgs.numInSamples = fixMin(e->frameSamples, e->samples - e->pos);
+    inSize = inArgs.numInSamples * sizeof(INT_PCM);
+    inBuf.numBufs = 1;
+    inBuf.bufs = &inPtr;
+    inBuf.bufferIdentifiers = &inId;
+    inBuf.bufSizes = &inSize;
+    inBuf.bufElSizes = &inElSize;
+  } else {
+    inArgs.numInSamples = -1;
+  }
+  outBuf.numBufs = 1;
+  outBuf.bufs = &outPtr;
+  outBuf.bufferIdentifiers = &outId;
+  outBuf.bufSizes = &outSize;
+  outBuf.bufElSizes = &outElSize;
+
+  err = aacEncEncode(e->hEnc, &inBuf, &outBuf, &inArgs, &outArgs);
+  if (err == AACENC_ENCODE_EOF) {
+    return 0;
+  }
+  if (err != AACENC_OK) {
+    return -1;
+  }
+  e->pos += outArgs.numInSamples;
+  *auSize = outArgs.numOutBytes;
+  return 1;
+}
+
+static INT verifyDecOpen(VERIFY_DEC *d, const VERIFY_CONFIG *cfg, const VERIFY_STREAM *stream)
+{
+  FDKmemclear(d, sizeof(VERIFY_DEC));
+  d->hDec = aacDecoder_Open(cfg->transport, 1);
+  if (d->hDec == NULL) {
+    return -1;
+  }
+  d->data = stream->data;
+  d->size = d->valid = stream->size;
+  return 0;
+}
+
+/* Decodes one frame. Returns 1 if a frame was decoded, 0 at the end and -1 on error. */
+static INT verifyDecStep(VERIFY_DEC *d, INT_PCM *pcm, INT *samples)
+{
+  AAC_DECODER_ERROR err;
+
+  *samples = 0;
+  while (1) {
+    if (d->valid > 0) {
+      UCHAR *ptr = d->data + (d->size - d->valid);
+      UINT size = d->valid;
+      aacDecoder_Fill(d->hDec, &ptr, &size, &d->valid);
+    }
+    err = aacDecoder_DecodeFrame(d->hDec, pcm, VERIFY_MAX_PCM, 0);
+    if (err == AAC_DEC_NOT_ENOUGH_BITS) {
+      if (d->valid == 0) {
+        return 0;
+      }
+      continue;
+    }
+    if (err != AAC_DEC_OK) {
+      return -1;
+    }
+    CStreamInfo *info = aacDecoder_GetStreamInfo(d->hDec);
+    *samples = info->frameSize * info->numChannels;
+    return 1;
+  }
+}
+
+
+/*
+ * Hash mode.
+ */
+
+static INT_PCM *verifyGenerate(const VERIFY_SIGNAL *sig, INT *samples)
+{
+  INT n = sig->sampleRate / 1000 * VERIFY_SIGNAL_MS;
+  INT_PCM *pcm = (INT_PCM *)calloc(n * sig->channels, sizeof(INT_PCM));
+
+  sig->generate(pcm, n, sig->channels, sig->sampleRate);
+  *samples = n * sig->channels;
+  return pcm;
+}
+
+/* Encodes the signal into stream. The caller frees stream->data. */
+static INT verifyEncodeStream(const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg, INT threads,
+                              VERIFY_STREAM *stream)
+{
+  VERIFY_ENC enc;
+  UCHAR au[VERIFY_MAX_AU];
+  INT samples, auSize, n;
+  INT_PCM *pcm = verifyGenerate(sig, &samples);
+
+  FDKmemclear(stream, sizeof(VERIFY_STREAM));
+
+  if (verifyEncOpen(&enc, sig, cfg, pcm, samples, threads) != 0) {
+    free(pcm);
+    return -1;
+  }
+  while ((n = verifyEncStep(&enc, au, &auSize)) > 0) {
+    if (auSize > 0) {
+      verifyStreamAppend(stream, au, auSize);
+    }
+  }
+  aacEncClose(&enc.hEnc);
+  free(pcm);
+  return (n < 0) ? -1 : 0;
+}
+
+static INT verifyHashRun(const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg, INT threads,
+                         VERIFY_HASH *hBitstream, VERIFY_HASH *hPcm)
+{
+  VERIFY_STREAM stream;
+  VERIFY_DEC dec;
+  INT_PCM *out = (INT_PCM *)malloc(VERIFY_MAX_PCM * sizeof(INT_PCM));
+  INT samples, n, ret = 0;
+
+  *hBitstream = *hPcm = VERIFY_HASH_INIT;
+
+  if (verifyEncodeStream(sig, cfg, threads, &stream) != 0) {
+    ret = -1;
+    goto bail;
+  }
+  *hBitstream = verifyHashBytes(*hBitstream, stream.data, stream.size);
+
+  if (verifyDecOpen(&dec, cfg, &stream) != 0) {
+    ret = -1;
+    goto bail;
+  }
+  while ((n = verifyDecStep(&dec, out, &samples)) > 0) {
+    *hPcm = verifyHashPcm(*hPcm, out, samples);
+  }
+  aacDecoder_Close(dec.hDec);
+  if (n < 0) {
+    ret = -1;
+  }
+
+bail:
+  free(stream.data);
+  free(out);
+  return ret;
+}
+
+static INT verifyReadGolden(const char *path, VERIFY_GOLDEN *golden)
+{
+  FILE *f = fopen(path, "r");
+  char line[256];
+  INT n = 0;
+
+  if (f == NULL) {
+    fprintf(stderr, "Unable to open %s\n", path);
+    return -1;
+  }
+  while (n < VERIFY_MAX_GOLDEN && fgets(line, sizeof(line), f) != NULL) {
+    char sig[32], cfg[16];
+    if (line[0] == '#' || sscanf(line, "%31s %15s %llx %llx", sig, cfg, &golden[n].bitstream, &golden[n].pcm) != 4) {
+      continue;
+    }
+    sprintf(golden[n].key, "%s %s", sig, cfg);
+    n++;
+  }
+  fclose(f);
+  return n;
+}
+
+static INT verifyHashAll(const char *writePath, const char *comparePath, INT threads)
+{
+  VERIFY_GOLDEN *golden = NULL;
+  FILE *out = (comparePath != NULL) ? NULL : stdout;
+  INT nGolden = 0, failed = 0, s, c, g;
+
+  if (comparePath != NULL) {
+    golden = (VERIFY_GOLDEN *)calloc(VERIFY_MAX_GOLDEN, sizeof(VERIFY_GOLDEN));
+    if ((nGolden = verifyReadGolden(comparePath, golden)) < 0) {
+      free(golden);
+      return 1;
+    }
+  }
+  if (writePath != NULL && (out = fopen(writePath, "w")) == NULL) {
+    fprintf(stderr, "Unable to open %s\n", writePath);
+    free(golden);
+    return 1;
+  }
+  if (out != NULL) {
+    fprintf(out, "# signal config bitstream pcm\n");
+  }
+
+  for (s = 0; s < VERIFY_NUM_SIGNALS; s++) {
+    for (c = 0; c < VERIFY_NUM_CONFIGS; c++) {
+      const VERIFY_SIGNAL *sig = &verifySignals[s];
+      const VERIFY_CONFIG *cfg = &verifyConfigs[c];
+      VERIFY_HASH hBitstream, hPcm;
+      char key[64];
+
+      if (sig->channels > cfg->maxChannels) {
+        continue;
+      }
+      sprintf(key, "%s %s", sig->name, cfg->name);
+      if (verifyHashRun(sig, cfg, threads, &hBitstream, &hPcm) != 0) {
+        fprintf(stderr, "%-18s FAILED to run\n", key);
+        failed++;
+        continue;
+      }
+      if (out != NULL) {
+        fprintf(out, "%-18s %016llx %016llx\n", key, hBitstream, hPcm);
+      }
+
+      if (golden != NULL) {
+        for (g = 0; g < nGolden && strcmp(golden[g].key, key) != 0; g++);
+        if (g == nGolden) {
+          fprintf(stderr, "%-18s no golden value\n", key);
+          failed++;
+        } else if (golden[g].bitstream != hBitstream || golden[g].pcm != hPcm) {
+          fprintf(stderr, "%-18s MISMATCH%s%s\n", key,
+                  (golden[g].bitstream != hBitstream) ? " bitstream" : "",
+                  (golden[g].pcm != hPcm) ? " pcm" : "");
+          failed++;
+        }
+      }
+    }
+  }
+
+  if (out != NULL && out != stdout) {
+    fclose(out);
+  }
+  if (golden != NULL) {
+    fprintf(stderr, "%s\n", failed ? "FAILED" : "All hashes match the golden values.");
+  }
+  free(golden);
+  return failed ? 1 : 0;
+}
+
+
+/*
+ * Precision mode. The 32 bit output has to carry more than 16 significant bits,
+ * also behind the limiter which is active by default for LC and HE-AAC.
+ */
+
+static INT verifyPrecisionRun(const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg,
+                              INT *nSamples, INT *nFine)
+{
+  VERIFY_STREAM stream;
+  VERIFY_DEC dec;
+  INT *out = (INT *)malloc(VERIFY_MAX_PCM * sizeof(INT));
+  INT samples, n, i, ret = 0;
+
+  *nSamples = *nFine = 0;
+
+  if (verifyEncodeStream(sig, cfg, 1, &stream) != 0 || verifyDecOpen(&dec, cfg, &stream) != 0) {
+    ret = -1;
+    goto bail;
+  }
+  if ( aacDecoder_SetParam(dec.hDec, AAC_PCM_OUTPUT_FORMAT, AACDEC_PCM_S32) != AAC_DEC_OK
+    || aacDecoder_SetParam(dec.hDec, AAC_PCM_LIMITER_ENABLE, 1) != AAC_DEC_OK )
+  {
+    aacDecoder_Close(dec.hDec);
+    ret = -1;
+    goto bail;
+  }
+  while ((n = verifyDecStep(&dec, (INT_PCM *)out, &samples)) > 0) {
+    for (i = 0; i < samples; i++) {
+      if (out[i] != 0) {
+        (*nSamples)++;
+        if ((out[i] & 0xFFFF) != 0) {
+          (*nFine)++;
+        }
+      }
+    }
+  }
+  aacDecoder_Close(dec.hDec);
+  if (n < 0) {
+    ret = -1;
+  }
+
+bail:
+  free(stream.data);
+  free(out);
+  return ret;
+}
+
+static INT verifyPrecisionAll(void)
+{
+  INT failed = 0, s, c;
+
+  for (s = 0; s < VERIFY_NUM_SIGNALS; s++) {
+    for (c = 0; c < VERIFY_NUM_CONFIGS; c++) {
+      const VERIFY_SIGNAL *sig = &verifySignals[s];
+      const VERIFY_CONFIG *cfg = &verifyConfigs[c];
+      INT nSamples, nFine;
+      char key[64];
+
+      if (sig->channels > cfg->maxChannels) {
+        continue;
+      }
+      sprintf(key, "%s %s", sig->name, cfg->name);
+      if (verifyPrecisionRun(sig, cfg, &nSamples, &nFine) != 0) {
+        fprintf(stderr, "%-18s FAILED to run\n", key);
+        failed++;
+        continue;
+      }
+      /* Most nonzero samples have to use the low 16 bits. */
+      if (nFine * 2 < nSamples) {
+        fprintf(stderr, "%-18s only %d of %d samples use the low 16 bits\n", key, nFine, nSamples);
+        failed++;
+      }
+    }
+  }
+
+  fprintf(stderr, "%s\n", failed ? "FAILED" : "The 32 bit output exceeds 16 bit precision.");
+  return failed ? 1 : 0;
+}
+
+
+/*
+ * A/B mode.
+ */
+
+typedef struct
+{
+  INT frame;                     /*!< First diverging frame, -1 if none */
+  INT channel;
+  INT sample;
+  INT error;
+} VERIFY_DIVERGENCE;
+
+/* Encodes with side A and side B in lockstep. The bitstream of side A is returned in stream. */
+static void verifyAbEncode(const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg,
+                           const INT_PCM *pcm, INT samples,
+                           const VERIFY_KERNELS *kernelsA, const VERIFY_KERNELS *kernelsB, INT threadsB,
+                           INT maxFrames, VERIFY_STREAM *stream, VERIFY_DIVERGENCE *div)
+{
+  VERIFY_ENC encA, encB;
+  UCHAR auA[VERIFY_MAX_AU], auB[VERIFY_MAX_AU];
+  INT sizeA, sizeB, runA = 1, runB = 1, frame = 0, i;
+
+  div->frame = -1;
+  div->error = 0;
+  if (verifyEncOpen(&encA, sig, cfg, pcm, samples, 1) != 0) {
+    div->error = 1;
+    return;
+  }
+  if (verifyEncOpen(&encB, sig, cfg, pcm, samples, threadsB) != 0) {
+    aacEncClose(&encA.hEnc);
+    div->error = 1;
+    return;
+  }
+
+  while (runA > 0 && runB > 0 && frame < maxFrames) {
+    verifySelectKernels(kernelsA);
+    runA = verifyEncStep(&encA, auA, &sizeA);
+    verifySelectKernels(kernelsB);
+    runB = verifyEncStep(&encB, auB, &sizeB);
+
+    if (runA != runB || sizeA != sizeB || FDKmemcmp(auA, auB, sizeA) != 0) {
+      div->frame = frame;
+      for (i = 0; i < fixMin(sizeA, sizeB) && auA[i] == auB[i]; i++);
+      div->sample = i;             /* first differing byte */
+      div->channel = -1;
+      break;
+    }
+    if (sizeA > 0) {
+      if (stream != NULL) {
+        verifyStreamAppend(stream, auA, sizeA);
+      }
+      frame++;
+    }
+  }
+  if (runA < 0 || runB < 0) {
+    div->error = 1;
+  }
+  aacEncClose(&encA.hEnc);
+  aacEncClose(&encB.hEnc);
+}
+
+/* Decodes the same bitstream with side A and side B in lockstep. */
+static void verifyAbDecode(const VERIFY_CONFIG *cfg, const VERIFY_STREAM *stream,
+                           const VERIFY_KERNELS *kernelsA, const VERIFY_KERNELS *kernelsB,
+                           INT maxFrames, VERIFY_DIVERGENCE *div)
+{
+  VERIFY_DEC decA, decB;
+  INT_PCM *pcmA = (INT_PCM *)malloc(VERIFY_MAX_PCM * sizeof(INT_PCM));
+  INT_PCM *pcmB = (INT_PCM *)malloc(VERIFY_MAX_PCM * sizeof(INT_PCM));
+  INT samplesA, samplesB, runA = 1, runB = 1, frame = 0, i;
+
+  div->frame = -1;
+  div->error = 0;
+  if (verifyDecOpen(&decA, cfg, stream) != 0 || verifyDecOpen(&decB, cfg, stream) != 0) {
+    div->error = 1;
+    goto bail;
+  }
+
+  while (runA > 0 && runB > 0 && frame < maxFrames) {
+    verifySelectKernels(kernelsA);
+    runA = verifyDecStep(&decA, pcmA, &samplesA);
+    verifySelectKernels(kernelsB);
+    runB = verifyDecStep(&decB, pcmB, &samplesB);
+
+    if (runA != runB || samplesA != samplesB || FDKmemcmp(pcmA, pcmB, samplesA * sizeof(INT_PCM)) != 0) {
+      CStreamInfo *info = aacDecoder_GetStreamInfo(decA.hDec);
+      INT channels = fixMax(1, info->numChannels);
+      div->frame = frame;
+      for (i = 0; i < fixMin(samplesA, samplesB) && pcmA[i] == pcmB[i]; i++);
+      div->channel = i % channels;
+      div->sample = i / channels;
+      break;
+    }
+    frame++;
+  }
+  if (runA < 0 || runB < 0) {
+    div->error = 1;
+  }
+
+bail:
+  if (decA.hDec != NULL) aacDecoder_Close(decA.hDec);
+  if (decB.hDec != NULL) aacDecoder_Close(decB.hDec);
+  free(pcmA);
+  free(pcmB);
+}
+
+/* Finds the optimized kernels which alone reproduce a divergence of the scalar
+   reference at the given frame. Returns the number of kernels found. */
+static INT verifyLocalize(const VERIFY_SIGNAL *sig, const VERIFY_CONFIG *cfg,
+                          const INT_PCM *pcm, INT samples, const VERIFY_STREAM *stream,
+                          const VERIFY_KERNELS *scalar, const VERIFY_KERNELS *optimized,
+                          INT decoder, INT frame)
+{
+  INT found = 0;
+#if defined(FDK_X86_SIMD)
+  INT k;
+
+  for (k = 0; k < VERIFY_NUM_KERNELS; k++) {
+    VERIFY_KERNELS mixed = *scalar;
+    VERIFY_DIVERGENCE div;
+
+    if (optimized->func[k] == NULL || optimized->func[k] == scalar->func[k]) {
+      continue;
+    }
+    mixed.func[k] = optimized->func[k];
+    if (decoder) {
+      verifyAbDecode(cfg, stream, scalar, &mixed, frame + 1, &div);
+    } else {
+      verifyAbEncode(sig, cfg, pcm, samples, scalar, &mixed, 1, frame + 1, NULL, &div);
+    }
+    if (div.frame >= 0) {
+      printf("    caused by kernel %s (diverges at frame %d on its own)\n", verifyKernelNames[k], div.frame);
+      found++;
+    }
+  }
+#endif
+  return found;
+}
+
+static INT verifyAbAll(INT threadsB)
+{
+  VERIFY_KERNELS scalar, optimized;
+  INT failed = 0, s, c;
+
+  FDK_initCpuFeatures();
+  verifyGetKernels(&scalar, 0);
+  verifyGetKernels(&optimized, FDK_CPU_ALL);
+  printf("A: plain C kernels, 1 encoder thread\n");
+  printf("B: CPU features 0x%04x, %d encoder thread%s\n", FDK_getCpuFeatures(), threadsB, (threadsB > 1) ? "s" : "");
+  if (VERIFY_NUM_KERNELS == 0 || FDK_getCpuFeatures() == 0) {
+    printf("Note: no optimized kernels are available on this host\n");
+  }
+
+  for (s = 0; s < VERIFY_NUM_SIGNALS; s++) {
+    INT samples;
+    INT_PCM *pcm = verifyGenerate(&verifySignals[s], &samples);
+
+    for (c = 0; c < VERIFY_NUM_CONFIGS; c++) {
+      const VERIFY_SIGNAL *sig = &verifySignals[s];
+      const VERIFY_CONFIG *cfg = &verifyConfigs[c];
+      VERIFY_STREAM stream;
+      VERIFY_DIVERGENCE div;
+      char key[64];
+
+      if (sig->channels > cfg->maxChannels) {
+        continue;
+      }
+      sprintf(key, "%s %s", sig->name, cfg->name);
+      FDKmemclear(&stream, sizeof(stream));
+
+      verifyAbEncode(sig, cfg, pcm, samples, &scalar, &optimized, threadsB, 0x7FFFFFFF, &stream, &div);
+      if (div.error) {
+        printf("%-18s FAILED to encode\n", key);
+        failed++;
+      } else if (div.frame >= 0) {
+        printf("%-18s encoder diverges at frame %d, byte %d\n", key, div.frame, div.sample);
+        if (verifyLocalize(sig, cfg, pcm, samples, NULL, &scalar, &optimized, 0, div.frame) == 0) {
+          printf("    not caused by a single kernel\n");
+        }
+        failed++;
+      } else {
+        /* The decoders of both sides run on the bitstream of side A. */
+        verifyAbDecode(cfg, &stream, &scalar, &optimized, 0x7FFFFFFF, &div);
+        if (div.error) {
+          printf("%-18s FAILED to decode\n", key);
+          failed++;
+        } else if (div.frame >= 0) {
+          printf("%-18s decoder diverges at frame %d, channel %d, sample %d\n", key, div.frame, div.channel, div.sample);
+          if (verifyLocalize(sig, cfg, pcm, samples, &stream, &scalar, &optimized, 1, div.frame) == 0) {
+            printf("    not caused by a single kernel\n");
+          }
+          failed++;
+        } else {
+          printf("%-18s identical (%d frames)\n", key, stream.frames);
+        }
+      }
+      free(stream.data);
+    }
+    free(pcm);
+  }
+
+  verifySelectKernels(&optimized);
+  printf("%s\n", failed ? "FAILED" : "A and B are bit-exact.");
+  return failed ? 1 : 0;
+}
+
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "%s [-w golden] [-c golden] [-s] [-a] [-p] [-j threads]\n", name);
+  fprintf(stderr, "Encodes and decodes a corpus of generated signals with every configuration.\n");
+  fprintf(stderr, " -w file     write the bitstream and PCM hashes to file (default: print)\n");
+  fprintf(stderr, " -c file     compare the hashes with a golden file, fail on mismatch\n");
+  fprintf(stderr, " -s          use the plain C kernels only\n");
+  fprintf(stderr, " -a          A/B mode: run the plain C and the optimized kernels side by side,\n");
+  fprintf(stderr, "             report the first diverging frame and the responsible kernel\n");
+  fprintf(stderr, " -p          check that the 32 bit output with limiter exceeds 16 bit precision\n");
+  fprintf(stderr, " -j threads  encoder threads (hash mode and side B of the A/B mode, default 1)\n");
+}
+
+int main(int argc, char *argv[])
+{
+  const char *writePath = NULL, *comparePath = NULL;
+  INT ab = 0, precision = 0, threads = 1, i;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-w") && i + 1 < argc) {
+      writePath = argv[++i];
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      comparePath = argv[++i];
+    } else if (!strcmp(argv[i], "-s")) {
+      FDK_setCpuFeatures(0);
+    } else if (!strcmp(argv[i], "-a")) {
+      ab = 1;
+    } else if (!strcmp(argv[i], "-p")) {
+      precision = 1;
+    } else if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if (ab) {
+    return verifyAbAll(threads);
+  }
+  if (precision) {
+    return verifyPrecisionAll();
+  }
+  return verifyHashAll(writePath, comparePath, threads);
+}
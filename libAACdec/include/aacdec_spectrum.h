@@ -0,0 +1,167 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/*****************************  MPEG-4 AAC Decoder  **************************
+
+   Author(s):
+   Description: spectral output of the AAC decoder for compressed domain processing
+
+******************************************************************************/
+
+#ifndef AACDEC_SPECTRUM_H
+#define AACDEC_SPECTRUM_H
+
+#include "aacdecoder_lib.h"
+#include "common_fix.h"
+
+
+#define AACDEC_SPEC_MAX_CHANNELS     ( 8 )   /*!< Maximum number of channels of a spectral frame.          */
+#define AACDEC_SPEC_MAX_ELEMENTS     ( 8 )   /*!< Maximum number of channel elements of a spectral frame.  */
+#define AACDEC_SPEC_MAX_WINDOWS      ( 8 )   /*!< Number of windows of an eight short sequence.            */
+#define AACDEC_SPEC_TNS_MAX_FILTERS  ( 3 )   /*!< Maximum number of TNS filters per window.                */
+#define AACDEC_SPEC_TNS_MAX_ORDER    ( 20 )  /*!< Maximum TNS filter order.                                */
+
+/**
+ * \brief Dequantized spectrum and window decisions of one channel.
+ *
+ * The spectral lines of window w are spectrum[w*frameLength/8 ... (w+1)*frameLength/8-1] for eight short
+ * sequences. The value of a line is spectrum[i] * 2^specScale[w]. If tnsActive is set, the lines are the
+ * TNS residual, i.e. the TNS synthesis filters described by the tns* fields have not been applied yet.
+ */
+typedef struct {
+  FIXP_DBL spectrum[1024];                                      /*!< Dequantized spectral lines after M/S, intensity and PNS decoding. */
+  SHORT    specScale[AACDEC_SPEC_MAX_WINDOWS];                  /*!< Exponent of the spectral lines of each window.                   */
+
+  UCHAR    windowSequence;                                      /*!< 0: only long, 1: long start, 2: eight short, 3: long stop.      */
+  UCHAR    windowShape;                                         /*!< 0: sine window, 1: KBD window.                                 */
+  UCHAR    windowGroups;                                        /*!< Number of window groups.                                       */
+  UCHAR    windowGroupLength[AACDEC_SPEC_MAX_WINDOWS];          /*!< Number of windows of each window group.                        */
+
+  UCHAR    tnsActive;                                           /*!< TNS filters are present and not applied to spectrum.           */
+  UCHAR    tnsNumFilters[AACDEC_SPEC_MAX_WINDOWS];              /*!< Number of TNS filters of each window.                          */
+  UCHAR    tnsCoefRes[AACDEC_SPEC_MAX_WINDOWS];                 /*!< TNS coefficient resolution of each window, 3 or 4 bits.        */
+  UCHAR    tnsLength[AACDEC_SPEC_MAX_WINDOWS][AACDEC_SPEC_TNS_MAX_FILTERS];    /*!< Length of each filter in scale factor bands.  */
+  UCHAR    tnsOrder[AACDEC_SPEC_MAX_WINDOWS][AACDEC_SPEC_TNS_MAX_FILTERS];     /*!< Order of each filter.                         */
+  UCHAR    tnsDirection[AACDEC_SPEC_MAX_WINDOWS][AACDEC_SPEC_TNS_MAX_FILTERS]; /*!< 0: upward, 1: downward filtering.             */
+  SCHAR    tnsCoef[AACDEC_SPEC_MAX_WINDOWS][AACDEC_SPEC_TNS_MAX_FILTERS][AACDEC_SPEC_TNS_MAX_ORDER]; /*!< Coefficient indices. */
+
+} AACDEC_SPECTRAL_CHANNEL;
+
+/**
+ * \brief Spectral output of one frame.
+ *
+ * Channels are stored in bitstream order, i.e. the channels of channel element el follow the ones of
+ * element el-1. Stream properties like sampling rate or AOT are available with aacDecoder_GetStreamInfo().
+ */
+typedef struct {
+  /* set by the caller */
+  UCHAR tnsMaxFilters;   /*!< The TNS residual is returned only if no window of a channel element uses more TNS filters. */
+  UCHAR tnsMaxOrder;     /*!< The TNS residual is returned only if no filter of a channel element has a higher order.  */
+
+  /* set by aacDecoder_DecodeSpectralFrame() */
+  INT             numElements;                            /*!< Number of channel elements.                  */
+  MP4_ELEMENT_ID  elementType[AACDEC_SPEC_MAX_ELEMENTS];  /*!< ID_SCE, ID_CPE or ID_LFE of each element.    */
+  INT             numChannels;                            /*!< Number of channels.                          */
+
+  AACDEC_SPECTRAL_CHANNEL channel[AACDEC_SPEC_MAX_CHANNELS];
+
+} AACDEC_SPECTRAL_FRAME;
+
+
+/**
+ * \brief Decode one frame into the dequantized spectral domain.
+ *
+ * Works like aacDecoder_DecodeFrame() but stops ahead of the TNS synthesis filter and the inverse
+ * transform. AAC-ELD streams are not supported. SBR and DRC data are not applied, and the time domain
+ * states of the decoder instance are not updated.
+ *
+ * \param self    AAC decoder handle.
+ * \param pFrame  Spectral frame to be filled. The TNS limits have to be set by the caller.
+ * \param flags   Flags for the decoder, see aacDecoder_DecodeFrame().
+ * \return        Error code.
+ */
+AAC_DECODER_ERROR aacDecoder_DecodeSpectralFrame( HANDLE_AACDECODER      self,
+                                                  AACDEC_SPECTRAL_FRAME *pFrame,
+                                                  const UINT             flags );
+
+#endif /* AACDEC_SPECTRUM_H */
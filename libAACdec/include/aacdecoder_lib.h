@@ -212,6 +212,169 @@ tpdec_lib.h and TRANSPORTDEC_INBUF_SIZE are not part of the decoder's library in
 only source-code clients may change this setting. If you received a library release, please ask us and
 we can change this in order to meet your memory requirements.
 
+\section BatchDecoding Batch Decoding
+
+Applications which decode many independent streams at the same time can hand the frames of all decoder
+instances to a batch decoder instead of scheduling the instances on their own threads. aacDecoder_BatchOpen()
+creates a pool of worker threads. Each call of aacDecoder_BatchDecode() takes an array of ::AACDEC_BATCH_JOB,
+each filling and decoding one frame of one decoder instance, and returns when all jobs are done.
+
+Each decoder instance is preferably decoded by the same worker as in the previous batch so that its state
+stays in the cache of that core. Every worker has its own job queue with its own lock, and idle workers
+steal jobs from the queues of busy ones. If the threads are bound to cores, each batch decoder takes the
+next free cores of the process, so several batch decoders do not share cores until all cores are in use.
+The thread calling aacDecoder_BatchDecode() takes part as a worker, but is never bound.
+
+The batch decoder has no scratch memory per worker: a job uses the stack of its worker and the work buffers
+of its decoder instance. To reduce the memory of many instances, bind instances which are always decoded by
+the same application thread to a shared scratch memory instead, see \ref SharedScratch. A decoder instance
+must not be used by other threads while a batch is running.
+
+\code
+HANDLE_AAC_DECODER_BATCH hBatch;
+AACDEC_BATCH_JOB jobs[N];
+
+aacDecoder_BatchOpen(&hBatch, 4, 1);
+...
+jobs[i].hDecoder = hDecoder[i]; jobs[i].pBuffer = au[i]; jobs[i].bufferSize = jobs[i].bytesValid = auSize[i];
+jobs[i].pTimeData = pcm[i]; jobs[i].timeDataSize = pcmSize; jobs[i].flags = 0;
+...
+aacDecoder_BatchDecode(hBatch, jobs, N);
+...
+aacDecoder_BatchClose(&hBatch);
+\endcode
+
+\section SharedScratch Shared Scratch Memory
+
+The work buffers of a decoder instance hold no data from one call of aacDecoder_DecodeFrame() to the next.
+Decoder instances which are decoded one after another on the same thread can therefore share one scratch
+memory owned by the application, instead of each instance allocating its own work buffers. This reduces the
+memory per instance, and the shared block tends to stay in the cache of the core. The scratch memory is sized
+with aacDecoder_GetScratchSize() for the maximum number of channels of the streams, and bound to each instance
+with aacDecoder_SetScratch(). Instances sharing a scratch memory must never be decoded concurrently, so each
+thread needs its own scratch memory, and such instances must not be decoded in the same batch.
+
+\code
+UINT scratchSize = aacDecoder_GetScratchSize(2);
+void *pScratch = malloc(scratchSize);
+
+for (i = 0; i < N; i++) {
+  aacDecoder_SetScratch(hDecoder[i], pScratch, scratchSize);
+}
+...
+for (i = 0; i < N; i++) {
+  aacDecoder_Close(hDecoder[i]);
+}
+free(pScratch);
+\endcode
+
+\section Seeking Frame Index and Seeking
+
+Seeking in ADTS or LOAS streams by feeding the decoder from an approximate byte position relies on the resynchronization
+of the transport decoder, which is neither fast nor sample accurate. Instead, the stream can be scanned once with
+aacDecoder_IndexOpen() and aacDecoder_IndexFill(). The scan only parses the transport headers and builds a table holding
+byte offset, size and sample position of each ADTS or LOAS frame. The table can be stored next to the media with
+aacDecoder_IndexWrite() and loaded again with aacDecoder_IndexRead().
+
+aacDecoder_Seek() looks up the frame from which decoding has to be restarted to output the requested sample, clears
+the decoder history and returns the byte offset of that frame. The application then feeds the stream from this offset
+as usual. The decoder silently decodes the pre-roll frames required to settle the filter banks and the concealment delay.
+The first output frame starts exactly at the requested sample and is shortened accordingly, which is reported in
+CStreamInfo::frameSize for that single call.
+
+Sample positions are counted in output samples of the decoder. For streams with implicit SBR signaling, the SBR upsampling
+is known to the decoder only after at least one frame has been decoded. Before that, positions are interpreted in units
+of the AAC core sample rate.
+
+Output after a seek to the first frame of a stream is identical to the output of a decoder started at the beginning.
+Elsewhere, the output is identical to a continuous decoding as well, except for streams using PNS or SBR: their random
+noise generators continue from the state of the previous position, so the output after a seek may deviate from a
+continuous decoding in noise-like components. This does not happen if the instance has passed all frames in front of
+the restart frame, for example with aacDecoder_InspectFrame(), see \ref SegmentDecoding.
+
+\code
+HANDLE_AACDEC_FRAME_INDEX hIndex;
+
+aacDecoder_IndexOpen(&hIndex, TT_MP4_ADTS);
+while ( (bytesValid = bufferSize = fread(buffer, 1, sizeof(buffer), fp)) > 0 ) {
+  while (bytesValid > 0) {
+    aacDecoder_IndexFill(hIndex, buffer, bufferSize, &bytesValid);
+  }
+}
+...
+aacDecoder_Seek(hDecoder, hIndex, samplePosition, &byteOffset);
+fseek(fp, byteOffset, SEEK_SET);
+... continue with aacDecoder_Fill() and aacDecoder_DecodeFrame()
+\endcode
+
+\section Inspection Stream Inspection
+
+Applications which only validate streams or extract their properties can call aacDecoder_InspectFrame() instead of
+aacDecoder_DecodeFrame(). It reads the access unit through the transport decoder and parses all raw data block elements
+including the SBR, PS, DRC and ancillary data payloads, but skips the inverse quantization, the concealment, the filter
+banks and the SBR/PS synthesis. No output buffer is required.
+
+Afterwards CStreamInfo holds the same stream properties as after decoding: sample rate and frame size including SBR,
+number and layout of the coded channels, ::AC_SBR_PRESENT and ::AC_PS_PRESENT in CStreamInfo::flags, the DRC
+presentation mode and program reference level, and the byte and error counters. The downmix settings of the decoder are
+not applied, so CStreamInfo::numChannels is the number of coded channels, or 2 for parametric stereo.
+::AACDEC_FRAME_INFO additionally returns the bit usage of the access unit.
+
+The signal processing state of the decoder instance is not updated, except for the random noise generators of PNS and
+SBR, the SBR envelope history and inverse filtering levels and the DRC data expiry, which advance exactly like in
+aacDecoder_DecodeFrame(). If an instance is used for
+decoding afterwards, the first call of aacDecoder_DecodeFrame() has to pass ::AACDEC_CLRHIST, or aacDecoder_Seek() has to
+be called.
+
+\code
+AACDEC_FRAME_INFO info;
+
+while ( aacDecoder_InspectFrame(hDecoder, &info, 0) != AAC_DEC_NOT_ENOUGH_BITS ) {
+  bits += info.auBits;
+  frames++;
+  corrupt += (info.frameOK == 0);
+}
+\endcode
+
+\section SegmentDecoding Segment Parallel Decoding
+
+A complete ADTS or LOAS stream in memory, for example a mapped file, can be decoded on several cores at once. The
+segment decoder opened with aacDecoder_SegmentsOpen() splits the stream at frame boundaries into one segment per decoder
+instance and decodes the segments on a pool of worker threads. Each worker inspects the frames in front of its segment
+to advance the noise generators, seeks a few frames ahead of the segment to rebuild the filter bank overlap and the
+SBR/PS history, discards that pre-roll output and writes the segment directly to its position in the output buffer.
+
+For an error free stream the output is identical to a serial decoding of the whole stream, sample for sample. The output
+frame size and the number of output channels must not change within the stream. The output buffer may be a memory
+mapped file of the size returned by aacDecoder_SegmentsGetTimeDataSize(). Streams shorter than 32 frames per decoder
+instance are split into fewer segments.
+
+\code
+HANDLE_AACDEC_SEGMENTS hSegments;
+HANDLE_AACDECODER hDecoder[4];
+
+for (i = 0; i < 4; i++) {
+  hDecoder[i] = aacDecoder_Open(TT_MP4_ADTS, 1);
+}
+aacDecoder_SegmentsOpen(&hSegments, hDecoder, 4);
+... build hIndex over pStream, see \ref Seeking
+aacDecoder_SegmentsGetTimeDataSize(hSegments, hIndex, pStream, streamSize, &timeDataSize);
+pTimeData = (INT_PCM*)mmap(NULL, timeDataSize*sizeof(INT_PCM), PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+aacDecoder_SegmentsDecode(hSegments, hIndex, pStream, streamSize, pTimeData, timeDataSize, &samplesWritten);
+aacDecoder_SegmentsClose(&hSegments);
+\endcode
+
+\section Profiling Stage Profiling
+
+Each decoder instance measures the execution time of its processing stages per decoded frame. The counters are read
+with aacDecoder_GetProfile() and hold, for each stage of ::AACDEC_PROFILE_STAGE, the number of frames the stage was
+executed in, the accumulated time and the maximum time of one frame. Times are ticks of the processor time stamp counter
+where available, else of a monotonic system clock, and include the time of nested stages: ::AACDEC_PROF_TNS is part
+of ::AACDEC_PROF_SPECTRAL, the SBR sub stages are part of ::AACDEC_PROF_SBR and all stages are part of
+::AACDEC_PROF_FRAME. Calls which do not produce output and the parse only calls of aacDecoder_InspectFrame() are not
+accounted, the pre-roll frames decoded after aacDecoder_Seek() are accounted like regular frames. The library configured with --disable-profile does not contain any time measurement, in this case
+aacDecoder_GetProfile() returns ::AAC_DEC_UNKNOWN.
+
 \page OutputFormat Decoder audio output
 
 \section OutputFormatObtaining Obtaining channel mapping information
@@ -243,6 +406,19 @@ The channel interleaving scheme and the actual channel order can be changed at r
 parameters ::AAC_PCM_OUTPUT_INTERLEAVED and ::AAC_PCM_OUTPUT_CHANNEL_MAPPING. See the description of those
 parameters and the decoder library function aacDecoder_SetParam() for more detail.
 
+\section OutputSampleFormat Sample format
+
+By default the decoder writes 16 bit signed integer samples (::INT_PCM). With the parameter
+::AAC_PCM_OUTPUT_FORMAT the application can select 32 bit signed integer samples (::AACDEC_PCM_S32)
+or 32 bit IEEE float samples (::AACDEC_PCM_F32) instead. In these modes the filter banks, the downmix
+and the limiter operate on the 32 bit signal, so the output is not truncated to 16 bits at any stage.
+The S32 output has the same level as the 16 bit output scaled by 2^16, the F32 output is normalized
+to the range [-1.0, 1.0).
+
+In all modes the output buffer is passed to aacDecoder_DecodeFrame() as ::INT_PCM pointer and its
+size is given in samples. For ::AACDEC_PCM_S32 and ::AACDEC_PCM_F32 the buffer must be an array of
+32 bit elements (e.g. LONG or float) which is cast to ::INT_PCM*.
+
 \section OutputFormatExample Channel mapping examples
 
 The following examples illustrate the location of individual audio samples in the audio buffer that
@@ -427,6 +603,17 @@ typedef enum {
 /** Macro to identify if the audio output buffer contains valid samples after calling aacDecoder_DecodeFrame(). */
 #define IS_OUTPUT_VALID(err) ( ((err) == AAC_DEC_OK) || IS_DECODE_ERROR(err) )
 
+/**
+ * \brief Sample formats of the decoder output, see ::AAC_PCM_OUTPUT_FORMAT.
+ */
+typedef enum
+{
+  AACDEC_PCM_S16 = 0,  /*!< 16 bit signed integer samples (::INT_PCM, default). */
+  AACDEC_PCM_S32 = 1,  /*!< 32 bit signed integer samples. */
+  AACDEC_PCM_F32 = 2   /*!< 32 bit float samples in the range [-1.0, 1.0). */
+
+} AACDEC_PCM_FORMAT;
+
 /**
  * \brief AAC decoder setting parameters
  */
@@ -449,6 +636,11 @@ typedef enum
                                                           Default confguration is 15 ms. Adjustable range from 1 ms to 15 ms. */
   AAC_PCM_LIMITER_RELEAS_TIME             = 0x0006,  /*!< Signal level limiting release time in ms.
                                                           Default configuration is 50 ms. Adjustable time must be larger than 0 ms. */
+  AAC_PCM_OUTPUT_FORMAT                   = 0x0007,  /*!< Sample format of the output buffer, see ::AACDEC_PCM_FORMAT. \n
+                                                          0: 16 bit integer (default). \n
+                                                          1: 32 bit integer. \n
+                                                          2: 32 bit float. \n
+                                                          See section \ref OutputSampleFormat for details. */
   AAC_PCM_MIN_OUTPUT_CHANNELS             = 0x0011,  /*!< Minimum number of PCM output channels. If higher than the number of encoded audio channels,
                                                           a simple channel extension is applied. \n
                                                           -1, 0: Disable channel extenstion feature. The decoder output contains the same number of
@@ -495,6 +687,14 @@ typedef enum
                                                             3. The operating mode of the MPEG Surround module will be set accordingly. \n
                                                             4. Setting this param with any value will disable the binaural processing of the MPEG
                                                                Surround module (::AAC_MPEGS_BINAURAL_ENABLE=0). */
+  AAC_PCM_FREQ_DOMAIN_DOWNMIX             = 0x0013,  /*!< Apply the downmix requested with ::AAC_PCM_MAX_OUTPUT_CHANNELS to the MDCT spectra and
+                                                          transform only the output channels. \n
+                                                          0: Always downmix the time signal (default). \n
+                                                          1: Downmix the spectra whenever all channels of a frame share the same window sequence
+                                                             and window shape. Other frames as well as SBR and AAC-ELD streams are mixed in time
+                                                             domain with the same mixing coefficients. The output is not bit-exact to the time
+                                                             domain downmix: for 5.1 AAC-LC to 2 channels about 46% of the samples differ, by up
+                                                             to 20 LSB. */
 
   AAC_CONCEAL_METHOD                      = 0x0100,  /*!< Error concealment: Processing method. \n
                                                           0: Spectral muting. \n
@@ -589,11 +789,96 @@ typedef struct
                                                2: DRC presentation mode 2 \n
                                                3: Reserved */
 
+  /* Memory */
+  UINT              memorySize;          /*!< Heap memory held by the decoder instance in bytes. The channel related memory
+                                              is allocated for the channel configuration of the stream and grows when a
+                                              configuration with more channels is received. */
+
 } CStreamInfo;
 
 
 typedef struct AAC_DECODER_INSTANCE *HANDLE_AACDECODER;  /*!< Pointer to a AAC decoder instance. */
 
+typedef struct AAC_DECODER_BATCH *HANDLE_AAC_DECODER_BATCH;  /*!< Pointer to a batch decoder, see \ref BatchDecoding. */
+
+/**
+ * \brief  One job of aacDecoder_BatchDecode(): fill and decode one frame of one decoder instance.
+ */
+typedef struct
+{
+  HANDLE_AACDECODER   hDecoder;      /*!< Decoder instance. Each instance may occur only once per batch. */
+  UCHAR              *pBuffer;       /*!< External input buffer passed to aacDecoder_Fill(). If NULL, the frame is decoded
+                                          from the data already buffered in the decoder instance. */
+  UINT                bufferSize;    /*!< Size of the external input buffer. */
+  UINT                bytesValid;    /*!< Number of bytes in the external input buffer not yet copied into the decoder.
+                                          Updated by aacDecoder_BatchDecode() like by aacDecoder_Fill(). */
+  INT_PCM            *pTimeData;     /*!< Output buffer passed to aacDecoder_DecodeFrame(). */
+  INT                 timeDataSize;  /*!< Size of the output buffer. */
+  UINT                flags;         /*!< Flags passed to aacDecoder_DecodeFrame(). */
+  AAC_DECODER_ERROR   errorStatus;   /*!< Returned error code of aacDecoder_Fill() or aacDecoder_DecodeFrame(). */
+} AACDEC_BATCH_JOB;
+
+typedef struct AACDEC_FRAME_INDEX *HANDLE_AACDEC_FRAME_INDEX;  /*!< Pointer to a frame index, see \ref Seeking. */
+
+typedef struct AACDEC_SEGMENTS *HANDLE_AACDEC_SEGMENTS;  /*!< Pointer to a segment decoder, see \ref SegmentDecoding. */
+
+#define AACDEC_SEGMENTS_MAX_DECODERS  ( 64 )  /*!< Maximum number of decoder instances of a segment decoder. */
+
+/**
+ * \brief  One entry of a frame index, describing one ADTS or LOAS frame.
+ */
+typedef struct
+{
+  UINT64  byteOffset;      /*!< Offset of the first byte of the frame sync word in the stream. */
+  UINT64  samplePosition;  /*!< Position of the first sample of the frame, counted in AAC core samples. */
+  UINT    frameSize;       /*!< Size of the frame in bytes including the transport header. */
+  UINT    configPresent;   /*!< 1 if the frame carries the complete decoder configuration, always the case for ADTS.
+                                For LOAS only frames with a StreamMuxConfig. */
+} AACDEC_FRAME_INDEX_ENTRY;
+
+/**
+ * \brief  Bit usage and payloads of one access unit, returned by aacDecoder_InspectFrame(), see \ref Inspection.
+ */
+typedef struct
+{
+  INT    auBits;       /*!< Size of the raw data block in bits, without transport header. */
+  INT    elementBits;  /*!< Bits of the channel elements (SCE, CPE, LFE, CCE) including their side information. */
+  INT    sbrBits;      /*!< Bits of the SBR extension payloads including PS data. */
+  INT    drcBits;      /*!< Bits of the MPEG-4 dynamic range control payloads. */
+  INT    ancBits;      /*!< Bits of the data stream elements. */
+  UCHAR  frameOK;      /*!< 1 if the access unit was parsed without any error, 0 if it is corrupt. */
+  UCHAR  sbrPresent;   /*!< 1 if the access unit carried SBR data. */
+  UCHAR  psPresent;    /*!< 1 if the access unit carried parametric stereo data. */
+  UCHAR  pcePresent;   /*!< 1 if the access unit carried a program config element. */
+} AACDEC_FRAME_INFO;
+
+/**
+ * \brief  Processing stages of the decoder measured by the stage profiling, see \ref Profiling.
+ */
+typedef enum
+{
+  AACDEC_PROF_FRAME = 0,   /*!< Complete aacDecoder_DecodeFrame() call producing output. */
+  AACDEC_PROF_PARSE,       /*!< Parsing of the channel elements including Huffman decoding of the spectral data. */
+  AACDEC_PROF_SPECTRAL,    /*!< Spectral processing: dequantization, stereo tools, PNS and TNS. */
+  AACDEC_PROF_TNS,         /*!< Temporal noise shaping filters. */
+  AACDEC_PROF_SYNTHESIS,   /*!< Concealment, DRC and inverse transform of all channels. */
+  AACDEC_PROF_SBR,         /*!< SBR and PS processing including the QMF filter banks. */
+  AACDEC_PROF_SBR_LPP,     /*!< SBR high frequency generation (LPC based transposer). */
+  AACDEC_PROF_SBR_ENV,     /*!< SBR envelope adjustment. */
+  AACDEC_PROF_PS,          /*!< Parametric stereo decoding and the stereo QMF synthesis. */
+  AACDEC_PROF_PCM_DMX,     /*!< PCM downmix and channel reordering. */
+  AACDEC_PROF_LIMITER,     /*!< Time domain limiter. */
+  AACDEC_PROFILE_STAGES    /*!< Number of profiled stages. */
+} AACDEC_PROFILE_STAGE;
+
+/**
+ * \brief  Stage profiling counters of a decoder instance, returned by aacDecoder_GetProfile().
+ */
+typedef struct
+{
+  FDK_PROFILE_COUNTER  stage[AACDEC_PROFILE_STAGES];  /*!< Counters indexed by ::AACDEC_PROFILE_STAGE. */
+} AACDEC_PROFILE;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -659,6 +944,69 @@ aacDecoder_GetFreeBytes ( const HANDLE_AACDECODER  self,
 LINKSPEC_H HANDLE_AACDECODER
 aacDecoder_Open ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers );
 
+/**
+ * \brief               Open an AAC decoder instance which obtains all of its memory from a user supplied allocator.
+ *                      The allocator is used for the allocations in aacDecoder_OpenWithAllocator(), aacDecoder_ConfigRaw()
+ *                      and aacDecoder_DecodeFrame(), and all memory is returned to it by aacDecoder_Close().
+ *                      The allocator structure is copied, the context has to remain valid until aacDecoder_Close().
+ * \param transportFmt  The transport type to be used
+ * \param nrOfLayers    Number of transport layers
+ * \param pAllocator    Allocator of the instance, NULL selects the C library heap like aacDecoder_Open().
+ * \return              AAC decoder handle
+ */
+LINKSPEC_H HANDLE_AACDECODER
+aacDecoder_OpenWithAllocator ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, const FDK_ALLOCATOR *pAllocator );
+
+/**
+ * \brief               Get the memory needed by aacDecoder_OpenWithMemory() for an instance decoding streams of
+ *                      up to maxChannels channels. The allocations of the instance itself are measured by opening
+ *                      and closing a temporary instance on the C library heap, the memory allocated when a stream
+ *                      configuration is set up is added for the worst case configuration with maxChannels channels.
+ * \param transportFmt  The transport type to be used
+ * \param nrOfLayers    Number of transport layers
+ * \param maxChannels   Maximum number of channels of the streams to be decoded, 0 for the maximum supported by the library.
+ * \return              Memory size in bytes, 0 on failure.
+ */
+LINKSPEC_H UINT
+aacDecoder_GetRequiredMemory ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UINT maxChannels );
+
+/**
+ * \brief               Open an AAC decoder instance which carves all of its memory from one caller supplied memory area.
+ *                      No heap memory is allocated by the instance. The instance does not own the memory area, which can
+ *                      be reused after aacDecoder_Close(). A stream with more channels than the area was sized for
+ *                      with aacDecoder_GetRequiredMemory() may fail to be configured and is not decoded then.
+ * \param transportFmt  The transport type to be used
+ * \param nrOfLayers    Number of transport layers
+ * \param pMemory       Memory area, aligned to 64 bytes.
+ * \param memorySize    Size of the memory area in bytes, see aacDecoder_GetRequiredMemory().
+ * \return              AAC decoder handle, NULL if the memory area is not aligned or too small.
+ */
+LINKSPEC_H HANDLE_AACDECODER
+aacDecoder_OpenWithMemory ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, void *pMemory, UINT memorySize );
+
+/**
+ * \brief               Get the size of a scratch memory for aacDecoder_SetScratch(), see \ref SharedScratch.
+ * \param maxChannels   Maximum number of channels of the streams decoded by the instances sharing the scratch memory,
+ *                      0 for the maximum supported by the library.
+ * \return              Scratch memory size in bytes.
+ */
+LINKSPEC_H UINT
+aacDecoder_GetScratchSize ( UINT maxChannels );
+
+/**
+ * \brief               Bind the work buffers of a decoder instance to a scratch memory owned by the application, see
+ *                      \ref SharedScratch. The instance releases its own work buffers. The scratch memory has to remain
+ *                      valid until it is unbound or the instance is closed. A stream with more channels than the scratch
+ *                      memory was sized for fails to be configured.
+ * \param self          AAC decoder handle.
+ * \param pScratch      Scratch memory, NULL to unbind it and allocate own work buffers again.
+ * \param scratchSize   Size of the scratch memory in bytes, see aacDecoder_GetScratchSize().
+ * \return              Error code. ::AAC_DEC_OUT_OF_MEMORY if the scratch memory is too small for the current stream
+ *                      configuration or the own work buffers could not be allocated.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_SetScratch ( HANDLE_AACDECODER self, void *pScratch, UINT scratchSize );
+
 /**
  * \brief Explicitly configure the decoder by passing a raw AudioSpecificConfig (ASC) or a StreamMuxConfig (SMC),
  *  contained in a binary buffer. This is required for MPEG-4 and Raw Packets file format bitstreams
@@ -716,6 +1064,8 @@ aacDecoder_Fill ( HANDLE_AACDECODER  self,
  *
  * \param self       AAC decoder handle.
  * \param pTimeData  Pointer to external output buffer where the decoded PCM samples will be stored into.
+ * \param timeDataSize  Size of external output buffer in samples. For ::AACDEC_PCM_S32 and ::AACDEC_PCM_F32
+ *                   output pTimeData points to a buffer of 32 bit samples, see ::AAC_PCM_OUTPUT_FORMAT.
  * \param flags      Bit field with flags for the decoder: \n
  *                   (flags & AACDEC_CONCEAL) == 1: Do concealment. \n
  *                   (flags & AACDEC_FLUSH) == 2: Discard input data. Flush filter banks (output delayed audio). \n
@@ -728,6 +1078,20 @@ aacDecoder_DecodeFrame ( HANDLE_AACDECODER  self,
                          const INT          timeDataSize,
                          const UINT         flags );
 
+/**
+ * \brief               Parse one access unit without signal reconstruction, see \ref Inspection.
+ *
+ * \param self          AAC decoder handle.
+ * \param pInfo         Returns the bit usage and payloads of the access unit.
+ * \param flags         Bit field with flags for the decoder, see aacDecoder_DecodeFrame(). ::AACDEC_CONCEAL only
+ *                      updates the counters of CStreamInfo.
+ * \return              Error code as of aacDecoder_DecodeFrame().
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_InspectFrame ( HANDLE_AACDECODER   self,
+                          AACDEC_FRAME_INFO  *pInfo,
+                          const UINT          flags );
+
 /**
  * \brief       De-allocate all resources of an AAC decoder instance.
  *
@@ -736,6 +1100,224 @@ aacDecoder_DecodeFrame ( HANDLE_AACDECODER  self,
  */
 LINKSPEC_H void aacDecoder_Close ( HANDLE_AACDECODER self );
 
+/**
+ * \brief              Open a batch decoder which decodes frames of many decoder instances on a pool of threads.
+ *
+ * \param phBatch      Pointer to the batch decoder handle.
+ * \param nThreads     Number of threads including the calling thread, 1 to 64. For 1 no thread is created.
+ * \param bindThreads  If unequal 0, bind each created thread to one CPU core where supported by the platform,
+ *                     using other cores than the batch decoders opened before. The calling thread is not bound.
+ * \return             Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_BatchOpen ( HANDLE_AAC_DECODER_BATCH *phBatch,
+                       const UINT                nThreads,
+                       const UINT                bindThreads );
+
+/**
+ * \brief          Decode one frame for each job and wait until all jobs are completed.
+ *
+ *  Each job calls aacDecoder_Fill() if AACDEC_BATCH_JOB::pBuffer is set and then aacDecoder_DecodeFrame().
+ *  The result of each job is returned in AACDEC_BATCH_JOB::errorStatus. Jobs with a NULL handle or with a
+ *  handle which occurs already in an earlier job of the batch fail with ::AAC_DEC_INVALID_HANDLE.
+ *
+ * \param hBatch   Batch decoder handle.
+ * \param pJobs    Array of jobs.
+ * \param nJobs    Number of jobs.
+ * \return         Error code of the batch itself, ::AAC_DEC_OK if all jobs have been processed.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_BatchDecode ( HANDLE_AAC_DECODER_BATCH  hBatch,
+                         AACDEC_BATCH_JOB         *pJobs,
+                         const UINT                nJobs );
+
+/**
+ * \brief          Stop the threads and free the batch decoder. The decoder instances are not closed.
+ *
+ * \param phBatch  Pointer to the batch decoder handle.
+ * \return         void
+ */
+LINKSPEC_H void aacDecoder_BatchClose ( HANDLE_AAC_DECODER_BATCH *phBatch );
+
+/**
+ * \brief               Open a frame index for a ADTS or LOAS stream, see \ref Seeking.
+ *
+ * \param phIndex       Pointer to the frame index handle.
+ * \param transportFmt  Transport format of the stream, ::TT_MP4_ADTS or ::TT_MP4_LOAS.
+ * \return              Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexOpen ( HANDLE_AACDEC_FRAME_INDEX *phIndex,
+                       const TRANSPORT_TYPE       transportFmt );
+
+/**
+ * \brief              Scan stream data and append all complete frames to the index. The stream must be passed
+ *                     contiguously from its first byte on. Semantics of the buffer arguments as in aacDecoder_Fill().
+ *
+ * \param hIndex       Frame index handle.
+ * \param pBuffer      Pointer to external input buffer.
+ * \param bufferSize   Size of external input buffer.
+ * \param pBytesValid  Number of bytes in external input buffer not yet scanned.
+ * \return             Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexFill ( HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                       UCHAR                     *pBuffer,
+                       const UINT                 bufferSize,
+                       UINT                      *pBytesValid );
+
+/**
+ * \brief              Get the number of frames and the total number of AAC core samples of the index.
+ *
+ * \param hIndex       Frame index handle.
+ * \param pNumFrames   Returns the number of frames.
+ * \param pNumSamples  Returns the number of AAC core samples of all frames.
+ * \return             Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexGetInfo ( HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                          UINT                      *pNumFrames,
+                          UINT64                    *pNumSamples );
+
+/**
+ * \brief         Get one entry of the frame index.
+ *
+ * \param hIndex  Frame index handle.
+ * \param frame   Index of the frame.
+ * \param pEntry  Returns the entry.
+ * \return        Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexGetEntry ( HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                           const UINT                 frame,
+                           AACDEC_FRAME_INDEX_ENTRY  *pEntry );
+
+/**
+ * \brief                Serialize the frame index into a compact, platform independent byte stream.
+ *
+ * \param hIndex         Frame index handle.
+ * \param pBuffer        Output buffer. If NULL, only the required size is returned.
+ * \param bufferSize     Size of the output buffer.
+ * \param pBytesWritten  Returns the number of bytes written, or required if pBuffer is NULL.
+ * \return               Error code. ::AAC_DEC_OUT_OF_MEMORY if the output buffer is too small.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexWrite ( HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                        UCHAR                     *pBuffer,
+                        const UINT                 bufferSize,
+                        UINT                      *pBytesWritten );
+
+/**
+ * \brief              Create a frame index from a byte stream written by aacDecoder_IndexWrite(). The returned
+ *                     index can be used for seeking but not be extended with aacDecoder_IndexFill().
+ *
+ * \param phIndex      Pointer to the frame index handle.
+ * \param pBuffer      Serialized frame index.
+ * \param bufferSize   Size of the serialized frame index.
+ * \return             Error code. ::AAC_DEC_UNSUPPORTED_FORMAT if the data is no valid frame index.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_IndexRead ( HANDLE_AACDEC_FRAME_INDEX *phIndex,
+                       const UCHAR               *pBuffer,
+                       const UINT                 bufferSize );
+
+/**
+ * \brief          Free a frame index.
+ *
+ * \param phIndex  Pointer to the frame index handle.
+ * \return         void
+ */
+LINKSPEC_H void aacDecoder_IndexClose ( HANDLE_AACDEC_FRAME_INDEX *phIndex );
+
+/**
+ * \brief                 Prepare the decoder to continue output at the given sample position, see \ref Seeking.
+ *
+ *  The internal input buffer and the signal history are cleared. The application has to feed the stream starting at
+ *  the returned byte offset. Subsequent calls of aacDecoder_DecodeFrame() decode the pre-roll frames without output
+ *  and return the first frame shortened to start at samplePosition.
+ *
+ * \param self            AAC decoder handle.
+ * \param hIndex          Frame index of the stream.
+ * \param samplePosition  Target position in output samples.
+ * \param pByteOffset     Returns the offset in the stream from which the application has to continue feeding data.
+ * \return                Error code. ::AAC_DEC_NOT_ENOUGH_BITS if the position is beyond the end of the indexed stream.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_Seek ( HANDLE_AACDECODER          self,
+                  HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                  const UINT64               samplePosition,
+                  UINT64                    *pByteOffset );
+
+/**
+ * \brief              Combine decoder instances to a segment decoder, see \ref SegmentDecoding.
+ *
+ *  The decoder instances have to be opened for the transport type of the stream and configured identically with
+ *  aacDecoder_SetParam() before. Each instance is run by its own thread. As long as the segment decoder is open, the
+ *  instances must only be used via aacDecoder_SegmentsDecode().
+ *
+ * \param phSegments   Pointer to the segment decoder handle.
+ * \param phDecoders   Array of nDecoders decoder handles.
+ * \param nDecoders    Number of decoder instances, 1 to ::AACDEC_SEGMENTS_MAX_DECODERS.
+ * \return             Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_SegmentsOpen ( HANDLE_AACDEC_SEGMENTS   *phSegments,
+                          const HANDLE_AACDECODER  *phDecoders,
+                          const UINT                nDecoders );
+
+/**
+ * \brief                Get the output buffer size needed by aacDecoder_SegmentsDecode(). The first frame of the
+ *                       stream is decoded to find out the output frame size and number of channels.
+ *
+ * \param hSegments      Segment decoder handle.
+ * \param hIndex         Frame index of the complete stream.
+ * \param pStream        The complete stream.
+ * \param streamSize     Size of the stream in bytes.
+ * \param pTimeDataSize  Returns the number of output samples of all channels.
+ * \return               Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_SegmentsGetTimeDataSize ( HANDLE_AACDEC_SEGMENTS     hSegments,
+                                     HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                                     const UCHAR               *pStream,
+                                     const UINT64               streamSize,
+                                     UINT64                    *pTimeDataSize );
+
+/**
+ * \brief                  Decode a complete stream in parallel segments.
+ *
+ *  The stream is split at frame boundaries into up to one segment per decoder instance. Each segment is written to its
+ *  position in the output buffer, which receives the same samples as from consecutive calls of
+ *  aacDecoder_DecodeFrame() on a single instance fed with the stream from its start.
+ *
+ * \param hSegments        Segment decoder handle.
+ * \param hIndex           Frame index of the complete stream.
+ * \param pStream          The complete stream.
+ * \param streamSize       Size of the stream in bytes.
+ * \param pTimeData        Output buffer, see aacDecoder_DecodeFrame() for the sample format.
+ * \param timeDataSize     Size of the output buffer in samples, see aacDecoder_SegmentsGetTimeDataSize().
+ * \param pSamplesWritten  Returns the number of output samples of all channels up to the first missing frame.
+ * \return                 Error code. The first error of any segment. ::AAC_DEC_UNSUPPORTED_FORMAT if the output frame
+ *                          size or number of channels changes within the stream. ::AAC_DEC_SET_PARAM_FAIL if the output
+ *                          format of the decoder instances differs.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_SegmentsDecode ( HANDLE_AACDEC_SEGMENTS     hSegments,
+                            HANDLE_AACDEC_FRAME_INDEX  hIndex,
+                            const UCHAR               *pStream,
+                            const UINT64               streamSize,
+                            INT_PCM                   *pTimeData,
+                            const UINT64               timeDataSize,
+                            UINT64                    *pSamplesWritten );
+
+/**
+ * \brief              Stop the threads and free the segment decoder. The decoder instances are not closed.
+ *
+ * \param phSegments   Pointer to the segment decoder handle.
+ * \return             void
+ */
+LINKSPEC_H void aacDecoder_SegmentsClose ( HANDLE_AACDEC_SEGMENTS *phSegments );
+
 /**
  * \brief       Get CStreamInfo handle from decoder.
  *
@@ -744,6 +1326,19 @@ LINKSPEC_H void aacDecoder_Close ( HANDLE_AACDECODER self );
  */
 LINKSPEC_H CStreamInfo* aacDecoder_GetStreamInfo( HANDLE_AACDECODER self );
 
+/**
+ * \brief Get the stage profiling counters of a decoder instance, see \ref Profiling.
+ *
+ * \param self      AAC decoder handle.
+ * \param pProfile  Pointer to a structure receiving the counters.
+ * \param reset     If not 0, the counters of the instance are cleared after they have been copied.
+ * \return          Error code, ::AAC_DEC_UNKNOWN if the library was built without profiling.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_GetProfile ( HANDLE_AACDECODER  self,
+                        AACDEC_PROFILE    *pProfile,
+                        const INT          reset );
+
 /**
  * \brief       Get decoder library info.
  *
@@ -128,7 +128,11 @@ C_ALLOC_MEM(DrcInfo, CDrcInfo, 1)
   Dynamic memory areas, might be reused in other algorithm sections,
   e.g. the sbr decoder
 */
-C_ALLOC_MEM_OVERLAY(WorkBufferCore2, FIXP_DBL, ((8)*1024), SECT_DATA_L2, WORKBUFFER2_TAG)
+/*! Spectral coefficients, 1024 lines for each channel. Allocated for the channels of the
+    stream configuration by CAacDecoder_Init(). */
+FIXP_DBL * GetWorkBufferCore2(int nChannels) { FDK_ASSERT((nChannels) <= (8)); return ((FIXP_DBL*)FDKaalloc_L((nChannels)*1024*sizeof(FIXP_DBL), ALIGNMENT_DEFAULT, SECT_DATA_L2)); }
+void FreeWorkBufferCore2(FIXP_DBL** p) { if ((p != NULL) && (*p != NULL)) { FDKafree_L(*p); *p=NULL; } }
+UINT GetRequiredMemWorkBufferCore2(int nChannels) { return ALGN_SIZE_EXTRES((nChannels)*1024*sizeof(FIXP_DBL) + ALIGNMENT_DEFAULT + sizeof(void *)); }
 
 
 C_ALLOC_MEM_OVERLAY(WorkBufferCore1, CWorkBufferCore1, 1, SECT_DATA_L1, WORKBUFFER1_TAG)
@@ -114,7 +114,9 @@ H_ALLOC_MEM(AacDecoderChannelInfo, CAacDecoderChannelInfo)
 H_ALLOC_MEM(OverlapBuffer, FIXP_DBL)
 
 H_ALLOC_MEM_OVERLAY(WorkBufferCore1, CWorkBufferCore1)
-H_ALLOC_MEM_OVERLAY(WorkBufferCore2, FIXP_DBL)
+/* Spectral coefficients of nChannels channels */
+FIXP_DBL * GetWorkBufferCore2(int nChannels); void FreeWorkBufferCore2(FIXP_DBL** p);
+UINT GetRequiredMemWorkBufferCore2(int nChannels);
 
 
 #endif /* #ifndef AAC_RAM_H */
@@ -419,243 +419,1058 @@ const SFB_INFO sfbOffsetTables[5][16] =
 };
 
 
-/*# don't use 1 bit hufman tables */
 /*
-  MPEG-2 AAC 2 BITS parallel Hufman Tables
+  MPEG-2 AAC multi bit Huffman lookup tables
 
-  Bit 0:     = 1=ENDNODE, 0=INDEX
-  Bit 1:     = CODEWORD LEN MOD 2
-  Bit 2..9:  = VALUE/REF Tables 1..10,SCL
-  Bit 2..11: = VALUE/REF Table 11
+  Each table starts with a root table of (1<<HuffmanBits) entries, which is indexed
+  with the next HuffmanBits bits of the bitstream. Codewords longer than HuffmanBits
+  continue in a sub table, which is indexed with the bits following the root index.
+
+  Bit 0:      = 1=ENDNODE, 0=SUBTABLE
+  Bit 1..4:   = ENDNODE: number of read bits not belonging to the codeword (push back)
+                SUBTABLE: number of bits used to index the sub table
+  Bit 5..15:  = ENDNODE: VALUE, SUBTABLE: offset of the sub table
 */
-  const USHORT HuffmanCodeBook_1[51][4] =
+const USHORT HuffmanCodeBook_1[536] =
 {
-  {0x0157,0x0157,0x0004,0x0018}, {0x0008,0x000c,0x0010,0x0014}, {0x015b,0x015b,0x0153,0x0153}, {0x0057,0x0057,0x0167,0x0167},
-  {0x0257,0x0257,0x0117,0x0117}, {0x0197,0x0197,0x0147,0x0147}, {0x001c,0x0030,0x0044,0x0058}, {0x0020,0x0024,0x0028,0x002c},
-  {0x014b,0x014b,0x0163,0x0163}, {0x0217,0x0217,0x0127,0x0127}, {0x0187,0x0187,0x0097,0x0097}, {0x016b,0x016b,0x0017,0x0017},
-  {0x0034,0x0038,0x003c,0x0040}, {0x0143,0x0143,0x0107,0x0107}, {0x011b,0x011b,0x0067,0x0067}, {0x0193,0x0193,0x0297,0x0297},
-  {0x019b,0x019b,0x0247,0x0247}, {0x0048,0x004c,0x0050,0x0054}, {0x01a7,0x01a7,0x0267,0x0267}, {0x0113,0x0113,0x025b,0x025b},
-  {0x0053,0x0053,0x005b,0x005b}, {0x0253,0x0253,0x0047,0x0047}, {0x005c,0x0070,0x0084,0x0098}, {0x0060,0x0064,0x0068,0x006c},
-  {0x012b,0x012b,0x0123,0x0123}, {0x018b,0x018b,0x00a7,0x00a7}, {0x0227,0x0227,0x0287,0x0287}, {0x0087,0x0087,0x010b,0x010b},
-  {0x0074,0x0078,0x007c,0x0080}, {0x021b,0x021b,0x0027,0x0027}, {0x01a3,0x01a3,0x0093,0x0093}, {0x0183,0x0183,0x0207,0x0207},
-  {0x024b,0x024b,0x004b,0x004b}, {0x0088,0x008c,0x0090,0x0094}, {0x0063,0x0063,0x0103,0x0103}, {0x0007,0x0007,0x02a7,0x02a7},
-  {0x009b,0x009b,0x026b,0x026b}, {0x0263,0x0263,0x01ab,0x01ab}, {0x009c,0x00a0,0x00a4,0x00b8}, {0x0241,0x0011,0x0069,0x0019},
-  {0x0211,0x0041,0x0291,0x0299}, {0x00a8,0x00ac,0x00b0,0x00b4}, {0x008b,0x008b,0x0223,0x0223}, {0x00a3,0x00a3,0x020b,0x020b},
-  {0x02ab,0x02ab,0x0283,0x0283}, {0x002b,0x002b,0x0083,0x0083}, {0x00bc,0x00c0,0x00c4,0x00c8}, {0x0003,0x0003,0x022b,0x022b},
-  {0x028b,0x028b,0x02a3,0x02a3}, {0x0023,0x0023,0x0203,0x0203}, {0x000b,0x000b,0x00ab,0x00ab}
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1, 0x0ab1,
+  0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9,
+  0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9, 0x0ac9,
+  0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89,
+  0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89,
+  0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9,
+  0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9,
+  0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9,
+  0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9,
+  0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9,
+  0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9,
+  0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9,
+  0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9,
+  0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29,
+  0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29,
+  0x0a45, 0x0a45, 0x0a45, 0x0a45, 0x0b05, 0x0b05, 0x0b05, 0x0b05,
+  0x10a5, 0x10a5, 0x10a5, 0x10a5, 0x0925, 0x0925, 0x0925, 0x0925,
+  0x0c25, 0x0c25, 0x0c25, 0x0c25, 0x04a5, 0x04a5, 0x04a5, 0x04a5,
+  0x0b45, 0x0b45, 0x0b45, 0x0b45, 0x00a5, 0x00a5, 0x00a5, 0x00a5,
+  0x0a05, 0x0a05, 0x0a05, 0x0a05, 0x0825, 0x0825, 0x0825, 0x0825,
+  0x08c5, 0x08c5, 0x08c5, 0x08c5, 0x0325, 0x0325, 0x0325, 0x0325,
+  0x0c85, 0x0c85, 0x0c85, 0x0c85, 0x14a5, 0x14a5, 0x14a5, 0x14a5,
+  0x0cc5, 0x0cc5, 0x0cc5, 0x0cc5, 0x1225, 0x1225, 0x1225, 0x1225,
+  0x0d25, 0x0d25, 0x0d25, 0x0d25, 0x1325, 0x1325, 0x1325, 0x1325,
+  0x0885, 0x0885, 0x0885, 0x0885, 0x12c5, 0x12c5, 0x12c5, 0x12c5,
+  0x0285, 0x0285, 0x0285, 0x0285, 0x02c5, 0x02c5, 0x02c5, 0x02c5,
+  0x1285, 0x1285, 0x1285, 0x1285, 0x0225, 0x0225, 0x0225, 0x0225,
+  0x0941, 0x0901, 0x0c41, 0x0521, 0x1121, 0x1421, 0x0421, 0x0841,
+  0x10c1, 0x0121, 0x0d01, 0x0481, 0x0c01, 0x1021, 0x1241, 0x0241,
+  0x0301, 0x0801, 0x0021, 0x1521, 0x04c1, 0x1341, 0x1301, 0x0d41,
+  0x4002, 0x4042, 0x4082, 0x40c2, 0x4104, 0x4184, 0x4204, 0x4284,
+  0x1201, 0x0081, 0x0341, 0x00c1, 0x1081, 0x0201, 0x1481, 0x14c1,
+  0x0441, 0x1101, 0x0501, 0x1041, 0x1541, 0x1401, 0x0141, 0x0401,
+  0x0001, 0x1141, 0x1441, 0x1501, 0x0101, 0x1001, 0x0041, 0x0541
 };
 
-const USHORT HuffmanCodeBook_2[39][4] =
+const USHORT HuffmanCodeBook_2[512] =
 {
-  {0x0004,0x000c,0x0020,0x0034}, {0x0157,0x0157,0x0159,0x0008}, {0x0153,0x0153,0x0257,0x0257}, {0x0010,0x0014,0x0018,0x001c},
-  {0x0117,0x0117,0x0057,0x0057}, {0x0147,0x0147,0x0197,0x0197}, {0x0167,0x0167,0x0185,0x0161}, {0x0125,0x0095,0x0065,0x0215},
-  {0x0024,0x0028,0x002c,0x0030}, {0x0051,0x0149,0x0119,0x0141}, {0x0015,0x0199,0x0259,0x0245}, {0x0191,0x0265,0x0105,0x0251},
-  {0x0045,0x0111,0x0169,0x01a5}, {0x0038,0x0044,0x0058,0x006c}, {0x0295,0x0059,0x003c,0x0040}, {0x0227,0x0227,0x021b,0x021b},
-  {0x0123,0x0123,0x0087,0x0087}, {0x0048,0x004c,0x0050,0x0054}, {0x018b,0x018b,0x006b,0x006b}, {0x029b,0x029b,0x01a3,0x01a3},
-  {0x0207,0x0207,0x01ab,0x01ab}, {0x0093,0x0093,0x0103,0x0103}, {0x005c,0x0060,0x0064,0x0068}, {0x0213,0x0213,0x010b,0x010b},
-  {0x012b,0x012b,0x0249,0x0061}, {0x0181,0x0291,0x0241,0x0041}, {0x0005,0x0099,0x0019,0x0025}, {0x0070,0x0074,0x0078,0x0088},
-  {0x02a5,0x0261,0x0011,0x00a5}, {0x0049,0x0285,0x0269,0x0089}, {0x0221,0x007c,0x0080,0x0084}, {0x020b,0x020b,0x0003,0x0003},
-  {0x00a3,0x00a3,0x02a3,0x02a3}, {0x02ab,0x02ab,0x0083,0x0083}, {0x008c,0x0090,0x0094,0x0098}, {0x028b,0x028b,0x0023,0x0023},
-  {0x0283,0x0283,0x002b,0x002b}, {0x000b,0x000b,0x0203,0x0203}, {0x022b,0x022b,0x00ab,0x00ab}
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad, 0x0aad,
+  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb,
+  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb,
+  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb,
+  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb,
+  0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89,
+  0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89, 0x0a89,
+  0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9,
+  0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9, 0x12a9,
+  0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9,
+  0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9, 0x08a9,
+  0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9,
+  0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9, 0x02a9,
+  0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29,
+  0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29, 0x0a29,
+  0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9,
+  0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9, 0x0ca9,
+  0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27,
+  0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07,
+  0x0927, 0x0927, 0x0927, 0x0927, 0x0927, 0x0927, 0x0927, 0x0927,
+  0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7,
+  0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327,
+  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
+  0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+  0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47,
+  0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7,
+  0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07, 0x0a07,
+  0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7,
+  0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7,
+  0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7, 0x12c7,
+  0x1227, 0x1227, 0x1227, 0x1227, 0x1227, 0x1227, 0x1227, 0x1227,
+  0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87,
+  0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327, 0x1327,
+  0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827,
+  0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287, 0x1287,
+  0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227,
+  0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887,
+  0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47, 0x0b47,
+  0x0d27, 0x0d27, 0x0d27, 0x0d27, 0x0d27, 0x0d27, 0x0d27, 0x0d27,
+  0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7, 0x14a7,
+  0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7, 0x02c7,
+  0x1125, 0x1125, 0x1125, 0x1125, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
+  0x0905, 0x0905, 0x0905, 0x0905, 0x0425, 0x0425, 0x0425, 0x0425,
+  0x0c45, 0x0c45, 0x0c45, 0x0c45, 0x0345, 0x0345, 0x0345, 0x0345,
+  0x14c5, 0x14c5, 0x14c5, 0x14c5, 0x0d05, 0x0d05, 0x0d05, 0x0d05,
+  0x1025, 0x1025, 0x1025, 0x1025, 0x0d45, 0x0d45, 0x0d45, 0x0d45,
+  0x0485, 0x0485, 0x0485, 0x0485, 0x0805, 0x0805, 0x0805, 0x0805,
+  0x1085, 0x1085, 0x1085, 0x1085, 0x0845, 0x0845, 0x0845, 0x0845,
+  0x0945, 0x0945, 0x0945, 0x0945, 0x1243, 0x1243, 0x0303, 0x0303,
+  0x0c03, 0x0c03, 0x1483, 0x1483, 0x1203, 0x1203, 0x0203, 0x0203,
+  0x0023, 0x0023, 0x04c3, 0x04c3, 0x00c3, 0x00c3, 0x0123, 0x0123,
+  0x1523, 0x1523, 0x1303, 0x1303, 0x0083, 0x0083, 0x0523, 0x0523,
+  0x0243, 0x0243, 0x1423, 0x1423, 0x1343, 0x1343, 0x0443, 0x0443,
+  0x1103, 0x1103, 0x1041, 0x0001, 0x0501, 0x1501, 0x1541, 0x0401,
+  0x1441, 0x0101, 0x1401, 0x0141, 0x0041, 0x1001, 0x1141, 0x0541
 };
 
-const USHORT HuffmanCodeBook_3[39][4] =
+const USHORT HuffmanCodeBook_3[670] =
 {
-  {0x0003,0x0003,0x0004,0x0008}, {0x0005,0x0101,0x0011,0x0041}, {0x000c,0x0010,0x0014,0x0020}, {0x0017,0x0017,0x0143,0x0143},
-  {0x0051,0x0111,0x0045,0x0151}, {0x0105,0x0055,0x0018,0x001c}, {0x0157,0x0157,0x0147,0x0147}, {0x0117,0x0117,0x0009,0x0201},
-  {0x0024,0x002c,0x0040,0x0054}, {0x0241,0x0019,0x0065,0x0028}, {0x0183,0x0183,0x0193,0x0193}, {0x0030,0x0034,0x0038,0x003c},
-  {0x0027,0x0027,0x0253,0x0253}, {0x005b,0x005b,0x0083,0x0083}, {0x0063,0x0063,0x0093,0x0093}, {0x0023,0x0023,0x0213,0x0213},
-  {0x0044,0x0048,0x004c,0x0050}, {0x004b,0x004b,0x0167,0x0167}, {0x0163,0x0163,0x0097,0x0097}, {0x0197,0x0197,0x0125,0x0085},
-  {0x0185,0x0121,0x0159,0x0255}, {0x0058,0x005c,0x0060,0x0070}, {0x0119,0x0245,0x0281,0x0291}, {0x0069,0x00a5,0x0205,0x0109},
-  {0x01a1,0x0064,0x0068,0x006c}, {0x002b,0x002b,0x01a7,0x01a7}, {0x0217,0x0217,0x014b,0x014b}, {0x0297,0x0297,0x016b,0x016b},
-  {0x0074,0x0078,0x007c,0x0080}, {0x00a3,0x00a3,0x0263,0x0263}, {0x0285,0x0129,0x0099,0x00a9}, {0x02a1,0x01a9,0x0199,0x0265},
-  {0x02a5,0x0084,0x0088,0x008c}, {0x0223,0x0223,0x008b,0x008b}, {0x0227,0x0227,0x0189,0x0259}, {0x0219,0x0090,0x0094,0x0098},
-  {0x02ab,0x02ab,0x026b,0x026b}, {0x029b,0x029b,0x024b,0x024b}, {0x020b,0x020b,0x0229,0x0289}
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b,
+  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b,
+  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b,
+  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b,
+  0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b,
+  0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b,
+  0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b,
+  0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9,
+  0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9,
+  0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09,
+  0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09, 0x0a09,
+  0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+  0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887,
+  0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227, 0x0227,
+  0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87, 0x0a87,
+  0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827,
+  0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7, 0x02a7,
+  0x0aa5, 0x0aa5, 0x0aa5, 0x0aa5, 0x0a25, 0x0a25, 0x0a25, 0x0a25,
+  0x08a5, 0x08a5, 0x08a5, 0x08a5, 0x0043, 0x0043, 0x1003, 0x1003,
+  0x1203, 0x1203, 0x00c3, 0x00c3, 0x0323, 0x0323, 0x0c01, 0x0c81,
+  0x0121, 0x1281, 0x02c1, 0x0401, 0x0301, 0x0481, 0x0101, 0x1081,
+  0x0241, 0x0b21, 0x0b01, 0x04a1, 0x0ca1, 0x4002, 0x4042, 0x4082,
+  0x40c2, 0x4102, 0x4142, 0x4182, 0x41c4, 0x4244, 0x42c6, 0x43ce,
+  0x0921, 0x0421, 0x0c21, 0x0901, 0x0ac1, 0x12a1, 0x08c1, 0x1221,
+  0x1401, 0x1481, 0x0341, 0x0521, 0x1021, 0x0841, 0x0d03, 0x0d03,
+  0x0141, 0x0d21, 0x10a1, 0x0a41, 0x14a1, 0x0b41, 0x0503, 0x0503,
+  0x1303, 0x1303, 0x1421, 0x0941, 0x04c1, 0x0541, 0x1509, 0x1509,
+  0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509,
+  0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x1509, 0x0d49, 0x0d49,
+  0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49,
+  0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0d49, 0x0cc9, 0x0cc9,
+  0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9,
+  0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x0cc9, 0x1329, 0x1329,
+  0x1329, 0x1329, 0x1329, 0x1329, 0x1329, 0x1329, 0x1329, 0x1329,
+  0x1329, 0x1329, 0x1329, 0x1329, 0x1329, 0x1329, 0x1529, 0x1529,
+  0x1529, 0x1529, 0x1529, 0x1529, 0x1529, 0x1529, 0x1529, 0x1529,
+  0x1529, 0x1529, 0x1529, 0x1529, 0x1529, 0x1529, 0x1107, 0x1107,
+  0x1107, 0x1107, 0x1107, 0x1107, 0x1107, 0x1107, 0x0447, 0x0447,
+  0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x1127, 0x1127,
+  0x1127, 0x1127, 0x1127, 0x1127, 0x1127, 0x1127, 0x0c45, 0x0c45,
+  0x0c45, 0x0c45, 0x12c5, 0x12c5, 0x12c5, 0x12c5, 0x10c5, 0x10c5,
+  0x10c5, 0x10c5, 0x1543, 0x1543, 0x1343, 0x1343, 0x14c3, 0x14c3,
+  0x1243, 0x1243, 0x1043, 0x1043, 0x1141, 0x1441
 };
 
-const USHORT HuffmanCodeBook_4[38][4] =
+const USHORT HuffmanCodeBook_4[542] =
 {
-  {0x0004,0x0008,0x000c,0x0018}, {0x0155,0x0151,0x0115,0x0055}, {0x0145,0x0005,0x0015,0x0001}, {0x0141,0x0045,0x0010,0x0014},
-  {0x0107,0x0107,0x0053,0x0053}, {0x0103,0x0103,0x0113,0x0113}, {0x001c,0x0020,0x0034,0x0048}, {0x0043,0x0043,0x0013,0x0013},
-  {0x0024,0x0028,0x002c,0x0030}, {0x015b,0x015b,0x0197,0x0197}, {0x0167,0x0167,0x0257,0x0257}, {0x005b,0x005b,0x011b,0x011b},
-  {0x0067,0x0067,0x014b,0x014b}, {0x0038,0x003c,0x0040,0x0044}, {0x0193,0x0193,0x0251,0x0095}, {0x0161,0x0245,0x0125,0x0215},
-  {0x0185,0x0019,0x0049,0x0025}, {0x0109,0x0211,0x0061,0x0241}, {0x004c,0x0050,0x0058,0x006c}, {0x0091,0x0121,0x0205,0x0181},
-  {0x0085,0x0009,0x0201,0x0054}, {0x0023,0x0023,0x0083,0x0083}, {0x005c,0x0060,0x0064,0x0068}, {0x01a7,0x01a7,0x016b,0x016b},
-  {0x019b,0x019b,0x0297,0x0297}, {0x0267,0x0267,0x025b,0x025b}, {0x00a5,0x0069,0x0099,0x01a1}, {0x0070,0x0074,0x0078,0x0084},
-  {0x0291,0x0129,0x0261,0x0189}, {0x0285,0x01a9,0x0225,0x0249}, {0x0219,0x02a5,0x007c,0x0080}, {0x029b,0x029b,0x026b,0x026b},
-  {0x00a3,0x00a3,0x002b,0x002b}, {0x0088,0x008c,0x0090,0x0094}, {0x0283,0x0283,0x008b,0x008b}, {0x0223,0x0223,0x020b,0x020b},
-  {0x02ab,0x02ab,0x02a3,0x02a3}, {0x00ab,0x00ab,0x0229,0x0289}
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
+  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
+  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
+  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
+  0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b,
+  0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b,
+  0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b,
+  0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b, 0x0a2b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab,
+  0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab,
+  0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab,
+  0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b,
+  0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b,
+  0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b,
+  0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b, 0x0a0b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829,
+  0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829,
+  0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289,
+  0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289, 0x0289,
+  0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809,
+  0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809, 0x0809,
+  0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889,
+  0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889, 0x0889,
+  0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209,
+  0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0ac5, 0x0ac5, 0x0ac5, 0x0ac5, 0x0ca5, 0x0ca5, 0x0ca5, 0x0ca5,
+  0x0b25, 0x0b25, 0x0b25, 0x0b25, 0x12a5, 0x12a5, 0x12a5, 0x12a5,
+  0x02c5, 0x02c5, 0x02c5, 0x02c5, 0x08c5, 0x08c5, 0x08c5, 0x08c5,
+  0x0325, 0x0325, 0x0325, 0x0325, 0x0a45, 0x0a45, 0x0a45, 0x0a45,
+  0x0c85, 0x0c85, 0x0c85, 0x0c85, 0x1283, 0x1283, 0x04a3, 0x04a3,
+  0x0b03, 0x0b03, 0x1223, 0x1223, 0x0923, 0x0923, 0x10a3, 0x10a3,
+  0x0c23, 0x0c23, 0x00c3, 0x00c3, 0x0243, 0x0243, 0x0123, 0x0123,
+  0x0843, 0x0843, 0x1083, 0x1083, 0x0303, 0x0303, 0x1203, 0x1203,
+  0x0483, 0x0483, 0x0903, 0x0903, 0x1023, 0x1023, 0x0c03, 0x0c03,
+  0x0423, 0x0423, 0x0043, 0x0043, 0x1003, 0x1003, 0x0101, 0x0401,
+  0x0d21, 0x0b41, 0x0cc1, 0x14a1, 0x1321, 0x12c1, 0x4002, 0x4042,
+  0x4082, 0x40c2, 0x4102, 0x4142, 0x4182, 0x41c4, 0x4244, 0x42c6,
+  0x0521, 0x0341, 0x04c1, 0x0d01, 0x1481, 0x0941, 0x1301, 0x0c41,
+  0x1421, 0x0d41, 0x1121, 0x1241, 0x10c1, 0x1521, 0x14c1, 0x1341,
+  0x0501, 0x0141, 0x1401, 0x0441, 0x1101, 0x1041, 0x1543, 0x1543,
+  0x1503, 0x1503, 0x0543, 0x0543, 0x1141, 0x1441
 };
 
-const USHORT HuffmanCodeBook_5[41][4] =
+const USHORT HuffmanCodeBook_5[564] =
 {
-  {0x0113,0x0113,0x0004,0x0008}, {0x010d,0x0115,0x0151,0x00d1}, {0x000c,0x0010,0x0014,0x0028}, {0x00d7,0x00d7,0x014f,0x014f},
-  {0x00cf,0x00cf,0x0157,0x0157}, {0x0018,0x001c,0x0020,0x0024}, {0x010b,0x010b,0x0193,0x0193}, {0x011b,0x011b,0x0093,0x0093},
-  {0x00c9,0x0159,0x008d,0x0195}, {0x0149,0x00d9,0x018d,0x0095}, {0x002c,0x0030,0x0044,0x0058}, {0x0105,0x011d,0x0051,0x01d1},
-  {0x0034,0x0038,0x003c,0x0040}, {0x00c7,0x00c7,0x01d7,0x01d7}, {0x015f,0x015f,0x004f,0x004f}, {0x0147,0x0147,0x00df,0x00df},
-  {0x0057,0x0057,0x01cf,0x01cf}, {0x0048,0x004c,0x0050,0x0054}, {0x018b,0x018b,0x019b,0x019b}, {0x008b,0x008b,0x009b,0x009b},
-  {0x0085,0x009d,0x01c9,0x0059}, {0x019d,0x01d9,0x0185,0x0049}, {0x005c,0x0060,0x0074,0x0088}, {0x0011,0x0101,0x0161,0x0121},
-  {0x0064,0x0068,0x006c,0x0070}, {0x00c3,0x00c3,0x0213,0x0213}, {0x00e3,0x00e3,0x000f,0x000f}, {0x0217,0x0217,0x020f,0x020f},
-  {0x0143,0x0143,0x0017,0x0017}, {0x0078,0x007c,0x0080,0x0084}, {0x005f,0x005f,0x0047,0x0047}, {0x01c7,0x01c7,0x020b,0x020b},
-  {0x0083,0x0083,0x01a3,0x01a3}, {0x001b,0x001b,0x021b,0x021b}, {0x008c,0x0090,0x0094,0x0098}, {0x01df,0x01df,0x0183,0x0183},
-  {0x0009,0x00a1,0x001d,0x0041}, {0x01c1,0x021d,0x0205,0x01e1}, {0x0061,0x0005,0x009c,0x00a0}, {0x0023,0x0023,0x0203,0x0203},
-  {0x0223,0x0223,0x0003,0x0003}
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891, 0x0891,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9,
+  0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9, 0x06a9,
+  0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69,
+  0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69, 0x0a69,
+  0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669,
+  0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669,
+  0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9,
+  0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9, 0x0aa9,
+  0x0845, 0x0845, 0x0845, 0x0845, 0x0c85, 0x0c85, 0x0c85, 0x0c85,
+  0x08c5, 0x08c5, 0x08c5, 0x08c5, 0x0485, 0x0485, 0x0485, 0x0485,
+  0x0643, 0x0643, 0x0ac3, 0x0ac3, 0x0463, 0x0463, 0x0ca3, 0x0ca3,
+  0x0a43, 0x0a43, 0x06c3, 0x06c3, 0x0c63, 0x0c63, 0x04a3, 0x04a3,
+  0x0823, 0x0823, 0x08e3, 0x08e3, 0x0283, 0x0283, 0x0e83, 0x0e83,
+  0x0621, 0x0ea1, 0x0ae1, 0x0261, 0x0a21, 0x06e1, 0x02a1, 0x0e61,
+  0x0c41, 0x0cc1, 0x0441, 0x04c1, 0x4002, 0x4042, 0x4082, 0x40c2,
+  0x4102, 0x4142, 0x4184, 0x4204, 0x4284, 0x4304, 0x4386, 0x4488,
+  0x0421, 0x04e1, 0x0e41, 0x02c1, 0x0ce1, 0x0ec1, 0x0c21, 0x0241,
+  0x0081, 0x0801, 0x0b01, 0x0901, 0x0601, 0x1081, 0x0701, 0x0061,
+  0x10a1, 0x1061, 0x0a01, 0x00a1, 0x02e1, 0x0221, 0x0e21, 0x1041,
+  0x0401, 0x0d01, 0x00c1, 0x10c1, 0x0ee3, 0x0ee3, 0x0c03, 0x0c03,
+  0x0041, 0x0501, 0x00e1, 0x0201, 0x0e03, 0x0e03, 0x10e3, 0x10e3,
+  0x1023, 0x1023, 0x0f03, 0x0f03, 0x0303, 0x0303, 0x0023, 0x0023,
+  0x0101, 0x1001, 0x1101, 0x0001
 };
 
-const USHORT HuffmanCodeBook_6[40][4] =
+const USHORT HuffmanCodeBook_6[524] =
 {
-  {0x0004,0x0008,0x000c,0x001c}, {0x0111,0x0115,0x00d1,0x0151}, {0x010d,0x0155,0x014d,0x00d5}, {0x00cd,0x0010,0x0014,0x0018},
-  {0x00d9,0x0159,0x0149,0x00c9}, {0x0109,0x018d,0x0119,0x0095}, {0x0195,0x0091,0x008d,0x0191}, {0x0020,0x0024,0x0038,0x004c},
-  {0x0099,0x0189,0x0089,0x0199}, {0x0028,0x002c,0x0030,0x0034}, {0x0147,0x0147,0x015f,0x015f}, {0x00df,0x00df,0x01cf,0x01cf},
-  {0x00c7,0x00c7,0x01d7,0x01d7}, {0x0057,0x0057,0x004f,0x004f}, {0x003c,0x0040,0x0044,0x0048}, {0x011f,0x011f,0x0107,0x0107},
-  {0x0053,0x0053,0x01d3,0x01d3}, {0x019f,0x019f,0x0085,0x01c9}, {0x01d9,0x009d,0x0059,0x0049}, {0x0050,0x005c,0x0070,0x0084},
-  {0x0185,0x01dd,0x0054,0x0058}, {0x005f,0x005f,0x0047,0x0047}, {0x01c7,0x01c7,0x0017,0x0017}, {0x0060,0x0064,0x0068,0x006c},
-  {0x000f,0x000f,0x0163,0x0163}, {0x0143,0x0143,0x00c3,0x00c3}, {0x0217,0x0217,0x00e3,0x00e3}, {0x020f,0x020f,0x0013,0x0013},
-  {0x0074,0x0078,0x007c,0x0080}, {0x0183,0x0183,0x0083,0x0083}, {0x021b,0x021b,0x000b,0x000b}, {0x0103,0x0103,0x01a3,0x01a3},
-  {0x00a3,0x00a3,0x020b,0x020b}, {0x0088,0x008c,0x0090,0x0094}, {0x0123,0x0123,0x001b,0x001b}, {0x0213,0x0213,0x0005,0x0205},
-  {0x001d,0x0061,0x021d,0x01e1}, {0x01c1,0x0041,0x0098,0x009c}, {0x0223,0x0223,0x0203,0x0203}, {0x0003,0x0003,0x0023,0x0023}
+  0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b,
+  0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b,
+  0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b,
+  0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b, 0x088b,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab, 0x08ab,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b, 0x068b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b, 0x086b,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b,
+  0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b,
+  0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b,
+  0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b, 0x0a6b,
+  0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab,
+  0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab,
+  0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab,
+  0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab, 0x06ab,
+  0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b,
+  0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b,
+  0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b,
+  0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b, 0x066b,
+  0x06c7, 0x06c7, 0x06c7, 0x06c7, 0x06c7, 0x06c7, 0x06c7, 0x06c7,
+  0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7,
+  0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47,
+  0x0647, 0x0647, 0x0647, 0x0647, 0x0647, 0x0647, 0x0647, 0x0647,
+  0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847,
+  0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67,
+  0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7, 0x08c7,
+  0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7,
+  0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7, 0x0ca7,
+  0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487,
+  0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467,
+  0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87, 0x0c87,
+  0x04c7, 0x04c7, 0x04c7, 0x04c7, 0x04c7, 0x04c7, 0x04c7, 0x04c7,
+  0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47,
+  0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447,
+  0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7, 0x0cc7,
+  0x0a25, 0x0a25, 0x0a25, 0x0a25, 0x0ae5, 0x0ae5, 0x0ae5, 0x0ae5,
+  0x06e5, 0x06e5, 0x06e5, 0x06e5, 0x0e65, 0x0e65, 0x0e65, 0x0e65,
+  0x0625, 0x0625, 0x0625, 0x0625, 0x0ea5, 0x0ea5, 0x0ea5, 0x0ea5,
+  0x02a5, 0x02a5, 0x02a5, 0x02a5, 0x0265, 0x0265, 0x0265, 0x0265,
+  0x08e5, 0x08e5, 0x08e5, 0x08e5, 0x0825, 0x0825, 0x0825, 0x0825,
+  0x0285, 0x0285, 0x0285, 0x0285, 0x0e85, 0x0e85, 0x0e85, 0x0e85,
+  0x0ce5, 0x0ce5, 0x0ce5, 0x0ce5, 0x0423, 0x0423, 0x0e43, 0x0e43,
+  0x0ec3, 0x0ec3, 0x04e3, 0x04e3, 0x02c3, 0x02c3, 0x0243, 0x0243,
+  0x0c23, 0x0c23, 0x0ee3, 0x0ee3, 0x02e1, 0x0221, 0x0e21, 0x00a1,
+  0x0061, 0x0b01, 0x0a01, 0x0601, 0x10a1, 0x0701, 0x1061, 0x0081,
+  0x0c01, 0x0401, 0x10c1, 0x0041, 0x0801, 0x0d01, 0x0501, 0x1041,
+  0x0901, 0x00c1, 0x1081, 0x4002, 0x4042, 0x4082, 0x40c2, 0x4104,
+  0x0021, 0x1021, 0x00e1, 0x0301, 0x10e1, 0x0f01, 0x0e01, 0x0201,
+  0x1101, 0x1001, 0x0001, 0x0101
 };
 
-const USHORT HuffmanCodeBook_7[31][4] =
+const USHORT HuffmanCodeBook_7[542] =
 {
-  {0x0003,0x0003,0x0004,0x0008}, {0x0007,0x0007,0x0043,0x0043}, {0x0045,0x000c,0x0010,0x0024}, {0x0049,0x0085,0x0009,0x0081},
-  {0x0014,0x0018,0x001c,0x0020}, {0x004f,0x004f,0x00c7,0x00c7}, {0x008b,0x008b,0x000f,0x000f}, {0x00c3,0x00c3,0x00c9,0x008d},
-  {0x0105,0x0051,0x0145,0x0055}, {0x0028,0x002c,0x0040,0x0054}, {0x00cd,0x0109,0x0101,0x0011}, {0x0030,0x0034,0x0038,0x003c},
-  {0x0093,0x0093,0x014b,0x014b}, {0x0097,0x0097,0x0143,0x0143}, {0x005b,0x005b,0x0017,0x0017}, {0x0187,0x0187,0x00d3,0x00d3},
-  {0x0044,0x0048,0x004c,0x0050}, {0x014f,0x014f,0x010f,0x010f}, {0x00d7,0x00d7,0x018b,0x018b}, {0x009b,0x009b,0x01c7,0x01c7},
-  {0x018d,0x0181,0x0019,0x0111}, {0x0058,0x005c,0x0060,0x0068}, {0x005d,0x0151,0x009d,0x0115}, {0x00d9,0x01c9,0x00dd,0x0119},
-  {0x0155,0x0191,0x01cd,0x0064}, {0x001f,0x001f,0x01c3,0x01c3}, {0x006c,0x0070,0x0074,0x0078}, {0x015b,0x015b,0x0197,0x0197},
-  {0x011f,0x011f,0x01d3,0x01d3}, {0x01d7,0x01d7,0x015f,0x015f}, {0x019d,0x0199,0x01d9,0x01dd}
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247,
+  0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+  0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+  0x0265, 0x0265, 0x0265, 0x0265, 0x0625, 0x0625, 0x0625, 0x0625,
+  0x0445, 0x0445, 0x0445, 0x0445, 0x0065, 0x0065, 0x0065, 0x0065,
+  0x0605, 0x0605, 0x0605, 0x0605, 0x0643, 0x0643, 0x0463, 0x0463,
+  0x0823, 0x0823, 0x0283, 0x0283, 0x0a23, 0x0a23, 0x02a3, 0x02a3,
+  0x0663, 0x0663, 0x0843, 0x0843, 0x0803, 0x0803, 0x0083, 0x0083,
+  0x0481, 0x0a41, 0x04a1, 0x0a01, 0x02c1, 0x00a1, 0x0c21, 0x0681,
+  0x0a61, 0x0861, 0x06a1, 0x0c41, 0x04c1, 0x0e21, 0x4002, 0x4042,
+  0x4082, 0x40c2, 0x4102, 0x4142, 0x4182, 0x41c4, 0x4244, 0x42c6,
+  0x0c61, 0x0c01, 0x00c1, 0x0881, 0x02e1, 0x0a81, 0x04e1, 0x08a1,
+  0x06c1, 0x0e41, 0x06e1, 0x08c1, 0x0aa1, 0x0c81, 0x0e63, 0x0e63,
+  0x00e1, 0x0e01, 0x0ac1, 0x0ca1, 0x08e1, 0x0e81, 0x0ea3, 0x0ea3,
+  0x0ae3, 0x0ae3, 0x0ce1, 0x0cc1, 0x0ec1, 0x0ee1
 };
 
-const USHORT HuffmanCodeBook_8[31][4] =
+const USHORT HuffmanCodeBook_8[516] =
 {
-  {0x0004,0x0008,0x0010,0x0024}, {0x0047,0x0047,0x0049,0x0005}, {0x0085,0x0041,0x0089,0x000c}, {0x0003,0x0003,0x000b,0x000b},
-  {0x0014,0x0018,0x001c,0x0020}, {0x0083,0x0083,0x004f,0x004f}, {0x00c7,0x00c7,0x008f,0x008f}, {0x00cb,0x00cb,0x00cd,0x0051},
-  {0x0105,0x0091,0x0109,0x000d}, {0x0028,0x002c,0x0040,0x0054}, {0x00c1,0x00d1,0x010d,0x0095}, {0x0030,0x0034,0x0038,0x003c},
-  {0x0057,0x0057,0x014b,0x014b}, {0x0147,0x0147,0x00d7,0x00d7}, {0x014f,0x014f,0x0113,0x0113}, {0x0117,0x0117,0x0103,0x0103},
-  {0x0044,0x0048,0x004c,0x0050}, {0x0153,0x0153,0x0013,0x0013}, {0x018b,0x018b,0x009b,0x009b}, {0x005b,0x005b,0x0187,0x0187},
-  {0x018d,0x00d9,0x0155,0x0015}, {0x0058,0x005c,0x0060,0x0068}, {0x0119,0x0141,0x0191,0x005d}, {0x009d,0x01c9,0x0159,0x00dd},
-  {0x01c5,0x0195,0x01cd,0x0064}, {0x019b,0x019b,0x011f,0x011f}, {0x006c,0x0070,0x0074,0x0078}, {0x001b,0x001b,0x01d3,0x01d3},
-  {0x0183,0x0183,0x015f,0x015f}, {0x019f,0x019f,0x01db,0x01db}, {0x01d5,0x001d,0x01c1,0x01dd}
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b, 0x020b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+  0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+  0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409,
+  0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409,
+  0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269,
+  0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269,
+  0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629,
+  0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629,
+  0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469,
+  0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469,
+  0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649,
+  0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649,
+  0x0667, 0x0667, 0x0667, 0x0667, 0x0667, 0x0667, 0x0667, 0x0667,
+  0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+  0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827,
+  0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487,
+  0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847,
+  0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067,
+  0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607,
+  0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687,
+  0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867,
+  0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7,
+  0x02a5, 0x02a5, 0x02a5, 0x02a5, 0x0a45, 0x0a45, 0x0a45, 0x0a45,
+  0x0a25, 0x0a25, 0x0a25, 0x0a25, 0x06a5, 0x06a5, 0x06a5, 0x06a5,
+  0x0a65, 0x0a65, 0x0a65, 0x0a65, 0x0885, 0x0885, 0x0885, 0x0885,
+  0x08a5, 0x08a5, 0x08a5, 0x08a5, 0x0805, 0x0805, 0x0805, 0x0805,
+  0x0a85, 0x0a85, 0x0a85, 0x0a85, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0c45, 0x0c45, 0x0c45, 0x0c45, 0x04c5, 0x04c5, 0x04c5, 0x04c5,
+  0x02c5, 0x02c5, 0x02c5, 0x02c5, 0x0c25, 0x0c25, 0x0c25, 0x0c25,
+  0x0c63, 0x0c63, 0x06c3, 0x06c3, 0x0aa3, 0x0aa3, 0x00a3, 0x00a3,
+  0x08c3, 0x08c3, 0x0a03, 0x0a03, 0x0c83, 0x0c83, 0x02e3, 0x02e3,
+  0x04e3, 0x04e3, 0x0e43, 0x0e43, 0x0ac3, 0x0ac3, 0x06e3, 0x06e3,
+  0x0e23, 0x0e23, 0x0ca3, 0x0ca3, 0x0e63, 0x0e63, 0x0cc1, 0x08e1,
+  0x00c1, 0x0e81, 0x0c01, 0x0ae1, 0x0ce1, 0x0ec1, 0x4002, 0x4042,
+  0x0ea1, 0x00e1, 0x0e01, 0x0ee1
 };
 
-const USHORT HuffmanCodeBook_9[84][4] =
+const USHORT HuffmanCodeBook_9[696] =
 {
-  {0x0003,0x0003,0x0004,0x0008}, {0x0007,0x0007,0x0043,0x0043}, {0x0045,0x000c,0x0010,0x002c}, {0x0049,0x0085,0x0009,0x0081},
-  {0x0014,0x0018,0x001c,0x0020}, {0x004f,0x004f,0x008b,0x008b}, {0x00c7,0x00c7,0x000d,0x00c1}, {0x00c9,0x008d,0x0105,0x0051},
-  {0x0109,0x0145,0x0024,0x0028}, {0x0093,0x0093,0x00cf,0x00cf}, {0x0103,0x0103,0x0013,0x0013}, {0x0030,0x0044,0x0058,0x00a4},
-  {0x0034,0x0038,0x003c,0x0040}, {0x0057,0x0057,0x014b,0x014b}, {0x0187,0x0187,0x010f,0x010f}, {0x0097,0x0097,0x005b,0x005b},
-  {0x00d3,0x00d3,0x0141,0x0189}, {0x0048,0x004c,0x0050,0x0054}, {0x0015,0x01c5,0x014d,0x0205}, {0x0061,0x0111,0x00d5,0x0099},
-  {0x005d,0x0181,0x00a1,0x0209}, {0x018d,0x01c9,0x0151,0x0065}, {0x005c,0x0068,0x007c,0x0090}, {0x0245,0x009d,0x0060,0x0064},
-  {0x001b,0x001b,0x0117,0x0117}, {0x00db,0x00db,0x00e3,0x00e3}, {0x006c,0x0070,0x0074,0x0078}, {0x01c3,0x01c3,0x00a7,0x00a7},
-  {0x020f,0x020f,0x0193,0x0193}, {0x01cf,0x01cf,0x0203,0x0203}, {0x006b,0x006b,0x011b,0x011b}, {0x0080,0x0084,0x0088,0x008c},
-  {0x024b,0x024b,0x0157,0x0157}, {0x0023,0x0023,0x001f,0x001f}, {0x00df,0x00df,0x00ab,0x00ab}, {0x00e7,0x00e7,0x0123,0x0123},
-  {0x0094,0x0098,0x009c,0x00a0}, {0x0287,0x0287,0x011f,0x011f}, {0x015b,0x015b,0x0197,0x0197}, {0x0213,0x0213,0x01d3,0x01d3},
-  {0x024f,0x024f,0x006f,0x006f}, {0x00a8,0x00bc,0x00d0,0x00f4}, {0x00ac,0x00b0,0x00b4,0x00b8}, {0x0217,0x0217,0x0027,0x0027},
-  {0x0163,0x0163,0x00e9,0x0289}, {0x0241,0x00ad,0x0125,0x0199}, {0x0071,0x0251,0x01a1,0x02c5}, {0x00c0,0x00c4,0x00c8,0x00cc},
-  {0x0165,0x0129,0x01d5,0x015d}, {0x02c9,0x0305,0x00b1,0x00ed}, {0x028d,0x0255,0x01d9,0x01e1}, {0x012d,0x0281,0x019d,0x00f1},
-  {0x00d4,0x00d8,0x00dc,0x00e0}, {0x0029,0x0169,0x0291,0x0219}, {0x0309,0x01a5,0x01e5,0x02d1}, {0x002d,0x0259,0x02cd,0x0295},
-  {0x00e4,0x00e8,0x00ec,0x00f0}, {0x0223,0x0223,0x021f,0x021f}, {0x0173,0x0173,0x030f,0x030f}, {0x016f,0x016f,0x01df,0x01df},
-  {0x0133,0x0133,0x01af,0x01af}, {0x00f8,0x010c,0x0120,0x0134}, {0x00fc,0x0100,0x0104,0x0108}, {0x01ab,0x01ab,0x0313,0x0313},
-  {0x025f,0x025f,0x02d7,0x02d7}, {0x02c3,0x02c3,0x01b3,0x01b3}, {0x029b,0x029b,0x0033,0x0033}, {0x0110,0x0114,0x0118,0x011c},
-  {0x01eb,0x01eb,0x0317,0x0317}, {0x029f,0x029f,0x0227,0x0227}, {0x0303,0x0303,0x01ef,0x01ef}, {0x0263,0x0263,0x0267,0x0267},
-  {0x0124,0x0128,0x012c,0x0130}, {0x022b,0x022b,0x02df,0x02df}, {0x01f3,0x01f3,0x02db,0x02db}, {0x02e3,0x02e3,0x022f,0x022f},
-  {0x031f,0x031f,0x031b,0x031b}, {0x0138,0x013c,0x0140,0x0144}, {0x02a1,0x0269,0x0321,0x02a5}, {0x02e5,0x0325,0x02e9,0x0271},
-  {0x02a9,0x026d,0x0231,0x02ad}, {0x02b1,0x02f1,0x0148,0x014c}, {0x032b,0x032b,0x02ef,0x02ef}, {0x032f,0x032f,0x0333,0x0333}
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d, 0x020d,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247, 0x0247,
+  0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+  0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+  0x0265, 0x0265, 0x0265, 0x0265, 0x0445, 0x0445, 0x0445, 0x0445,
+  0x0625, 0x0625, 0x0625, 0x0625, 0x0063, 0x0063, 0x0603, 0x0603,
+  0x0643, 0x0643, 0x0463, 0x0463, 0x0823, 0x0823, 0x0283, 0x0283,
+  0x0843, 0x0843, 0x0a23, 0x0a23, 0x0481, 0x0661, 0x0801, 0x0081,
+  0x02a1, 0x0a41, 0x0c21, 0x0861, 0x04a1, 0x02c1, 0x0681, 0x4002,
+  0x4042, 0x4082, 0x40c2, 0x4102, 0x4142, 0x4182, 0x41c2, 0x4202,
+  0x4242, 0x4284, 0x4304, 0x4384, 0x4404, 0x4484, 0x4504, 0x4584,
+  0x4606, 0x4706, 0x4806, 0x4906, 0x4a06, 0x4b08, 0x4d08, 0x4f0c,
+  0x0a01, 0x0c41, 0x00a1, 0x0e21, 0x0a61, 0x1021, 0x0301, 0x0881,
+  0x06a1, 0x04c1, 0x02e1, 0x0c01, 0x0501, 0x1041, 0x0c61, 0x0e41,
+  0x0a81, 0x0321, 0x1221, 0x04e1, 0x00c1, 0x08a1, 0x06c1, 0x0701,
+  0x0e01, 0x0521, 0x1061, 0x0c81, 0x0e61, 0x1001, 0x0341, 0x08c1,
+  0x1241, 0x0aa1, 0x0101, 0x00e1, 0x06e1, 0x0541, 0x0721, 0x0901,
+  0x1421, 0x08e1, 0x0ac1, 0x0ca1, 0x1081, 0x0e81, 0x1261, 0x0361,
+  0x10a3, 0x10a3, 0x0123, 0x0123, 0x0b03, 0x0b03, 0x0741, 0x1441,
+  0x1201, 0x0561, 0x0921, 0x0cc1, 0x0381, 0x1281, 0x0d01, 0x1621,
+  0x0b21, 0x0941, 0x0ea1, 0x0ae1, 0x1641, 0x1821, 0x0581, 0x0761,
+  0x1461, 0x12a1, 0x0ec1, 0x0f01, 0x0961, 0x1401, 0x0ce1, 0x0781,
+  0x0141, 0x0b41, 0x1481, 0x10c1, 0x1841, 0x0d21, 0x0f21, 0x1681,
+  0x0163, 0x0163, 0x12c3, 0x12c3, 0x1663, 0x1663, 0x14a3, 0x14a3,
+  0x1101, 0x10e1, 0x0b81, 0x1861, 0x0b61, 0x0ee1, 0x0981, 0x0d61,
+  0x0d41, 0x1881, 0x12e1, 0x16a1, 0x1601, 0x0d81, 0x14c1, 0x0181,
+  0x0f41, 0x18a1, 0x14e1, 0x1121, 0x1801, 0x0f61, 0x1301, 0x1321,
+  0x1145, 0x1145, 0x1145, 0x1145, 0x16e5, 0x16e5, 0x16e5, 0x16e5,
+  0x0f85, 0x0f85, 0x0f85, 0x0f85, 0x16c5, 0x16c5, 0x16c5, 0x16c5,
+  0x1705, 0x1705, 0x1705, 0x1705, 0x1165, 0x1165, 0x1165, 0x1165,
+  0x18e5, 0x18e5, 0x18e5, 0x18e5, 0x18c5, 0x18c5, 0x18c5, 0x18c5,
+  0x1503, 0x1503, 0x1343, 0x1343, 0x1903, 0x1903, 0x1523, 0x1523,
+  0x1723, 0x1723, 0x1923, 0x1923, 0x1743, 0x1743, 0x1383, 0x1383,
+  0x1543, 0x1543, 0x1363, 0x1363, 0x1183, 0x1183, 0x1563, 0x1563,
+  0x1583, 0x1583, 0x1783, 0x1783, 0x1941, 0x1761, 0x1961, 0x1981
 };
 
-const USHORT HuffmanCodeBook_10[82][4] =
+const USHORT HuffmanCodeBook_10[584] =
 {
-  {0x0004,0x000c,0x0020,0x004c}, {0x0045,0x0085,0x0049,0x0008}, {0x008b,0x008b,0x0007,0x0007}, {0x0010,0x0014,0x0018,0x001c},
-  {0x0043,0x0043,0x00c7,0x00c7}, {0x008f,0x008f,0x004f,0x004f}, {0x00cb,0x00cb,0x00cf,0x00cf}, {0x0009,0x0081,0x0109,0x0091},
-  {0x0024,0x0028,0x002c,0x0038}, {0x0105,0x0051,0x0001,0x00d1}, {0x010d,0x000d,0x00c1,0x0111}, {0x0149,0x0095,0x0030,0x0034},
-  {0x0147,0x0147,0x0057,0x0057}, {0x00d7,0x00d7,0x014f,0x014f}, {0x003c,0x0040,0x0044,0x0048}, {0x0117,0x0117,0x0153,0x0153},
-  {0x009b,0x009b,0x018b,0x018b}, {0x00db,0x00db,0x0013,0x0013}, {0x005b,0x005b,0x0103,0x0103}, {0x0050,0x0064,0x0078,0x00c0},
-  {0x0054,0x0058,0x005c,0x0060}, {0x0187,0x0187,0x018f,0x018f}, {0x0157,0x0157,0x011b,0x011b}, {0x0193,0x0193,0x0159,0x009d},
-  {0x01cd,0x01c9,0x0195,0x00a1}, {0x0068,0x006c,0x0070,0x0074}, {0x00dd,0x0015,0x005d,0x0141}, {0x0061,0x01c5,0x00e1,0x011d},
-  {0x01d1,0x0209,0x0199,0x015d}, {0x0205,0x020d,0x0121,0x0211}, {0x007c,0x0084,0x0098,0x00ac}, {0x01d5,0x0161,0x0215,0x0080},
-  {0x019f,0x019f,0x01db,0x01db}, {0x0088,0x008c,0x0090,0x0094}, {0x00a7,0x00a7,0x001b,0x001b}, {0x021b,0x021b,0x00e7,0x00e7},
-  {0x024f,0x024f,0x0067,0x0067}, {0x024b,0x024b,0x0183,0x0183}, {0x009c,0x00a0,0x00a4,0x00a8}, {0x01a3,0x01a3,0x0127,0x0127},
-  {0x0253,0x0253,0x00ab,0x00ab}, {0x0247,0x0247,0x01df,0x01df}, {0x01e3,0x01e3,0x0167,0x0167}, {0x00b0,0x00b4,0x00b8,0x00bc},
-  {0x021f,0x021f,0x00eb,0x00eb}, {0x0257,0x0257,0x012b,0x012b}, {0x028b,0x028b,0x006b,0x006b}, {0x028f,0x028f,0x01a7,0x01a7},
-  {0x00c4,0x00d8,0x00ec,0x0100}, {0x00c8,0x00cc,0x00d0,0x00d4}, {0x025b,0x025b,0x0023,0x0023}, {0x0293,0x0293,0x001f,0x001f},
-  {0x00af,0x00af,0x025d,0x00ed}, {0x01a9,0x0285,0x006d,0x01e5}, {0x00dc,0x00e0,0x00e4,0x00e8}, {0x01c1,0x0221,0x0169,0x02cd},
-  {0x0295,0x0261,0x016d,0x0201}, {0x012d,0x02c9,0x029d,0x0299}, {0x01e9,0x02d1,0x02c5,0x00b1}, {0x00f0,0x00f4,0x00f8,0x00fc},
-  {0x0225,0x00f1,0x01ad,0x02d5}, {0x0131,0x01ed,0x0171,0x030d}, {0x02d9,0x0025,0x0229,0x0029}, {0x0071,0x0241,0x0311,0x0265},
-  {0x0104,0x010c,0x0120,0x0134}, {0x01b1,0x0309,0x02a1,0x0108}, {0x02a7,0x02a7,0x0307,0x0307}, {0x0110,0x0114,0x0118,0x011c},
-  {0x022f,0x022f,0x01f3,0x01f3}, {0x02df,0x02df,0x0317,0x0317}, {0x031b,0x031b,0x026b,0x026b}, {0x02e3,0x02e3,0x0233,0x0233},
-  {0x0124,0x0128,0x012c,0x0130}, {0x0283,0x0283,0x031f,0x031f}, {0x002f,0x002f,0x02ab,0x02ab}, {0x026f,0x026f,0x02af,0x02af},
-  {0x02c3,0x02c3,0x02ef,0x02ef}, {0x0138,0x013c,0x0140,0x0144}, {0x02e7,0x02e7,0x02eb,0x02eb}, {0x0033,0x0033,0x0323,0x0323},
-  {0x0271,0x0329,0x0325,0x032d}, {0x02f1,0x0301,0x02b1,0x0331}
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
+  0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449,
+  0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209,
+  0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0209,
+  0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629,
+  0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629, 0x0629,
+  0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469,
+  0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469, 0x0469,
+  0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269,
+  0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269, 0x0269,
+  0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649,
+  0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649,
+  0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669,
+  0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669, 0x0669,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+  0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407,
+  0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847,
+  0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487,
+  0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827,
+  0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287, 0x0287,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687, 0x0687,
+  0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867,
+  0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067,
+  0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607, 0x0607,
+  0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887, 0x0887,
+  0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47, 0x0a47,
+  0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7, 0x04a7,
+  0x0a25, 0x0a25, 0x0a25, 0x0a25, 0x02a5, 0x02a5, 0x02a5, 0x02a5,
+  0x06a5, 0x06a5, 0x06a5, 0x06a5, 0x0a65, 0x0a65, 0x0a65, 0x0a65,
+  0x08a5, 0x08a5, 0x08a5, 0x08a5, 0x0a85, 0x0a85, 0x0a85, 0x0a85,
+  0x04c5, 0x04c5, 0x04c5, 0x04c5, 0x0c45, 0x0c45, 0x0c45, 0x0c45,
+  0x06c5, 0x06c5, 0x06c5, 0x06c5, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x02c5, 0x02c5, 0x02c5, 0x02c5, 0x0805, 0x0805, 0x0805, 0x0805,
+  0x0c25, 0x0c25, 0x0c25, 0x0c25, 0x0c65, 0x0c65, 0x0c65, 0x0c65,
+  0x0aa5, 0x0aa5, 0x0aa5, 0x0aa5, 0x08c5, 0x08c5, 0x08c5, 0x08c5,
+  0x0c85, 0x0c85, 0x0c85, 0x0c85, 0x0ac3, 0x0ac3, 0x04e3, 0x04e3,
+  0x0e63, 0x0e63, 0x0e43, 0x0e43, 0x0ca3, 0x0ca3, 0x0503, 0x0503,
+  0x06e3, 0x06e3, 0x00a3, 0x00a3, 0x02e3, 0x02e3, 0x0a03, 0x0a03,
+  0x0303, 0x0303, 0x0e23, 0x0e23, 0x0703, 0x0703, 0x08e3, 0x08e3,
+  0x0e83, 0x0e83, 0x1043, 0x1043, 0x0cc3, 0x0cc3, 0x0ae3, 0x0ae3,
+  0x1023, 0x1023, 0x1063, 0x1063, 0x0903, 0x0903, 0x1083, 0x1083,
+  0x0ea3, 0x0ea3, 0x0b03, 0x0b03, 0x10a3, 0x10a3, 0x0ce1, 0x0ec1,
+  0x0521, 0x00c1, 0x10c1, 0x0721, 0x1261, 0x0321, 0x1241, 0x0c01,
+  0x0d01, 0x0921, 0x1281, 0x0541, 0x1221, 0x0ee1, 0x0f01, 0x0b21,
+  0x10e1, 0x0741, 0x12a1, 0x0941, 0x1441, 0x0341, 0x1461, 0x0d21,
+  0x12c1, 0x0101, 0x1481, 0x00e1, 0x0561, 0x4002, 0x4042, 0x4082,
+  0x40c2, 0x4102, 0x4142, 0x4182, 0x41c2, 0x4202, 0x4242, 0x4282,
+  0x42c2, 0x4302, 0x4342, 0x4382, 0x43c2, 0x4402, 0x4442, 0x4482,
+  0x44c2, 0x4504, 0x4584, 0x4604, 0x4684, 0x4704, 0x4784, 0x4806,
+  0x12e1, 0x0761, 0x0d41, 0x1421, 0x0361, 0x0f21, 0x0e01, 0x1101,
+  0x0b41, 0x1661, 0x14a1, 0x1301, 0x0b61, 0x1001, 0x0961, 0x1641,
+  0x14e1, 0x14c1, 0x0f41, 0x1681, 0x1621, 0x0581, 0x1121, 0x0781,
+  0x0d61, 0x16a1, 0x0981, 0x0f61, 0x0b81, 0x1861, 0x16c1, 0x0121,
+  0x1141, 0x0141, 0x0381, 0x1201, 0x1881, 0x1321, 0x0d81, 0x1841,
+  0x1503, 0x1503, 0x1521, 0x1821, 0x1161, 0x0f81, 0x16e1, 0x18a1,
+  0x18c1, 0x1341, 0x1701, 0x1181, 0x1401, 0x18e1, 0x0161, 0x1541,
+  0x1361, 0x1561, 0x1601, 0x1761, 0x1721, 0x1741, 0x0181, 0x1901,
+  0x1381, 0x1941, 0x1921, 0x1961, 0x1781, 0x1801, 0x1581, 0x1981
 };
 
-const USHORT HuffmanCodeBook_11[152][4] =
+const USHORT HuffmanCodeBook_11[658] =
 {
-  {0x0004,0x0010,0x0038,0x008c}, {0x0001,0x0085,0x0008,0x000c}, {0x0843,0x0843,0x0007,0x0007}, {0x0083,0x0083,0x008b,0x008b},
-  {0x0014,0x0018,0x001c,0x0024}, {0x0107,0x0107,0x010b,0x010b}, {0x0185,0x008d,0x010d,0x0009}, {0x0189,0x0101,0x018d,0x0020},
-  {0x0093,0x0093,0x0207,0x0207}, {0x0028,0x002c,0x0030,0x0034}, {0x0113,0x0113,0x020b,0x020b}, {0x0193,0x0193,0x020f,0x020f},
-  {0x000f,0x000f,0x0183,0x0183}, {0x0097,0x0097,0x0117,0x0117}, {0x003c,0x0050,0x0064,0x0078}, {0x0040,0x0044,0x0048,0x004c},
-  {0x028b,0x028b,0x0213,0x0213}, {0x0287,0x0287,0x0197,0x0197}, {0x028f,0x028f,0x0217,0x0217}, {0x0291,0x0119,0x0309,0x0099},
-  {0x0054,0x0058,0x005c,0x0060}, {0x0199,0x030d,0x0305,0x0811}, {0x080d,0x02c1,0x01c1,0x0241}, {0x0219,0x0341,0x0011,0x0311},
-  {0x0201,0x0809,0x0295,0x0815}, {0x0068,0x006c,0x0070,0x0074}, {0x03c1,0x0141,0x0441,0x0389}, {0x011d,0x038d,0x0299,0x0315},
-  {0x0819,0x0541,0x019d,0x009d}, {0x04c1,0x081d,0x0805,0x0385}, {0x007c,0x0080,0x0084,0x0088}, {0x0391,0x05c1,0x021d,0x0641},
-  {0x0821,0x00c1,0x0319,0x0825}, {0x0409,0x0395,0x0829,0x06c1}, {0x01a1,0x0121,0x040d,0x0015}, {0x0090,0x00c8,0x011c,0x0170},
-  {0x0094,0x0098,0x00a0,0x00b4}, {0x0741,0x082d,0x029d,0x0411}, {0x0399,0x031d,0x0281,0x009c}, {0x0223,0x0223,0x07c3,0x07c3},
-  {0x00a4,0x00a8,0x00ac,0x00b0}, {0x0833,0x0833,0x0407,0x0407}, {0x00a3,0x00a3,0x083b,0x083b}, {0x0417,0x0417,0x0837,0x0837},
-  {0x048f,0x048f,0x02a3,0x02a3}, {0x00b8,0x00bc,0x00c0,0x00c4}, {0x039f,0x039f,0x048b,0x048b}, {0x0323,0x0323,0x0127,0x0127},
-  {0x01a7,0x01a7,0x083f,0x083f}, {0x0493,0x0493,0x041b,0x041b}, {0x00cc,0x00e0,0x00f4,0x0108}, {0x00d0,0x00d4,0x00d8,0x00dc},
-  {0x001b,0x001b,0x0227,0x0227}, {0x0497,0x0497,0x03a3,0x03a3}, {0x041f,0x041f,0x0487,0x0487}, {0x01ab,0x01ab,0x0303,0x0303},
-  {0x00e4,0x00e8,0x00ec,0x00f0}, {0x012b,0x012b,0x00a7,0x00a7}, {0x02a7,0x02a7,0x0513,0x0513}, {0x050b,0x050b,0x0327,0x0327},
-  {0x050f,0x050f,0x049b,0x049b}, {0x00f8,0x00fc,0x0100,0x0104}, {0x022b,0x022b,0x0423,0x0423}, {0x02ab,0x02ab,0x03a7,0x03a7},
-  {0x01af,0x01af,0x0507,0x0507}, {0x001f,0x001f,0x032b,0x032b}, {0x010c,0x0110,0x0114,0x0118}, {0x049f,0x049f,0x058f,0x058f},
-  {0x0517,0x0517,0x00ab,0x00ab}, {0x0593,0x0593,0x012f,0x012f}, {0x0137,0x0137,0x051b,0x051b}, {0x0120,0x0134,0x0148,0x015c},
-  {0x0124,0x0128,0x012c,0x0130}, {0x01b7,0x01b7,0x058b,0x058b}, {0x0043,0x0043,0x0597,0x0597}, {0x02af,0x02af,0x022d,0x0425},
-  {0x051d,0x04a1,0x0801,0x0691}, {0x0138,0x013c,0x0140,0x0144}, {0x0381,0x068d,0x032d,0x00b5}, {0x0235,0x01b1,0x0689,0x02b5},
-  {0x0521,0x0599,0x0429,0x03a9}, {0x0139,0x0231,0x0585,0x0611}, {0x014c,0x0150,0x0154,0x0158}, {0x00ad,0x060d,0x0685,0x0131},
-  {0x059d,0x070d,0x0615,0x0695}, {0x0239,0x0711,0x03ad,0x01b9}, {0x02b1,0x0335,0x0331,0x0021}, {0x0160,0x0164,0x0168,0x016c},
-  {0x042d,0x0609,0x04a5,0x02b9}, {0x0699,0x0529,0x013d,0x05a1}, {0x0525,0x0339,0x04a9,0x0715}, {0x04ad,0x00b9,0x0709,0x0619},
-  {0x0174,0x0188,0x019c,0x01cc}, {0x0178,0x017c,0x0180,0x0184}, {0x0605,0x0435,0x0401,0x03b5}, {0x061d,0x03b1,0x069d,0x01bd},
-  {0x00b1,0x0719,0x0789,0x02bd}, {0x023d,0x0705,0x05a5,0x0791}, {0x018c,0x0190,0x0194,0x0198}, {0x03b9,0x06a1,0x04b5,0x0621},
-  {0x0795,0x078d,0x05a9,0x052d}, {0x0431,0x033d,0x03bd,0x0721}, {0x00bd,0x071d,0x0025,0x0481}, {0x01a0,0x01a4,0x01a8,0x01b8},
-  {0x06a5,0x0625,0x04b1,0x0439}, {0x06a9,0x04b9,0x0531,0x0799}, {0x079d,0x01ac,0x01b0,0x01b4}, {0x0727,0x0727,0x043f,0x043f},
-  {0x05af,0x05af,0x072f,0x072f}, {0x0787,0x0787,0x062b,0x062b}, {0x01bc,0x01c0,0x01c4,0x01c8}, {0x072b,0x072b,0x05b7,0x05b7},
-  {0x0537,0x0537,0x06af,0x06af}, {0x062f,0x062f,0x07a3,0x07a3}, {0x05bb,0x05bb,0x0637,0x0637}, {0x01d0,0x01e4,0x01f8,0x020c},
-  {0x01d4,0x01d8,0x01dc,0x01e0}, {0x06b3,0x06b3,0x04bf,0x04bf}, {0x053b,0x053b,0x002b,0x002b}, {0x05b3,0x05b3,0x07a7,0x07a7},
-  {0x0503,0x0503,0x0633,0x0633}, {0x01e8,0x01ec,0x01f0,0x01f4}, {0x002f,0x002f,0x0733,0x0733}, {0x07ab,0x07ab,0x06b7,0x06b7},
-  {0x0683,0x0683,0x063b,0x063b}, {0x053f,0x053f,0x05bf,0x05bf}, {0x01fc,0x0200,0x0204,0x0208}, {0x07af,0x07af,0x06bb,0x06bb},
-  {0x0037,0x0037,0x0583,0x0583}, {0x0737,0x0737,0x063f,0x063f}, {0x06bf,0x06bf,0x07b3,0x07b3}, {0x0210,0x0214,0x0218,0x021c},
-  {0x003b,0x003b,0x073b,0x073b}, {0x07b7,0x07b7,0x0033,0x0033}, {0x07bb,0x07bb,0x0701,0x0601}, {0x073d,0x003d,0x0781,0x07bd},
-  {0x0118,0x0117,0x0100,0x0109}, {0x05a5,0x05a1,0x05b7,0x0513}, {0x08f9,0x08ff,0x0821,0x08ff}, {0x084f,0x08ff,0x08bc,0x08ff},
-  {0x0815,0x08ff,0x0837,0x08ff}, {0x080d,0x08ff,0x085f,0x08ff}, {0x084a,0x08ff,0x087d,0x08ff}, {0x08ff,0x08ff,0x08a8,0x08ff},
-  {0x0815,0x08ff,0x083f,0x08ff}, {0x0830,0x08ff,0x0894,0x08ff}, {0x08d4,0x08ff,0x0825,0x08ff}, {0x08ef,0x08ff,0x083f,0x08ff},
-  {0x0809,0x08ff,0x08fc,0x08ff}, {0x0842,0x08ff,0x08b3,0x08ff}, {0x070d,0x07a9,0x060e,0x06e2}, {0x06c7,0x06d0,0x04b2,0x0407}
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209,
+  0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209, 0x4209,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409,
+  0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409, 0x0409,
+  0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449,
+  0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449,
+  0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829,
+  0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829, 0x0829,
+  0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849,
+  0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849, 0x0849,
+  0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27, 0x0c27,
+  0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467, 0x0467,
+  0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867, 0x0867,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+  0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47, 0x0c47,
+  0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
+  0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67, 0x0c67,
+  0x0485, 0x0485, 0x0485, 0x0485, 0x1025, 0x1025, 0x1025, 0x1025,
+  0x0885, 0x0885, 0x0885, 0x0885, 0x1045, 0x1045, 0x1045, 0x1045,
+  0x0c85, 0x0c85, 0x0c85, 0x0c85, 0x1065, 0x1065, 0x1065, 0x1065,
+  0x0065, 0x0065, 0x0065, 0x0065, 0x0c05, 0x0c05, 0x0c05, 0x0c05,
+  0x04a5, 0x04a5, 0x04a5, 0x04a5, 0x08a5, 0x08a5, 0x08a5, 0x08a5,
+  0x1445, 0x1445, 0x1445, 0x1445, 0x1085, 0x1085, 0x1085, 0x1085,
+  0x1425, 0x1425, 0x1425, 0x1425, 0x0ca5, 0x0ca5, 0x0ca5, 0x0ca5,
+  0x1465, 0x1465, 0x1465, 0x1465, 0x10a5, 0x10a5, 0x10a5, 0x10a5,
+  0x1483, 0x1483, 0x08c3, 0x08c3, 0x1843, 0x1843, 0x04c3, 0x04c3,
+  0x0cc3, 0x0cc3, 0x1863, 0x1863, 0x1823, 0x1823, 0x4083, 0x4083,
+  0x4063, 0x4063, 0x1603, 0x1603, 0x0e03, 0x0e03, 0x1203, 0x1203,
+  0x10c3, 0x10c3, 0x1a03, 0x1a03, 0x0083, 0x0083, 0x1883, 0x1883,
+  0x1003, 0x1003, 0x4043, 0x4043, 0x14a3, 0x14a3, 0x40a3, 0x40a3,
+  0x1e03, 0x1e03, 0x0a03, 0x0a03, 0x2203, 0x2203, 0x1c43, 0x1c43,
+  0x08e3, 0x08e3, 0x1c63, 0x1c63, 0x14c3, 0x14c3, 0x18a3, 0x18a3,
+  0x40c3, 0x40c3, 0x2a03, 0x2a03, 0x0ce3, 0x0ce3, 0x04e3, 0x04e3,
+  0x2603, 0x2603, 0x40e3, 0x40e3, 0x4023, 0x4023, 0x1c23, 0x1c23,
+  0x1c83, 0x1c83, 0x2e03, 0x2e03, 0x10e3, 0x10e3, 0x3203, 0x3203,
+  0x4103, 0x4103, 0x0603, 0x0603, 0x18c3, 0x18c3, 0x4123, 0x4123,
+  0x2043, 0x2043, 0x1ca3, 0x1ca3, 0x4143, 0x4143, 0x3603, 0x3603,
+  0x0d03, 0x0d03, 0x0903, 0x0903, 0x2063, 0x2063, 0x00a3, 0x00a3,
+  0x3a03, 0x3a03, 0x4163, 0x4163, 0x14e3, 0x14e3, 0x2083, 0x2083,
+  0x1cc3, 0x1cc3, 0x18e3, 0x18e3, 0x1403, 0x1403, 0x1101, 0x3e01,
+  0x4181, 0x2021, 0x0501, 0x41c1, 0x20a1, 0x41a1, 0x2461, 0x1501,
+  0x1ce1, 0x2441, 0x1901, 0x0921, 0x0d21, 0x41e1, 0x2481, 0x20c1,
+  0x00c1, 0x1121, 0x24a1, 0x1d01, 0x20e1, 0x2421, 0x0d41, 0x1801,
+  0x0941, 0x0521, 0x1521, 0x2881, 0x2841, 0x1921, 0x2861, 0x24c1,
+  0x1141, 0x2101, 0x1541, 0x1d21, 0x0d61, 0x2821, 0x00e1, 0x1941,
+  0x24e1, 0x2c61, 0x28a1, 0x0541, 0x2c81, 0x0961, 0x09a1, 0x28c1,
+  0x0da1, 0x2c41, 0x0201, 0x2ca1, 0x1561, 0x4002, 0x4042, 0x4082,
+  0x40c2, 0x4102, 0x4142, 0x4182, 0x41c2, 0x4202, 0x4242, 0x4282,
+  0x42c2, 0x4302, 0x4342, 0x4382, 0x43c2, 0x4402, 0x4442, 0x4482,
+  0x44c2, 0x4502, 0x4542, 0x4582, 0x45c2, 0x4602, 0x4642, 0x4682,
+  0x46c2, 0x4702, 0x4742, 0x4782, 0x47c2, 0x4802, 0x4842, 0x4882,
+  0x48c2, 0x4902, 0x4942, 0x4982, 0x49c2, 0x4a02, 0x4a42, 0x4a82,
+  0x4ac2, 0x4b02, 0x4b42, 0x4b82, 0x4bc4, 0x4c44, 0x4cc4, 0x4d44,
+  0x4dc4, 0x4e44, 0x4ec4, 0x4f44, 0x4fc4, 0x5044, 0x50c4, 0x5146,
+  0x1161, 0x2121, 0x28e1, 0x2501, 0x4001, 0x3481, 0x1c01, 0x3461,
+  0x1961, 0x05a1, 0x11a1, 0x0d81, 0x3441, 0x15a1, 0x2901, 0x2cc1,
+  0x2141, 0x1d41, 0x09c1, 0x1181, 0x2c21, 0x3081, 0x0561, 0x3061,
+  0x3421, 0x0981, 0x2ce1, 0x3861, 0x30a1, 0x34a1, 0x11c1, 0x3881,
+  0x1d61, 0x0dc1, 0x1581, 0x19a1, 0x1981, 0x0101, 0x2161, 0x3041,
+  0x2521, 0x15c1, 0x34c1, 0x2941, 0x09e1, 0x2d01, 0x2921, 0x19c1,
+  0x2541, 0x38a1, 0x2561, 0x05c1, 0x3841, 0x30c1, 0x3021, 0x21a1,
+  0x2001, 0x1da1, 0x30e1, 0x1d81, 0x34e1, 0x0de1, 0x0581, 0x38c1,
+  0x3c41, 0x15e1, 0x11e1, 0x3821, 0x2d21, 0x3c81, 0x1dc1, 0x3501,
+  0x25a1, 0x3101, 0x3ca1, 0x3c61, 0x2d41, 0x2961, 0x2181, 0x19e1,
+  0x1de1, 0x3901, 0x05e1, 0x38e1, 0x0121, 0x2401, 0x3521, 0x3121,
+  0x2581, 0x21c1, 0x3541, 0x25c1, 0x2981, 0x3cc1, 0x3ce3, 0x3ce3,
+  0x3921, 0x21e1, 0x2d61, 0x3961, 0x3c21, 0x3141, 0x3941, 0x2da1,
+  0x29a1, 0x3561, 0x3161, 0x3d01, 0x2dc1, 0x31a1, 0x3581, 0x25e1,
+  0x29c1, 0x0141, 0x2d81, 0x3d21, 0x2801, 0x3181, 0x0161, 0x3981,
+  0x3d41, 0x35a1, 0x3401, 0x31c1, 0x29e1, 0x2de1, 0x3d61, 0x35c1,
+  0x01a1, 0x2c01, 0x39a1, 0x31e1, 0x35e1, 0x3d81, 0x01c1, 0x39c1,
+  0x3da1, 0x0181, 0x3dc3, 0x3dc3, 0x3801, 0x3001, 0x39e1, 0x01e1,
+  0x3c01, 0x3de1
 };
 
-
-const USHORT HuffmanCodeBook_SCL[65][4] =
+const USHORT HuffmanCodeBook_SCL[1554] =
 {
-  {0x00f3,0x00f3,0x0004,0x0008}, {0x00ef,0x00ef,0x00f5,0x00e9}, {0x00f9,0x000c,0x0010,0x0014}, {0x00e7,0x00e7,0x00ff,0x00ff},
-  {0x00e1,0x0101,0x00dd,0x0105}, {0x0018,0x001c,0x0020,0x0028}, {0x010b,0x010b,0x00db,0x00db}, {0x010f,0x010f,0x00d5,0x0111},
-  {0x00d1,0x0115,0x00cd,0x0024}, {0x011b,0x011b,0x00cb,0x00cb}, {0x002c,0x0030,0x0034,0x0040}, {0x00c7,0x00c7,0x011f,0x011f},
-  {0x0121,0x00c1,0x0125,0x00bd}, {0x0129,0x00b9,0x0038,0x003c}, {0x0133,0x0133,0x012f,0x012f}, {0x0137,0x0137,0x013b,0x013b},
-  {0x0044,0x0048,0x004c,0x0058}, {0x00b7,0x00b7,0x00af,0x00af}, {0x00b1,0x013d,0x00a9,0x00a5}, {0x0141,0x00a1,0x0050,0x0054},
-  {0x0147,0x0147,0x009f,0x009f}, {0x014b,0x014b,0x009b,0x009b}, {0x005c,0x0060,0x0064,0x0070}, {0x014f,0x014f,0x0095,0x008d},
-  {0x0155,0x0085,0x0091,0x0089}, {0x0151,0x0081,0x0068,0x006c}, {0x015f,0x015f,0x0167,0x0167}, {0x007b,0x007b,0x007f,0x007f},
-  {0x0074,0x0078,0x0080,0x00b0}, {0x0159,0x0075,0x0069,0x006d}, {0x0071,0x0061,0x0161,0x007c}, {0x0067,0x0067,0x005b,0x005b},
-  {0x0084,0x0088,0x008c,0x009c}, {0x005f,0x005f,0x0169,0x0055}, {0x004d,0x000d,0x0005,0x0009}, {0x0001,0x0090,0x0094,0x0098},
-  {0x018b,0x018b,0x018f,0x018f}, {0x0193,0x0193,0x0197,0x0197}, {0x019b,0x019b,0x01d7,0x01d7}, {0x00a0,0x00a4,0x00a8,0x00ac},
-  {0x0187,0x0187,0x016f,0x016f}, {0x0173,0x0173,0x0177,0x0177}, {0x017b,0x017b,0x017f,0x017f}, {0x0183,0x0183,0x01a3,0x01a3},
-  {0x00b4,0x00c8,0x00dc,0x00f0}, {0x00b8,0x00bc,0x00c0,0x00c4}, {0x01bf,0x01bf,0x01c3,0x01c3}, {0x01c7,0x01c7,0x01cb,0x01cb},
-  {0x01cf,0x01cf,0x01d3,0x01d3}, {0x01bb,0x01bb,0x01a7,0x01a7}, {0x00cc,0x00d0,0x00d4,0x00d8}, {0x01ab,0x01ab,0x01af,0x01af},
-  {0x01b3,0x01b3,0x01b7,0x01b7}, {0x01db,0x01db,0x001b,0x001b}, {0x0023,0x0023,0x0027,0x0027}, {0x00e0,0x00e4,0x00e8,0x00ec},
-  {0x002b,0x002b,0x0017,0x0017}, {0x019f,0x019f,0x01e3,0x01e3}, {0x01df,0x01df,0x0013,0x0013}, {0x001f,0x001f,0x003f,0x003f},
-  {0x00f4,0x00f8,0x00fc,0x0100}, {0x0043,0x0043,0x004b,0x004b}, {0x0053,0x0053,0x0047,0x0047}, {0x002f,0x002f,0x0033,0x0033},
-  {0x003b,0x003b,0x0037,0x0037}
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791, 0x0791,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d, 0x076d,
+  0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab,
+  0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab,
+  0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab,
+  0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab, 0x07ab,
+  0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b,
+  0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b,
+  0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b,
+  0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b, 0x074b,
+  0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb,
+  0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb,
+  0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb,
+  0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb, 0x07cb,
+  0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729,
+  0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729,
+  0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9,
+  0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9, 0x07e9,
+  0x0707, 0x0707, 0x0707, 0x0707, 0x0707, 0x0707, 0x0707, 0x0707,
+  0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
+  0x06e7, 0x06e7, 0x06e7, 0x06e7, 0x06e7, 0x06e7, 0x06e7, 0x06e7,
+  0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827, 0x0827,
+  0x0845, 0x0845, 0x0845, 0x0845, 0x06c5, 0x06c5, 0x06c5, 0x06c5,
+  0x0865, 0x0865, 0x0865, 0x0865, 0x06a3, 0x06a3, 0x0883, 0x0883,
+  0x0683, 0x0683, 0x08a3, 0x08a3, 0x0663, 0x0663, 0x08c1, 0x0641,
+  0x0621, 0x08e1, 0x4002, 0x4042, 0x4082, 0x40c4, 0x4146, 0x4254,
+  0x0901, 0x0601, 0x0921, 0x05e1, 0x0941, 0x05c1, 0x0981, 0x0961,
+  0x09a1, 0x09c1, 0x05a3, 0x05a3, 0x0563, 0x0563, 0x0581, 0x09e1,
+  0x0541, 0x0521, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f, 0x0a0f,
+  0x0a0f, 0x0a0f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f, 0x050f,
+  0x050f, 0x050f, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d, 0x0a2d,
+  0x0a2d, 0x0a2d, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04ed, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d, 0x0a4d,
+  0x0a4d, 0x0a4d, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd, 0x04cd,
+  0x04cd, 0x04cd, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d, 0x0a6d,
+  0x0a6d, 0x0a6d, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab,
+  0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab,
+  0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab,
+  0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab, 0x04ab,
+  0x04ab, 0x04ab, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b,
+  0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b,
+  0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b,
+  0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b, 0x046b,
+  0x046b, 0x046b, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
+  0x0aab, 0x0aab, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b, 0x042b,
+  0x042b, 0x042b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b,
+  0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b,
+  0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b,
+  0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b,
+  0x048b, 0x048b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b, 0x044b,
+  0x044b, 0x044b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b, 0x0a8b,
+  0x0a8b, 0x0a8b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b,
+  0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b,
+  0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b,
+  0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x040b,
+  0x040b, 0x040b, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9,
+  0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9, 0x0ae9,
+  0x0ae9, 0x0ae9, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29, 0x0b29,
+  0x0b29, 0x0b29, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9,
+  0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9,
+  0x03c9, 0x03c9, 0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9,
+  0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9, 0x03e9,
+  0x03e9, 0x03e9, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7, 0x0ac7,
+  0x0ac7, 0x0ac7, 0x03a7, 0x03a7, 0x03a7, 0x03a7, 0x03a7, 0x03a7,
+  0x03a7, 0x03a7, 0x0347, 0x0347, 0x0347, 0x0347, 0x0347, 0x0347,
+  0x0347, 0x0347, 0x0367, 0x0367, 0x0367, 0x0367, 0x0367, 0x0367,
+  0x0367, 0x0367, 0x0387, 0x0387, 0x0387, 0x0387, 0x0387, 0x0387,
+  0x0387, 0x0387, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+  0x0307, 0x0307, 0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07, 0x0b07,
+  0x0b07, 0x0b07, 0x0325, 0x0325, 0x0325, 0x0325, 0x02c5, 0x02c5,
+  0x02c5, 0x02c5, 0x02e5, 0x02e5, 0x02e5, 0x02e5, 0x0b43, 0x0b43,
+  0x02a3, 0x02a3, 0x0263, 0x0263, 0x0063, 0x0063, 0x0023, 0x0023,
+  0x0043, 0x0043, 0x0003, 0x0003, 0x0c41, 0x0c61, 0x0c81, 0x0ca1,
+  0x0cc1, 0x0ea1, 0x0c21, 0x0b61, 0x0b81, 0x0ba1, 0x0bc1, 0x0be1,
+  0x0c01, 0x0d01, 0x0de1, 0x0e01, 0x0e21, 0x0e41, 0x0e61, 0x0e81,
+  0x0dc1, 0x0d21, 0x0d41, 0x0d61, 0x0d81, 0x0da1, 0x0ec1, 0x00c1,
+  0x0101, 0x0121, 0x0141, 0x00a1, 0x0ce1, 0x0f01, 0x0ee1, 0x0081,
+  0x00e1, 0x01e1, 0x0201, 0x0241, 0x0281, 0x0221, 0x0161, 0x0181,
+  0x01c1, 0x01a1
 };
 
 
-
 /* .CodeBook = HuffmanCodeBook_x, .Dimension = 4, .numBits = 2, .Offset =  0  */
 const CodeBookDescription AACcodeBookDescriptionTable[13] = {
   { NULL, 0, 0,  0 },
@@ -124,13 +124,13 @@ extern const SFB_INFO sfbOffsetTables[5][16];
 
 /* Huffman tables */
 enum {
-  HuffmanBits = 2,
+  HuffmanBits = 9,                    /*!< Number of bits used to index the root lookup table. */
   HuffmanEntries = (1 << HuffmanBits)
 };
 
 typedef struct
 {
-  const USHORT (*CodeBook)[HuffmanEntries];
+  const USHORT *CodeBook;
   UCHAR Dimension;
   UCHAR numBits;
   UCHAR Offset;
@@ -842,6 +842,31 @@ static int aacDecoder_drcExtractAndMap (
 }
 
 
+/*!
+  \brief Update the DRC channel data of a frame which is not decoded
+
+  Advances the expiry counter exactly like aacDecoder_drcApply() does.
+
+  \self       Handle of DRC info
+  \pDrcChData Pointer to the DRC channel data
+
+  \return none
+*/
+void aacDecoder_drcSkip (
+        HANDLE_AAC_DRC          self,
+        CDrcChannelData        *pDrcChData )
+{
+  CDrcParams  *pParams = &self->params;
+
+  /* Increment and check expiry counter */
+  if ( (pParams->expiryFrame > 0)
+    && (++pDrcChData->expiryCount > pParams->expiryFrame) )
+  { /* The DRC data is too old, so delete it. */
+    aacDecoder_drcInitChannelData( pDrcChData );
+  }
+}
+
+
 void aacDecoder_drcApply (
         HANDLE_AAC_DRC          self,
         void                   *pSbrDec,
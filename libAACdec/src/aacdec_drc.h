@@ -165,6 +165,16 @@ void aacDecoder_drcApply (
         int  aacFrameSize,
         int  bSbrPresent );
 
+/**
+ * \brief Update the DRC channel data like aacDecoder_drcApply() without processing any spectral data.
+ *        Used for parse-only decoding.
+ * \param self AAC decoder instance
+ * \param pDrcDat DRC channel data
+ */
+void aacDecoder_drcSkip (
+        HANDLE_AAC_DRC          self,
+        CDrcChannelData        *pDrcDat );
+
 int aacDecoder_drcEpilog (
         HANDLE_AAC_DRC  self,
         HANDLE_FDK_BITSTREAM hBs,
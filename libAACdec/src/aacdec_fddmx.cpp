@@ -0,0 +1,459 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+
+/*****************************  MPEG-4 AAC Decoder  **************************
+
+   Author(s):
+   Description: downmix of MDCT spectra ahead of the inverse transform
+
+******************************************************************************/
+
+#include "aacdec_fddmx.h"
+
+#include "aacdecoder.h"
+#include "block.h"
+#include "genericStds.h"
+
+
+/* Guard bits for the accumulation of up to 8 channels */
+#define FDDMX_ACCU_HEADROOM  3
+/* Maximum downmix headroom that is handed to the limiter, see pcmDmx_ApplyFrame() */
+#define FDDMX_MAX_HEADROOM   3
+
+H_ALLOC_MEM (AacDecFdDmx, CAacDecFdDmx)
+C_ALLOC_MEM (AacDecFdDmx, CAacDecFdDmx, 1)
+
+
+/* Channel info holding the data of channel c (canonical order). */
+static CAacDecoderChannelInfo *fdDmxGetChannelInfo(HANDLE_AACDECODER self, const int c, const int aacChannels)
+{
+  return self->pAacDecoderChannelInfo[(self->chMapping[c] >= aacChannels) ? c : self->chMapping[c]];
+}
+
+/* Channel description in output buffer order as the time domain downmix gets it. */
+static void fdDmxGetChannelDescription(HANDLE_AACDECODER self,
+                                       const int aacChannels,
+                                       const int chOutMapIdx,
+                                       AUDIO_CHANNEL_TYPE types[],
+                                       UCHAR idx[],
+                                       UCHAR slot[])
+{
+  int c;
+
+  FDKmemcpy(types, self->channelType, (8)*sizeof(AUDIO_CHANNEL_TYPE));
+  FDKmemcpy(idx, self->channelIndices, (8)*sizeof(UCHAR));
+  for (c = 0; c < aacChannels; c++) {
+    slot[c] = self->channelOutputMapping[chOutMapIdx][c];
+    types[slot[c]] = self->channelType[c];
+    idx[slot[c]] = self->channelIndices[c];
+  }
+}
+
+/* Rebuild the overlap of all decoder channels from the last downmixed frame. */
+static void fdDmxLeave(HANDLE_AACDECODER self, CAacDecFdDmx *pFdDmx)
+{
+  FIXP_DBL *pTmp = self->aacCommonData.workBufferCore1->mdctOutTemp;
+  int c;
+
+  for (c = 0; c < pFdDmx->numInChannels; c++) {
+    H_MDCT hMdct = &self->pAacDecoderStaticChannelInfo[c]->IMdct;
+
+    /* The overlap written by the transform depends only on the spectrum and the state ahead of
+       the frame, but not on the previous overlap. The time output is dropped. */
+    FDKmemcpy(hMdct, &pFdDmx->prevMdct[c], sizeof(mdct_t));
+    CBlock_InverseTransform(hMdct,
+                           &pFdDmx->icsInfo[c],
+                            pFdDmx->spectrum[c],
+                            pFdDmx->specScale[c],
+                            pTmp,
+                            self->streamInfo.aacSamplesPerFrame);
+  }
+
+  pFdDmx->numInChannels = 0;
+}
+
+/* Check that the filter banks of all mixed channels are in the same state, so that the overlap of
+   the downmix is the downmix of the overlaps. Returns the first mixed channel or -1. */
+static int fdDmxGetReferenceState(HANDLE_AACDECODER self, const int aacChannels, const UINT mixedChannels)
+{
+  const mdct_t *pRef = NULL;
+  int c, ref = -1;
+
+  for (c = 0; c < aacChannels; c++) {
+    const mdct_t *pMdct = &self->pAacDecoderStaticChannelInfo[c]->IMdct;
+
+    if ( !(mixedChannels & (1<<c)) ) {
+      continue;
+    }
+    if (pRef == NULL) {
+      pRef = pMdct;
+      ref = c;
+    }
+    else if ( (pMdct->prev_wrs  != pRef->prev_wrs)
+           || (pMdct->prev_tl   != pRef->prev_tl)
+           || (pMdct->prev_nr   != pRef->prev_nr)
+           || (pMdct->prev_fr   != pRef->prev_fr)
+           || (pMdct->ov_offset != pRef->ov_offset)
+           || (pMdct->ov_size   != pRef->ov_size) ) {
+      return -1;
+    }
+  }
+
+  return ref;
+}
+
+/* Set up the output filter banks with the downmix of the decoder channel overlaps. */
+static void fdDmxEnter(HANDLE_AACDECODER self,
+                       CAacDecFdDmx *pFdDmx,
+                       const FIXP_DBL mixMatrix[][8],
+                       const UCHAR slot[],
+                       const int aacChannels,
+                       const int ref,
+                       const int numOutChannels,
+                       const int outScale)
+{
+  const mdct_t *pRef = &self->pAacDecoderStaticChannelInfo[ref]->IMdct;
+  int c, o, i;
+
+  for (o = 0; o < numOutChannels; o++) {
+    FIXP_DBL *pOut = pFdDmx->overlap[o];
+
+    mdct_init(&pFdDmx->IMdct[o], pOut, OverlapBufferSize);
+    pFdDmx->IMdct[o].prev_wrs  = pRef->prev_wrs;
+    pFdDmx->IMdct[o].prev_tl   = pRef->prev_tl;
+    pFdDmx->IMdct[o].prev_nr   = pRef->prev_nr;
+    pFdDmx->IMdct[o].prev_fr   = pRef->prev_fr;
+    pFdDmx->IMdct[o].ov_offset = pRef->ov_offset;
+
+    FDKmemclear(pOut, OverlapBufferSize*sizeof(FIXP_DBL));
+    for (c = 0; c < aacChannels; c++) {
+      const FIXP_DBL *pIn = self->pAacDecoderStaticChannelInfo[c]->pOverlapBuffer;
+      const FIXP_DBL  fac = mixMatrix[o][slot[c]];
+
+      if (fac == (FIXP_DBL)0) {
+        continue;
+      }
+      for (i = 0; i < OverlapBufferSize; i++) {
+        pOut[i] += fMult(pIn[i], fac) >> FDDMX_ACCU_HEADROOM;
+      }
+    }
+    for (i = 0; i < OverlapBufferSize; i++) {
+      pOut[i] = scaleValueSaturate(pOut[i], outScale + FDDMX_ACCU_HEADROOM);
+    }
+  }
+}
+
+/* Mix the saved input spectra into the spectral buffers of the output channels. */
+static void fdDmxMixSpectra(HANDLE_AACDECODER self,
+                            CAacDecFdDmx *pFdDmx,
+                            const FIXP_DBL mixMatrix[][8],
+                            const UCHAR slot[],
+                            const int aacChannels,
+                            const int ref,
+                            const int numOutChannels,
+                            const int outScale)
+{
+  const int frameLen = self->streamInfo.aacSamplesPerFrame;
+  const int nWindows = (pFdDmx->icsInfo[ref].WindowSequence == EightShortSequence) ? 8 : 1;
+  const int tl = frameLen / nWindows;
+  int c, o, w, i;
+
+  for (o = 0; o < numOutChannels; o++) {
+    CAacDecoderChannelInfo *pOutInfo = self->pAacDecoderChannelInfo[o];
+    FIXP_DBL *pOut = SPEC_LONG(pOutInfo->pSpectralCoefficient);
+
+    for (w = 0; w < nWindows; w++) {
+      FIXP_DBL *pOutWin = pOut + w*tl;
+      int maxScale = 0, numMixed = 0;
+
+      /* Align all contributions to the largest exponent of this window. */
+      for (c = 0; c < aacChannels; c++) {
+        if (mixMatrix[o][slot[c]] != (FIXP_DBL)0) {
+          maxScale = (numMixed == 0) ? pFdDmx->specScale[c][w] : fixMax(maxScale, (int)pFdDmx->specScale[c][w]);
+          numMixed++;
+        }
+      }
+
+      FDKmemclear(pOutWin, tl*sizeof(FIXP_DBL));
+      pOutInfo->specScale[w] = 0;
+      if (numMixed == 0) {
+        continue;
+      }
+
+      for (c = 0; c < aacChannels; c++) {
+        const FIXP_DBL  fac = mixMatrix[o][slot[c]];
+        const FIXP_DBL *pIn = pFdDmx->spectrum[c] + w*tl;
+        int shift;
+
+        if (fac == (FIXP_DBL)0) {
+          continue;
+        }
+        shift = fixMin(maxScale - pFdDmx->specScale[c][w] + FDDMX_ACCU_HEADROOM, DFRACT_BITS-1);
+        for (i = 0; i < tl; i++) {
+          pOutWin[i] += fMult(pIn[i], fac) >> shift;
+        }
+      }
+      pOutInfo->specScale[w] = maxScale + FDDMX_ACCU_HEADROOM + outScale;
+    }
+  }
+}
+
+int CAacDecoder_FdDmxApply(HANDLE_AACDECODER self,
+                           void *pTimeData,
+                           const int aacChannels,
+                           const int chOutMapIdx,
+                           const int interleaved,
+                           const UINT flags)
+{
+  CAacDecFdDmx *pFdDmx = self->pFdDmx;
+  const int frameLen = self->streamInfo.aacSamplesPerFrame;
+  const CIcsInfo *pRefIcsInfo = NULL;
+  FIXP_DBL  mixMatrix[(8)][8];
+  AUDIO_CHANNEL_TYPE types[(8)];
+  UCHAR idx[(8)];
+  UCHAR slot[(8)];
+  UINT  mixedChannels = 0;
+  INT   numOutChannels, maxOutChannels = 0, dmxScale = 0, bypScale;
+  int   c, o, i, ref;
+
+  if ( !self->fdDmxEnable
+    || self->sbrEnabled
+    || (self->flags & (AC_ELD|AC_USAC|AC_RSVD50))
+    || (flags & (AACDEC_FLUSH|AACDEC_INTR|AACDEC_CLRHIST)) ) {
+    goto bail;
+  }
+  if ( (pcmDmx_GetParam(self->hPcmUtils, MAX_NUMBER_OF_OUTPUT_CHANNELS, &maxOutChannels) != PCMDMX_OK)
+    || (maxOutChannels <= 0)
+    || (maxOutChannels >= aacChannels) ) {
+    goto bail;
+  }
+  for (c = 0; c < aacChannels; c++) {
+    if (fdDmxGetChannelInfo(self, c, aacChannels)->renderMode != AACDEC_RENDER_IMDCT) {
+      goto bail;
+    }
+  }
+
+  /* Check the downmix matrix of this frame without consuming the downmix meta data. */
+  fdDmxGetChannelDescription(self, aacChannels, chOutMapIdx, types, idx, slot);
+  numOutChannels = aacChannels;
+  if (pcmDmx_GetMixMatrix(self->hPcmUtils, &numOutChannels, types, idx,
+                          self->channelOutputMapping, mixMatrix, &dmxScale, 0) != PCMDMX_OK) {
+    goto bail;
+  }
+
+  /* All channels contributing to the output have to share the same window sequence and window shape.
+     Channels that are not mixed into the output (e.g. the LFE) are not transformed at all. */
+  for (c = 0; c < aacChannels; c++) {
+    const CIcsInfo *pIcsInfo = &fdDmxGetChannelInfo(self, c, aacChannels)->icsInfo;
+
+    for (o = 0; o < numOutChannels; o++) {
+      if (mixMatrix[o][slot[c]] != (FIXP_DBL)0) {
+        break;
+      }
+    }
+    if (o == numOutChannels) {
+      continue;
+    }
+    mixedChannels |= 1<<c;
+    if (pRefIcsInfo == NULL) {
+      pRefIcsInfo = pIcsInfo;
+    }
+    else if ( (pIcsInfo->WindowSequence != pRefIcsInfo->WindowSequence)
+           || (pIcsInfo->WindowShape != pRefIcsInfo->WindowShape) ) {
+      goto bail;
+    }
+  }
+  if (mixedChannels == 0) {
+    goto bail;
+  }
+  bypScale = (self->limiterEnableCurr) ? fixMin(FDDMX_MAX_HEADROOM, dmxScale) : 0;
+
+  if (pFdDmx == NULL) {
+    pFdDmx = self->pFdDmx = GetAacDecFdDmx(0);
+    if (pFdDmx == NULL) {
+      goto bail;
+    }
+    pFdDmx->numInChannels = 0;
+  }
+  if ( (pFdDmx->numInChannels > 0)
+    && ( (pFdDmx->numInChannels  != aacChannels)
+      || (pFdDmx->numOutChannels != numOutChannels)
+      || (pFdDmx->mixedChannels  != mixedChannels)
+      || (pFdDmx->bypScale       != bypScale) ) ) {
+    fdDmxLeave(self, pFdDmx);
+  }
+  ref = fdDmxGetReferenceState(self, aacChannels, mixedChannels);
+  if ( (pFdDmx->numInChannels == 0) && (ref < 0) ) {
+    goto bail;
+  }
+
+  /* Now consume the downmix meta data for this frame. */
+  fdDmxGetChannelDescription(self, aacChannels, chOutMapIdx, types, idx, slot);
+  numOutChannels = aacChannels;
+  if (pcmDmx_GetMixMatrix(self->hPcmUtils, &numOutChannels, types, idx,
+                          self->channelOutputMapping, mixMatrix, &dmxScale, 1) != PCMDMX_OK) {
+    goto bail;
+  }
+
+  if (pFdDmx->numInChannels == 0) {
+    fdDmxEnter(self, pFdDmx, mixMatrix, slot, aacChannels, ref, numOutChannels, dmxScale - bypScale);
+    pFdDmx->numOutChannels = numOutChannels;
+    pFdDmx->mixedChannels  = mixedChannels;
+    pFdDmx->bypScale       = bypScale;
+  }
+
+  /* Keep the input spectra and advance the channel filter banks to be able to rebuild their overlap. */
+  for (c = 0; c < aacChannels; c++) {
+    const CAacDecoderChannelInfo *pInfo = fdDmxGetChannelInfo(self, c, aacChannels);
+    H_MDCT hMdct = &self->pAacDecoderStaticChannelInfo[c]->IMdct;
+
+    FDKmemcpy(pFdDmx->spectrum[c], SPEC_LONG(pInfo->pSpectralCoefficient), frameLen*sizeof(FIXP_DBL));
+    FDKmemcpy(pFdDmx->specScale[c], pInfo->specScale, 8*sizeof(SHORT));
+    FDKmemcpy(&pFdDmx->icsInfo[c], &pInfo->icsInfo, sizeof(CIcsInfo));
+    FDKmemcpy(&pFdDmx->prevMdct[c], hMdct, sizeof(mdct_t));
+    CBlock_InverseTransformSkip(hMdct, &pInfo->icsInfo, frameLen);
+  }
+  pFdDmx->numInChannels = aacChannels;
+
+  for (ref = 0; !(mixedChannels & (1<<ref)); ref++);
+  fdDmxMixSpectra(self, pFdDmx, mixMatrix, slot, aacChannels, ref, numOutChannels, dmxScale - bypScale);
+
+  /* Inverse transform of the output channels only */
+  for (o = 0; o < numOutChannels; o++) {
+    FIXP_DBL *pTmp = self->aacCommonData.workBufferCore1->mdctOutTemp;
+    const int stride = (interleaved) ? numOutChannels : 1;
+    const int offset = (interleaved) ? o : o*frameLen;
+
+    CBlock_InverseTransform(&pFdDmx->IMdct[o],
+                            &pFdDmx->icsInfo[ref],
+                             SPEC_LONG(self->pAacDecoderChannelInfo[o]->pSpectralCoefficient),
+                             self->pAacDecoderChannelInfo[o]->specScale,
+                             pTmp,
+                             frameLen);
+
+    if (self->pcmOutputFormat != AACDEC_PCM_S16) {
+      FIXP_DBL *pOut = (FIXP_DBL*)pTimeData + offset;
+      for (i = 0; i < frameLen; i++) {
+        pOut[i*stride] = IMDCT_SCALE_32(pTmp[i]);
+      }
+    } else {
+      INT_PCM *pOut = (INT_PCM*)pTimeData + offset;
+      for (i = 0; i < frameLen; i++) {
+        pOut[i*stride] = IMDCT_SCALE(pTmp[i]);
+      }
+    }
+  }
+
+  FDKmemcpy(self->channelType, types, sizeof(types));
+  FDKmemcpy(self->channelIndices, idx, sizeof(idx));
+  self->fdDmxChannels = numOutChannels;
+  self->fdDmxOutScale = bypScale;
+
+  return 1;
+
+bail:
+  if ( (pFdDmx != NULL) && (pFdDmx->numInChannels > 0) ) {
+    fdDmxLeave(self, pFdDmx);
+  }
+  return 0;
+}
+
+void CAacDecoder_FdDmxReset(CAacDecFdDmx *pFdDmx)
+{
+  if (pFdDmx != NULL) {
+    pFdDmx->numInChannels = 0;
+  }
+}
+
+void CAacDecoder_FdDmxClose(CAacDecFdDmx **ppFdDmx)
+{
+  if (*ppFdDmx != NULL) {
+    FreeAacDecFdDmx(ppFdDmx);
+  }
+}
+
+UINT CAacDecoder_FdDmxGetRequiredMemory(void)
+{
+  return FDKarenaGetBlockSize(GetRequiredMemAacDecFdDmx());
+}
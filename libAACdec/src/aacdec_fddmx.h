@@ -0,0 +1,161 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+
+/*****************************  MPEG-4 AAC Decoder  **************************
+
+   Author(s):
+   Description: downmix of MDCT spectra ahead of the inverse transform
+
+******************************************************************************/
+
+#ifndef AACDEC_FDDMX_H
+#define AACDEC_FDDMX_H
+
+#include "aacdecoder_lib.h"
+#include "channelinfo.h"
+#include "overlapadd.h"
+#include "mdct.h"
+
+
+/*!
+  \brief State of the frequency domain downmix.
+
+  The downmix matrix of the PCM downmix module is applied to the spectra of all channels and only
+  the output channels are transformed. Meanwhile the filter banks of the decoder channels are only
+  advanced without computing their overlap. The spectra of the last downmixed frame are kept to
+  rebuild the overlap when the decoder has to fall back to the time domain downmix.
+*/
+typedef struct
+{
+  FIXP_DBL   spectrum[(8)][1024];      /*!< Spectra of the last downmixed frame in canonical channel order. */
+  SHORT      specScale[(8)][8];        /*!< Window exponents of the last downmixed frame. */
+  CIcsInfo   icsInfo[(8)];             /*!< Window sequence and shape of the last downmixed frame. */
+  mdct_t     prevMdct[(8)];            /*!< Filter bank state of each channel ahead of the last downmixed frame. */
+  INT        numInChannels;            /*!< Channels of the last downmixed frame, 0 if it was not downmixed. */
+  INT        numOutChannels;           /*!< Output channels of the last downmixed frame. */
+  INT        bypScale;                 /*!< Downmix headroom handed to the limiter. */
+  UINT       mixedChannels;            /*!< Bit mask of the channels contributing to the output. */
+
+  mdct_t     IMdct[(8)];               /*!< Filter bank states of the output channels. */
+  FIXP_DBL   overlap[(8)][OverlapBufferSize]; /*!< Overlap buffers of the output channels. */
+
+} CAacDecFdDmx;
+
+/**
+ * \brief Downmix the spectra of the current frame and transform the output channels into
+ *        pTimeData. Has to be called after concealment and DRC processing of all channels.
+ * \param self         decoder handle.
+ * \param pTimeData    time output buffer, INT_PCM or FIXP_DBL samples depending on the output format.
+ * \param aacChannels  number of channels of the current frame.
+ * \param chOutMapIdx  line of the output channel mapping table used for the current frame.
+ * \param interleaved  1 if the time output has to be interleaved.
+ * \param flags        decoder flags of the current frame.
+ * \return 1 if the frame was downmixed and rendered, 0 if all channels have to be transformed
+ *         and mixed in time domain. The decoder channel filter banks are valid in that case.
+ */
+int CAacDecoder_FdDmxApply(HANDLE_AACDECODER self,
+                           void *pTimeData,
+                           const int aacChannels,
+                           const int chOutMapIdx,
+                           const int interleaved,
+                           const UINT flags);
+
+/**
+ * \brief Drop the downmix state after the decoder channel filter banks have been reset.
+ * \param pFdDmx  downmix state, may be NULL.
+ */
+void CAacDecoder_FdDmxReset(CAacDecFdDmx *pFdDmx);
+
+/**
+ * \brief Free the downmix state.
+ * \param ppFdDmx  pointer to the downmix state, set to NULL.
+ */
+void CAacDecoder_FdDmxClose(CAacDecFdDmx **ppFdDmx);
+
+/**
+ * \brief Get the arena memory of the downmix state, which is allocated on first use.
+ */
+UINT CAacDecoder_FdDmxGetRequiredMemory(void);
+
+#endif /* AACDEC_FDDMX_H */
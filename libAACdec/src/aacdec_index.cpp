@@ -0,0 +1,529 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+
+/*****************************  MPEG-4 AAC Decoder  **************************
+
+   Author(s):
+   Description: frame index of ADTS/LOAS streams for random access
+
+******************************************************************************/
+
+#include "aacdec_index.h"
+
+#include "genericStds.h"
+
+
+/* Initial size of the frame table, doubled whenever it runs full. */
+#define INDEX_INITIAL_ENTRIES  1024
+
+/* Serialized index: magic, version, header size. */
+#define INDEX_MAGIC            "FDKI"
+#define INDEX_VERSION          1
+#define INDEX_HEADER_BYTES     26
+
+H_ALLOC_MEM (AacDecFrameIndex, AACDEC_FRAME_INDEX)
+C_ALLOC_MEM (AacDecFrameIndex, AACDEC_FRAME_INDEX, 1)
+
+
+static INT aacDecoder_IndexConfigCallback(void *handle, const CSAudioSpecificConfig *pAscStruct)
+{
+  HANDLE_AACDEC_FRAME_INDEX hIndex = (HANDLE_AACDEC_FRAME_INDEX)handle;
+
+  hIndex->sampleRate   = pAscStruct->m_samplingFrequency;
+  hIndex->samplesPerAu = pAscStruct->m_samplesPerFrame;
+
+  return 0;
+}
+
+/**
+ * \brief Skip the SBR header embedded in an ELD specific config. The index only needs the
+ *        configuration to stay aligned with the bit stream, the header content is not used.
+ */
+static INT aacDecoder_IndexSbrCallback(
+        void *handle,
+        HANDLE_FDK_BITSTREAM hBs,
+        const INT sampleRateIn,
+        const INT sampleRateOut,
+        const INT samplesPerFrame,
+        const AUDIO_OBJECT_TYPE coreCodec,
+        const MP4_ELEMENT_ID elementID,
+        const INT elementIndex
+        )
+{
+  INT headerExtra1, headerExtra2;
+
+  FDKpushFor(hBs, 1+4+4+3+2);  /* amp_res, start_freq, stop_freq, xover_band, reserved */
+  headerExtra1 = FDKreadBits(hBs, 1);
+  headerExtra2 = FDKreadBits(hBs, 1);
+  if (headerExtra1) {
+    FDKpushFor(hBs, 2+1+2);    /* freq_scale, alter_scale, noise_bands */
+  }
+  if (headerExtra2) {
+    FDKpushFor(hBs, 2+2+1+1);  /* limiter_bands, limiter_gains, interpol_freq, smoothing_mode */
+  }
+
+  return 0;
+}
+
+/**
+ * \brief Append one entry to the frame table, growing the table if required.
+ */
+static AAC_DECODER_ERROR aacDecoder_IndexAppend(HANDLE_AACDEC_FRAME_INDEX hIndex, const UINT64 byteOffset, const UINT frameSize, const UINT configPresent)
+{
+  AACDEC_FRAME_INDEX_ENTRY *pEntry;
+
+  if (hIndex->numEntries == hIndex->maxEntries) {
+    UINT maxEntries = (hIndex->maxEntries == 0) ? INDEX_INITIAL_ENTRIES : 2*hIndex->maxEntries;
+    AACDEC_FRAME_INDEX_ENTRY *pEntries;
+
+    pEntries = (AACDEC_FRAME_INDEX_ENTRY*)FDKcalloc(maxEntries, sizeof(AACDEC_FRAME_INDEX_ENTRY));
+    if (pEntries == NULL) {
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    if (hIndex->pEntries != NULL) {
+      FDKmemcpy(pEntries, hIndex->pEntries, hIndex->numEntries*sizeof(AACDEC_FRAME_INDEX_ENTRY));
+      FDKfree(hIndex->pEntries);
+    }
+    hIndex->pEntries = pEntries;
+    hIndex->maxEntries = maxEntries;
+  }
+
+  pEntry = &hIndex->pEntries[hIndex->numEntries++];
+  pEntry->byteOffset     = byteOffset;
+  pEntry->samplePosition = hIndex->numSamples;
+  pEntry->frameSize      = frameSize;
+  pEntry->configPresent  = configPresent;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexOpen(HANDLE_AACDEC_FRAME_INDEX *phIndex, const TRANSPORT_TYPE transportFmt)
+{
+  HANDLE_AACDEC_FRAME_INDEX hIndex;
+
+  if (phIndex == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *phIndex = NULL;
+
+  if ( (transportFmt != TT_MP4_ADTS) && (transportFmt != TT_MP4_LOAS) ) {
+    return AAC_DEC_UNSUPPORTED_FORMAT;
+  }
+
+  hIndex = GetAacDecFrameIndex();
+  if (hIndex == NULL) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  hIndex->transportFmt = transportFmt;
+
+  hIndex->hInput = transportDec_Open(transportFmt, TP_FLAG_MPEG4);
+  if (hIndex->hInput == NULL) {
+    FreeAacDecFrameIndex(&hIndex);
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  transportDec_SetParam(hIndex->hInput, TPDEC_PARAM_IGNORE_BUFFERFULLNESS, 1);
+  transportDec_RegisterAscCallback(hIndex->hInput, aacDecoder_IndexConfigCallback, (void*)hIndex);
+  transportDec_RegisterSbrCallback(hIndex->hInput, (cbSbr_t)aacDecoder_IndexSbrCallback, (void*)hIndex);
+
+  *phIndex = hIndex;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexFill(
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        UCHAR                     *pBuffer,
+        const UINT                 bufferSize,
+        UINT                      *pBytesValid
+        )
+{
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  TRANSPORTDEC_ERROR tpErr;
+  HANDLE_FDK_BITSTREAM hBs;
+
+  if ( (hIndex == NULL) || (hIndex->hInput == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  hBs = transportDec_GetBitstream(hIndex->hInput, 0);
+
+  do {
+    UINT bytesValid = *pBytesValid;
+
+    tpErr = transportDec_FillData(hIndex->hInput, pBuffer, bufferSize, pBytesValid, 0);
+    if (tpErr != TRANSPORTDEC_OK) {
+      return AAC_DEC_UNKNOWN;
+    }
+    hIndex->bytesScanned += bytesValid - *pBytesValid;
+
+    /* Parse the headers of all complete frames in the bit buffer. */
+    do {
+      tpErr = transportDec_ReadAccessUnit(hIndex->hInput, 0);
+
+      if (tpErr == TRANSPORTDEC_OK) {
+        UINT frameStart, frameLength, numAccessUnits, configPresent;
+
+        transportDec_GetFrameInfo(hIndex->hInput, &frameStart, &frameLength, &numAccessUnits, &configPresent);
+
+        err = aacDecoder_IndexAppend(hIndex, hIndex->bytesScanned - (frameStart>>3), frameLength, configPresent);
+        if (err != AAC_DEC_OK) {
+          return err;
+        }
+        hIndex->numSamples += (UINT64)numAccessUnits * hIndex->samplesPerAu;
+
+        if (transportDec_SkipFrame(hIndex->hInput) != TRANSPORTDEC_OK) {
+          /* Frame length does not match: drop the entry and resynchronize. */
+          hIndex->numEntries--;
+          hIndex->numSamples -= (UINT64)numAccessUnits * hIndex->samplesPerAu;
+          transportDec_SetParam(hIndex->hInput, TPDEC_PARAM_FLUSH, 1);
+        }
+      }
+    } while ( (tpErr == TRANSPORTDEC_OK) || (tpErr == TRANSPORTDEC_SYNC_ERROR) || (tpErr == TRANSPORTDEC_CRC_ERROR) );
+
+    if (tpErr != TRANSPORTDEC_NOT_ENOUGH_BITS) {
+      err = AAC_DEC_TRANSPORT_SYNC_ERROR;
+      break;
+    }
+  } while ( (*pBytesValid > 0) && (FDKgetFreeBits(hBs) >= 8) );
+
+  return err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexGetInfo(HANDLE_AACDEC_FRAME_INDEX hIndex, UINT *pNumFrames, UINT64 *pNumSamples)
+{
+  if (hIndex == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  if (pNumFrames != NULL) {
+    *pNumFrames = hIndex->numEntries;
+  }
+  if (pNumSamples != NULL) {
+    *pNumSamples = hIndex->numSamples;
+  }
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexGetEntry(HANDLE_AACDEC_FRAME_INDEX hIndex, const UINT frame, AACDEC_FRAME_INDEX_ENTRY *pEntry)
+{
+  if ( (hIndex == NULL) || (pEntry == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  if (frame >= hIndex->numEntries) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+
+  *pEntry = hIndex->pEntries[frame];
+
+  return AAC_DEC_OK;
+}
+
+INT aacDecoder_IndexFind(const HANDLE_AACDEC_FRAME_INDEX hIndex, const UINT64 samplePosition)
+{
+  INT lo = 0, hi = (INT)hIndex->numEntries - 1;
+
+  if (hi < 0) {
+    return -1;
+  }
+
+  /* Binary search for the last entry with samplePosition <= position. */
+  while (lo < hi) {
+    INT mid = (lo + hi + 1) >> 1;
+
+    if (hIndex->pEntries[mid].samplePosition <= samplePosition) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+
+  return lo;
+}
+
+/*
+ * Serialized format, all multi byte fields little endian:
+ *   4 bytes  magic "FDKI"
+ *   1 byte   version
+ *   1 byte   transport format
+ *   4 bytes  sample rate
+ *   4 bytes  samples per access unit
+ *   4 bytes  number of frames
+ *   8 bytes  total number of samples
+ * followed by three variable length integers per frame (7 bits per byte, LSB first, MSB set
+ * if more bytes follow): bytes skipped since the end of the previous frame, frame size shifted
+ * left by one with the config present flag in the LSB, and number of samples of the frame.
+ */
+
+static UCHAR *indexPutBytes(UCHAR *p, const UCHAR *pEnd, UINT64 value, INT nBytes, UINT *pCount)
+{
+  INT i;
+
+  for (i = 0; i < nBytes; i++) {
+    if (p != NULL && p < pEnd) {
+      *p++ = (UCHAR)(value & 0xFF);
+    }
+    value >>= 8;
+  }
+  *pCount += nBytes;
+
+  return p;
+}
+
+static UCHAR *indexPutVarInt(UCHAR *p, const UCHAR *pEnd, UINT64 value, UINT *pCount)
+{
+  do {
+    UCHAR byte = (UCHAR)(value & 0x7F);
+
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    if (p != NULL && p < pEnd) {
+      *p++ = byte;
+    }
+    *pCount += 1;
+  } while (value != 0);
+
+  return p;
+}
+
+static UINT64 indexGetBytes(const UCHAR **pp, INT nBytes)
+{
+  UINT64 value = 0;
+  INT i;
+
+  for (i = 0; i < nBytes; i++) {
+    value |= (UINT64)(*pp)[i] << (8*i);
+  }
+  *pp += nBytes;
+
+  return value;
+}
+
+static INT indexGetVarInt(const UCHAR **pp, const UCHAR *pEnd, UINT64 *pValue)
+{
+  UINT64 value = 0;
+  INT shift = 0;
+  UCHAR byte;
+
+  do {
+    if (*pp >= pEnd || shift > 63) {
+      return -1;
+    }
+    byte = *(*pp)++;
+    value |= (UINT64)(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+
+  *pValue = value;
+
+  return 0;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexWrite(
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        UCHAR                     *pBuffer,
+        const UINT                 bufferSize,
+        UINT                      *pBytesWritten
+        )
+{
+  UCHAR *p = pBuffer;
+  const UCHAR *pEnd = pBuffer + bufferSize;
+  UINT64 frameEnd = 0;
+  UINT count = 0;
+  UINT i;
+
+  if ( (hIndex == NULL) || (pBytesWritten == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  for (i = 0; i < 4; i++) {
+    p = indexPutBytes(p, pEnd, (UCHAR)INDEX_MAGIC[i], 1, &count);
+  }
+  p = indexPutBytes(p, pEnd, INDEX_VERSION, 1, &count);
+  p = indexPutBytes(p, pEnd, (UINT64)hIndex->transportFmt, 1, &count);
+  p = indexPutBytes(p, pEnd, hIndex->sampleRate, 4, &count);
+  p = indexPutBytes(p, pEnd, hIndex->samplesPerAu, 4, &count);
+  p = indexPutBytes(p, pEnd, hIndex->numEntries, 4, &count);
+  p = indexPutBytes(p, pEnd, hIndex->numSamples, 8, &count);
+
+  for (i = 0; i < hIndex->numEntries; i++) {
+    const AACDEC_FRAME_INDEX_ENTRY *pEntry = &hIndex->pEntries[i];
+    UINT64 nextPosition = (i+1 < hIndex->numEntries) ? hIndex->pEntries[i+1].samplePosition : hIndex->numSamples;
+
+    p = indexPutVarInt(p, pEnd, pEntry->byteOffset - frameEnd, &count);
+    p = indexPutVarInt(p, pEnd, ((UINT64)pEntry->frameSize<<1) | (pEntry->configPresent ? 1 : 0), &count);
+    p = indexPutVarInt(p, pEnd, nextPosition - pEntry->samplePosition, &count);
+    frameEnd = pEntry->byteOffset + pEntry->frameSize;
+  }
+
+  *pBytesWritten = count;
+
+  if ( (pBuffer != NULL) && (count > bufferSize) ) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_IndexRead(
+        HANDLE_AACDEC_FRAME_INDEX *phIndex,
+        const UCHAR               *pBuffer,
+        const UINT                 bufferSize
+        )
+{
+  HANDLE_AACDEC_FRAME_INDEX hIndex;
+  const UCHAR *p = pBuffer;
+  const UCHAR *pEnd = pBuffer + bufferSize;
+  UINT64 frameEnd = 0;
+  UINT numEntries, i;
+
+  if ( (phIndex == NULL) || (pBuffer == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *phIndex = NULL;
+
+  if ( (bufferSize < INDEX_HEADER_BYTES)
+    || (FDKmemcmp(p, INDEX_MAGIC, 4) != 0)
+    || (p[4] != INDEX_VERSION) ) {
+    return AAC_DEC_UNSUPPORTED_FORMAT;
+  }
+  p += 4 + 1;
+
+  hIndex = GetAacDecFrameIndex();
+  if (hIndex == NULL) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+
+  hIndex->transportFmt = (TRANSPORT_TYPE)indexGetBytes(&p, 1);
+  hIndex->sampleRate   = (UINT)indexGetBytes(&p, 4);
+  hIndex->samplesPerAu = (UINT)indexGetBytes(&p, 4);
+  numEntries           = (UINT)indexGetBytes(&p, 4);
+  indexGetBytes(&p, 8); /* total samples, recomputed below */
+
+  /* Each entry occupies at least three bytes. */
+  if (numEntries > (UINT)(pEnd - p)/3) {
+    FreeAacDecFrameIndex(&hIndex);
+    return AAC_DEC_UNSUPPORTED_FORMAT;
+  }
+
+  for (i = 0; i < numEntries; i++) {
+    UINT64 gap, frameSize, numSamples;
+
+    if ( indexGetVarInt(&p, pEnd, &gap)
+      || indexGetVarInt(&p, pEnd, &frameSize)
+      || indexGetVarInt(&p, pEnd, &numSamples) )
+    {
+      aacDecoder_IndexClose(&hIndex);
+      return AAC_DEC_UNSUPPORTED_FORMAT;
+    }
+    if (aacDecoder_IndexAppend(hIndex, frameEnd + gap, (UINT)(frameSize>>1), (UINT)(frameSize&1)) != AAC_DEC_OK) {
+      aacDecoder_IndexClose(&hIndex);
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    hIndex->numSamples += numSamples;
+    frameEnd += gap + (frameSize>>1);
+  }
+  hIndex->bytesScanned = frameEnd;
+
+  *phIndex = hIndex;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP void aacDecoder_IndexClose(HANDLE_AACDEC_FRAME_INDEX *phIndex)
+{
+  if ( (phIndex == NULL) || (*phIndex == NULL) ) {
+    return;
+  }
+
+  if ((*phIndex)->hInput != NULL) {
+    transportDec_Close(&(*phIndex)->hInput);
+  }
+  if ((*phIndex)->pEntries != NULL) {
+    FDKfree((*phIndex)->pEntries);
+  }
+  FreeAacDecFrameIndex(phIndex);
+}
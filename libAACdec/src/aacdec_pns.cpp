@@ -322,6 +322,25 @@ static void ScaleBand (FIXP_DBL *RESTRICT spec, int size, int scaleFactor, int s
 }
 
 
+/**
+ * \brief Advance a random generator state like GenerateRandomVector() does.
+ * \param size amount of noise values which would have been generated.
+ * \param pRandomState pointer to the state of the random generator being used.
+ */
+static void SkipRandomVector (int size,
+                              int *pRandomState)
+{
+  int i;
+  int randomState = *pRandomState;
+
+  for (i=0; i<size; i++)
+  {
+    randomState = (1664525L * randomState) + 1013904223L; // Numerical Recipes
+  }
+
+  *pRandomState = randomState;
+}
+
 /*!
   \brief Apply PNS
 
@@ -380,3 +399,45 @@ void CPns_Apply (const CPnsData *pPnsData,
     }
   }
 }
+
+/*!
+  \brief Skip PNS
+
+  The function advances the random generators exactly like CPns_Apply()
+  but does not generate the noise. The spectrum is not touched.
+
+*/
+void CPns_SkipApply (const CPnsData *pPnsData,
+                     const CIcsInfo *pIcsInfo,
+                     const SamplingRateInfo *pSamplingRateInfo,
+                     const int channel)
+{
+  if (pPnsData->PnsActive) {
+    const short *BandOffsets = GetScaleFactorBandOffsets(pIcsInfo, pSamplingRateInfo);
+
+    int ScaleFactorBandsTransmitted = GetScaleFactorBandsTransmitted(pIcsInfo);
+
+    for (int group = 0; group < GetWindowGroups(pIcsInfo); group++) {
+      for (int groupwin = 0; groupwin < GetWindowGroupLength(pIcsInfo, group); groupwin++) {
+        for (int band = 0 ; band < ScaleFactorBandsTransmitted; band++) {
+          if (CPns_IsPnsUsed (pPnsData, group, band)) {
+            UINT pns_band = group*16+band;
+
+            int bandWidth = BandOffsets [band + 1] - BandOffsets [band] ;
+
+            if (channel > 0 && CPns_IsCorrelated(pPnsData, group, band))
+            {
+              SkipRandomVector (bandWidth, &pPnsData->randomSeed [pns_band]) ;
+            }
+            else
+            {
+              pPnsData->randomSeed [pns_band] = *pPnsData->currentSeed ;
+
+              SkipRandomVector (bandWidth, pPnsData->currentSeed) ;
+            }
+          }
+        }
+      }
+    }
+  }
+}
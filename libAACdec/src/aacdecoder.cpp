@@ -204,6 +204,22 @@ void CAacDecoder_SignalInterruption(HANDLE_AACDECODER self)
 {
 }
 
+void CAacDecoder_ClearHistory(HANDLE_AACDECODER self)
+{
+  int ch;
+
+  for (ch = 0; ch < self->aacChannels; ch++) {
+    /* Reset concealment */
+    CConcealment_InitChannelData(&self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo,
+                                 &self->concealCommonData,
+                                  self->streamInfo.aacSamplesPerFrame );
+    /* Clear overlap-add buffers to avoid clicks. */
+    FDKmemclear(self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer, OverlapBufferSize*sizeof(FIXP_DBL));
+  }
+  /* The cleared channel states are valid, drop the downmix state. */
+  CAacDecoder_FdDmxReset(self->pFdDmx);
+}
+
 /*!
   \brief Reset ancillary data struct. Call before parsing a new frame.
 
@@ -515,6 +531,10 @@ AAC_DECODER_ERROR CAacDecoder_ExtPayloadParse (HANDLE_AACDECODER self,
     {
       INT readBits = aacDecoder_drcMarkPayload( self->hDrcInfo, hBs, MPEG_DRC_EXT_DATA );
 
+      if (self->pFrameInfo != NULL) {
+        self->pFrameInfo->drcBits += readBits;
+      }
+
       if (readBits > *count)
       { /* Read too much. Something went wrong! */
         error = AAC_DEC_PARSE_ERROR;
@@ -529,6 +549,7 @@ AAC_DECODER_ERROR CAacDecoder_ExtPayloadParse (HANDLE_AACDECODER self,
   case EXT_SBR_DATA:
     if (IS_CHANNEL_ELEMENT(previous_element)) {
       SBR_ERROR sbrError;
+      INT payloadBits = *count;
 
       CAacDecoder_SyncQmfMode(self);
 
@@ -573,6 +594,9 @@ AAC_DECODER_ERROR CAacDecoder_ExtPayloadParse (HANDLE_AACDECODER self,
           self->frameOK = 0;
         }
       }
+      if (self->pFrameInfo != NULL) {
+        self->pFrameInfo->sbrBits += payloadBits - *count;
+      }
     } else {
       error = AAC_DEC_PARSE_ERROR;
     }
@@ -750,6 +774,9 @@ LINKSPEC_CPP HANDLE_AACDECODER CAacDecoder_Open(TRANSPORT_TYPE bsFormat)    /*!<
 
   /* set default output mode */
   self->outputInterleaved = 1;  /* interleaved */
+  self->pcmOutputFormat = AACDEC_PCM_S16;
+  self->pSpectralFrame = NULL;
+  self->pFrameInfo = NULL;
 
   /* initialize anc data */
   CAacDecoder_AncDataInit(&self->ancData, NULL, 0);
@@ -774,10 +801,9 @@ LINKSPEC_CPP HANDLE_AACDECODER CAacDecoder_Open(TRANSPORT_TYPE bsFormat)    /*!<
         );
 
 
+  /* The spectral work buffer workBufferCore2 is allocated with the channels in CAacDecoder_Init(). */
   self->aacCommonData.workBufferCore1 = GetWorkBufferCore1();
-  self->aacCommonData.workBufferCore2 = GetWorkBufferCore2();
-  if (self->aacCommonData.workBufferCore1 == NULL
-    ||self->aacCommonData.workBufferCore2 == NULL )
+  if (self->aacCommonData.workBufferCore1 == NULL)
     goto bail;
 
   return self;
@@ -816,16 +842,96 @@ LINKSPEC_CPP void CAacDecoder_Close(HANDLE_AACDECODER self)
     FreeDrcInfo(&self->hDrcInfo);
   }
 
-  if (self->aacCommonData.workBufferCore1 != NULL) {
-    FreeWorkBufferCore1 (&self->aacCommonData.workBufferCore1);
-  }
-  if (self->aacCommonData.workBufferCore2 != NULL) {
-    FreeWorkBufferCore2 (&self->aacCommonData.workBufferCore2);
+  CAacDecoder_FdDmxClose(&self->pFdDmx);
+
+  /* A bound scratch memory is owned by the application. */
+  if (self->pScratch == NULL) {
+    if (self->aacCommonData.workBufferCore1 != NULL) {
+      FreeWorkBufferCore1 (&self->aacCommonData.workBufferCore1);
+    }
+    if (self->aacCommonData.workBufferCore2 != NULL) {
+      FreeWorkBufferCore2 (&self->aacCommonData.workBufferCore2);
+    }
   }
 
   FreeAacDecoder ( &self);
 }
 
+/* Point the channels to the work buffers, after they were moved. */
+static void CAacDecoder_HookWorkBuffers(HANDLE_AACDECODER self)
+{
+  int ch;
+
+  for (ch = 0; ch < (8); ch++) {
+    if (self->pAacDecoderChannelInfo[ch] != NULL) {
+      self->pAacDecoderChannelInfo[ch]->pDynData = &self->aacCommonData.workBufferCore1->pAacDecoderDynamicData[ch%2];
+      self->pAacDecoderChannelInfo[ch]->pSpectralCoefficient = (SPECTRAL_PTR) &self->aacCommonData.workBufferCore2[ch*1024];
+    }
+  }
+}
+
+/* Scratch memory layout: CWorkBufferCore1, followed by the spectral coefficients of nChannels channels.
+   Extra ALIGNMENT_DEFAULT bytes allow for an unaligned scratch memory address. */
+LINKSPEC_CPP UINT CAacDecoder_GetScratchSize(const INT nChannels)
+{
+  return ALIGNMENT_DEFAULT + ALIGN_SIZE(sizeof(CWorkBufferCore1)) + nChannels*1024*sizeof(FIXP_DBL);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_SetScratch(HANDLE_AACDECODER self, void *pScratch, const UINT scratchSize)
+{
+  if (pScratch != NULL) {
+    UCHAR *pBase = ALIGN_PTR(pScratch);
+
+    if (scratchSize < CAacDecoder_GetScratchSize(self->aacChannels)) {
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    if (self->pScratch == NULL) {
+      FreeWorkBufferCore1(&self->aacCommonData.workBufferCore1);
+      FreeWorkBufferCore2(&self->aacCommonData.workBufferCore2);
+    }
+    self->pScratch    = (UCHAR*)pScratch;
+    self->scratchSize = scratchSize;
+
+    self->aacCommonData.workBufferCore1 = (CWorkBufferCore1*)pBase;
+    self->aacCommonData.workBufferCore2 = (FIXP_DBL*)(pBase + ALIGN_SIZE(sizeof(CWorkBufferCore1)));
+  }
+  else if (self->pScratch != NULL) {
+    CWorkBufferCore1 *pWorkBufferCore1 = GetWorkBufferCore1();
+    FIXP_DBL *pWorkBufferCore2 = (self->aacChannels > 0) ? GetWorkBufferCore2(self->aacChannels) : NULL;
+
+    if ( (pWorkBufferCore1 == NULL) || ((self->aacChannels > 0) && (pWorkBufferCore2 == NULL)) ) {
+      /* Keep the scratch memory bound. */
+      if (pWorkBufferCore1 != NULL) {
+        FreeWorkBufferCore1(&pWorkBufferCore1);
+      }
+      FreeWorkBufferCore2(&pWorkBufferCore2);
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    self->pScratch    = NULL;
+    self->scratchSize = 0;
+
+    self->aacCommonData.workBufferCore1 = pWorkBufferCore1;
+    self->aacCommonData.workBufferCore2 = pWorkBufferCore2;
+  }
+  else {
+    return AAC_DEC_OK;
+  }
+
+  CAacDecoder_HookWorkBuffers(self);
+
+  return AAC_DEC_OK;
+}
+
+/* Arena memory of the channel structures allocated by CAacDecoder_Init() */
+LINKSPEC_CPP UINT CAacDecoder_GetRequiredChannelMemory(const INT nChannels)
+{
+  /* GetRequiredMem*() report the memory of all (8) channels. */
+  return nChannels * ( FDKarenaGetBlockSize(GetRequiredMemAacDecoderChannelInfo() / (8))
+                     + FDKarenaGetBlockSize(GetRequiredMemAacDecoderStaticChannelInfo() / (8))
+                     + FDKarenaGetBlockSize(GetRequiredMemOverlapBuffer() / (8)) )
+       + FDKarenaGetBlockSize(GetRequiredMemWorkBufferCore2(nChannels));
+}
+
 
 /*!
   \brief Initialization of decoder instance
@@ -1020,6 +1126,27 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self, const CS
 
      /* Allocate all memory structures for each channel */
      {
+       /* Grow the spectral work buffer, which holds the coefficients of all channels. */
+       if (ascChannels > self->aacChannels) {
+         if (self->pScratch != NULL) {
+           /* A bound scratch memory can not grow. */
+           if (self->scratchSize < CAacDecoder_GetScratchSize(ascChannels)) {
+             goto bail;
+           }
+         }
+         else {
+           FIXP_DBL *pWorkBufferCore2 = GetWorkBufferCore2(ascChannels);
+
+           if (pWorkBufferCore2 == NULL) {
+             goto bail;
+           }
+           FreeWorkBufferCore2(&self->aacCommonData.workBufferCore2);
+           self->aacCommonData.workBufferCore2 = pWorkBufferCore2;
+
+           CAacDecoder_HookWorkBuffers(self);
+         }
+       }
+
        for (ch = 0; ch < ascChannels; ch++) {
          CAacDecoderDynamicData *aacDecoderDynamicData = &self->aacCommonData.workBufferCore1->pAacDecoderDynamicData[ch%2];
 
@@ -1069,6 +1196,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self, const CS
   /* Update structures */
   if (ascChanged) {
 
+     /* The channel filter banks are initialized below, drop the downmix state. */
+     CAacDecoder_FdDmxReset(self->pFdDmx);
+
      /* Things to be done for each channel, which do not involve allocating memory.
         Doing these things only on the channels needed for the current configuration
         (ascChannels) could lead to memory access violation later (error concealment). */
@@ -1104,10 +1234,156 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self, const CS
   return err;
 
 bail:
-  aacDecoder_Close( self );
+  /* Keep the instance, the channels allocated so far are released by CAacDecoder_Close(). */
   return AAC_DEC_OUT_OF_MEMORY;
 }
 
+/*!
+  \brief Check whether the TNS filters of a channel element fit into the limits of the spectral frame.
+
+  \return 1 if the TNS residual of the element can be exported, 0 if TNS has to be applied in the decoder.
+*/
+static
+int CAacDecoder_SpectralKeepTns(
+        const AACDEC_SPECTRAL_FRAME *pFrame,
+        CAacDecoderChannelInfo *pAacDecoderChannelInfo[],
+        const int el_channels
+        )
+{
+  int ch, w, f;
+
+  for (ch = 0; ch < el_channels; ch++) {
+    const CTnsData *pTnsData = &pAacDecoderChannelInfo[ch]->pDynData->TnsData;
+
+    if ( !pTnsData->Active ) {
+      continue;
+    }
+    for (w = 0; w < GetWindowsPerFrame(&pAacDecoderChannelInfo[ch]->icsInfo); w++) {
+      if (pTnsData->NumberOfFilters[w] > pFrame->tnsMaxFilters) {
+        return 0;
+      }
+      for (f = 0; f < pTnsData->NumberOfFilters[w]; f++) {
+        if (pTnsData->Filter[w][f].Order > pFrame->tnsMaxOrder) {
+          return 0;
+        }
+      }
+    }
+  }
+
+  return 1;
+}
+
+/*!
+  \brief Copy the TNS side info of one channel into the spectral frame.
+
+  Must be called right after CChannelElement_Decode() because the dynamic channel data is shared
+  among the channel elements.
+*/
+static
+void CAacDecoder_SpectralExportTns(
+        AACDEC_SPECTRAL_CHANNEL *pChannel,
+        const CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+        const int tnsKept
+        )
+{
+  const CTnsData *pTnsData = &pAacDecoderChannelInfo->pDynData->TnsData;
+  int w, f, i;
+
+  FDKmemclear(pChannel->tnsNumFilters, sizeof(pChannel->tnsNumFilters));
+  pChannel->tnsActive = (tnsKept && pTnsData->Active) ? 1 : 0;
+
+  if ( !pChannel->tnsActive ) {
+    return;
+  }
+
+  for (w = 0; w < GetWindowsPerFrame(&pAacDecoderChannelInfo->icsInfo); w++) {
+    pChannel->tnsNumFilters[w] = pTnsData->NumberOfFilters[w];
+    pChannel->tnsCoefRes[w] = 4;
+
+    for (f = 0; f < pTnsData->NumberOfFilters[w]; f++) {
+      const CFilter *filter = &pTnsData->Filter[w][f];
+
+      pChannel->tnsLength[w][f] = filter->StopBand - filter->StartBand;
+      pChannel->tnsOrder[w][f] = filter->Order;
+      pChannel->tnsDirection[w][f] = (filter->Direction < 0) ? 1 : 0;
+      if (filter->Order > 0) {
+        pChannel->tnsCoefRes[w] = filter->Resolution;
+      }
+      for (i = 0; i < filter->Order; i++) {
+        pChannel->tnsCoef[w][f][i] = filter->Coeff[i];
+      }
+    }
+  }
+}
+
+/*!
+  \brief Copy the decoded spectrum and window decisions of one channel into the spectral frame.
+
+  The concealment module swaps only spectrum, scale and window sequence and shape with its buffer,
+  so the grouping of a concealed spectrum is unknown and the TNS data does not belong to it.
+*/
+static
+void CAacDecoder_SpectralExport(
+        AACDEC_SPECTRAL_CHANNEL *pChannel,
+        const CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+        const int frameLength,
+        const int concealed
+        )
+{
+  const CIcsInfo *pIcsInfo = &pAacDecoderChannelInfo->icsInfo;
+  int g;
+
+  FDKmemcpy(pChannel->spectrum, pAacDecoderChannelInfo->pSpectralCoefficient, frameLength*sizeof(FIXP_DBL));
+  FDKmemcpy(pChannel->specScale, pAacDecoderChannelInfo->specScale, sizeof(pChannel->specScale));
+
+  pChannel->windowSequence = GetWindowSequence(pIcsInfo);
+  pChannel->windowShape = GetWindowShape(pIcsInfo);
+
+  if (concealed) {
+    pChannel->windowGroups = GetWindowsPerFrame(pIcsInfo);
+    for (g = 0; g < pChannel->windowGroups; g++) {
+      pChannel->windowGroupLength[g] = 1;
+    }
+    pChannel->tnsActive = 0;
+  } else {
+    pChannel->windowGroups = GetWindowGroups(pIcsInfo);
+    for (g = 0; g < pChannel->windowGroups; g++) {
+      pChannel->windowGroupLength[g] = GetWindowGroupLength(pIcsInfo, g);
+    }
+  }
+}
+
+
+/*!
+  \brief Account the bits of one raw data block element in parse only mode.
+
+  SBR and DRC payloads are accounted where they are parsed.
+*/
+static
+void CAacDecoder_InspectElement(
+        AACDEC_FRAME_INFO *pInfo,
+        const MP4_ELEMENT_ID type,
+        const INT bits
+        )
+{
+  switch (type) {
+    case ID_SCE:
+    case ID_CPE:
+    case ID_LFE:
+    case ID_CCE:
+      pInfo->elementBits += bits;
+      break;
+    case ID_DSE:
+      pInfo->ancBits += bits;
+      break;
+    case ID_PCE:
+      pInfo->pcePresent = 1;
+      break;
+    default:
+      break;
+  }
+}
+
 
 LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         HANDLE_AACDECODER self,
@@ -1183,18 +1459,14 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
 
   if ( flags & AACDEC_CLRHIST )
   {
-    int ch;
     /* Clear history */
-    for (ch = 0; ch < self->aacChannels; ch++) {
-      /* Reset concealment */
-      CConcealment_InitChannelData(&self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo,
-                                   &self->concealCommonData,
-                                    self->streamInfo.aacSamplesPerFrame );
-      /* Clear overlap-add buffers to avoid clicks. */
-      FDKmemclear(self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer, OverlapBufferSize*sizeof(FIXP_DBL));
-     }
+    CAacDecoder_ClearHistory(self);
   }
 
+  /* The render stage decides whether this frame is downmixed in frequency domain. */
+  self->fdDmxChannels = 0;
+  self->fdDmxOutScale = 0;
+
 
 
 #ifdef TP_PCE_ENABLE
@@ -1207,10 +1479,13 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
   UCHAR previous_element_index = 0;         /* Canonical index of last element */
   int element_count = 0;                    /* Element counter for elements found in the bitstream */
   int el_cnt[ID_LAST] = { 0 };              /* element counter ( robustness ) */
+  AACDEC_SPECTRAL_FRAME *pSpecFrame = self->pSpectralFrame;
+  int specElements = 0;                     /* Element counter of the spectral frame */
 
   while ( (type != ID_END) && (! (flags & (AACDEC_CONCEAL | AACDEC_FLUSH))) && self->frameOK )
   {
     int el_channels;
+    INT elStartBits = (INT)FDKgetValidBits(bs);
 
     if (! (self->flags & (AC_USAC|AC_RSVD50|AC_ELD|AC_SCALABLE|AC_ER)))
       type = (MP4_ELEMENT_ID) FDKreadBits(bs,3);
@@ -1253,6 +1528,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         }
 
         if(self->frameOK) {
+          FDK_PROFILE_TICKS profileStart = FDKprofileStart();
+
           ErrorStatus = CChannelElement_Read( bs,
                                              &self->pAacDecoderChannelInfo[aacChannels],
                                              &self->pAacDecoderStaticChannelInfo[aacChannels],
@@ -1264,6 +1541,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
                                               self->streamInfo.epConfig,
                                               self->hInput
                                               );
+          FDKprofileStop(profileStart, &self->profileTicks[AACDEC_PROF_PARSE]);
           if (ErrorStatus) {
             self->frameOK = 0;
           }
@@ -1284,10 +1562,35 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
                   self->elements,
                   type) )
           {
-            if ( !hdaacDecoded ) {
+            if ( !hdaacDecoded && (self->pFrameInfo == NULL) ) {
+              int keepTns = 0;
+              FDK_PROFILE_TICKS profileStart;
+
+              if (pSpecFrame != NULL) {
+                keepTns = CAacDecoder_SpectralKeepTns(pSpecFrame, &self->pAacDecoderChannelInfo[aacChannels], el_channels);
+              }
+              profileStart = FDKprofileStart();
               CChannelElement_Decode(
                      &self->pAacDecoderChannelInfo[aacChannels],
                      &self->pAacDecoderStaticChannelInfo[aacChannels],
+                     &self->samplingRateInfo,
+                      self->flags,
+                      el_channels,
+                     !keepTns
+                      );
+              FDKprofileStop(profileStart, &self->profileTicks[AACDEC_PROF_SPECTRAL]);
+              if (pSpecFrame != NULL && specElements < AACDEC_SPEC_MAX_ELEMENTS) {
+                int ch;
+                pSpecFrame->elementType[specElements++] = type;
+                for (ch = 0; ch < el_channels; ch++) {
+                  CAacDecoder_SpectralExportTns(&pSpecFrame->channel[aacChannels+ch], self->pAacDecoderChannelInfo[aacChannels+ch], keepTns);
+                }
+              }
+            }
+            else if ( !hdaacDecoded ) {
+              /* Parse only: keep the noise generator in step with a regular decoding. */
+              CChannelElement_SkipDecode(
+                     &self->pAacDecoderChannelInfo[aacChannels],
                      &self->samplingRateInfo,
                       self->flags,
                       el_channels
@@ -1344,6 +1647,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
 
           /* create dummy channel for CCE parsing on stack */
           CAacDecoderChannelInfo  tmpAacDecoderChannelInfo, *pTmpAacDecoderChannelInfo;
+          FDK_PROFILE_TICKS profileStart;
 
           FDKmemclear(mdctSpec, 1024*sizeof(FIXP_DBL));
 
@@ -1358,6 +1662,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
 
           pTmpAacDecoderChannelInfo = &tmpAacDecoderChannelInfo;
           /* do CCE parsing */
+          profileStart = FDKprofileStart();
           ErrorStatus = CChannelElement_Read( bs,
                                              &pTmpAacDecoderChannelInfo,
                                               NULL,
@@ -1369,6 +1674,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
                                               self->streamInfo.epConfig,
                                               self->hInput
                                              );
+          FDKprofileStop(profileStart, &self->profileTicks[AACDEC_PROF_PARSE]);
 
           C_ALLOC_SCRATCH_END(mdctSpec, FIXP_DBL, 1024);
 
@@ -1494,6 +1800,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
           {
             SBR_ERROR err = SBRDEC_OK;
             int  elIdx, numChElements = el_cnt[ID_SCE] + el_cnt[ID_CPE];
+            INT  sbrStartBits = bitCnt;
 
             for (elIdx = 0; elIdx < numChElements; elIdx += 1)
             {
@@ -1525,6 +1832,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
               self->frameOK = 0;
               break;
             }
+            if (self->pFrameInfo != NULL) {
+              self->pFrameInfo->sbrBits += sbrStartBits - bitCnt;
+            }
           }
 
 
@@ -1551,6 +1861,10 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         break;
     }
 
+    if (self->pFrameInfo != NULL) {
+      CAacDecoder_InspectElement(self->pFrameInfo, type, elStartBits - (INT)FDKgetValidBits(bs));
+    }
+
     previous_element = type;
     element_count++;
 
@@ -1578,6 +1892,10 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
       }
     }
 
+    if (self->pFrameInfo != NULL) {
+      self->pFrameInfo->auBits = auStartAnchor - (INT)FDKgetValidBits(bs);
+    }
+
     /* Check the last element. The terminator (ID_END) has to be the last one (even if ER syntax is used). */
     if ( self->frameOK && type != ID_END ) {
       /* Do not overwrite current error */
@@ -1619,6 +1937,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
     FDKmemcpy(self->channelTypePrev, self->channelType, (8)*sizeof(AUDIO_CHANNEL_TYPE));  /* store */
     FDKmemcpy(self->channelIndicesPrev, self->channelIndices, (8)*sizeof(UCHAR));         /* store */
     self->sbrEnabledPrev = self->sbrEnabled;
+    if (pSpecFrame != NULL) {
+      pSpecFrame->numElements = specElements;
+    }
   } else {
     if (self->aacChannels > 0) {
       aacChannels = self->aacChannelsPrev;  /* restore */
@@ -1668,6 +1989,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
   */
   {
     int stride, offset, c;
+    int fdDmx = 0;
+    int parseOnly = (self->pFrameInfo != NULL);  /* Skip concealment, DRC processing and the inverse transform. */
+    FDK_PROFILE_TICKS profileStart = FDKprofileStart();
 
     /* Turn on/off DRC modules level normalization in digital domain depending on the limiter status. */
     aacDecoder_drcSetParam( self->hDrcInfo, APPLY_NORMALIZATION, (self->limiterEnableCurr) ? 0 : 1 );
@@ -1681,33 +2005,39 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
             aacChannels
           );
 
+    /* Keep the DRC channel data of frames which are only parsed in sync with the decoding. */
+    for (c=0; (c < aacChannels) && parseOnly; c++)
+    {
+      if (flags & (AACDEC_INTR|AACDEC_CLRHIST)) {
+        aacDecoder_drcInitChannelData ( &self->pAacDecoderStaticChannelInfo[c]->drcData );
+      }
+      aacDecoder_drcSkip ( self->hDrcInfo, &self->pAacDecoderStaticChannelInfo[c]->drcData );
+    }
+
     /* "c" iterates in canonical MPEG channel order */
-    for (c=0; c < aacChannels; c++)
+    for (c=0; (c < aacChannels) && !parseOnly; c++)
     {
       CAacDecoderChannelInfo *pAacDecoderChannelInfo;
+      int bsCh;                             /* Channel index in bitstream order */
 
       /* Select correct pAacDecoderChannelInfo for current channel */
       if (self->chMapping[c] >= aacChannels) {
-        pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[c];
-      } else {
-        pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[self->chMapping[c]];
-      }
-
-      /* Setup offset and stride for time buffer traversal. */
-      if (interleaved) {
-        stride = aacChannels;
-        offset = self->channelOutputMapping[chOutMapIdx][c];
+        bsCh = c;
       } else {
-        stride = 1;
-        offset = self->channelOutputMapping[chOutMapIdx][c] * self->streamInfo.aacSamplesPerFrame;
+        bsCh = self->chMapping[c];
       }
-
+      pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[bsCh];
 
       if ( flags&AACDEC_FLUSH ) {
         /* Clear pAacDecoderChannelInfo->pSpectralCoefficient because with AACDEC_FLUSH set it contains undefined data. */
         FDKmemclear(pAacDecoderChannelInfo->pSpectralCoefficient, sizeof(FIXP_DBL)*self->streamInfo.aacSamplesPerFrame);
       }
 
+      if ( (pSpecFrame != NULL) && self->frameOK && !(flags&AACDEC_CONCEAL) ) {
+        /* Export ahead of the concealment which may delay the spectrum by one frame. */
+        CAacDecoder_SpectralExport(&pSpecFrame->channel[bsCh], pAacDecoderChannelInfo, self->streamInfo.aacSamplesPerFrame, 0);
+      }
+
       /*
         Conceal defective spectral data
       */
@@ -1726,6 +2056,14 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         /* Reset DRC control data for this channel */
         aacDecoder_drcInitChannelData ( &self->pAacDecoderStaticChannelInfo[c]->drcData );
       }
+      if (pSpecFrame != NULL) {
+        /* Spectral output: no DRC and no inverse transform. */
+        if ( !(self->frameOK && !(flags&AACDEC_CONCEAL)) ) {
+          CAacDecoder_SpectralExport(&pSpecFrame->channel[bsCh], pAacDecoderChannelInfo, self->streamInfo.aacSamplesPerFrame, 1);
+        }
+        continue;
+      }
+
       /* The DRC module demands to be called with the gain field holding the gain scale. */
       self->extGain[0] = (FIXP_DBL)TDL_GAIN_SCALING;
       /* DRC processing */
@@ -1739,10 +2077,53 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
               self->streamInfo.aacSamplesPerFrame,
               self->sbrEnabled
             );
+    }
+
+    if ( (pSpecFrame == NULL) && !parseOnly ) {
+      /* Try to downmix the spectra to save the inverse transforms of the mixed channels. */
+      fdDmx = CAacDecoder_FdDmxApply(self, pTimeData, aacChannels, chOutMapIdx, interleaved, flags);
+      if (fdDmx) {
+        self->extGainDelay = self->streamInfo.aacSamplesPerFrame;
+      }
+    }
+
+    /* "c" iterates in canonical MPEG channel order */
+    for (c=0; (c < aacChannels) && (pSpecFrame == NULL) && !fdDmx && !parseOnly; c++)
+    {
+      CAacDecoderChannelInfo *pAacDecoderChannelInfo;
+      int bsCh;                             /* Channel index in bitstream order */
+
+      /* Select correct pAacDecoderChannelInfo for current channel */
+      if (self->chMapping[c] >= aacChannels) {
+        bsCh = c;
+      } else {
+        bsCh = self->chMapping[c];
+      }
+      pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[bsCh];
+
+      /* Setup offset and stride for time buffer traversal. */
+      if (interleaved) {
+        stride = aacChannels;
+        offset = self->channelOutputMapping[chOutMapIdx][c];
+      } else {
+        stride = 1;
+        offset = self->channelOutputMapping[chOutMapIdx][c] * self->streamInfo.aacSamplesPerFrame;
+      }
 
       switch (pAacDecoderChannelInfo->renderMode)
       {
         case AACDEC_RENDER_IMDCT:
+          if (self->pcmOutputFormat != AACDEC_PCM_S16) {
+            CBlock_FrequencyToTime(
+                    self->pAacDecoderStaticChannelInfo[c],
+                    pAacDecoderChannelInfo,
+                    (FIXP_DBL*)pTimeData + offset,
+                    self->streamInfo.aacSamplesPerFrame,
+                    stride,
+                    (self->frameOK && !(flags&AACDEC_CONCEAL)),
+                    self->aacCommonData.workBufferCore1->mdctOutTemp
+                    );
+          } else {
           CBlock_FrequencyToTime(
                   self->pAacDecoderStaticChannelInfo[c],
                   pAacDecoderChannelInfo,
@@ -1752,9 +2133,19 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
                   (self->frameOK && !(flags&AACDEC_CONCEAL)),
                   self->aacCommonData.workBufferCore1->mdctOutTemp
                   );
+          }
           self->extGainDelay = self->streamInfo.aacSamplesPerFrame;
           break;
         case AACDEC_RENDER_ELDFB:
+          if (self->pcmOutputFormat != AACDEC_PCM_S16) {
+            CBlock_FrequencyToTimeLowDelay(
+                    self->pAacDecoderStaticChannelInfo[c],
+                    pAacDecoderChannelInfo,
+                    (FIXP_DBL*)pTimeData + offset,
+                    self->streamInfo.aacSamplesPerFrame,
+                    stride
+                    );
+          } else {
           CBlock_FrequencyToTimeLowDelay(
                   self->pAacDecoderStaticChannelInfo[c],
                   pAacDecoderChannelInfo,
@@ -1762,6 +2153,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
                   self->streamInfo.aacSamplesPerFrame,
                   stride
                   );
+          }
           self->extGainDelay = (self->streamInfo.aacSamplesPerFrame*2 -  self->streamInfo.aacSamplesPerFrame/2 - 1)/2;
           break;
         default:
@@ -1773,8 +2165,13 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         FDKmemclear(self->pAacDecoderStaticChannelInfo[c]->pOverlapBuffer, OverlapBufferSize*sizeof(FIXP_DBL));
       }
     }
+    FDKprofileStop(profileStart, &self->profileTicks[AACDEC_PROF_SYNTHESIS]);
 
 
+    if (pSpecFrame != NULL) {
+      pSpecFrame->numChannels = aacChannels;
+    }
+
     /* Extract DRC control data and map it to channels (with bitstream delay) */
     aacDecoder_drcEpilog (
             self->hDrcInfo,
@@ -1796,8 +2193,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
            &self->streamInfo.drcProgRefLev
           );
 
-  /* Reorder channel type information tables.  */
-  {
+  /* Reorder channel type information tables. The frequency domain downmix already set up the output tables. */
+  if (self->fdDmxChannels == 0) {
     AUDIO_CHANNEL_TYPE types[(8)];
     UCHAR idx[(8)];
     int c;
@@ -1831,6 +2228,7 @@ LINKSPEC_CPP CStreamInfo* CAacDecoder_GetStreamInfo ( HANDLE_AACDECODER self )
   if (!self) {
     return NULL;
   }
+  self->streamInfo.memorySize = self->memorySize;
   return &self->streamInfo;
 }
 
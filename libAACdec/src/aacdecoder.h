@@ -107,9 +107,12 @@ amm-info@iis.fraunhofer.de
 
 #include "sbrdecoder.h"
 
+#include "aacdec_spectrum.h"
 
 #include "aacdec_drc.h"
 
+#include "aacdec_fddmx.h"
+
  #include "pcmutils_lib.h"
  #include "limiter.h"
 
@@ -168,6 +171,7 @@ struct AAC_DECODER_INSTANCE {
   INT                   nrOfLayers;
 
   INT                   outputInterleaved;           /*!< PCM output format (interleaved/none interleaved). */
+  INT                   pcmOutputFormat;             /*!< PCM output sample format (see AACDEC_PCM_FORMAT). */
 
   HANDLE_TRANSPORTDEC   hInput;                      /*!< Transport layer handle. */
 
@@ -226,6 +230,29 @@ struct AAC_DECODER_INSTANCE {
   FIXP_DBL     extGain[1];                           /*!< Gain that must be applied to the output signal. */
   UINT         extGainDelay;                         /*!< Delay that must be accounted for extGain. */
 
+  INT          batchWorker;                          /*!< Worker of a batch pool which decoded the last frame, -1 if none. */
+  UCHAR        batchQueued;                          /*!< Flag to detect the same handle queued twice in one batch. */
+
+  AACDEC_SPECTRAL_FRAME *pSpectralFrame;             /*!< Destination of the spectral output, NULL for time domain output. */
+  AACDEC_FRAME_INFO     *pFrameInfo;                 /*!< Bit usage of the current frame in parse only mode, NULL when decoding. */
+
+  INT          seekPreRollFrames;                    /*!< Frames to be decoded without output after aacDecoder_Seek(). */
+  INT          seekSkipSamples;                      /*!< Samples to be dropped from the first output frame after aacDecoder_Seek(). */
+
+  UCHAR        fdDmxEnable;                          /*!< Downmix in frequency domain if possible, see AAC_PCM_FREQ_DOMAIN_DOWNMIX. */
+  UCHAR        fdDmxChannels;                        /*!< Output channels of the current frame if it was downmixed in frequency domain, else 0. */
+  SCHAR        fdDmxOutScale;                        /*!< Downmix headroom of the current frame that has to be applied by the limiter. */
+  CAacDecFdDmx *pFdDmx;                              /*!< Frequency domain downmix state, allocated on first use. */
+
+  FDK_ALLOCATOR allocator;                           /*!< Allocator of all memory of the instance, see aacDecoder_OpenWithAllocator(). */
+  UINT          memorySize;                          /*!< Heap memory held by the instance in bytes, see CStreamInfo::memorySize. */
+
+  UCHAR        *pScratch;                            /*!< Work buffers bound with aacDecoder_SetScratch(), NULL if the instance owns them. */
+  UINT          scratchSize;                         /*!< Size of the bound work buffer memory in bytes. */
+
+  FDK_PROFILE_TICKS   profileTicks[AACDEC_PROFILE_STAGES]; /*!< Stage times of the current frame, see aacDecoder_GetProfile(). */
+  FDK_PROFILE_COUNTER profile[AACDEC_PROFILE_STAGES];      /*!< Stage profiling counters. */
+
 };
 
 
@@ -261,6 +288,12 @@ void CAacDecoder_SyncQmfMode(HANDLE_AACDECODER self);
  */
 void CAacDecoder_SignalInterruption(HANDLE_AACDECODER self);
 
+/**
+ * \brief Clear the overlap buffers and the concealment state of all channels
+ * \param self decoder handle
+ */
+void CAacDecoder_ClearHistory(HANDLE_AACDECODER self);
+
 /*!
   \brief Initialize ancillary buffer
 
@@ -316,6 +349,15 @@ LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
 /* Destroy aac decoder */
 LINKSPEC_H void CAacDecoder_Close ( HANDLE_AACDECODER self );
 
+/* Arena memory of the channel structures allocated by CAacDecoder_Init() for nChannels channels */
+LINKSPEC_H UINT CAacDecoder_GetRequiredChannelMemory ( const INT nChannels );
+
+/* Size of the scratch memory holding the work buffers for nChannels channels */
+LINKSPEC_H UINT CAacDecoder_GetScratchSize ( const INT nChannels );
+
+/* Bind the work buffers to the scratch memory pScratch, NULL to allocate them again */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_SetScratch ( HANDLE_AACDECODER self, void *pScratch, const UINT scratchSize );
+
 /* get streaminfo handle from decoder */
 LINKSPEC_H CStreamInfo* CAacDecoder_GetStreamInfo ( HANDLE_AACDECODER self );
 
@@ -94,6 +94,8 @@ amm-info@iis.fraunhofer.de
 #include "aacdecoder.h"
 #include "tpdec_lib.h"
 #include "FDK_core.h" /* FDK_tools version info */
+#include "FDK_cpu.h"
+#include "FDK_threads.h"
 
 
  #include "sbrdecoder.h"
@@ -105,6 +107,8 @@ amm-info@iis.fraunhofer.de
 
  #include "aacdec_drc.h"
 
+#include "aacdec_index.h"
+
 
 
 /* Decoder library info */
@@ -159,6 +163,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ConfigRaw (
   AAC_DECODER_ERROR err = AAC_DEC_OK;
   TRANSPORTDEC_ERROR   errTp;
   UINT layer, nrOfLayers = self->nrOfLayers;
+  const FDK_ALLOCATOR *prevAllocator = FDKsetAllocator(&self->allocator);
+  UINT *prevCounter = FDKsetAllocCounter(&self->memorySize);
 
   for(layer = 0; layer < nrOfLayers; layer++){
     if(length[layer] > 0){
@@ -184,6 +190,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ConfigRaw (
     }
   }
 
+  FDKsetAllocCounter(prevCounter);
+  FDKsetAllocator(prevAllocator);
+
   return err;
 }
 
@@ -422,6 +431,20 @@ aacDecoder_SetParam ( const HANDLE_AACDECODER  self,   /*!< Handle of the decode
     self->outputInterleaved = value;
     break;
 
+  case AAC_PCM_OUTPUT_FORMAT:
+    if (value < AACDEC_PCM_S16 || value > AACDEC_PCM_F32) {
+      return AAC_DEC_SET_PARAM_FAIL;
+    }
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    if (self->pcmOutputFormat != value) {
+      /* The limiter keeps its delayed signal at a scaling depending on the sample width. */
+      resetLimiter(self->hLimiter);
+    }
+    self->pcmOutputFormat = value;
+    break;
+
   case AAC_PCM_MIN_OUTPUT_CHANNELS:
     if (value < -1 || value > (8)) {
       return AAC_DEC_SET_PARAM_FAIL;
@@ -468,6 +491,16 @@ aacDecoder_SetParam ( const HANDLE_AACDECODER  self,   /*!< Handle of the decode
     }
     break;
 
+  case AAC_PCM_FREQ_DOMAIN_DOWNMIX:
+    if (value < 0 || value > 1) {
+      return AAC_DEC_SET_PARAM_FAIL;
+    }
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    self->fdDmxEnable = value;
+    break;
+
   case AAC_PCM_DUAL_CHANNEL_OUTPUT_MODE:
     {
       PCMDMX_ERROR err;
@@ -631,14 +664,31 @@ aacDecoder_SetParam ( const HANDLE_AACDECODER  self,   /*!< Handle of the decode
 
 
 LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT nrOfLayers)
+{
+  return aacDecoder_OpenWithAllocator(transportFmt, nrOfLayers, NULL);
+}
+
+LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_OpenWithAllocator(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, const FDK_ALLOCATOR *pAllocator)
 {
   AAC_DECODER_INSTANCE *aacDec = NULL;
   HANDLE_TRANSPORTDEC pIn;
+  const FDK_ALLOCATOR *prevAllocator;
+  UINT *prevCounter;
+  UINT memorySize = 0;
   int err = 0;
 
+  /* Select the kernel implementations for the host CPU. */
+  FDK_initCpuFeatures();
+
+  prevAllocator = FDKsetAllocator(pAllocator);
+  /* Count into a local until the instance exists. */
+  prevCounter = FDKsetAllocCounter(&memorySize);
+
   /* Allocate transport layer struct. */
   pIn = transportDec_Open(transportFmt, TP_FLAG_MPEG4);
   if (pIn == NULL) {
+    FDKsetAllocCounter(prevCounter);
+    FDKsetAllocator(prevAllocator);
     return NULL;
   }
 
@@ -653,6 +703,11 @@ LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT
   }
   aacDec->hInput = pIn;
 
+  /* Keep a copy of the allocator for the allocations following in later calls. */
+  if (pAllocator != NULL) {
+    aacDec->allocator = *pAllocator;
+  }
+
   aacDec->nrOfLayers = nrOfLayers;
 
   aacDec->channelOutputMapping = channelMappingTableWAV;
@@ -675,7 +730,8 @@ LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT
     goto bail;
   }
 
-  aacDec->hLimiter = createLimiter(TDL_ATTACK_DEFAULT_MS, TDL_RELEASE_DEFAULT_MS, SAMPLE_MAX, (8), 96000);
+  /* The delay buffer of the limiter grows with the output channels in aacDecoder_DecodeFrame(). */
+  aacDec->hLimiter = createLimiter(TDL_ATTACK_DEFAULT_MS, TDL_RELEASE_DEFAULT_MS, SAMPLE_MAX, 1, 96000);
   if (NULL == aacDec->hLimiter) {
     err = -1;
     goto bail;
@@ -683,6 +739,10 @@ LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT
   aacDec->limiterEnableUser = (UCHAR)-1;
   aacDec->limiterEnableCurr = 0;
 
+  aacDec->fdDmxEnable = 0;
+
+  aacDec->batchWorker = -1;
+
 
 
   /* Assure that all modules have same delay */
@@ -696,9 +756,75 @@ bail:
     aacDecoder_Close(aacDec);
     aacDec = NULL;
   }
+  if (aacDec != NULL) {
+    aacDec->memorySize = memorySize;
+  }
+  FDKsetAllocCounter(prevCounter);
+  FDKsetAllocator(prevAllocator);
   return aacDec;
 }
 
+LINKSPEC_CPP UINT aacDecoder_GetRequiredMemory(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UINT maxChannels)
+{
+  FDK_ARENA measure;
+  HANDLE_AACDECODER self;
+  INT nChannels = ( (maxChannels == 0) || (maxChannels > (8)) ) ? (8) : (INT)maxChannels;
+
+  /* Measure the allocations of a new instance. */
+  FDKarenaInit(&measure, NULL, 0);
+  self = aacDecoder_OpenWithAllocator(transportFmt, nrOfLayers, &measure.allocator);
+  if (self == NULL) {
+    return 0;
+  }
+  aacDecoder_Close(self);
+
+  /* Add the modules allocated depending on the stream configuration. */
+  return FDKarenaGetOverhead()
+       + measure.used
+       + FDKarenaGetBlockSize(getLimiterDelayBufferSize(TDL_ATTACK_DEFAULT_MS, nChannels, 96000))
+       + CAacDecoder_GetRequiredChannelMemory(nChannels)
+       + sbrDecoder_GetRequiredMemory(nChannels)
+       + CAacDecoder_FdDmxGetRequiredMemory();
+}
+
+LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_OpenWithMemory(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, void *pMemory, UINT memorySize)
+{
+  FDK_ARENA *pArena = FDKarenaCreate(pMemory, memorySize);
+
+  if (pArena == NULL) {
+    return NULL;
+  }
+
+  return aacDecoder_OpenWithAllocator(transportFmt, nrOfLayers, &pArena->allocator);
+}
+
+LINKSPEC_CPP UINT aacDecoder_GetScratchSize(UINT maxChannels)
+{
+  return CAacDecoder_GetScratchSize( ((maxChannels == 0) || (maxChannels > (8))) ? (8) : (INT)maxChannels );
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SetScratch(HANDLE_AACDECODER self, void *pScratch, UINT scratchSize)
+{
+  AAC_DECODER_ERROR err;
+  const FDK_ALLOCATOR *prevAllocator;
+  UINT *prevCounter;
+
+  if (self == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  /* Unbinding allocates the work buffers of the instance. */
+  prevAllocator = FDKsetAllocator(&self->allocator);
+  prevCounter = FDKsetAllocCounter(&self->memorySize);
+
+  err = CAacDecoder_SetScratch(self, pScratch, scratchSize);
+
+  FDKsetAllocCounter(prevCounter);
+  FDKsetAllocator(prevAllocator);
+
+  return err;
+}
+
 LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_Fill(
         HANDLE_AACDECODER   self,
         UCHAR              *pBuffer[],
@@ -778,6 +904,188 @@ static INT aacDecoder_EstimateNumberOfLostFrames(HANDLE_AACDECODER self)
   return n;
 }
 
+/**
+ * \brief Convert 32 bit fixed point output samples into float samples in place.
+ */
+static void aacDecoder_ConvertToFloat(INT_PCM *pTimeData, const INT nSamples)
+{
+  FIXP_DBL *pIn = (FIXP_DBL*)pTimeData;
+  float *pOut = (float*)pTimeData;
+  INT i;
+
+  for (i = 0; i < nSamples; i++) {
+    pOut[i] = FX_DBL2FL(pIn[i]);
+  }
+}
+
+/* Frames decoded without output after aacDecoder_Seek() to settle the filter bank overlap, the time
+   differential coded SBR envelopes and the parametric stereo parameters, in addition to the error
+   concealment delay. The low delay filter bank of ELD overlaps 3 frames, but its output only matches a
+   continuous decoding bit-exactly after 12 frames. */
+#define AACDEC_SEEK_PREROLL_FRAMES      6
+#define AACDEC_SEEK_PREROLL_FRAMES_ELD 12
+
+/**
+ * \brief Decode the pre-roll frames after a seek into the output buffer of the caller and discard them.
+ */
+static AAC_DECODER_ERROR aacDecoder_SeekPreRoll(HANDLE_AACDECODER self, INT_PCM *pTimeData, const INT timeDataSize, const UINT flags)
+{
+  AAC_DECODER_ERROR ErrorStatus = AAC_DEC_OK;
+  INT skipSamples = self->seekSkipSamples;
+
+  while (self->seekPreRollFrames > 0) {
+    INT preRollFrames = self->seekPreRollFrames;
+
+    /* Decode as regular frame. */
+    self->seekPreRollFrames = 0;
+    self->seekSkipSamples = 0;
+    ErrorStatus = aacDecoder_DecodeFrame(self, pTimeData, timeDataSize, flags);
+    self->seekSkipSamples = skipSamples;
+
+    if (ErrorStatus == AAC_DEC_NOT_ENOUGH_BITS) {
+      self->seekPreRollFrames = preRollFrames;
+      break;
+    }
+    self->seekPreRollFrames = preRollFrames - 1;
+    if ( ! IS_OUTPUT_VALID(ErrorStatus) ) {
+      break;
+    }
+  }
+
+  return IS_OUTPUT_VALID(ErrorStatus) ? AAC_DEC_OK : ErrorStatus;
+}
+
+/**
+ * \brief Drop the leading samples of the first output frame after a seek.
+ */
+static void aacDecoder_SeekTrimFrame(HANDLE_AACDECODER self, INT_PCM *pTimeData, const INT interleaved)
+{
+  INT frameSize = self->streamInfo.frameSize;
+  INT numChannels = self->streamInfo.numChannels;
+  INT skip = fixMin(self->seekSkipSamples, frameSize);
+  INT sampleSize = (self->pcmOutputFormat == AACDEC_PCM_S16) ? (INT)sizeof(INT_PCM) : (INT)sizeof(FIXP_DBL);
+  UCHAR *pOut = (UCHAR*)pTimeData;
+
+  if (interleaved) {
+    FDKmemmove(pOut, pOut + skip*numChannels*sampleSize, (frameSize-skip)*numChannels*sampleSize);
+  } else {
+    INT ch;
+
+    for (ch = 0; ch < numChannels; ch++) {
+      FDKmemmove(pOut + ch*(frameSize-skip)*sampleSize, pOut + (ch*frameSize+skip)*sampleSize, (frameSize-skip)*sampleSize);
+    }
+  }
+
+  self->streamInfo.frameSize = frameSize - skip;
+  self->seekSkipSamples = 0;
+}
+
+/**
+ * \brief Configure the SBR decoder for the current frame ahead of sbrDecoder_Apply() or sbrDecoder_Skip().
+ */
+static void aacDecoder_SbrSetParams(HANDLE_AACDECODER self, const UINT flags)
+{
+  sbrDecoder_SetParam ( self->hSbrDecoder,
+                        SBR_SYSTEM_BITSTREAM_DELAY,
+                        self->sbrParams.bsDelay);
+  sbrDecoder_SetParam ( self->hSbrDecoder,
+                        SBR_FLUSH_DATA,
+                        (flags & AACDEC_FLUSH) );
+
+  if ( self->streamInfo.aot == AOT_ER_AAC_ELD ) {
+    /* Configure QMF */
+    sbrDecoder_SetParam ( self->hSbrDecoder,
+                          SBR_LD_QMF_TIME_ALIGN,
+                          (self->flags & AC_LD_MPS) ? 1 : 0 );
+  }
+
+  {
+    PCMDMX_ERROR dmxErr;
+    INT  maxOutCh = 0;
+
+    dmxErr = pcmDmx_GetParam(self->hPcmUtils, MAX_NUMBER_OF_OUTPUT_CHANNELS, &maxOutCh);
+    if ( (dmxErr == PCMDMX_OK) && (maxOutCh == 1) ) {
+      /* Disable PS processing if we have to create a mono output signal. */
+      self->psPossible = 0;
+    }
+  }
+}
+
+/**
+ * \brief Pass a parse only frame through the SBR decoder. The SBR header handling, the envelope
+ *        decoding and the noise generators advance like in a regular decoding, so that seeking
+ *        after an inspection continues with the same SBR state as after decoding.
+ */
+static void aacDecoder_InspectSbr(HANDLE_AACDECODER self, const AAC_DECODER_ERROR ErrorStatus, const UINT flags)
+{
+  CAacDecoder_SyncQmfMode(self);
+
+  if ( !self->sbrEnabled ) {
+    return;
+  }
+
+  aacDecoder_SbrSetParams(self, flags);
+
+  sbrDecoder_Skip ( self->hSbrDecoder,
+                    self->streamInfo.numChannels,
+                    (self->frameOK && (ErrorStatus == AAC_DEC_OK) && !(flags & AACDEC_CONCEAL)),
+                   &self->psPossible );
+}
+
+/**
+ * \brief Update the stream info after a parse only frame as if SBR and PS had been applied.
+ */
+static void aacDecoder_InspectStreamInfo(HANDLE_AACDECODER self)
+{
+  AACDEC_FRAME_INFO *pInfo = self->pFrameInfo;
+  INT sbrSampleRate = 0, psData = 0;
+
+  pInfo->sbrPresent = (pInfo->sbrBits > 0) ? 1 : 0;
+
+  if (self->sbrEnabled) {
+    sbrDecoder_GetParseInfo(self->hSbrDecoder, &sbrSampleRate, &psData);
+  }
+  if (sbrSampleRate > 0) {
+    self->flags |= AC_SBR_PRESENT;
+    if (sbrSampleRate != self->streamInfo.aacSampleRate) {
+      /* Same upsampling factors as in aacDecoder_DecodeFrame(). */
+      self->streamInfo.frameSize = (self->streamInfo.aacSamplesPerFrame == 768)
+                                 ? (self->streamInfo.aacSamplesPerFrame*8)/3
+                                 : self->streamInfo.aacSamplesPerFrame*2;
+    }
+    self->streamInfo.sampleRate = sbrSampleRate;
+  }
+  if (psData && (self->streamInfo.numChannels == 1)) {
+    pInfo->psPresent = 1;
+    self->flags |= AC_PS_PRESENT;
+    self->streamInfo.numChannels = 2;
+    self->channelType[0] = ACT_FRONT;
+    self->channelType[1] = ACT_FRONT;
+    self->channelIndices[0] = 0;
+    self->channelIndices[1] = 1;
+  }
+
+  self->streamInfo.flags = self->flags;
+  self->seekSkipSamples = 0;
+}
+
+/**
+ * \brief Account the stage times of the current frame to the profiling counters.
+ */
+static void aacDecoder_ProfileFrame(HANDLE_AACDECODER self, FDK_PROFILE_TICKS frameStart)
+{
+  int stage;
+
+  FDKprofileStop(frameStart, &self->profileTicks[AACDEC_PROF_FRAME]);
+  self->profileTicks[AACDEC_PROF_TNS] = self->aacCommonData.tnsTicks;
+
+  for (stage = 0; stage < AACDEC_PROFILE_STAGES; stage++) {
+    if (self->profileTicks[stage] > 0) {
+      FDKprofileAdd(&self->profile[stage], self->profileTicks[stage]);
+    }
+  }
+}
+
 LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
         HANDLE_AACDECODER  self,
         INT_PCM           *pTimeData,
@@ -788,19 +1096,42 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
     INT layer;
     INT nBits;
     INT interleaved = self->outputInterleaved;
+    INT sampleBits;
     HANDLE_FDK_BITSTREAM hBs;
+    const FDK_ALLOCATOR *prevAllocator;
+    UINT *prevCounter;
     int fTpInterruption = 0;  /* Transport originated interruption detection. */
     int fTpConceal = 0;       /* Transport originated concealment. */
+    FDK_PROFILE_TICKS profileStart;
 
 
     if (self == NULL) {
       return AAC_DEC_INVALID_HANDLE;
     }
 
+    /* A configuration change in the bitstream allocates memory. */
+    prevAllocator = FDKsetAllocator(&self->allocator);
+    prevCounter = FDKsetAllocCounter(&self->memorySize);
+
+    if ( (self->seekPreRollFrames > 0) && !(flags & (AACDEC_CONCEAL|AACDEC_FLUSH)) && (self->pFrameInfo == NULL) ) {
+      ErrorStatus = aacDecoder_SeekPreRoll(self, pTimeData, timeDataSize, flags);
+      if (ErrorStatus != AAC_DEC_OK) {
+        FDKsetAllocCounter(prevCounter);
+        FDKsetAllocator(prevAllocator);
+        return ErrorStatus;
+      }
+    }
+
+    profileStart = FDKprofileStart();
+    FDKmemclear(self->profileTicks, sizeof(self->profileTicks));
+    self->aacCommonData.tnsTicks = 0;
+
     if (flags & AACDEC_INTR) {
       self->streamInfo.numLostAccessUnits = 0;
     }
 
+    sampleBits = (self->pcmOutputFormat == AACDEC_PCM_S16) ? SAMPLE_BITS : DFRACT_BITS;
+
     hBs = transportDec_GetBitstream(self->hInput, 0);
 
     /* Get current bits position for bitrate calculation. */
@@ -897,8 +1228,22 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
       self->streamInfo.sampleRate = self->streamInfo.aacSampleRate;
       self->streamInfo.frameSize  = self->streamInfo.aacSamplesPerFrame;
     }
-    self->streamInfo.numChannels = self->streamInfo.aacNumChannels;
+    /* A frequency domain downmix already reduced the number of output channels. */
+    self->streamInfo.numChannels = (self->fdDmxChannels > 0) ? self->fdDmxChannels : self->streamInfo.aacNumChannels;
 
+    if (self->pSpectralFrame != NULL) {
+      /* Spectral output: no SBR, downmix or limiter. */
+      self->streamInfo.flags = self->flags;
+      self->seekSkipSamples = 0;
+      goto bail;
+    }
+
+    if (self->pFrameInfo != NULL) {
+      /* Stream inspection: report the output format without any signal processing. */
+      aacDecoder_InspectSbr(self, ErrorStatus, flags);
+      aacDecoder_InspectStreamInfo(self);
+      goto bail;
+    }
 
 
     CAacDecoder_SyncQmfMode(self);
@@ -915,42 +1260,21 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
       SBR_ERROR sbrError = SBRDEC_OK;
       int chOutMapIdx = ((self->chMapIndex==0) && (self->streamInfo.numChannels<7)) ? self->streamInfo.numChannels : self->chMapIndex;
 
-      /* set params */
-      sbrDecoder_SetParam ( self->hSbrDecoder,
-                            SBR_SYSTEM_BITSTREAM_DELAY,
-                            self->sbrParams.bsDelay);
-      sbrDecoder_SetParam ( self->hSbrDecoder,
-                            SBR_FLUSH_DATA,
-                            (flags & AACDEC_FLUSH) );
-
-      if ( self->streamInfo.aot == AOT_ER_AAC_ELD ) {
-        /* Configure QMF */
-        sbrDecoder_SetParam ( self->hSbrDecoder,
-                              SBR_LD_QMF_TIME_ALIGN,
-                              (self->flags & AC_LD_MPS) ? 1 : 0 );
-      }
-
-      {
-        PCMDMX_ERROR dmxErr;
-        INT  maxOutCh = 0;
-
-        dmxErr = pcmDmx_GetParam(self->hPcmUtils, MAX_NUMBER_OF_OUTPUT_CHANNELS, &maxOutCh);
-        if ( (dmxErr == PCMDMX_OK) && (maxOutCh == 1) ) {
-          /* Disable PS processing if we have to create a mono output signal. */
-          self->psPossible = 0;
-        }
-      }
+      aacDecoder_SbrSetParams(self, flags);
 
 
       /* apply SBR processing */
+      FDK_PROFILE_TICKS sbrStart = FDKprofileStart();
       sbrError = sbrDecoder_Apply ( self->hSbrDecoder,
                                     pTimeData,
                                    &self->streamInfo.numChannels,
                                    &self->streamInfo.sampleRate,
                                     self->channelOutputMapping[chOutMapIdx],
                                     interleaved,
+                                    sampleBits,
                                     self->frameOK,
                                    &self->psPossible);
+      FDKprofileStop(sbrStart, &self->profileTicks[AACDEC_PROF_SBR]);
 
 
      if (sbrError == SBRDEC_OK) {
@@ -985,38 +1309,48 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
     {
     INT pcmLimiterScale = 0;
     PCMDMX_ERROR dmxErr = PCMDMX_OK;
+    FDK_PROFILE_TICKS stageStart;
     if ( flags & (AACDEC_INTR | AACDEC_CLRHIST) ) {
       /* delete data from the past (e.g. mixdown coeficients) */
       pcmDmx_Reset( self->hPcmUtils, PCMDMX_RESET_BS_DATA );
     }
     /* do PCM post processing */
+    stageStart = FDKprofileStart();
     dmxErr = pcmDmx_ApplyFrame (
             self->hPcmUtils,
             pTimeData,
             self->streamInfo.frameSize,
            &self->streamInfo.numChannels,
             interleaved,
+            sampleBits,
             self->channelType,
             self->channelIndices,
             self->channelOutputMapping,
             (self->limiterEnableCurr) ? &pcmLimiterScale : NULL
       );
+    FDKprofileStop(stageStart, &self->profileTicks[AACDEC_PROF_PCM_DMX]);
     if (dmxErr == PCMDMX_INVALID_MODE) {
       /* Announce the framework that the current combination of channel configuration and downmix
        * settings are not know to produce a predictable behavior and thus maybe produce strange output. */
       ErrorStatus = AAC_DEC_DECODE_FRAME_ERROR;
     }
+    if (self->fdDmxChannels > 0) {
+      /* The frequency domain downmix left its headroom to the limiter. */
+      pcmLimiterScale = self->fdDmxOutScale;
+    }
 
     if ( flags & AACDEC_CLRHIST ) {
       /* Delete the delayed signal. */
       resetLimiter(self->hLimiter);
     }
-    if (self->limiterEnableCurr)
+    if ( self->limiterEnableCurr
+      && (setLimiterMaxChannels(self->hLimiter, self->streamInfo.numChannels) == TDLIMIT_OK) )
     {
       /* Set actual signal parameters */
       setLimiterNChannels(self->hLimiter, self->streamInfo.numChannels);
       setLimiterSampleRate(self->hLimiter, self->streamInfo.sampleRate);
 
+      stageStart = FDKprofileStart();
       applyLimiter(
               self->hLimiter,
               pTimeData,
@@ -1024,14 +1358,23 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
              &pcmLimiterScale,
               1,
               self->extGainDelay,
-              self->streamInfo.frameSize
+              self->streamInfo.frameSize,
+              sampleBits
               );
+      FDKprofileStop(stageStart, &self->profileTicks[AACDEC_PROF_LIMITER]);
 
       /* Announce the additional limiter output delay */
       self->streamInfo.outputDelay += getLimiterDelay(self->hLimiter);
     }
     }
 
+    if (self->pcmOutputFormat == AACDEC_PCM_F32) {
+      aacDecoder_ConvertToFloat(pTimeData, self->streamInfo.frameSize*self->streamInfo.numChannels);
+    }
+
+    if (self->seekSkipSamples > 0) {
+      aacDecoder_SeekTrimFrame(self, pTimeData, interleaved);
+    }
 
     /* Signal interruption to take effect in next frame. */
     if ( flags & AACDEC_FLUSH ) {
@@ -1046,9 +1389,189 @@ bail:
     /* Update Statistics */
     aacDecoder_UpdateBitStreamCounters(&self->streamInfo, hBs, nBits, ErrorStatus);
 
+    if ( IS_OUTPUT_VALID(ErrorStatus) && (self->pFrameInfo == NULL) ) {
+      aacDecoder_ProfileFrame(self, profileStart);
+    }
+
+    FDKsetAllocCounter(prevCounter);
+    FDKsetAllocator(prevAllocator);
+
+    return ErrorStatus;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeSpectralFrame(
+        HANDLE_AACDECODER      self,
+        AACDEC_SPECTRAL_FRAME *pFrame,
+        const UINT             flags)
+{
+    AAC_DECODER_ERROR ErrorStatus;
+
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    if (pFrame == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    if (self->flags & AC_ELD) {
+      return AAC_DEC_UNSUPPORTED_AOT;
+    }
+
+    self->pSpectralFrame = pFrame;
+    ErrorStatus = aacDecoder_DecodeFrame(self, NULL, 0, flags);
+    self->pSpectralFrame = NULL;
+
+    return ErrorStatus;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_InspectFrame(
+        HANDLE_AACDECODER   self,
+        AACDEC_FRAME_INFO  *pInfo,
+        const UINT          flags)
+{
+    AAC_DECODER_ERROR ErrorStatus;
+
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    if (pInfo == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+
+    FDKmemclear(pInfo, sizeof(AACDEC_FRAME_INFO));
+
+    self->pFrameInfo = pInfo;
+    ErrorStatus = aacDecoder_DecodeFrame(self, NULL, 0, flags);
+    self->pFrameInfo = NULL;
+
+    pInfo->frameOK = ( (ErrorStatus == AAC_DEC_OK) && self->frameOK && !(flags & AACDEC_CONCEAL) ) ? 1 : 0;
+
     return ErrorStatus;
 }
 
+/**
+ * \brief Find the frame from which decoding has to be restarted to output a given access unit.
+ *
+ * \param self            AAC decoder handle.
+ * \param hIndex          Frame index of the stream, holding at least one frame.
+ * \param auTarget        Target access unit.
+ * \param extraPreRoll    Pre-roll frames in addition to the default pre-roll.
+ * \return                Index of the restart frame, -1 if the access unit is behind the end of the stream.
+ */
+static INT aacDecoder_SeekFindEntry(
+        HANDLE_AACDECODER                self,
+        const HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UINT64                     auTarget,
+        const INT                        extraPreRoll)
+{
+    UINT64 auStart;
+    INT preRoll, entry;
+
+    if (auTarget * hIndex->samplesPerAu >= hIndex->numSamples) {
+      return -1;
+    }
+
+    preRoll  = (self->flags & AC_ELD) ? AACDEC_SEEK_PREROLL_FRAMES_ELD : AACDEC_SEEK_PREROLL_FRAMES;
+    preRoll += CConcealment_GetDelay(&self->concealCommonData) + extraPreRoll;
+
+    auStart = (auTarget > (UINT64)preRoll) ? auTarget - preRoll : 0;
+
+    /* Restart at the frame carrying the first pre-roll access unit. A decoder which has not been
+       configured yet has to start with a frame carrying the configuration. */
+    entry = aacDecoder_IndexFind(hIndex, auStart * hIndex->samplesPerAu);
+    if (self->streamInfo.aacSampleRate == 0) {
+      while ( (entry > 0) && !hIndex->pEntries[entry].configPresent ) {
+        entry--;
+      }
+    }
+
+    return entry;
+}
+
+/**
+ * \brief Restart decoding for a given access unit, see aacDecoder_Seek().
+ *
+ * \param self            AAC decoder handle.
+ * \param hIndex          Frame index of the stream.
+ * \param auTarget        Access unit of the first output frame.
+ * \param skipSamples     Samples per channel dropped from the first output frame.
+ * \param extraPreRoll    Pre-roll frames in addition to the default pre-roll.
+ * \param pByteOffset     Returns the stream position to continue filling the decoder from.
+ * \return                Error code.
+ */
+static AAC_DECODER_ERROR aacDecoder_SeekAccessUnit(
+        HANDLE_AACDECODER          self,
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UINT64               auTarget,
+        const INT                  skipSamples,
+        const INT                  extraPreRoll,
+        UINT64                    *pByteOffset)
+{
+    const AACDEC_FRAME_INDEX_ENTRY *pEntry;
+    INT entry;
+
+    entry = aacDecoder_SeekFindEntry(self, hIndex, auTarget, extraPreRoll);
+    if (entry < 0) {
+      return AAC_DEC_NOT_ENOUGH_BITS;
+    }
+    pEntry = &hIndex->pEntries[entry];
+
+    *pByteOffset = pEntry->byteOffset;
+    self->seekPreRollFrames = (INT)(auTarget - pEntry->samplePosition / hIndex->samplesPerAu);
+    self->seekSkipSamples = skipSamples;
+
+    /* Discard buffered input and the signal history of the previous position. The transport decoder
+       and the SBR decoder keep the configuration and header since the stream continues, the SBR state
+       is settled by the pre-roll frames. Restarting at the first frame resets the window sequence,
+       the DRC state, the SBR decoder and the noise generator like a new decoder instance, which
+       reproduces the output of a decoder started at the beginning of the stream. */
+    transportDec_SetParam(self->hInput, TPDEC_PARAM_FLUSH, 1);
+    self->streamInfo.numLostAccessUnits = 0;
+    CAacDecoder_ClearHistory(self);
+    if (entry == 0) {
+      INT ch;
+
+      for (ch = 0; ch < self->aacChannels; ch++) {
+        mdct_init( &self->pAacDecoderStaticChannelInfo[ch]->IMdct,
+                    self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer,
+                    OverlapBufferSize );
+        aacDecoder_drcInitChannelData( &self->pAacDecoderStaticChannelInfo[ch]->drcData );
+      }
+      sbrDecoder_SetParam(self->hSbrDecoder, SBR_CLEAR_HISTORY, 1);
+      self->aacCommonData.pnsCurrentSeed = 0;
+      FDKmemclear(self->aacCommonData.pnsRandomSeed, sizeof(self->aacCommonData.pnsRandomSeed));
+    }
+    pcmDmx_Reset(self->hPcmUtils, PCMDMX_RESET_BS_DATA);
+    resetLimiter(self->hLimiter);
+
+    return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_Seek(
+        HANDLE_AACDECODER          self,
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UINT64               samplePosition,
+        UINT64                    *pByteOffset)
+{
+    UINT64 auTarget;
+    INT outFrameSize;
+
+    if ( (self == NULL) || (hIndex == NULL) || (pByteOffset == NULL) ) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    if (hIndex->samplesPerAu == 0) {
+      return AAC_DEC_NOT_ENOUGH_BITS;
+    }
+
+    /* Output samples per access unit. The SBR upsampling is known after the first decoded frame only. */
+    outFrameSize = hIndex->samplesPerAu;
+    if ( (self->streamInfo.aacSampleRate > 0) && (self->streamInfo.sampleRate > 0) ) {
+      outFrameSize = (INT)(((INT64)hIndex->samplesPerAu * self->streamInfo.sampleRate) / self->streamInfo.aacSampleRate);
+    }
+    auTarget = samplePosition / outFrameSize;
+
+    return aacDecoder_SeekAccessUnit(self, hIndex, auTarget, (INT)(samplePosition - auTarget * outFrameSize), 0, pByteOffset);
+}
+
 LINKSPEC_CPP void aacDecoder_Close ( HANDLE_AACDECODER self )
 {
   if (self == NULL)
@@ -1077,11 +1600,525 @@ LINKSPEC_CPP void aacDecoder_Close ( HANDLE_AACDECODER self )
 }
 
 
+/****************************************************************************
+                              Batch Decoding
+****************************************************************************/
+
+struct AAC_DECODER_BATCH {
+  HANDLE_FDK_WORKER_POOL  hPool;
+  INT                    *pHomeWorker;   /* preferred worker of each job of the current batch */
+  UINT                    homeWorkerSize;
+};
+
+H_ALLOC_MEM (AacDecoderBatch, AAC_DECODER_BATCH)
+C_ALLOC_MEM (AacDecoderBatch, AAC_DECODER_BATCH, 1)
+
+static void aacDecoder_BatchJob(void *pJobData, INT jobIndex, INT workerIndex)
+{
+  AACDEC_BATCH_JOB *pJob = &((AACDEC_BATCH_JOB*)pJobData)[jobIndex];
+  HANDLE_AACDECODER self = pJob->hDecoder;
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+
+  if (pJob->errorStatus != AAC_DEC_OK) {
+    return; /* rejected by aacDecoder_BatchDecode() */
+  }
+
+  if (pJob->pBuffer != NULL) {
+    err = aacDecoder_Fill(self, &pJob->pBuffer, &pJob->bufferSize, &pJob->bytesValid);
+  }
+  if (err == AAC_DEC_OK) {
+    err = aacDecoder_DecodeFrame(self, pJob->pTimeData, pJob->timeDataSize, pJob->flags);
+  }
+
+  /* Keep the handle on this worker in the next batch. */
+  self->batchWorker = workerIndex;
+
+  pJob->errorStatus = err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_BatchOpen(HANDLE_AAC_DECODER_BATCH *phBatch, const UINT nThreads, const UINT bindThreads)
+{
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  HANDLE_AAC_DECODER_BATCH hBatch = NULL;
+
+  if (phBatch == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *phBatch = NULL;
+
+  if ( (nThreads < 1) || (nThreads > FDK_MAX_WORKERS) ) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+
+  hBatch = GetAacDecoderBatch();
+  if (hBatch == NULL) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+    goto bail;
+  }
+  FDKmemclear(hBatch, sizeof(AAC_DECODER_BATCH));
+
+  if (nThreads > 1) {
+    if (FDKworkerPoolOpen(&hBatch->hPool, (INT)nThreads) != 0) {
+      err = AAC_DEC_OUT_OF_MEMORY;
+      goto bail;
+    }
+    if (bindThreads) {
+      FDKworkerPoolBindThreads(hBatch->hPool); /* best effort, not supported on all platforms */
+    }
+  }
+
+  *phBatch = hBatch;
+  return err;
+
+bail:
+  aacDecoder_BatchClose(&hBatch);
+  return err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_BatchDecode(HANDLE_AAC_DECODER_BATCH hBatch, AACDEC_BATCH_JOB *pJobs, const UINT nJobs)
+{
+  INT nWorkers;
+  UINT i;
+
+  if ( (hBatch == NULL) || ((pJobs == NULL) && (nJobs > 0)) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  if (nJobs > hBatch->homeWorkerSize) {
+    if (hBatch->pHomeWorker != NULL) {
+      FDKfree(hBatch->pHomeWorker);
+    }
+    hBatch->homeWorkerSize = 0;
+    hBatch->pHomeWorker = (INT*)FDKcalloc(nJobs, sizeof(INT));
+    if (hBatch->pHomeWorker == NULL) {
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    hBatch->homeWorkerSize = nJobs;
+  }
+
+  nWorkers = FDKworkerPoolGetNumWorkers(hBatch->hPool);
+
+  /* A decoder instance must not be processed by two workers at the same time. */
+  for (i = 0; i < nJobs; i++) {
+    if (pJobs[i].hDecoder != NULL) {
+      pJobs[i].hDecoder->batchQueued = 0;
+    }
+  }
+  for (i = 0; i < nJobs; i++) {
+    HANDLE_AACDECODER self = pJobs[i].hDecoder;
+
+    pJobs[i].errorStatus = AAC_DEC_OK;
+    hBatch->pHomeWorker[i] = -1;
+
+    if ( (self == NULL) || self->batchQueued ) {
+      pJobs[i].errorStatus = AAC_DEC_INVALID_HANDLE;
+      continue;
+    }
+    self->batchQueued = 1;
+
+    if (self->batchWorker < nWorkers) {
+      hBatch->pHomeWorker[i] = self->batchWorker;
+    }
+  }
+
+  FDKworkerPoolRunAffine(hBatch->hPool, aacDecoder_BatchJob, (void*)pJobs, (INT)nJobs, hBatch->pHomeWorker);
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP void aacDecoder_BatchClose(HANDLE_AAC_DECODER_BATCH *phBatch)
+{
+  if ( (phBatch == NULL) || (*phBatch == NULL) ) {
+    return;
+  }
+
+  FDKworkerPoolClose(&(*phBatch)->hPool);
+
+  if ((*phBatch)->pHomeWorker != NULL) {
+    FDKfree((*phBatch)->pHomeWorker);
+  }
+
+  FreeAacDecoderBatch(phBatch);
+}
+
+/****************************************************************************
+                         Segment Parallel Decoding
+****************************************************************************/
+
+#define AACDEC_SEGMENTS_FRAME_SIZE  ( (8)*2048 )  /* samples of the largest output frame of all channels */
+#define AACDEC_SEGMENTS_MIN_FRAMES  ( 32 )        /* minimum access units per segment, keeps the share of the pre-roll small */
+#define AACDEC_SEGMENTS_PREROLL_FRAMES ( 10 )     /* extra pre-roll until the recursive PS and limiter states match the serial decoding */
+
+typedef struct {
+  HANDLE_AACDECODER          hDecoder;
+  HANDLE_AACDEC_FRAME_INDEX  hIndex;
+  const UCHAR               *pStream;
+  UINT64                     streamSize;
+  UINT64                     auFirst;      /* first access unit of the segment */
+  UINT64                     auEnd;        /* access unit behind the segment */
+  INT                        frameSize;    /* output samples per channel and access unit */
+  INT                        numChannels;
+  INT                        frameBytes;   /* output bytes per access unit */
+  UCHAR                     *pTimeData;    /* output of the first access unit of the segment */
+  FIXP_DBL                  *pFrame;       /* output buffer of the decoder, also receives the pre-roll */
+  UINT64                     auDecoded;    /* access units written to pTimeData */
+  AAC_DECODER_ERROR          err;
+} AACDEC_SEGMENT_JOB;
+
+struct AACDEC_SEGMENTS {
+  HANDLE_AACDECODER       hDecoder[AACDEC_SEGMENTS_MAX_DECODERS];
+  UINT                    nDecoders;
+
+  INT                     frameSize;     /* output samples per channel and access unit of the current stream */
+  INT                     numChannels;   /* output channels of the current stream */
+
+  HANDLE_FDK_WORKER_POOL  hPool;         /* one worker per decoder instance */
+  FIXP_DBL               *pFrames;       /* one output frame per decoder instance */
+  AACDEC_SEGMENT_JOB      job[AACDEC_SEGMENTS_MAX_DECODERS];
+};
+
+H_ALLOC_MEM (AacDecoderSegments, AACDEC_SEGMENTS)
+C_ALLOC_MEM (AacDecoderSegments, AACDEC_SEGMENTS, 1)
+
+/**
+ * \brief Pass the stream from the given position on to the input buffer of a decoder, as far as it fits.
+ */
+static void aacDecoder_SegmentFill(HANDLE_AACDECODER self, const UCHAR *pStream, const UINT64 streamSize, UINT64 *pPosition)
+{
+  UCHAR *pBuffer = (UCHAR*)pStream + *pPosition;
+  UINT bufferSize = (streamSize - *pPosition > (UINT64)0x7FFFFFFF) ? 0x7FFFFFFF : (UINT)(streamSize - *pPosition);
+  UINT bytesValid = bufferSize;
+
+  aacDecoder_Fill(self, &pBuffer, &bufferSize, &bytesValid);
+
+  *pPosition += bufferSize - bytesValid;
+}
+
+/**
+ * \brief Decode one segment of a stream: restart the decoder in front of the segment and write the output
+ *        of the access units of the segment.
+ */
+static void aacDecoder_SegmentJob(void *pJobData, INT jobIndex, INT workerIndex)
+{
+  AACDEC_SEGMENT_JOB *job = &((AACDEC_SEGMENT_JOB*)pJobData)[jobIndex];
+  HANDLE_AACDECODER self = job->hDecoder;
+  HANDLE_AACDEC_FRAME_INDEX hIndex = job->hIndex;
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  UINT64 position, auParsed = 0;
+  INT entry;
+
+  job->auDecoded = 0;
+  job->err = AAC_DEC_OK;
+
+  /* Start over like a new decoder instance. */
+  aacDecoder_Seek(self, hIndex, 0, &position);
+
+  /* The noise generators of PNS and SBR and the SBR envelope history depend on all preceding frames.
+     Parsing the frames in front of the restart frame advances them exactly like decoding would, the
+     pre-roll of aacDecoder_Seek() then rebuilds the signal history. */
+  while ( ((entry = aacDecoder_SeekFindEntry(self, hIndex, job->auFirst, AACDEC_SEGMENTS_PREROLL_FRAMES)) >= 0)
+       && (auParsed < hIndex->pEntries[entry].samplePosition / hIndex->samplesPerAu) )
+  {
+    AACDEC_FRAME_INFO info;
+
+    err = aacDecoder_InspectFrame(self, &info, 0);
+    if (err == AAC_DEC_NOT_ENOUGH_BITS) {
+      if (position >= job->streamSize) {
+        break;
+      }
+      aacDecoder_SegmentFill(self, job->pStream, job->streamSize, &position);
+      continue;
+    }
+    auParsed++;
+  }
+
+  err = aacDecoder_SeekAccessUnit(self, hIndex, job->auFirst, 0, AACDEC_SEGMENTS_PREROLL_FRAMES, &position);
+
+  while ( (err == AAC_DEC_OK) && (job->auDecoded < job->auEnd - job->auFirst) ) {
+    AAC_DECODER_ERROR decErr = aacDecoder_DecodeFrame(self, (INT_PCM*)job->pFrame, AACDEC_SEGMENTS_FRAME_SIZE, 0);
+
+    if (decErr == AAC_DEC_NOT_ENOUGH_BITS) {
+      if (position >= job->streamSize) {
+        break;
+      }
+      aacDecoder_SegmentFill(self, job->pStream, job->streamSize, &position);
+      continue;
+    }
+    if ( !IS_OUTPUT_VALID(decErr) ) {
+      err = decErr;
+      break;
+    }
+    if ( (self->streamInfo.frameSize != job->frameSize) || (self->streamInfo.numChannels != job->numChannels) ) {
+      err = AAC_DEC_UNSUPPORTED_FORMAT;
+      break;
+    }
+    if ( (decErr != AAC_DEC_OK) && (job->err == AAC_DEC_OK) ) {
+      job->err = decErr;  /* concealed frame, keep going like a serial decoding */
+    }
+
+    FDKmemcpy(job->pTimeData + job->auDecoded * job->frameBytes, job->pFrame, job->frameBytes);
+    job->auDecoded++;
+  }
+
+  if (err != AAC_DEC_OK) {
+    job->err = err;
+  }
+}
+
+/**
+ * \brief Decode the first frame of the stream to find out the output frame size and channels.
+ */
+static AAC_DECODER_ERROR aacDecoder_SegmentsProbe(
+        HANDLE_AACDEC_SEGMENTS     hSegments,
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UCHAR               *pStream,
+        const UINT64               streamSize)
+{
+  HANDLE_AACDECODER self = hSegments->hDecoder[0];
+  AAC_DECODER_ERROR err;
+  UINT64 position;
+  UINT n;
+
+  for (n = 1; n < hSegments->nDecoders; n++) {
+    /* The segments are joined sample by sample. */
+    if ( (hSegments->hDecoder[n]->pcmOutputFormat != self->pcmOutputFormat)
+      || (hSegments->hDecoder[n]->outputInterleaved != self->outputInterleaved) )
+    {
+      return AAC_DEC_SET_PARAM_FAIL;
+    }
+  }
+
+  if ( (err = aacDecoder_Seek(self, hIndex, 0, &position)) != AAC_DEC_OK ) {
+    return err;
+  }
+
+  while ( ((err = aacDecoder_DecodeFrame(self, (INT_PCM*)hSegments->pFrames, AACDEC_SEGMENTS_FRAME_SIZE, 0)) == AAC_DEC_NOT_ENOUGH_BITS)
+       && (position < streamSize) )
+  {
+    aacDecoder_SegmentFill(self, pStream, streamSize, &position);
+  }
+
+  if ( !IS_OUTPUT_VALID(err) ) {
+    return err;
+  }
+
+  hSegments->frameSize   = self->streamInfo.frameSize;
+  hSegments->numChannels = self->streamInfo.numChannels;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SegmentsOpen(HANDLE_AACDEC_SEGMENTS *phSegments, const HANDLE_AACDECODER *phDecoders, const UINT nDecoders)
+{
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  HANDLE_AACDEC_SEGMENTS hSegments = NULL;
+  UINT n;
+
+  if ( (phSegments == NULL) || (phDecoders == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *phSegments = NULL;
+
+  if ( (nDecoders < 1) || (nDecoders > AACDEC_SEGMENTS_MAX_DECODERS) ) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+  for (n = 0; n < nDecoders; n++) {
+    if (phDecoders[n] == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+  }
+
+  hSegments = GetAacDecoderSegments();
+  if (hSegments == NULL) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+    goto bail;
+  }
+  FDKmemclear(hSegments, sizeof(AACDEC_SEGMENTS));
+
+  for (n = 0; n < nDecoders; n++) {
+    hSegments->hDecoder[n] = phDecoders[n];
+  }
+  hSegments->nDecoders = nDecoders;
+
+  hSegments->pFrames = (FIXP_DBL*)FDKcalloc(nDecoders * AACDEC_SEGMENTS_FRAME_SIZE, sizeof(FIXP_DBL));
+  if (hSegments->pFrames == NULL) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+    goto bail;
+  }
+
+  if (nDecoders > 1) {
+    if (FDKworkerPoolOpen(&hSegments->hPool, (INT)nDecoders) != 0) {
+      err = AAC_DEC_OUT_OF_MEMORY;
+      goto bail;
+    }
+  }
+
+  *phSegments = hSegments;
+  return err;
+
+bail:
+  aacDecoder_SegmentsClose(&hSegments);
+  return err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SegmentsGetTimeDataSize(
+        HANDLE_AACDEC_SEGMENTS     hSegments,
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UCHAR               *pStream,
+        const UINT64               streamSize,
+        UINT64                    *pTimeDataSize)
+{
+  AAC_DECODER_ERROR err;
+
+  if ( (hSegments == NULL) || (hIndex == NULL) || (pStream == NULL) || (pTimeDataSize == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *pTimeDataSize = 0;
+
+  if (hIndex->samplesPerAu == 0) {
+    return AAC_DEC_NOT_ENOUGH_BITS;
+  }
+  if ( (err = aacDecoder_SegmentsProbe(hSegments, hIndex, pStream, streamSize)) != AAC_DEC_OK ) {
+    return err;
+  }
+
+  *pTimeDataSize = (hIndex->numSamples / hIndex->samplesPerAu) * hSegments->frameSize * hSegments->numChannels;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SegmentsDecode(
+        HANDLE_AACDEC_SEGMENTS     hSegments,
+        HANDLE_AACDEC_FRAME_INDEX  hIndex,
+        const UCHAR               *pStream,
+        const UINT64               streamSize,
+        INT_PCM                   *pTimeData,
+        const UINT64               timeDataSize,
+        UINT64                    *pSamplesWritten)
+{
+  AAC_DECODER_ERROR err;
+  UINT64 numAu, requiredSize, auFirst;
+  INT sampleSize, nSegments, k;
+
+  if ( (hSegments == NULL) || (pTimeData == NULL) || (pSamplesWritten == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  *pSamplesWritten = 0;
+
+  if ( (err = aacDecoder_SegmentsGetTimeDataSize(hSegments, hIndex, pStream, streamSize, &requiredSize)) != AAC_DEC_OK ) {
+    return err;
+  }
+  if (timeDataSize < requiredSize) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+
+  numAu = hIndex->numSamples / hIndex->samplesPerAu;
+  sampleSize = (hSegments->hDecoder[0]->pcmOutputFormat == AACDEC_PCM_S16) ? (INT)sizeof(INT_PCM) : (INT)sizeof(FIXP_DBL);
+
+  /* Split at frame boundaries into up to one segment per decoder instance. */
+  nSegments = (numAu / AACDEC_SEGMENTS_MIN_FRAMES < (UINT64)hSegments->nDecoders) ? (INT)(numAu / AACDEC_SEGMENTS_MIN_FRAMES) : (INT)hSegments->nDecoders;
+  nSegments = fixMax(nSegments, 1);
+
+  for (k = 0, auFirst = 0; k < nSegments; k++) {
+    AACDEC_SEGMENT_JOB *job = &hSegments->job[k];
+    INT entryEnd = (k == nSegments-1) ? -1 : aacDecoder_IndexFind(hIndex, ((numAu * (k+1)) / nSegments) * hIndex->samplesPerAu);
+
+    job->hDecoder    = hSegments->hDecoder[k];
+    job->hIndex      = hIndex;
+    job->pStream     = pStream;
+    job->streamSize  = streamSize;
+    job->auFirst     = auFirst;
+    job->auEnd       = (entryEnd < 0) ? numAu : hIndex->pEntries[entryEnd].samplePosition / hIndex->samplesPerAu;
+    if (job->auEnd < auFirst) {
+      job->auEnd = auFirst;
+    }
+    job->frameSize   = hSegments->frameSize;
+    job->numChannels = hSegments->numChannels;
+    job->frameBytes  = hSegments->frameSize * hSegments->numChannels * sampleSize;
+    job->pTimeData   = (UCHAR*)pTimeData + auFirst * job->frameBytes;
+    job->pFrame      = hSegments->pFrames + k * AACDEC_SEGMENTS_FRAME_SIZE;
+    job->auDecoded   = 0;
+    job->err         = AAC_DEC_OK;
+
+    auFirst = job->auEnd;
+  }
+
+  FDKworkerPoolRun(hSegments->hPool, aacDecoder_SegmentJob, (void*)hSegments->job, nSegments);
+
+  /* The output ends at the first segment which ended early. */
+  for (k = 0; k < nSegments; k++) {
+    AACDEC_SEGMENT_JOB *job = &hSegments->job[k];
+
+    *pSamplesWritten += job->auDecoded * job->frameSize * job->numChannels;
+
+    if ( (job->err != AAC_DEC_OK) && (err == AAC_DEC_OK) ) {
+      err = job->err;
+    }
+    if (job->auDecoded < job->auEnd - job->auFirst) {
+      if (err == AAC_DEC_OK) {
+        err = AAC_DEC_NOT_ENOUGH_BITS;
+      }
+      break;
+    }
+  }
+
+  return err;
+}
+
+LINKSPEC_CPP void aacDecoder_SegmentsClose(HANDLE_AACDEC_SEGMENTS *phSegments)
+{
+  if ( (phSegments == NULL) || (*phSegments == NULL) ) {
+    return;
+  }
+
+  FDKworkerPoolClose(&(*phSegments)->hPool);
+
+  if ((*phSegments)->pFrames != NULL) {
+    FDKfree((*phSegments)->pFrames);
+  }
+
+  FreeAacDecoderSegments(phSegments);
+}
+
+
 LINKSPEC_CPP CStreamInfo* aacDecoder_GetStreamInfo ( HANDLE_AACDECODER self )
 {
   return CAacDecoder_GetStreamInfo(self);
 }
 
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetProfile (
+        HANDLE_AACDECODER  self,
+        AACDEC_PROFILE    *pProfile,
+        const INT          reset )
+{
+#ifdef FDK_PROFILE
+  FDK_PROFILE_COUNTER sbrProfile[SBRDEC_PROFILE_STAGES];
+
+  if ( (self == NULL) || (pProfile == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  FDKmemcpy(pProfile->stage, self->profile, sizeof(self->profile));
+  if (reset) {
+    FDKmemclear(self->profile, sizeof(self->profile));
+  }
+
+  /* The SBR sub stages are counted by the SBR decoder. */
+  if (sbrDecoder_GetProfile(self->hSbrDecoder, sbrProfile, reset) == SBRDEC_OK) {
+    pProfile->stage[AACDEC_PROF_SBR_LPP] = sbrProfile[SBRDEC_PROF_LPP];
+    pProfile->stage[AACDEC_PROF_SBR_ENV] = sbrProfile[SBRDEC_PROF_ENV];
+    pProfile->stage[AACDEC_PROF_PS]      = sbrProfile[SBRDEC_PROF_PS];
+  }
+
+  return AAC_DEC_OK;
+#else
+  if ( (self == NULL) || (pProfile == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  return AAC_DEC_UNKNOWN;
+#endif
+}
+
 LINKSPEC_CPP INT aacDecoder_GetLibInfo ( LIB_INFO *info )
 {
   int i;
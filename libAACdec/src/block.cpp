@@ -103,6 +103,10 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/block_arm.cpp"
+
+#elif defined(__x86__)
+#include "x86/block_x86.cpp"
+
 #endif
 
 /*!
@@ -382,7 +386,11 @@ AAC_DECODER_ERROR CBlock_ReadSectionData(HANDLE_FDK_BITSTREAM bs,
  * \param scale max allowed shift scale for the sfb.
  */
 static
+#ifndef FUNCTION_InverseQuantizeBand
 void InverseQuantizeBand( FIXP_DBL * RESTRICT spectrum,
+#else
+void InverseQuantizeBand_fallback( FIXP_DBL * RESTRICT spectrum,
+#endif
                               INT noLines,
                               INT lsb,
                               INT scale )
@@ -557,24 +565,44 @@ AAC_DECODER_ERROR  CBlock_ReadSpectralData(HANDLE_FDK_BITSTREAM bs,
             {
               int idx = CBlock_DecodeHuffmanWord(bs,hcb);
 
-              for (i=0; i<step; i++) {
-                FIXP_DBL tmp;
+              if (offset != 0) {
+                /* signed codebook: unpack the n-tuple */
+                for (i=0; i<step; i++) {
+                  mdctSpectrum[index+i] = (FIXP_DBL)((idx & mask)-offset);
+                  idx >>= bits;
+                }
+              }
+              else {
+                /* unsigned codebook: unpack the n-tuple and fetch all sign bits with one read */
+                int numSign = 0;
 
-                tmp = (FIXP_DBL)((idx & mask)-offset);
-                idx >>= bits;
+                for (i=0; i<step; i++) {
+                  int tmp = idx & mask;
+                  idx >>= bits;
 
-                if (offset == 0) {
-                  if (tmp != FIXP_DBL(0))
-                    tmp = (FDKreadBits(bs,1))? -tmp : tmp;
+                  numSign += (tmp != 0);
+                  mdctSpectrum[index+i] = (FIXP_DBL)tmp;
+                }
+
+                if (numSign) {
+                  UINT sign = FDKreadBits(bs,numSign) << (32-numSign);
+
+                  for (i=0; i<step; i++) {
+                    if (mdctSpectrum[index+i] != FIXP_DBL(0)) {
+                      if ((INT)sign < 0) {
+                        mdctSpectrum[index+i] = -mdctSpectrum[index+i];
+                      }
+                      sign <<= 1;
+                    }
+                  }
                 }
-                mdctSpectrum[index+i] = tmp;
-              }
 
-              if (currentCB == ESCBOOK)
-              {
-                mdctSpectrum[index+0] = (FIXP_DBL)CBlock_GetEscape(bs, (LONG)mdctSpectrum[index+0]);
-                mdctSpectrum[index+1] = (FIXP_DBL)CBlock_GetEscape(bs, (LONG)mdctSpectrum[index+1]);
+                if (currentCB == ESCBOOK)
+                {
+                  mdctSpectrum[index+0] = (FIXP_DBL)CBlock_GetEscape(bs, (LONG)mdctSpectrum[index+0]);
+                  mdctSpectrum[index+1] = (FIXP_DBL)CBlock_GetEscape(bs, (LONG)mdctSpectrum[index+1]);
 
+                }
               }
             }
           }
@@ -635,7 +663,8 @@ AAC_DECODER_ERROR  CBlock_ReadSpectralData(HANDLE_FDK_BITSTREAM bs,
 void ApplyTools ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[],
                   const SamplingRateInfo *pSamplingRateInfo,
                   const UINT flags,
-                  const int channel )
+                  const int channel,
+                  const int applyTns )
 {
 
   if ( !(flags & (AC_USAC|AC_RSVD50|AC_MPS_RES)) ) {
@@ -651,13 +680,19 @@ void ApplyTools ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[],
             );
   }
 
-  CTns_Apply (
-         &pAacDecoderChannelInfo[channel]->pDynData->TnsData,
-         &pAacDecoderChannelInfo[channel]->icsInfo,
-          pAacDecoderChannelInfo[channel]->pSpectralCoefficient,
-          pSamplingRateInfo,
-          pAacDecoderChannelInfo[channel]->granuleLength
-          );
+  if (applyTns) {
+    FDK_PROFILE_TICKS start = FDKprofileStart();
+
+    CTns_Apply (
+           &pAacDecoderChannelInfo[channel]->pDynData->TnsData,
+           &pAacDecoderChannelInfo[channel]->icsInfo,
+            pAacDecoderChannelInfo[channel]->pSpectralCoefficient,
+            pSamplingRateInfo,
+            pAacDecoderChannelInfo[channel]->granuleLength
+            );
+
+    FDKprofileStop(start, &pAacDecoderChannelInfo[channel]->pComData->tnsTicks);
+  }
 }
 
 static
@@ -673,28 +708,31 @@ int getWindow2Nr(int length, int shape)
   return nr;
 }
 
-void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
-                            CAacDecoderChannelInfo *pAacDecoderChannelInfo,
-                            INT_PCM outSamples[],
-                            const SHORT frameLen,
-                            const int stride,
-                            const int frameOk,
-                            FIXP_DBL *pWorkBuffer1 )
+/*!
+  \brief Determine left slope length (fl), right slope length (fr), transform length (tl) and
+         number of transforms (nSpec) of one frame.
+*/
+static
+void CBlock_GetTransformParams(const CIcsInfo *pIcsInfo,
+                               const SHORT frameLen,
+                               int *pFl,
+                               int *pFr,
+                               int *pTl,
+                               int *pNSpec)
 {
-  int fr, fl, tl, nSamples, nSpec;
+  int fr, fl, tl, nSpec;
 
-  /* Determine left slope length (fl), right slope length (fr) and transform length (tl).
-     USAC: The slope length may mismatch with the previous frame in case of LPD / FD
+  /* USAC: The slope length may mismatch with the previous frame in case of LPD / FD
            transitions. The adjustment is handled by the imdct implementation.
   */
   tl = frameLen;
   nSpec = 1;
 
-  switch( pAacDecoderChannelInfo->icsInfo.WindowSequence ) {
+  switch( pIcsInfo->WindowSequence ) {
     default:
     case OnlyLongSequence:
       fl = frameLen;
-      fr = frameLen - getWindow2Nr(frameLen, GetWindowShape(&pAacDecoderChannelInfo->icsInfo));
+      fr = frameLen - getWindow2Nr(frameLen, GetWindowShape(pIcsInfo));
       break;
     case LongStopSequence:
       fl = frameLen >> 3;
@@ -711,34 +749,105 @@ void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChann
       break;
   }
 
-  {
-    int i;
+  *pFl = fl;
+  *pFr = fr;
+  *pTl = tl;
+  *pNSpec = nSpec;
+}
 
-    {
-      FIXP_DBL *tmp = pAacDecoderChannelInfo->pComData->workBufferCore1->mdctOutTemp;
-
-      nSamples = imdct_block(
-             &pAacDecoderStaticChannelInfo->IMdct,
-              tmp,
-              SPEC_LONG(pAacDecoderChannelInfo->pSpectralCoefficient),
-              pAacDecoderChannelInfo->specScale,
-              nSpec,
-              frameLen,
-              tl,
-              FDKgetWindowSlope(fl, GetWindowShape(&pAacDecoderChannelInfo->icsInfo)),
-              fl,
-              FDKgetWindowSlope(fr, GetWindowShape(&pAacDecoderChannelInfo->icsInfo)),
-              fr,
-              (FIXP_DBL)0 );
-
-      for (i=0; i<frameLen; i++) {
-        outSamples[i*stride] = IMDCT_SCALE(tmp[i]);
-      }
-    }
-  }
+void CBlock_InverseTransform(H_MDCT hMdct,
+                             const CIcsInfo *pIcsInfo,
+                             FIXP_DBL *pSpectrum,
+                             const SHORT specScale[],
+                             FIXP_DBL *pTimeOut,
+                             const SHORT frameLen)
+{
+  int fr, fl, tl, nSamples, nSpec;
+
+  CBlock_GetTransformParams(pIcsInfo, frameLen, &fl, &fr, &tl, &nSpec);
+
+  nSamples = imdct_block(
+          hMdct,
+          pTimeOut,
+          pSpectrum,
+          specScale,
+          nSpec,
+          frameLen,
+          tl,
+          FDKgetWindowSlope(fl, GetWindowShape(pIcsInfo)),
+          fl,
+          FDKgetWindowSlope(fr, GetWindowShape(pIcsInfo)),
+          fr,
+          (FIXP_DBL)0 );
 
   FDK_ASSERT(nSamples == frameLen);
+}
 
+void CBlock_InverseTransformSkip(H_MDCT hMdct,
+                                 const CIcsInfo *pIcsInfo,
+                                 const SHORT frameLen)
+{
+  int fr, fl, tl, nSamples, nSpec;
+
+  CBlock_GetTransformParams(pIcsInfo, frameLen, &fl, &fr, &tl, &nSpec);
+
+  nSamples = imdct_skip_block(
+          hMdct,
+          nSpec,
+          frameLen,
+          tl,
+          FDKgetWindowSlope(fl, GetWindowShape(pIcsInfo)),
+          fl,
+          FDKgetWindowSlope(fr, GetWindowShape(pIcsInfo)),
+          fr );
+
+  FDK_ASSERT(nSamples == frameLen);
+}
+
+void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
+                            CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+                            INT_PCM outSamples[],
+                            const SHORT frameLen,
+                            const int stride,
+                            const int frameOk,
+                            FIXP_DBL *pWorkBuffer1 )
+{
+  int i;
+  FIXP_DBL *tmp = pAacDecoderChannelInfo->pComData->workBufferCore1->mdctOutTemp;
+
+  CBlock_InverseTransform(&pAacDecoderStaticChannelInfo->IMdct,
+                          &pAacDecoderChannelInfo->icsInfo,
+                           SPEC_LONG(pAacDecoderChannelInfo->pSpectralCoefficient),
+                           pAacDecoderChannelInfo->specScale,
+                           tmp,
+                           frameLen);
+
+  for (i=0; i<frameLen; i++) {
+    outSamples[i*stride] = IMDCT_SCALE(tmp[i]);
+  }
+}
+
+void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
+                            CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+                            FIXP_DBL outSamples[],
+                            const SHORT frameLen,
+                            const int stride,
+                            const int frameOk,
+                            FIXP_DBL *pWorkBuffer1 )
+{
+  int i;
+  FIXP_DBL *tmp = pAacDecoderChannelInfo->pComData->workBufferCore1->mdctOutTemp;
+
+  CBlock_InverseTransform(&pAacDecoderStaticChannelInfo->IMdct,
+                          &pAacDecoderChannelInfo->icsInfo,
+                           SPEC_LONG(pAacDecoderChannelInfo->pSpectralCoefficient),
+                           pAacDecoderChannelInfo->specScale,
+                           tmp,
+                           frameLen);
+
+  for (i=0; i<frameLen; i++) {
+    outSamples[i*stride] = IMDCT_SCALE_32(tmp[i]);
+  }
 }
 
 #include "ldfiltbank.h"
@@ -757,3 +866,19 @@ void CBlock_FrequencyToTimeLowDelay( CAacDecoderStaticChannelInfo *pAacDecoderSt
           frameLen
           );
 }
+
+void CBlock_FrequencyToTimeLowDelay( CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
+                                     CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+                                     FIXP_DBL outSamples[],
+                                     const short frameLen,
+                                     const char stride )
+{
+  InvMdctTransformLowDelay_fdk (
+          SPEC_LONG(pAacDecoderChannelInfo->pSpectralCoefficient),
+          pAacDecoderChannelInfo->specScale[0],
+          outSamples,
+          pAacDecoderStaticChannelInfo->pOverlapBuffer,
+          stride,
+          frameLen
+          );
+}
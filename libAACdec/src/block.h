@@ -115,6 +115,15 @@ void CPns_Apply (const CPnsData *pPnsData,
                  const INT granuleLength,
                  const int channel);
 
+/**
+ * \brief Advance the PNS random generator like CPns_Apply() without generating any noise.
+ *        Used by the parse-only decoding to keep the noise sequence in step with a regular decoding.
+ */
+void CPns_SkipApply (const CPnsData *pPnsData,
+                     const CIcsInfo *pIcsInfo,
+                     const SamplingRateInfo *pSamplingRateInfo,
+                     const int channel);
+
 
 
 /* TNS (of block) */
@@ -194,11 +203,40 @@ void CBlock_ScaleSpectralData(CAacDecoderChannelInfo *pAacDecoderChannelInfo, Sa
 
 /**
  * \brief Apply TNS and PNS tools.
+ * \param applyTns  if 0 the TNS synthesis filter is skipped and the spectrum is left as TNS residual.
  */
 void ApplyTools ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[],
                   const SamplingRateInfo *pSamplingRateInfo,
                   const UINT flags,
-                  const int channel );
+                  const int channel,
+                  const int applyTns );
+
+/**
+ * \brief Inverse transform of one frame of MDCT spectral data.
+ * \param hMdct      filter bank state.
+ * \param pIcsInfo   window sequence and window shape of the frame.
+ * \param pSpectrum  spectral data of the frame. Destroyed by the transform.
+ * \param specScale  exponent of each window of pSpectrum.
+ * \param pTimeOut   buffer receiving frameLen time samples with MDCT_OUT_HEADROOM bits of headroom.
+ * \param frameLen   frame length.
+ */
+void CBlock_InverseTransform(H_MDCT hMdct,
+                             const CIcsInfo *pIcsInfo,
+                             FIXP_DBL *pSpectrum,
+                             const SHORT specScale[],
+                             FIXP_DBL *pTimeOut,
+                             const SHORT frameLen);
+
+/**
+ * \brief Advance the filter bank state by one frame without computing any output, see
+ *        imdct_skip_block(). The overlap buffer content becomes invalid.
+ * \param hMdct      filter bank state.
+ * \param pIcsInfo   window sequence and window shape of the frame.
+ * \param frameLen   frame length.
+ */
+void CBlock_InverseTransformSkip(H_MDCT hMdct,
+                                 const CIcsInfo *pIcsInfo,
+                                 const SHORT frameLen);
 
 /**
  * \brief Transform MDCT spectral data into time domain
@@ -211,6 +249,17 @@ void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChann
                             const int frameOk,
                             FIXP_DBL *pWorkBuffer1);
 
+/**
+ * \brief Transform MDCT spectral data into a 32 bit time signal
+ */
+void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
+                            CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+                            FIXP_DBL outSamples[],
+                            const SHORT frameLen,
+                            const int stride,
+                            const int frameOk,
+                            FIXP_DBL *pWorkBuffer1);
+
 /**
  * \brief Transform double lapped MDCT (AAC-ELD) spectral data into time domain.
  */
@@ -220,6 +269,15 @@ void CBlock_FrequencyToTimeLowDelay(CAacDecoderStaticChannelInfo *pAacDecoderSta
                                     const short frameLen,
                                     const char stride);
 
+/**
+ * \brief Transform double lapped MDCT (AAC-ELD) spectral data into a 32 bit time signal.
+ */
+void CBlock_FrequencyToTimeLowDelay(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
+                                    CAacDecoderChannelInfo *pAacDecoderChannelInfo,
+                                    FIXP_DBL outSamples[],
+                                    const short frameLen,
+                                    const char stride);
+
 AAC_DECODER_ERROR CBlock_InverseQuantizeSpectralData(CAacDecoderChannelInfo *pAacDecoderChannelInfo, SamplingRateInfo *pSamplingRateInfo);
 
 /**
@@ -282,39 +340,30 @@ FDK_INLINE int GetScaleFromValue (FIXP_DBL value, unsigned int lsb)
   \brief Read huffman codeword
 
   The function reads the huffman codeword from the bitstream and
-  returns the index value.
+  returns the index value. HuffmanBits bits are looked up at once in the
+  root table of the codebook, longer codewords are resolved with one
+  additional sub table access. Bits read beyond the codeword are pushed
+  back into the cache.
 
   \return  index value
 */
 inline int CBlock_DecodeHuffmanWord( HANDLE_FDK_BITSTREAM bs,                           /*!< pointer to bitstream */
                                      const CodeBookDescription *hcb )                   /*!< pointer to codebook description */
 {
+  const USHORT *CodeBook = hcb->CodeBook;
   UINT val;
-  UINT index = 0;
-  const USHORT (*CodeBook) [HuffmanEntries] = hcb->CodeBook;
 
-  while (1)
+  val = CodeBook[FDKreadBits(bs,HuffmanBits)];
+
+  if ((val & 1) == 0)
   {
-    val = CodeBook[index][FDKreadBits(bs,HuffmanBits)]; /* Expensive memory access */
-
-    if ((val & 1) == 0)
-    {
-      index = val>>2;
-      continue;
-    }
-    else
-    {
-      if (val & 2)
-      {
-        FDKpushBackCache(bs,1);
-      }
-
-      val >>= 2;
-      break;
-    }
+    /* codeword is longer than HuffmanBits, continue in sub table */
+    val = CodeBook[(val>>5) + FDKreadBits(bs,(val>>1) & 0xF)];
   }
 
-  return val;
+  FDKpushBackCache(bs,(val>>1) & 0xF);
+
+  return val>>5;
 }
 
 //#endif /* AACDEC_HUFFMANDECODER_ENABLE */
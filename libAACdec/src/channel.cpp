@@ -133,7 +133,8 @@ void CChannelElement_Decode( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
                              CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo[2],
                              SamplingRateInfo *pSamplingRateInfo,
                              UINT  flags,
-                             int el_channels)
+                             int el_channels,
+                             int applyTns)
 {
   int ch, maybe_jstereo = 0;
 
@@ -182,7 +183,7 @@ void CChannelElement_Decode( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
       /* write pAacDecoderChannelInfo[ch]->specScale */
       CBlock_ScaleSpectralData(pAacDecoderChannelInfo[ch], pSamplingRateInfo);
 
-      ApplyTools (pAacDecoderChannelInfo, pSamplingRateInfo, flags, ch);
+      ApplyTools (pAacDecoderChannelInfo, pSamplingRateInfo, flags, ch, applyTns);
     }
 
   }
@@ -195,6 +196,40 @@ void CChannelElement_Decode( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
           );
 }
 
+/*!
+  \brief Skip the decoding of a channel element
+
+  The function updates the decoder state which carries over to the
+  following frames like CChannelElement_Decode() does, without
+  reconstructing the spectral data. This is the PNS random generator.
+
+  \return  none
+*/
+void CChannelElement_SkipDecode( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
+                                 SamplingRateInfo *pSamplingRateInfo,
+                                 UINT  flags,
+                                 int el_channels)
+{
+  int ch;
+
+  if ( (el_channels > 1) && pAacDecoderChannelInfo[L]->pDynData->RawDataInfo.CommonWindow ) {
+    if (pAacDecoderChannelInfo[L]->data.aac.PnsData.PnsActive || pAacDecoderChannelInfo[R]->data.aac.PnsData.PnsActive) {
+      MapMidSideMaskToPnsCorrelation(pAacDecoderChannelInfo);
+    }
+  }
+
+  if ( !(flags & (AC_USAC|AC_RSVD50|AC_MPS_RES)) ) {
+    for (ch = 0; ch < el_channels; ch++) {
+      CPns_SkipApply(
+             &pAacDecoderChannelInfo[ch]->data.aac.PnsData,
+             &pAacDecoderChannelInfo[ch]->icsInfo,
+              pSamplingRateInfo,
+              ch
+              );
+    }
+  }
+}
+
 void CChannel_CodebookTableInit(CAacDecoderChannelInfo *pAacDecoderChannelInfo)
 {
   int b, w, maxBands, maxWindows;
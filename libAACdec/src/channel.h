@@ -110,6 +110,7 @@ void CChannel_CodebookTableInit(CAacDecoderChannelInfo *pAacDecoderChannelInfo);
  * \param pAacDecoderChannelInfo pointer to channel data struct. Depending on el_channels either one or two.
  * \param pSamplingRateInfo pointer to sample rate information structure
  * \param el_channels amount of channels of the element to be decoded.
+ * \param applyTns if 0 the TNS synthesis filter is not applied.
  * \param output pointer to time domain output buffer (ACELP)
  * \param stride factor for accessing output
  */
@@ -117,7 +118,21 @@ void CChannelElement_Decode ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
                               CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo[2],
                               SamplingRateInfo *pSamplingRateInfo,
                               UINT flags,
-                              int el_channels );
+                              int el_channels,
+                              int applyTns );
+
+/**
+ * \brief Update the decoder state of a channel element like CChannelElement_Decode() without
+ *        reconstructing its spectral data. Used for parse-only decoding.
+ * \param pAacDecoderChannelInfo pointer to channel data struct. Depending on el_channels either one or two.
+ * \param pSamplingRateInfo pointer to sample rate information structure
+ * \param flags decoder flags
+ * \param el_channels amount of channels of the element.
+ */
+void CChannelElement_SkipDecode ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[2],
+                                  SamplingRateInfo *pSamplingRateInfo,
+                                  UINT flags,
+                                  int el_channels );
 
 
 /**
@@ -97,6 +97,7 @@ amm-info@iis.fraunhofer.de
 #include "aacdecoder_lib.h"
 #include "FDK_bitstream.h"
 #include "overlapadd.h"
+#include "FDK_profile.h"
 
 #include "mdct.h"
 #include "stereo.h"
@@ -247,6 +248,8 @@ typedef struct {
 
   CJointStereoData jointStereoData;              /* One for one element */
 
+  FDK_PROFILE_TICKS tnsTicks;                    /* TNS filter time of the current frame */
+
   shouldBeUnion {
     struct {
       CErHcrInfo erHcrInfo;
@@ -99,6 +99,70 @@ amm-info@iis.fraunhofer.de
 
 #define LDFB_HEADROOM 2
 
+/*!
+  \brief Store a 32 bit output sample of the same level as the INT_PCM output of multE2_DinvF_fdk().
+  \param shift  Right shift of the INT_PCM output, (DFRACT_BITS-SAMPLE_BITS) less for 32 bit output.
+*/
+static inline FIXP_DBL ldfbOutSample32(FIXP_DBL x, int shift)
+{
+  shift -= (DFRACT_BITS - SAMPLE_BITS);
+  return (FIXP_DBL)SATURATE_SHIFT(x, shift, DFRACT_BITS);
+}
+
+/*!
+  \brief Variant of multE2_DinvF_fdk() for a 32 bit output signal.
+*/
+static void multE2_DinvF_fdk(FIXP_DBL *output, FIXP_DBL* x, const FIXP_WTB* fb, FIXP_DBL* z, const int N, const int  stride)
+{
+  int i, scale;
+
+  scale = (DFRACT_BITS - SAMPLE_BITS) - LDFB_HEADROOM;
+
+  for(i=0;i<N/4;i++)
+  {
+    FIXP_DBL z0, z2, tmp;
+
+    z2 = x[N/2+i];
+    z0 = z2 + ( fMultDiv2(z[N/2+i], fb[2*N + i]) >> (-WTS2-1) );
+
+    z[N/2+i] = x[N/2-1-i] + ( fMultDiv2(z[N + i], fb[2*N + N/2 + i]) >> (-WTS2-1) );
+
+    tmp = ( fMultDiv2(z[N/2+i], fb[N+N/2-1-i]) + fMultDiv2(z[i], fb[N+N/2+i]) ) ;
+
+    output[(N*3/4-1-i)*stride] = ldfbOutSample32(tmp, -WTS1-1 + scale);
+
+    z[i] = z0;
+    z[N + i] = z2;
+  }
+
+  for(i=N/4;i<N/2;i++)
+  {
+    FIXP_DBL z0, z2, tmp0, tmp1;
+
+    z2 = x[N/2+i];
+    z0 = z2 + ( fMultDiv2(z[N/2+i], fb[2*N + i]) >> (-WTS2-1) );
+
+    z[N/2+i] = x[N/2-1-i] + ( fMultDiv2(z[N + i], fb[2*N + N/2 + i]) >> (-WTS2-1) );
+
+    tmp0 = ( fMultDiv2(z[N/2+i], fb[N/2-1-i])   + fMultDiv2(z[i], fb[N/2+i])   ) ;
+    tmp1 = ( fMultDiv2(z[N/2+i], fb[N+N/2-1-i]) + fMultDiv2(z[i], fb[N+N/2+i]) ) ;
+
+    output[(i-N/4)*stride]     = ldfbOutSample32(tmp0, -WTS0-1 + scale);
+    output[(N*3/4-1-i)*stride] = ldfbOutSample32(tmp1, -WTS1-1 + scale);
+
+    z[i] = z0;
+    z[N + i] = z2;
+  }
+
+  /* Exchange quarter parts of x to bring them in the "right" order */
+  for(i=0;i<N/4;i++)
+  {
+    FIXP_DBL tmp0 = fMultDiv2(z[i], fb[N/2+i]);
+
+    output[(N*3/4 + i)*stride] = ldfbOutSample32(tmp0, -WTS0-1 + scale);
+  }
+}
+
 static void multE2_DinvF_fdk(INT_PCM *output, FIXP_DBL* x, const FIXP_WTB* fb, FIXP_DBL* z, const int N, const int  stride)
 {
   int i, scale;
@@ -169,7 +233,11 @@ static void multE2_DinvF_fdk(INT_PCM *output, FIXP_DBL* x, const FIXP_WTB* fb, F
   }
 }
 
-int InvMdctTransformLowDelay_fdk (FIXP_DBL *mdctData, const int mdctData_e, INT_PCM *output, FIXP_DBL *fs_buffer, const int stride, const int N) {
+/*!
+  \brief Scale and transform the low delay MDCT spectrum in place ahead of the
+         windowing in multE2_DinvF_fdk(), and select the window slope.
+*/
+static void InvMdctLowDelayCore (FIXP_DBL *mdctData, const int mdctData_e, const int N, const FIXP_WTB **pCoef) {
 
   const FIXP_WTB *coef;
   FIXP_DBL gain = (FIXP_DBL)0;
@@ -197,12 +265,32 @@ int InvMdctTransformLowDelay_fdk (FIXP_DBL *mdctData, const int mdctData_e, INT_
     scaleValues(mdctData, N, scale);
   }
 
+  *pCoef = coef;
+}
+
+int InvMdctTransformLowDelay_fdk (FIXP_DBL *mdctData, const int mdctData_e, INT_PCM *output, FIXP_DBL *fs_buffer, const int stride, const int N) {
+
+  const FIXP_WTB *coef;
+
+  InvMdctLowDelayCore(mdctData, mdctData_e, N, &coef);
+
   /* Since all exponent and factors have been applied, current exponent is zero. */
   multE2_DinvF_fdk(output, mdctData, coef, fs_buffer, N, stride);
 
   return (1);
 }
 
+int InvMdctTransformLowDelay_fdk (FIXP_DBL *mdctData, const int mdctData_e, FIXP_DBL *output, FIXP_DBL *fs_buffer, const int stride, const int N) {
+
+  const FIXP_WTB *coef;
+
+  InvMdctLowDelayCore(mdctData, mdctData_e, N, &coef);
+
+  multE2_DinvF_fdk(output, mdctData, coef, fs_buffer, N, stride);
+
+  return (1);
+}
+
 
 
 
@@ -105,5 +105,15 @@ int InvMdctTransformLowDelay_fdk (
         const int frameLength
         );
 
+/* Variant for a 32 bit time signal */
+int InvMdctTransformLowDelay_fdk (
+        FIXP_DBL *mdctdata_m,
+        const int mdctdata_e,
+        FIXP_DBL *mdctOut,
+        FIXP_DBL *fs_buffer,
+        const int stride,
+        const int frameLength
+        );
+
 
 #endif
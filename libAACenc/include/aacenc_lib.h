@@ -200,6 +200,16 @@ This is the default open procedure for the AAC encoder if memory consumption doe
    This encoder instance can produce for example 5.1 channel AAC-LC streams or stereo HE-AAC (v2) streams.
    HE-AAC 5.1 multi channel is not possible since only 2 out of 6 channels support SBR, which saves data memory.
 \code aacEncOpen(&hAacEncoder,0,6|(2<<8)) \endcode
+- The dynamic memory of the AAC and SBR encoder modules holds no data from one call of aacEncEncode() to the next.
+  Encoder instances which encode one after another on the same thread can therefore share one scratch memory owned by the
+  application, sized by aacEncGetScratchSize() for the largest of the instances and bound with aacEncSetScratch().
+  Instances sharing a scratch memory must never encode concurrently, so each thread needs its own scratch memory.
+\code
+UINT scratchSize = aacEncGetScratchSize(0,2);
+void *pScratch = malloc(scratchSize);
+aacEncSetScratch(hAacEncoder[0], pScratch, scratchSize);
+aacEncSetScratch(hAacEncoder[1], pScratch, scratchSize);
+\endcode
 \n
 
 \section bufDes Input/Output Arguments
@@ -342,6 +352,113 @@ increase which might be significant. If workload is not an issue in the applicat
 we recommended to activate this feature.
 \code aacEncoder_SetParam(hAacEncoder, AACENC_AFTERBURNER, 1); \endcode
 
+\subsection encThreads Multithreaded Encoding
+For multichannel configurations the workload of the core encoder can be spread over several
+threads with ::AACENC_NUM_THREADS. The psychoacoustic model including TNS and M/S stereo
+as well as the scalefactor estimation then run for the channel elements in parallel, while
+the distribution of bits among the channel elements and the bitstream writing stay serial.
+The output is identical to single-threaded encoding.
+\code aacEncoder_SetParam(hAacEncoder, AACENC_NUM_THREADS, 4); \endcode
+
+\subsection encLadder Encoder Ladder
+Adaptive streaming requires the same audio signal encoded at several bitrates. Encoder instances
+which only differ in bitrate, bitrate mode, afterburner or transport settings can be combined to an
+encoder ladder with aacEncLadderOpen(). Each call of aacEncLadderEncode() passes the input samples to all
+renditions, computes block switching and MDCT once in the first rendition and encodes one transport
+stream per rendition. The renditions must use the same AOT, sampling rate, frame length and channel
+configuration, and SBR must be disabled. The output of each rendition is identical to the output of a
+standalone encoder instance with the same configuration.
+\code
+HANDLE_AACENCODER hEnc[3];
+HANDLE_AACENC_LADDER hLadder;
+const AACENC_BufDesc *outBufDescs[3] = { &outBufDesc[0], &outBufDesc[1], &outBufDesc[2] };
+
+for (r=0; r<3; r++) {
+  aacEncOpen(&hEnc[r], 0x01, 2);
+  aacEncoder_SetParam(hEnc[r], AACENC_AOT, AOT_AAC_LC);
+  aacEncoder_SetParam(hEnc[r], AACENC_SAMPLERATE, 48000);
+  aacEncoder_SetParam(hEnc[r], AACENC_CHANNELMODE, MODE_2);
+  aacEncoder_SetParam(hEnc[r], AACENC_BITRATE, bitrates[r]);
+}
+aacEncLadderOpen(&hLadder, hEnc, 3);
+aacEncLadderEncode(hLadder, &inBufDesc, outBufDescs, &inargs, outargs);
+...
+aacEncLadderClose(&hLadder);
+for (r=0; r<3; r++) {
+  aacEncClose(&hEnc[r]);
+}
+\endcode
+
+\subsection encTranscode Compressed Domain Transcoding
+An AAC-LC bitstream can be reencoded at a different bitrate or in another transport format without
+going through the time domain. aacEncTranscodeOpen() attaches an internal AAC decoder to a configured
+encoder instance. aacEncTranscode() takes the input bitstream like aacDecoder_Fill(), decodes one frame
+up to the dequantized spectrum and passes spectrum, window decisions and TNS filters to the encoder
+psychoacoustic, which quantizes and codes the spectrum again. Inverse and forward MDCT, block switching
+and TNS analysis are skipped. AOT, sampling rate and channel mode of the encoder follow the input stream,
+while bitrate and transport settings are taken from the encoder configuration. Only AAC-LC input with a
+channel configuration of 1 to 7 and without SBR is supported.
+
+The transcoder runs about 1.1 to 2.2 times as fast as decoding to PCM and encoding again, depending on
+bitrate, channel count and machine. The skipped stages are only about a third of the tandem cost. The
+psychoacoustic model still computes thresholds, the tonality for the PNS decision and the perceptual entropy
+from the decoded spectrum, and the complete quantization and coding loop runs for every frame. These two
+stages take about 60% and 30% of the encoder time of a transcoded frame.
+\code
+aacEncOpen(&hEnc, 0x01, 8);
+aacEncoder_SetParam(hEnc, AACENC_BITRATE, 64000);
+aacEncoder_SetParam(hEnc, AACENC_TRANSMUX, TT_MP4_ADTS);
+aacEncTranscodeOpen(&hTc, hEnc, TT_MP4_ADTS, NULL, 0);
+do {
+  bytesValid = inputSize;
+  aacEncTranscode(hTc, inputBuffer, inputSize, &bytesValid, &outBufDesc, &outargs);
+  ...
+} while (...);
+aacEncTranscodeClose(&hTc);
+aacEncClose(&hEnc);
+\endcode
+
+\subsection encSegments Segment Parallel Encoding
+A single encoder instance processes a file strictly frame after frame. For files which are available in
+advance, the encoding time can be shortened by splitting the input into segments which are encoded in parallel
+by several encoder instances, combined with aacEncSegmentsOpen(). Each call of aacEncSegmentsEncode() splits
+the given frames into up to one segment per instance. The first segment continues the stream of the previous
+call. Each further segment is encoded by a restarted instance which first encodes some frames in front of the
+segment as pre-roll and drops their access units, so that the filterbank, block switching and bit reservoir
+have converged at the start of the segment. With fewer than ::AACENC_SEGMENTS_PREROLL pre-roll frames, the bit
+reservoir is still filling up at the seam: its fill level drops at the start of each segment and the bits
+missing to the level of a continuous stream are lost for the following frames. The access units of all
+segments are concatenated in order. The instances must be configured identically for ADTS or LOAS with one
+sub frame per transport frame, since the access units are concatenated in the transport stream. The stream
+decodes without seams, but it is not identical to the output of a single instance, because the segments are
+quantized with a slightly different bit reservoir state. Each segment spans at least as many frames as the
+pre-roll, and longer chunks per call keep the share of pre-roll frames small.
+\code
+HANDLE_AACENCODER hEnc[4];
+HANDLE_AACENC_SEGMENTS hSegments;
+
+for (n=0; n<4; n++) {
+  aacEncOpen(&hEnc[n], 0, 2);
+  aacEncoder_SetParam(hEnc[n], AACENC_AOT, AOT_AAC_LC);
+  ...
+}
+aacEncSegmentsOpen(&hSegments, hEnc, 4, AACENC_SEGMENTS_PREROLL);
+do {
+  aacEncSegmentsEncode(hSegments, pSamples, numSamples, lastChunk, pOutput, outputSize, &outputBytes);
+  fwrite(pOutput, 1, outputBytes, pFile);
+} while (!lastChunk);
+aacEncSegmentsClose(&hSegments);
+\endcode
+
+\subsection encProfiling Stage Profiling
+Each encoder instance measures the execution time of its processing stages per encoded frame. The counters are
+read with aacEncGetProfile() and hold, for each stage of ::AACENC_PROFILE_STAGE, the number of frames the stage was
+executed in, the accumulated time and the maximum time of one frame. Times are ticks of the processor time stamp
+counter where available, else of a monotonic system clock, and include the time of nested stages. The transform and
+psychoacoustics stages run per channel element, possibly on the worker threads of \ref encThreads, and report the
+processing time summed over all elements. A library configured with --disable-profile does not contain any time
+measurement, in this case aacEncGetProfile() returns ::AACENC_UNSUPPORTED_PARAMETER.
+
 \subsection encELD ELD Auto Configuration Mode
 For ELD configuration a so called auto configurator is available which configures SBR and the SBR ratio by itself.
 The configurator is used when the encoder parameter ::AACENC_SBR_MODE and ::AACENC_SBR_RATIO are not set explicitely.
@@ -756,6 +873,50 @@ typedef enum {
  */
 typedef struct AACENCODER *HANDLE_AACENCODER;
 
+/**
+ *  AAC encoder ladder handle, see \ref encLadder.
+ */
+typedef struct AACENC_LADDER *HANDLE_AACENC_LADDER;
+
+#define AACENC_LADDER_MAX_RENDITIONS  ( 8 )  /*!< Maximum number of renditions of an encoder ladder. */
+
+/**
+ *  AAC segment encoder handle, see \ref encSegments.
+ */
+typedef struct AACENC_SEGMENTS *HANDLE_AACENC_SEGMENTS;
+
+#define AACENC_SEGMENTS_MAX_ENCODERS   ( 64 )  /*!< Maximum number of encoder instances of a segment encoder. */
+#define AACENC_SEGMENTS_PREROLL        ( 48 )  /*!< Recommended number of pre-roll frames of a segment encoder. The bit reservoir
+                                                    of a restarted instance needs about 40 frames to reach the fill level of a
+                                                    continuous stream. */
+
+/**
+ *  AAC transcoder handle, see \ref encTranscode.
+ */
+typedef struct AACENC_TRANSCODER *HANDLE_AACENC_TRANSCODER;
+
+/**
+ *  Processing stages of the encoder measured by the stage profiling, see \ref encProfiling.
+ */
+typedef enum {
+    AACENC_PROF_FRAME = 0,                   /*!< Complete aacEncEncode() call encoding one frame. */
+    AACENC_PROF_SBR,                         /*!< SBR and PS parameter extraction and downsampling. */
+    AACENC_PROF_SBR_QMF,                     /*!< SBR QMF analysis of channels without parametric stereo. */
+    AACENC_PROF_SBR_PS,                      /*!< Parametric stereo processing including its filter banks. */
+    AACENC_PROF_TRANSFORM,                   /*!< Block switching and MDCT, or the import of a shared transform. */
+    AACENC_PROF_PSY,                         /*!< Psychoacoustic model, PE and static bit demand of the channel elements. */
+    AACENC_PROF_QC,                          /*!< Quantization and coding loop. */
+    AACENC_PROF_BITSTREAM,                   /*!< Bit reservoir update and bitstream writing. */
+    AACENC_PROFILE_STAGES                    /*!< Number of profiled stages. */
+} AACENC_PROFILE_STAGE;
+
+/**
+ *  Stage profiling counters of an encoder instance, returned by aacEncGetProfile().
+ */
+typedef struct {
+    FDK_PROFILE_COUNTER stage[AACENC_PROFILE_STAGES];  /*!< Counters indexed by ::AACENC_PROFILE_STAGE. */
+} AACENC_PROFILE;
+
 
 /**
  *  Provides some info about the encoder configuration.
@@ -1040,6 +1201,12 @@ typedef enum
                                                   - 1: Embed MPEG defined metadata only.
                                                   - 2: Embed all metadata. */
 
+  AACENC_NUM_THREADS              = 0x0700,  /*!< Number of threads processing the channel elements of the core encoder in
+                                                  parallel, see \ref encThreads. The number of threads is limited to the number
+                                                  of channel elements.
+                                                  - 0, 1: Single-threaded encoding (default).
+                                                  - 2 to 8: Number of threads including the calling thread. */
+
   AACENC_CONTROL_STATE            = 0xFF00,  /*!< There is an automatic process which internally reconfigures the encoder instance
                                                   when a configuration parameter changed or an error occured. This paramerter allows
                                                   overwriting or getting the control status of this process. See ::AACENC_CTRLFLAGS. */
@@ -1083,6 +1250,104 @@ AACENC_ERROR aacEncOpen(
         const UINT                maxChannels
         );
 
+/**
+ * \brief  Open an instance of the encoder which obtains all of its memory from a user supplied allocator.
+ *
+ * Equivalent to aacEncOpen(), except for the memory allocation. The allocator is used for the allocations in
+ * aacEncOpenWithAllocator() and in the (re)initialization performed by aacEncEncode(), and all memory is returned
+ * to it by aacEncClose(). The allocator structure is copied, the context has to remain valid until aacEncClose().
+ *
+ * \param phAacEncoder  A pointer to an encoder handle. Initialized on return.
+ * \param encModules    Encoder modules to be supported, see aacEncOpen().
+ * \param maxChannels   Number of channels to be allocated, see aacEncOpen().
+ * \param pAllocator    Allocator of the instance, NULL selects the C library heap like aacEncOpen().
+ *
+ * \return
+ *          - AACENC_OK, on succes.
+ *          - AACENC_INVALID_HANDLE, AACENC_MEMORY_ERROR, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncOpenWithAllocator(
+        HANDLE_AACENCODER        *phAacEncoder,
+        const UINT                encModules,
+        const UINT                maxChannels,
+        const FDK_ALLOCATOR      *pAllocator
+        );
+
+/**
+ * \brief  Get the memory needed by aacEncOpenWithMemory().
+ *
+ * All memory of an encoder instance is allocated when it is opened. The function measures these allocations by
+ * opening and closing a temporary instance on the C library heap.
+ *
+ * \param encModules    Encoder modules to be supported, see aacEncOpen().
+ * \param maxChannels   Number of channels to be allocated, see aacEncOpen().
+ *
+ * \return Memory size in bytes, 0 on failure.
+ */
+UINT aacEncGetRequiredMemory(
+        const UINT                encModules,
+        const UINT                maxChannels
+        );
+
+/**
+ * \brief  Open an instance of the encoder which carves all of its memory from one caller supplied memory area.
+ *
+ * Equivalent to aacEncOpen(), but no heap memory is allocated by the instance. The instance does not own the
+ * memory area, which can be reused after aacEncClose().
+ *
+ * \param phAacEncoder  A pointer to an encoder handle. Initialized on return.
+ * \param encModules    Encoder modules to be supported, see aacEncOpen().
+ * \param maxChannels   Number of channels to be allocated, see aacEncOpen().
+ * \param pMemory       Memory area, aligned to 64 bytes.
+ * \param memorySize    Size of the memory area in bytes, see aacEncGetRequiredMemory().
+ *
+ * \return
+ *          - AACENC_OK, on succes.
+ *          - AACENC_MEMORY_ERROR, if the memory area is not aligned or too small.
+ *          - AACENC_INVALID_HANDLE, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncOpenWithMemory(
+        HANDLE_AACENCODER        *phAacEncoder,
+        const UINT                encModules,
+        const UINT                maxChannels,
+        void                     *pMemory,
+        const UINT                memorySize
+        );
+
+/**
+ * \brief  Get the size of a scratch memory for aacEncSetScratch(), see \ref encOpen.
+ *
+ * \param encModules    Encoder modules to be supported, see aacEncOpen().
+ * \param maxChannels   Number of channels to be allocated, see aacEncOpen().
+ *
+ * \return Scratch memory size in bytes, 0 on failure.
+ */
+UINT aacEncGetScratchSize(
+        const UINT                encModules,
+        const UINT                maxChannels
+        );
+
+/**
+ * \brief  Bind the dynamic memory of an encoder instance to a scratch memory owned by the application.
+ *
+ * The instance releases its own dynamic memory. The scratch memory has to remain valid until it is unbound or
+ * the instance is closed. Instances sharing a scratch memory must not encode concurrently.
+ *
+ * \param hAacEncoder   Encoder handle.
+ * \param pScratch      Scratch memory, or NULL to unbind and allocate own dynamic memory again.
+ * \param scratchSize   Size of the scratch memory in bytes, see aacEncGetScratchSize().
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_MEMORY_ERROR, if the scratch memory is too small or the dynamic memory could not be allocated.
+ *          - AACENC_INVALID_HANDLE, on failure.
+ */
+AACENC_ERROR aacEncSetScratch(
+        const HANDLE_AACENCODER   hAacEncoder,
+        void                     *pScratch,
+        const UINT                scratchSize
+        );
+
 
 /**
  * \brief  Close the encoder instance.
@@ -1144,6 +1409,238 @@ AACENC_ERROR aacEncEncode(
         );
 
 
+/**
+ * \brief  Combine encoder instances to an encoder ladder.
+ *
+ * The encoder instances have to be opened and configured with aacEncoder_SetParam() before. Pending
+ * reinitializations are applied. All instances are expected to encode the same input signal with the
+ * same AOT, sampling rate, frame length and channel configuration without SBR. Block switching and MDCT
+ * are computed by the first instance and shared with the others. As long as the ladder is open, the
+ * instances must only be used via aacEncLadderEncode().
+ *
+ * \param phLadder              A pointer to an encoder ladder handle. Initialized on return.
+ * \param phEncoders            Array of nRenditions configured encoder handles.
+ * \param nRenditions           Number of encoder instances, up to ::AACENC_LADDER_MAX_RENDITIONS.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_MEMORY_ERROR, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncLadderOpen(
+        HANDLE_AACENC_LADDER     *phLadder,
+        const HANDLE_AACENCODER  *phEncoders,
+        const UINT                nRenditions
+        );
+
+
+/**
+ * \brief Encode audio data with all renditions of an encoder ladder.
+ *
+ * Feeds the same input to each encoder instance of the ladder, see aacEncEncode(). If an instance failed in
+ * a previous call, the input buffers of the instances are out of lockstep and AACENC_ENCODE_ERROR is returned
+ * without encoding. To restart, set ::AACENC_CONTROL_STATE to ::AACENC_INIT_ALL on every instance.
+ *
+ * \param hLadder               A valid encoder ladder handle.
+ * \param inBufDesc             Input buffer descriptor, see aacEncEncode().
+ * \param outBufDesc            Array of one output buffer descriptor per rendition.
+ * \param inargs                Input arguments, see AACENC_InArgs.
+ * \param outargs               Array of one AACENC_OutArgs per rendition.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - The first error returned by aacEncEncode() for any rendition, on failure.
+ *          - AACENC_INVALID_CONFIG, if the renditions were reconfigured incompatibly.
+ *          - AACENC_ENCODE_ERROR, if the renditions are out of lockstep.
+ *          - AACENC_ENCODE_EOF, when flushing fully concluded.
+ */
+AACENC_ERROR aacEncLadderEncode(
+        const HANDLE_AACENC_LADDER   hLadder,
+        const AACENC_BufDesc        *inBufDesc,
+        const AACENC_BufDesc *const *outBufDesc,
+        const AACENC_InArgs         *inargs,
+        AACENC_OutArgs              *outargs
+        );
+
+
+/**
+ * \brief  Close an encoder ladder.
+ *
+ * The encoder instances are not closed. Since all but the first instance did not update their own
+ * filterbank states, they should be closed after the ladder as well.
+ *
+ * \param phLadder              Pointer to the encoder ladder handle to be deallocated.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, on failure.
+ */
+AACENC_ERROR aacEncLadderClose(
+        HANDLE_AACENC_LADDER     *phLadder
+        );
+
+
+/**
+ * \brief  Open a compressed domain transcoder for an encoder instance.
+ *
+ * The encoder instance has to be opened for the maximum number of channels to be transcoded. Bitrate,
+ * bitrate mode, afterburner and transport settings can be configured with aacEncoder_SetParam(), all other
+ * settings are derived from the input bitstream. As long as the transcoder is open, the encoder instance
+ * must only be used via aacEncTranscode().
+ *
+ * \param phTranscoder          A pointer to a transcoder handle. Initialized on return.
+ * \param hEncoder              A valid AAC encoder handle, not part of an encoder ladder.
+ * \param inputFormat           Transport format of the input bitstream, see aacDecoder_Open().
+ * \param conf                  Out of band configuration of the input bitstream, e.g. for ::TT_MP4_RAW,
+ *                              see aacDecoder_ConfigRaw(). NULL if the configuration is inband.
+ * \param confSize              Size of conf in bytes.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_MEMORY_ERROR, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncTranscodeOpen(
+        HANDLE_AACENC_TRANSCODER *phTranscoder,
+        const HANDLE_AACENCODER   hEncoder,
+        const TRANSPORT_TYPE      inputFormat,
+        UCHAR                    *conf,
+        const UINT                confSize
+        );
+
+
+/**
+ * \brief Transcode one frame.
+ *
+ * Copies input bitstream data into the internal buffer like aacDecoder_Fill() and transcodes the next
+ * complete frame of the internal buffer, if any.
+ *
+ * \param hTranscoder           A valid transcoder handle.
+ * \param pBuffer               Input bitstream data, NULL to transcode only data already buffered.
+ * \param bufferSize            Size of pBuffer in bytes.
+ * \param pBytesValid           Number of valid bytes of pBuffer. Holds the number of bytes not copied
+ *                              into the internal buffer on return.
+ * \param outBufDesc            Output buffer descriptor, see aacEncEncode().
+ * \param outargs               Output arguments, see aacEncEncode(). numOutBytes is 0 if the internal
+ *                              buffer does not yet hold a complete frame.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_CONFIG, if the input bitstream is not AAC-LC with channel configuration 1 to 7,
+ *            or if a channel pair element does not use common window decisions.
+ *          - AACENC_ENCODE_ERROR, if the input frame could not be decoded or encoded.
+ */
+AACENC_ERROR aacEncTranscode(
+        const HANDLE_AACENC_TRANSCODER  hTranscoder,
+        UCHAR                          *pBuffer,
+        const UINT                      bufferSize,
+        UINT                           *pBytesValid,
+        const AACENC_BufDesc           *outBufDesc,
+        AACENC_OutArgs                 *outargs
+        );
+
+
+/**
+ * \brief  Close a transcoder.
+ *
+ * The encoder instance is not closed. It is reinitialized with the next call of aacEncEncode().
+ *
+ * \param phTranscoder          Pointer to the transcoder handle to be deallocated.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, on failure.
+ */
+AACENC_ERROR aacEncTranscodeClose(
+        HANDLE_AACENC_TRANSCODER *phTranscoder
+        );
+
+
+/**
+ * \brief  Combine encoder instances to a segment encoder, see \ref encSegments.
+ *
+ * The encoder instances have to be opened and configured identically with aacEncoder_SetParam() before, for the
+ * transport types TT_MP4_ADTS or TT_MP4_LOAS. Pending reinitializations are applied. Each instance is run by its
+ * own thread. As long as the segment encoder is open, the instances must only be used via aacEncSegmentsEncode().
+ *
+ * \param phSegments            A pointer to a segment encoder handle. Initialized on return.
+ * \param phEncoders            Array of nEncoders configured encoder handles, not part of an encoder ladder or
+ *                              transcoder.
+ * \param nEncoders             Number of encoder instances, up to ::AACENC_SEGMENTS_MAX_ENCODERS.
+ * \param preRollFrames         Number of frames encoded in front of each segment, see ::AACENC_SEGMENTS_PREROLL.
+ *                              At least the frames of the encoder delay plus one are used.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_MEMORY_ERROR, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncSegmentsOpen(
+        HANDLE_AACENC_SEGMENTS   *phSegments,
+        const HANDLE_AACENCODER  *phEncoders,
+        const UINT                nEncoders,
+        const UINT                preRollFrames
+        );
+
+
+/**
+ * \brief  Get the output buffer size needed by aacEncSegmentsEncode().
+ *
+ * \param hSegments             A valid segment encoder handle.
+ * \param numSamples            Number of input samples of all channels passed to aacEncSegmentsEncode().
+ * \param flush                 Flag passed to aacEncSegmentsEncode().
+ *
+ * \return Output buffer size in bytes.
+ */
+UINT aacEncSegmentsGetOutBufferSize(
+        const HANDLE_AACENC_SEGMENTS  hSegments,
+        const UINT                    numSamples,
+        const INT                     flush
+        );
+
+
+/**
+ * \brief  Encode a chunk of audio data in parallel segments.
+ *
+ * \param hSegments             A valid segment encoder handle.
+ * \param pSamples              Interleaved input samples of all channels.
+ * \param numSamples            Number of input samples of all channels. Must be a multiple of the frame length
+ *                              times the number of channels, except for the last chunk of the stream.
+ * \param flush                 Set for the last chunk of the stream to flush the encoder delay. The next call
+ *                              starts a new stream.
+ * \param pOutput               Output buffer receiving the concatenated access units of the chunk.
+ * \param outputSize            Size of the output buffer, see aacEncSegmentsGetOutBufferSize().
+ * \param pOutputBytes          Number of bytes written to the output buffer.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_MEMORY_ERROR, if the output buffer is too small.
+ *          - AACENC_INVALID_CONFIG, if the chunk holds an incomplete frame or the instances were reconfigured.
+ *          - The first error returned by aacEncEncode() for any segment, on failure. The next call starts a new
+ *            stream then.
+ */
+AACENC_ERROR aacEncSegmentsEncode(
+        const HANDLE_AACENC_SEGMENTS  hSegments,
+        const INT_PCM                *pSamples,
+        const UINT                    numSamples,
+        const INT                     flush,
+        UCHAR                        *pOutput,
+        const UINT                    outputSize,
+        UINT                         *pOutputBytes
+        );
+
+
+/**
+ * \brief  Close a segment encoder. The encoder instances are not closed.
+ *
+ * \param phSegments            Pointer to the segment encoder handle to be deallocated.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, on failure.
+ */
+AACENC_ERROR aacEncSegmentsClose(
+        HANDLE_AACENC_SEGMENTS   *phSegments
+        );
+
+
 /**
  * \brief  Acquire info about present encoder instance.
  *
@@ -1166,6 +1663,25 @@ AACENC_ERROR aacEncInfo(
         );
 
 
+/**
+ * \brief  Get the stage profiling counters of an encoder instance, see \ref encProfiling.
+ *
+ * \param hAacEncoder           A valid AAC encoder handle.
+ * \param pProfile              Pointer to an AACENC_PROFILE structure. Filled on return.
+ * \param reset                 If not 0, the counters of the instance are cleared after they have been copied.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, on failure.
+ *          - AACENC_UNSUPPORTED_PARAMETER, if the library was built without profiling.
+ */
+AACENC_ERROR aacEncGetProfile(
+        const HANDLE_AACENCODER   hAacEncoder,
+        AACENC_PROFILE           *pProfile,
+        const INT                 reset
+        );
+
+
 /**
  * \brief  Set one single AAC encoder parameter.
  *
@@ -95,7 +95,10 @@ amm-info@iis.fraunhofer.de
 
 #include "aacEnc_ram.h"
 
-  C_AALLOC_MEM (AACdynamic_RAM, FIXP_DBL, AAC_ENC_DYN_RAM_SIZE/sizeof(FIXP_DBL))
+  /* Sized for the channels of the encoder instance, see AAC_ENC_DYN_RAM_SIZE. */
+  FIXP_DBL *GetAACdynamic_RAM(int nChannels) { FDK_ASSERT((nChannels) <= (8)); return ((FIXP_DBL*)FDKaalloc(AAC_ENC_DYN_RAM_SIZE(nChannels), ALIGNMENT_DEFAULT)); }
+  void FreeAACdynamic_RAM(FIXP_DBL** p) { if ((p != NULL) && (*p != NULL)) { FDKafree(*p); *p=NULL; } }
+  UINT GetRequiredMemAACdynamic_RAM(int nChannels) { return ALGN_SIZE_EXTRES(AAC_ENC_DYN_RAM_SIZE(nChannels) + ALIGNMENT_DEFAULT + sizeof(void *)); }
 
 /*
   Static memory areas, must not be overwritten in other sections of the decoder !
@@ -126,12 +129,24 @@ C_ALLOC_MEM2 (Ram_aacEnc_PsyStatic,   PSY_STATIC,   1, (8))
 
 C_ALLOC_MEM2 (Ram_aacEnc_PsyInputBuffer, INT_PCM, MAX_INPUT_BUFFER_SIZE, (8))
 
+/*
+   Additional PsyDynamic scratch for each worker thread of a multithreaded encoder.
+*/
+C_ALLOC_MEM2 (Ram_aacEnc_PsyDynamicWorker, PSY_DYNAMIC, 1, (8))
+
+/*
+   Block switching and transform results shared by the renditions of an encoder ladder, one entry per input channel.
+*/
+C_ALLOC_MEM (Ram_aacEnc_PsyFrontEnd, PSY_FRONTEND_CHANNEL, (8))
+
   PSY_DYNAMIC *GetRam_aacEnc_PsyDynamic (int n, UCHAR* dynamic_RAM) {
       FDK_ASSERT(dynamic_RAM!=0);
-      return ((PSY_DYNAMIC*) (dynamic_RAM + P_BUF_1 + n*sizeof(PSY_DYNAMIC)));
+      return ((PSY_DYNAMIC*) (dynamic_RAM + P_BUF_0 + n*sizeof(PSY_DYNAMIC)));
   }
 
-  C_ALLOC_MEM (Ram_bsOutbuffer, UCHAR, OUTPUTBUFFER_SIZE)
+  /* Bitstream buffer of size bytes, at most OUTPUTBUFFER_SIZE. */
+  UCHAR *GetRam_bsOutbuffer(int size) { FDK_ASSERT((size) <= OUTPUTBUFFER_SIZE); return ((UCHAR*)FDKcalloc(size, sizeof(UCHAR))); }
+  void FreeRam_bsOutbuffer(UCHAR** p) { if (p != NULL) { FDKfree(*p); *p=NULL; } }
 
 /*
    The structure PSY_OUT holds all psychoaccoustic data needed
@@ -161,11 +176,11 @@ C_ALLOC_MEM (Ram_aacEnc_BitCntrState, BITCNTR_STATE, 1)
 
   INT *GetRam_aacEnc_BitLookUp(int n, UCHAR* dynamic_RAM) {
     FDK_ASSERT(dynamic_RAM!=0);
-    return ((INT*) (dynamic_RAM + P_BUF_1));
+    return ((INT*) (dynamic_RAM + P_BUF_0));
   }
   INT *GetRam_aacEnc_MergeGainLookUp(int n, UCHAR* dynamic_RAM) {
     FDK_ASSERT(dynamic_RAM!=0);
-    return ((INT*) (dynamic_RAM + P_BUF_1 + sizeof(INT)*(MAX_SFB_LONG*(CODE_BOOK_ESC_NDX+1))));
+    return ((INT*) (dynamic_RAM + P_BUF_0 + sizeof(INT)*(MAX_SFB_LONG*(CODE_BOOK_ESC_NDX+1))));
   }
 
 
@@ -178,7 +193,7 @@ C_ALLOC_MEM2 (Ram_aacEnc_QCout, QC_OUT, 1, (1))
 C_ALLOC_MEM2 (Ram_aacEnc_QCelement, QC_OUT_ELEMENT, (1), (8))
   QC_OUT_CHANNEL *GetRam_aacEnc_QCchannel (int n, UCHAR* dynamic_RAM) {
       FDK_ASSERT(dynamic_RAM!=0);
-      return ((QC_OUT_CHANNEL*) (dynamic_RAM + P_BUF_0 + n*sizeof(QC_OUT_CHANNEL)));
+      return ((QC_OUT_CHANNEL*) (dynamic_RAM + P_BUF_1 + n*sizeof(QC_OUT_CHANNEL)));
   }
 
 
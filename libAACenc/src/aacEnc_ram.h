@@ -107,7 +107,11 @@ amm-info@iis.fraunhofer.de
 #include "bit_cnt.h"
 #include "psy_const.h"
 
-  #define  OUTPUTBUFFER_SIZE    (8192)  /*!< Output buffer size has to be at least 6144 bits per channel (768 bytes). FDK bitbuffer implementation expects buffer of size 2^n. */
+#include "FDK_threads.h"
+#include "FDK_profile.h"
+#include "aacenc_lib.h"
+
+  #define  OUTPUTBUFFER_SIZE    (8192)  /*!< Maximum output buffer size. It has to be at least 6144 bits per channel (768 bytes). FDK bitbuffer implementation expects buffer of size 2^n. */
 
 
 /*
@@ -143,6 +147,15 @@ struct AAC_ENC {
   INT    dontWriteAdif;      /* use: write ADIF header only before 1st frame */
 
   FIXP_DBL  *dynamic_RAM;
+  UCHAR      dynamicRamShared;   /* dynamic_RAM is scratch memory of the application, see FDKaacEnc_SetDynamicRam() */
+
+  HANDLE_FDK_WORKER_POOL  hWorkerPool;       /* worker pool for the per element processing, NULL if single-threaded */
+  PSY_DYNAMIC            *psyDynamicWorker[(8)]; /* psych scratch of the workers, worker 0 uses psyKernel->psyDynamic */
+
+  PSY_FRONTEND_MODE       psyFrontEndMode;   /* block switching and transform of this instance or shared ones */
+  PSY_FRONTEND_CHANNEL   *psyFrontEnd;       /* shared block switching and transform, one entry per input channel */
+
+  FDK_PROFILE_TICKS       profileTicks[AACENC_PROFILE_STAGES]; /* core encoder stage times of the current frame */
 
 
   INT maxChannels;           /* used while allocation */
@@ -163,27 +176,28 @@ struct AAC_ENC {
 /* Dynamic RAM - Allocation */
 /*
  ++++++++++++++++++++++++++++++++++++++++++++
- |   P_BUF_0   |         P_BUF_1            |
- ++++++++++++++++++++++++++++++++++++++++++++
- |  QC_OUT_CH  |         PSY_DYN            |
+ |         P_BUF_0            |   P_BUF_1   |
  ++++++++++++++++++++++++++++++++++++++++++++
- |             | BitLookUp+MergeGainLookUp  |
+ |         PSY_DYN            |  QC_OUT_CH  |
  ++++++++++++++++++++++++++++++++++++++++++++
- |             |  Bitstream output buffer   |
+ | BitLookUp+MergeGainLookUp  |             |
  ++++++++++++++++++++++++++++++++++++++++++++
+
+ The QC_OUT_CH area is placed last, it holds the channels the encoder instance is opened for.
 */
 
-#define BUF_SIZE_0       ( ALIGN_SIZE(sizeof(QC_OUT_CHANNEL)*(8)) )
-#define BUF_SIZE_1       ( ALIGN_SIZE(maxSize(sizeof(PSY_DYNAMIC), \
+#define BUF_SIZE_0       ( ALIGN_SIZE(maxSize(sizeof(PSY_DYNAMIC), \
                                       (BIT_LOOK_UP_SIZE+MERGE_GAIN_LOOK_UP_SIZE))) )
+#define BUF_SIZE_1(nChannels)  ( ALIGN_SIZE(sizeof(QC_OUT_CHANNEL)*(nChannels)) )
 
 #define P_BUF_0          ( 0 )
 #define P_BUF_1          ( P_BUF_0 + BUF_SIZE_0 )
 
-#define AAC_ENC_DYN_RAM_SIZE  ( BUF_SIZE_0 + BUF_SIZE_1 )
+#define AAC_ENC_DYN_RAM_SIZE(nChannels)  ( BUF_SIZE_0 + BUF_SIZE_1(nChannels) )
 
 
-  H_ALLOC_MEM (AACdynamic_RAM, FIXP_DBL)
+  FIXP_DBL *GetAACdynamic_RAM(int nChannels); void FreeAACdynamic_RAM(FIXP_DBL** p);
+  UINT GetRequiredMemAACdynamic_RAM(int nChannels);
 /*
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 END - Dynamic RAM - Allocation */
@@ -198,9 +212,11 @@ END - Dynamic RAM - Allocation */
   H_ALLOC_MEM (Ram_aacEnc_PsyInternal, PSY_INTERNAL)
   H_ALLOC_MEM (Ram_aacEnc_PsyStatic, PSY_STATIC)
   H_ALLOC_MEM (Ram_aacEnc_PsyInputBuffer, INT_PCM)
+  H_ALLOC_MEM (Ram_aacEnc_PsyDynamicWorker, PSY_DYNAMIC)
+  H_ALLOC_MEM (Ram_aacEnc_PsyFrontEnd, PSY_FRONTEND_CHANNEL)
 
   PSY_DYNAMIC *GetRam_aacEnc_PsyDynamic (int n, UCHAR* dynamic_RAM);
-  H_ALLOC_MEM (Ram_bsOutbuffer, UCHAR)
+  UCHAR *GetRam_bsOutbuffer(int size); void FreeRam_bsOutbuffer(UCHAR** p);
 
   H_ALLOC_MEM (Ram_aacEnc_PsyOutChannel, PSY_OUT_CHANNEL)
 
@@ -113,6 +113,11 @@ static AAC_ENCODER_ERROR FDKaacEnc_InitCheckAncillary(INT bitRate,
                                                       INT *ancillaryBitsPerFrame,
                                                       INT sampleRate);
 
+static AAC_ENCODER_ERROR FDKaacEnc_InitWorkers(HANDLE_AAC_ENC hAacEnc,
+                                               INT            nWorkers);
+
+static void FDKaacEnc_CloseWorkers(HANDLE_AAC_ENC hAacEnc);
+
 INT FDKaacEnc_LimitBitrate(
         HANDLE_TRANSPORTENC hTpEnc,
         INT coreSamplingRate,
@@ -324,7 +329,11 @@ AAC_ENCODER_ERROR FDKaacEnc_Open(HANDLE_AAC_ENC  *phAacEnc,
   }
   FDKmemclear(hAacEnc, sizeof(AAC_ENC));
 
-  hAacEnc->dynamic_RAM = GetAACdynamic_RAM();
+  hAacEnc->dynamic_RAM = GetAACdynamic_RAM(nChannels*nSubFrames);
+  if (hAacEnc->dynamic_RAM == NULL) {
+    ErrorStatus = AAC_ENC_NO_MEMORY;
+    goto bail;
+  }
   dynamicRAM = (UCHAR*)hAacEnc->dynamic_RAM;
 
   /* allocate the Psy aud Psy Out structure */
@@ -373,6 +382,85 @@ bail:
 }
 
 
+UINT FDKaacEnc_GetDynamicRamSize(const INT nChannels,
+                                  const INT nSubFrames)
+{
+  return AAC_ENC_DYN_RAM_SIZE(nChannels*nSubFrames);
+}
+
+/* Move a pointer into the old dynamic RAM to the same offset of the new one. */
+static void *FDKaacEnc_RebaseDynamicRam(void *p, const UCHAR *pOld, UCHAR *pNew, const UINT size)
+{
+  if ( ((UCHAR*)p >= pOld) && ((UCHAR*)p < pOld+size) ) {
+    return (void*)(pNew + ((UCHAR*)p - pOld));
+  }
+  return p;
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetDynamicRam
+    description:  move the dynamic RAM of an encoder instance to memory of the
+                  application, or back to an own allocation if ram is NULL
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+AAC_ENCODER_ERROR FDKaacEnc_SetDynamicRam(HANDLE_AAC_ENC  hAacEnc,
+                                          FIXP_DBL       *ram)
+{
+  UCHAR *pOld, *pNew;
+  UINT size;
+  int n, i, ch;
+
+  if (hAacEnc == NULL) {
+    return AAC_ENC_INVALID_HANDLE;
+  }
+  if ( (ram == NULL) && !hAacEnc->dynamicRamShared ) {
+    return AAC_ENC_OK; /* already using the own dynamic RAM */
+  }
+
+  size = FDKaacEnc_GetDynamicRamSize(hAacEnc->maxChannels, hAacEnc->maxFrames);
+  pOld = (UCHAR*)hAacEnc->dynamic_RAM;
+  pNew = (UCHAR*)ram;
+
+  if (pNew == NULL) {
+    pNew = (UCHAR*)GetAACdynamic_RAM(hAacEnc->maxChannels*hAacEnc->maxFrames);
+    if (pNew == NULL) {
+      return AAC_ENC_NO_MEMORY;
+    }
+  }
+
+  /* psych scratch, quantizer channel data and bit counter lookup tables */
+  hAacEnc->psyKernel->psyDynamic = (PSY_DYNAMIC*)FDKaacEnc_RebaseDynamicRam(hAacEnc->psyKernel->psyDynamic, pOld, pNew, size);
+
+  for (n=0; n<hAacEnc->maxFrames; n++) {
+    for (i=0; i<hAacEnc->maxChannels; i++) {
+      hAacEnc->qcOut[n]->pQcOutChannels[i] =
+          (QC_OUT_CHANNEL*)FDKaacEnc_RebaseDynamicRam(hAacEnc->qcOut[n]->pQcOutChannels[i], pOld, pNew, size);
+    }
+    for (i=0; i<hAacEnc->maxElements; i++) {
+      for (ch=0; ch<(2); ch++) {
+        hAacEnc->qcOut[n]->qcElement[i]->qcOutChannel[ch] =
+            (QC_OUT_CHANNEL*)FDKaacEnc_RebaseDynamicRam(hAacEnc->qcOut[n]->qcElement[i]->qcOutChannel[ch], pOld, pNew, size);
+      }
+    }
+  }
+
+  hAacEnc->qcKernel->hBitCounter->bitLookUp =
+      (INT*)FDKaacEnc_RebaseDynamicRam(hAacEnc->qcKernel->hBitCounter->bitLookUp, pOld, pNew, size);
+  hAacEnc->qcKernel->hBitCounter->mergeGainLookUp =
+      (INT*)FDKaacEnc_RebaseDynamicRam(hAacEnc->qcKernel->hBitCounter->mergeGainLookUp, pOld, pNew, size);
+
+  if (!hAacEnc->dynamicRamShared) {
+    FreeAACdynamic_RAM(&hAacEnc->dynamic_RAM);
+  }
+  hAacEnc->dynamic_RAM      = (FIXP_DBL*)pNew;
+  hAacEnc->dynamicRamShared = (ram != NULL) ? 1 : 0;
+
+  return AAC_ENC_OK;
+}
+
+
 AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC      hAacEnc,
                                        AACENC_CONFIG      *config,     /* pre-initialized config struct */
                                        HANDLE_TRANSPORTENC hTpEnc,
@@ -667,6 +755,11 @@ AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC      hAacEnc,
       hAacEnc->aot = hAacEnc->config->audioObjectType;
   }
 
+  /* worker threads for the per element processing, more workers than elements are useless */
+  ErrorStatus = FDKaacEnc_InitWorkers(hAacEnc, fixMin(config->nThreads, cm->nElements));
+  if (ErrorStatus != AAC_ENC_OK)
+    goto bail;
+
   /* common things */
 
   return AAC_ENC_OK;
@@ -677,6 +770,110 @@ bail:
 }
 
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_psyElementJob
+    description:  psychoacoustics, PE and static bit demand of one channel
+                  element, executed by a worker of hAacEnc->hWorkerPool
+    returns:      error code in jobs->ErrorStatus
+
+  ---------------------------------------------------------------------------*/
+typedef struct {
+    HANDLE_AAC_ENC     hAacEnc;
+    INT_PCM           *inputBuffer;
+    INT                nJobs;
+    INT                element[(8)];      /* channel element index of each job */
+    AAC_ENCODER_ERROR  ErrorStatus[(8)];  /* error status of each job */
+    FDK_PROFILE_TICKS  transformTicks[(8)]; /* block switching and transform time of each job */
+    FDK_PROFILE_TICKS  psyTicks[(8)];     /* psychoacoustics time of each job */
+} AACENC_ELEMENT_JOBS;
+
+static void FDKaacEnc_psyElementJob(void *pJobData, INT jobIndex, INT workerIndex)
+{
+    AACENC_ELEMENT_JOBS *jobs    = (AACENC_ELEMENT_JOBS*)pJobData;
+    HANDLE_AAC_ENC       hAacEnc = jobs->hAacEnc;
+    CHANNEL_MAPPING     *cm      = &hAacEnc->channelMapping;
+    PSY_OUT             *psyOut  = hAacEnc->psyOut[0];
+    QC_OUT              *qcOut   = hAacEnc->qcOut[0];
+    INT                  el      = jobs->element[jobIndex];
+    ELEMENT_INFO         elInfo  = cm->elInfo[el];
+    int ch;
+    FDK_PROFILE_TICKS    profileStart = FDKprofileStart();
+
+    jobs->transformTicks[jobIndex] = 0;
+    jobs->psyTicks[jobIndex]       = 0;
+
+    /* each worker needs its own psych scratch */
+    PSY_DYNAMIC *psyDynamic = (workerIndex == 0) ? hAacEnc->psyKernel->psyDynamic
+                                                 : hAacEnc->psyDynamicWorker[workerIndex];
+
+    /* update pointer!*/
+    for(ch=0;ch<elInfo.nChannelsInEl;ch++) {
+        PSY_OUT_CHANNEL *psyOutChan = psyOut->psyOutElement[el]->psyOutChannel[ch];
+        QC_OUT_CHANNEL  *qcOutChan = qcOut->qcElement[el]->qcOutChannel[ch];
+
+        psyOutChan->mdctSpectrum       = qcOutChan->mdctSpectrum;
+        psyOutChan->sfbSpreadEnergy  = qcOutChan->sfbSpreadEnergy;
+        psyOutChan->sfbEnergy          = qcOutChan->sfbEnergy;
+        psyOutChan->sfbEnergyLdData    = qcOutChan->sfbEnergyLdData;
+        psyOutChan->sfbMinSnrLdData    = qcOutChan->sfbMinSnrLdData;
+        psyOutChan->sfbThresholdLdData = qcOutChan->sfbThresholdLdData;
+
+    }
+
+    /* block switching and transform, possibly shared with other encoder instances */
+    if ( (hAacEnc->psyFrontEndMode == PSY_FRONTEND_IMPORT)
+      || (hAacEnc->psyFrontEndMode == PSY_FRONTEND_SPECTRUM) ) {
+        FDKaacEnc_psyImportTransform(elInfo.nChannelsInEl,
+                                     hAacEnc->psyKernel->psyElement[el],
+                                     psyOut->psyOutElement[el],
+                                     cm->elInfo[el].ChannelIndex,
+                                     hAacEnc->psyFrontEnd,
+                                     (hAacEnc->psyFrontEndMode == PSY_FRONTEND_SPECTRUM));
+    }
+    else {
+        jobs->ErrorStatus[jobIndex] = FDKaacEnc_psyMainTransform(elInfo.nChannelsInEl,
+                                                                 hAacEnc->psyKernel->psyElement[el],
+                                                                 hAacEnc->psyKernel->psyConf,
+                                                                 psyOut->psyOutElement[el],
+                                                                 jobs->inputBuffer,
+                                                                 cm->elInfo[el].ChannelIndex,
+                                                                 cm->nChannels);
+        if (jobs->ErrorStatus[jobIndex] != AAC_ENC_OK)
+          return;
+
+        if (hAacEnc->psyFrontEndMode == PSY_FRONTEND_EXPORT) {
+            FDKaacEnc_psyExportTransform(elInfo.nChannelsInEl,
+                                         hAacEnc->psyKernel->psyElement[el],
+                                         psyOut->psyOutElement[el],
+                                         cm->elInfo[el].ChannelIndex,
+                                         hAacEnc->psyFrontEnd);
+        }
+    }
+    FDKprofileStop(profileStart, &jobs->transformTicks[jobIndex]);
+
+    profileStart = FDKprofileStart();
+    jobs->ErrorStatus[jobIndex] = FDKaacEnc_psyMain(elInfo.nChannelsInEl,
+                                                    hAacEnc->psyKernel->psyElement[el],
+                                                    psyDynamic,
+                                                    hAacEnc->psyKernel->psyConf,
+                                                    psyOut->psyOutElement[el],
+                                                    (hAacEnc->psyFrontEndMode == PSY_FRONTEND_SPECTRUM)
+                                                   );
+    if (jobs->ErrorStatus[jobIndex] != AAC_ENC_OK)
+      return;
+
+    /* FormFactor, Pe and staticBitDemand calculation */
+    jobs->ErrorStatus[jobIndex] = FDKaacEnc_QCMainPrepare(&elInfo,
+                                                          hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el],
+                                                          psyOut->psyOutElement[el],
+                                                          qcOut->qcElement[el],
+                                                          hAacEnc->aot,
+                                                          hAacEnc->config->syntaxFlags,
+                                                          hAacEnc->config->epConfig);
+    FDKprofileStop(profileStart, &jobs->psyTicks[jobIndex]);
+}
+
 /*---------------------------------------------------------------------------
 
     functionname: FDKaacEnc_EncodeFrame
@@ -696,19 +893,49 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
     UCHAR  extPayloadUsed[MAX_TOTAL_EXT_PAYLOADS];
 
     CHANNEL_MAPPING *cm      = &hAacEnc->channelMapping;
+    FDK_PROFILE_TICKS profileStart;
 
 
 
     PSY_OUT *psyOut = hAacEnc->psyOut[c];
     QC_OUT  *qcOut  = hAacEnc->qcOut[c];
 
+    FDKmemclear(hAacEnc->profileTicks, sizeof(hAacEnc->profileTicks));
+
     FDKmemclear(extPayloadUsed, MAX_TOTAL_EXT_PAYLOADS * sizeof(UCHAR));
 
     qcOut->elementExtBits = 0; /* sum up all extended bit of each element */
     qcOut->staticBits     = 0; /* sum up side info bits of each element */
     qcOut->totalNoRedPe   = 0; /* sum up PE */
 
-    /* advance psychoacoustics */
+    /* advance psychoacoustics, the channel elements are processed independently of each other */
+    {
+        AACENC_ELEMENT_JOBS jobs;
+
+        jobs.hAacEnc     = hAacEnc;
+        jobs.inputBuffer = inputBuffer;
+        jobs.nJobs       = 0;
+
+        for (el=0; el<cm->nElements; el++) {
+            if ( (cm->elInfo[el].elType == ID_SCE)
+              || (cm->elInfo[el].elType == ID_CPE)
+              || (cm->elInfo[el].elType == ID_LFE) )
+            {
+                jobs.element[jobs.nJobs++] = el;
+            }
+        }
+
+        FDKworkerPoolRun(hAacEnc->hWorkerPool, FDKaacEnc_psyElementJob, &jobs, jobs.nJobs);
+
+        /* report the error of the first failing element */
+        for (n = 0; n < jobs.nJobs; n++) {
+            if (jobs.ErrorStatus[n] != AAC_ENC_OK)
+              return jobs.ErrorStatus[n];
+            hAacEnc->profileTicks[AACENC_PROF_TRANSFORM] += jobs.transformTicks[n];
+            hAacEnc->profileTicks[AACENC_PROF_PSY]       += jobs.psyTicks[n];
+        }
+    }
+
     for (el=0; el<cm->nElements; el++) {
         ELEMENT_INFO elInfo = cm->elInfo[el];
 
@@ -716,45 +943,6 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
           || (elInfo.elType == ID_CPE)
           || (elInfo.elType == ID_LFE) )
         {
-            int ch;
-
-            /* update pointer!*/
-            for(ch=0;ch<elInfo.nChannelsInEl;ch++) {
-                PSY_OUT_CHANNEL *psyOutChan = psyOut->psyOutElement[el]->psyOutChannel[ch];
-                QC_OUT_CHANNEL  *qcOutChan = qcOut->qcElement[el]->qcOutChannel[ch];
-
-                psyOutChan->mdctSpectrum       = qcOutChan->mdctSpectrum;
-                psyOutChan->sfbSpreadEnergy  = qcOutChan->sfbSpreadEnergy;
-                psyOutChan->sfbEnergy          = qcOutChan->sfbEnergy;
-                psyOutChan->sfbEnergyLdData    = qcOutChan->sfbEnergyLdData;
-                psyOutChan->sfbMinSnrLdData    = qcOutChan->sfbMinSnrLdData;
-                psyOutChan->sfbThresholdLdData = qcOutChan->sfbThresholdLdData;
-
-            }
-
-            FDKaacEnc_psyMain(elInfo.nChannelsInEl,
-                              hAacEnc->psyKernel->psyElement[el],
-                              hAacEnc->psyKernel->psyDynamic,
-                              hAacEnc->psyKernel->psyConf,
-                              psyOut->psyOutElement[el],
-                              inputBuffer,
-                              cm->elInfo[el].ChannelIndex,
-                              cm->nChannels
-
-                    );
-
-            /* FormFactor, Pe and staticBitDemand calculation */
-            ErrorStatus = FDKaacEnc_QCMainPrepare(&elInfo,
-                                                   hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el],
-                                                   psyOut->psyOutElement[el],
-                                                   qcOut->qcElement[el],
-                                                   hAacEnc->aot,
-                                                   hAacEnc->config->syntaxFlags,
-                                                   hAacEnc->config->epConfig);
-
-            if (ErrorStatus != AAC_ENC_OK)
-              return ErrorStatus;
-
             /*-------------------------------------------- */
 
             qcOut->qcElement[el]->extBitsUsed = 0;
@@ -882,7 +1070,9 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
         /*-------------------------------------------- */
         /*-------------------------------------------- */
 
+        profileStart = FDKprofileStart();
         ErrorStatus = FDKaacEnc_QCMain(hAacEnc->qcKernel,
+                                       hAacEnc->hWorkerPool,
                                        hAacEnc->psyOut,
                                        hAacEnc->qcOut,
                                        avgTotalBits,
@@ -893,9 +1083,11 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
 
         if (ErrorStatus != AAC_ENC_OK)
             return ErrorStatus;
+        FDKprofileStop(profileStart, &hAacEnc->profileTicks[AACENC_PROF_QC]);
         /*-------------------------------------------- */
 
         /*-------------------------------------------- */
+        profileStart = FDKprofileStart();
         ErrorStatus = FDKaacEnc_updateFillBits(cm,
                                                hAacEnc->qcKernel,
                                                hAacEnc->qcKernel->elementBits,
@@ -949,6 +1141,7 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
 
               /* transportEnc_EndAccessUnit() is being called inside FDKaacEnc_WriteBitstream() */
               transportEnc_GetFrame(hTpEnc, nOutBytes);
+              FDKprofileStop(profileStart, &hAacEnc->profileTicks[AACENC_PROF_BITSTREAM]);
 
     } /* -end- if (curFrame==hAacEnc->qcKernel->nSubFrames) */
 
@@ -957,6 +1150,22 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
     return AAC_ENC_OK;
 }
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetPsyFrontEnd
+    description:  share block switching and transform among encoder instances
+    returns:      ---
+
+  ---------------------------------------------------------------------------*/
+void FDKaacEnc_SetPsyFrontEnd( HANDLE_AAC_ENC               hAacEnc,
+                               PSY_FRONTEND_MODE            mode,
+                               struct PSY_FRONTEND_CHANNEL *psyFrontEnd
+                             )
+{
+    hAacEnc->psyFrontEndMode = (psyFrontEnd != NULL) ? mode : PSY_FRONTEND_OWN;
+    hAacEnc->psyFrontEnd     = psyFrontEnd;
+}
+
 /*---------------------------------------------------------------------------
 
     functionname:FDKaacEnc_Close
@@ -972,7 +1181,9 @@ void FDKaacEnc_Close( HANDLE_AAC_ENC*  phAacEnc)   /* encoder handle */
     }
     AAC_ENC *hAacEnc = (AAC_ENC*)*phAacEnc;
 
-   if (hAacEnc->dynamic_RAM != NULL)
+    FDKaacEnc_CloseWorkers(hAacEnc);
+
+   if ( (hAacEnc->dynamic_RAM != NULL) && !hAacEnc->dynamicRamShared )
        FreeAACdynamic_RAM(&hAacEnc->dynamic_RAM);
 
     FDKaacEnc_PsyClose(&hAacEnc->psyKernel,hAacEnc->psyOut);
@@ -986,6 +1197,56 @@ void FDKaacEnc_Close( HANDLE_AAC_ENC*  phAacEnc)   /* encoder handle */
 /* The following functions are in this source file only for convenience and */
 /* need not be visible outside of a possible encoder library. */
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_InitWorkers
+    description:  (re)create the worker pool and the per worker psych scratch
+                  for the given number of workers, no pool for up to one worker
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+static AAC_ENCODER_ERROR FDKaacEnc_InitWorkers(HANDLE_AAC_ENC hAacEnc,
+                                               INT            nWorkers)
+{
+  INT i;
+
+  nWorkers = fixMax(1, fixMin(nWorkers, (8)));
+
+  if (nWorkers == FDKworkerPoolGetNumWorkers(hAacEnc->hWorkerPool)) {
+    return AAC_ENC_OK;
+  }
+
+  FDKaacEnc_CloseWorkers(hAacEnc);
+
+  if (nWorkers > 1) {
+    for (i = 1; i < nWorkers; i++) {
+      hAacEnc->psyDynamicWorker[i] = GetRam_aacEnc_PsyDynamicWorker(i);
+      if (hAacEnc->psyDynamicWorker[i] == NULL) {
+        FDKaacEnc_CloseWorkers(hAacEnc);
+        return AAC_ENC_NO_MEMORY;
+      }
+    }
+
+    if (FDKworkerPoolOpen(&hAacEnc->hWorkerPool, nWorkers) != 0) {
+      FDKaacEnc_CloseWorkers(hAacEnc);
+      return AAC_ENC_NO_MEMORY;
+    }
+  }
+
+  return AAC_ENC_OK;
+}
+
+static void FDKaacEnc_CloseWorkers(HANDLE_AAC_ENC hAacEnc)
+{
+  INT i;
+
+  FDKworkerPoolClose(&hAacEnc->hWorkerPool);
+
+  for (i = 1; i < (8); i++) {
+    FreeRam_aacEnc_PsyDynamicWorker(&hAacEnc->psyDynamicWorker[i]);
+  }
+}
+
 /* basic defines for ancillary data */
 #define MAX_ANCRATE 19200            /* ancillary rate >= 19200 isn't valid */
 
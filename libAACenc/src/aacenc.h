@@ -212,6 +212,8 @@ struct AACENC_CONFIG {
   UCHAR useIS;                  /* flag: use intensity coding */
 
   UCHAR useRequant;             /* flag: use afterburner */
+
+  INT   nThreads;               /* number of threads used for the per element processing, 0 or 1: single-threaded */
 };
 
 typedef struct {
@@ -223,6 +225,15 @@ typedef struct {
 
 typedef struct AAC_ENC *HANDLE_AAC_ENC;
 
+typedef enum {
+  PSY_FRONTEND_OWN = 0,   /*!< Block switching and transform are computed by the instance itself.              */
+  PSY_FRONTEND_EXPORT,    /*!< Block switching and transform are computed and shared with other instances.     */
+  PSY_FRONTEND_IMPORT,    /*!< Block switching and transform are taken over from the exporting instance.       */
+  PSY_FRONTEND_SPECTRUM   /*!< Window decisions, spectrum and TNS filters are delivered by a transcoder.         */
+} PSY_FRONTEND_MODE;
+
+struct PSY_FRONTEND_CHANNEL;
+
 /**
  * \brief Limit given bit rate to a valid value
  * \param hTpEnc transport encoder handle
@@ -283,6 +294,29 @@ AAC_ENCODER_ERROR FDKaacEnc_Open(HANDLE_AAC_ENC  *phAacEnc,              /* poin
                                  const INT        nChannels,             /* number of maximal channels in instance to support */
                                  const INT        nSubFrames);           /* support superframing in instance */
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_GetDynamicRamSize
+    description:  size of the dynamic RAM of an encoder instance, i.e. the memory
+                  which does not carry content from one frame to the next
+    returns:      size in bytes
+
+  ---------------------------------------------------------------------------*/
+UINT FDKaacEnc_GetDynamicRamSize(const INT nChannels,         /* number of maximal channels as passed to FDKaacEnc_Open() */
+                                  const INT nSubFrames);       /* number of sub frames as passed to FDKaacEnc_Open() */
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetDynamicRam
+    description:  move the dynamic RAM of an encoder instance to memory owned by
+                  the application, which may be shared by instances never
+                  encoding at the same time. NULL allocates an own dynamic RAM again.
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+AAC_ENCODER_ERROR FDKaacEnc_SetDynamicRam(HANDLE_AAC_ENC  hAacEnc,  /* encoder handle */
+                                          FIXP_DBL       *ram);     /* at least FDKaacEnc_GetDynamicRamSize() bytes, aligned by ALIGNMENT_DEFAULT */
+
 
 AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC     hAacEncoder,   /* pointer to an encoder handle, initialized on return */
                                        AACENC_CONFIG    *config,         /* pre-initialized config struct */
@@ -305,6 +339,22 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,         /
                                          AACENC_EXT_PAYLOAD   extPayload[MAX_TOTAL_EXT_PAYLOADS]
                                        );
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetPsyFrontEnd
+    description:  share block switching and transform among encoder instances
+                  which encode the same input signal with the same sample rate,
+                  AOT and channel configuration. The exporting instance has to
+                  encode each frame before the importing instances.
+    returns:      ---
+
+  ---------------------------------------------------------------------------*/
+
+void FDKaacEnc_SetPsyFrontEnd( HANDLE_AAC_ENC               hAacEnc,         /* encoder handle */
+                               PSY_FRONTEND_MODE            mode,
+                               struct PSY_FRONTEND_CHANNEL *psyFrontEnd      /* one entry per input channel, NULL for PSY_FRONTEND_OWN */
+                             );
+
 /*---------------------------------------------------------------------------
 
     functionname:FDKaacEnc_Close
@@ -94,6 +94,8 @@ amm-info@iis.fraunhofer.de
 
 #include "aacEnc_ram.h"
 #include "FDK_core.h" /* FDK_tools versioning info */
+#include "FDK_cpu.h"
+#include "FDK_threads.h"
 
 /* Encoder library info */
 #define AACENCODER_LIB_VL0 3
@@ -115,6 +117,9 @@ amm-info@iis.fraunhofer.de
 
 #include "metadata_main.h"
 
+#include "aacdecoder_lib.h"
+#include "aacdec_spectrum.h"
+
 #define SBL(fl)            (fl/8)                 /*!< Short block length (hardcoded to 8 short blocks per long block) */
 #define BSLA(fl)           (4*SBL(fl)+SBL(fl)/2)  /*!< AAC block switching look-ahead */
 #define DELAY_AAC(fl)      (fl+BSLA(fl))          /*!< MDCT + blockswitching */
@@ -166,6 +171,8 @@ typedef struct {
 
     UCHAR             userMetaDataMode;      /*!< Meta data library configuration. */
 
+    UINT              userNumThreads;        /*!< Number of threads of the core encoder. */
+
     UCHAR             userSbrEnabled;        /*!< Enable SBR for ELD. */
     UINT              userSbrRatio;          /*!< SBR sampling rate ratio. Dual- or single-rate. */
 
@@ -220,6 +227,10 @@ struct AACENCODER
 
     ULONG                    InitFlags;         /* internal status to treggier re-initialization */
 
+    FDK_ALLOCATOR            allocator;         /* allocator of all memory of the instance, see aacEncOpenWithAllocator() */
+
+    FDK_PROFILE_COUNTER      profile[AACENC_PROFILE_STAGES];  /* stage profiling counters, see aacEncGetProfile() */
+
 
    /* Memory allocation info. */
    INT                       nMaxAacElements;
@@ -407,6 +418,75 @@ static SBR_PS_SIGNALING getSbrSignalingMode(
 H_ALLOC_MEM (_AacEncoder, AACENCODER)
 C_ALLOC_MEM (_AacEncoder, AACENCODER, 1)
 
+/****************************************************************************
+                            Encoder Ladder
+****************************************************************************/
+
+struct AACENC_LADDER {
+    HANDLE_AACENCODER      hEncoder[AACENC_LADDER_MAX_RENDITIONS]; /* renditions, the first one computes the shared front end */
+    UINT                   nRenditions;
+
+    PSY_FRONTEND_CHANNEL  *psyFrontEnd;   /* block switching and transform shared by all renditions */
+} ;
+
+H_ALLOC_MEM (_AacEncLadder, AACENC_LADDER)
+C_ALLOC_MEM (_AacEncLadder, AACENC_LADDER, 1)
+
+/****************************************************************************
+                        Segment Parallel Encoding
+****************************************************************************/
+
+typedef struct {
+    HANDLE_AACENCODER  hEncoder;
+    INT                reset;           /* restart the encoder before the pre-roll */
+    INT                nPreRollFrames;  /* frames in front of pSamples encoded and dropped */
+    const INT_PCM     *pSamples;        /* first sample of the segment */
+    INT                numSamples;      /* number of samples of the segment */
+    INT                flush;           /* the segment ends the stream */
+    UCHAR             *pOutput;         /* access units of the segment */
+    INT                outputSize;
+    INT                outputBytes;
+    AACENC_ERROR       err;
+} AACENC_SEGMENT_JOB;
+
+struct AACENC_SEGMENTS {
+    HANDLE_AACENCODER       hEncoder[AACENC_SEGMENTS_MAX_ENCODERS];
+    UINT                    nEncoders;
+    INT                     nPreRollFrames;
+
+    UINT                    current;     /* encoder continuing the stream in the next call */
+    INT                     restart;     /* the next call starts a new stream */
+
+    HANDLE_FDK_WORKER_POOL  hPool;       /* one worker per encoder instance */
+    AACENC_SEGMENT_JOB      job[AACENC_SEGMENTS_MAX_ENCODERS];
+} ;
+
+H_ALLOC_MEM (_AacEncSegments, AACENC_SEGMENTS)
+C_ALLOC_MEM (_AacEncSegments, AACENC_SEGMENTS, 1)
+
+/****************************************************************************
+                        Compressed Domain Transcoder
+****************************************************************************/
+
+#define TRANSCODE_HEADROOM         ( 4 )   /* headroom of the imported spectrum like the encoder MDCT output */
+#define TRANSCODE_SCALE_OFFSET     ( -15 )   /* exponent of the encoder spectrum minus exponent of the decoder spectrum */
+
+struct AACENC_TRANSCODER {
+    HANDLE_AACENCODER       hEncoder;
+    HANDLE_AACDECODER       hDecoder;
+
+    AACDEC_SPECTRAL_FRAME  *pSpectralFrame;  /* decoded spectra of the current frame */
+    PSY_FRONTEND_CHANNEL   *psyFrontEnd;     /* spectra handed over to the encoder, one entry per channel */
+
+    INT                     sampleRate;      /* stream configuration the encoder is set up for */
+    INT                     channelConfig;
+} ;
+
+H_ALLOC_MEM (_AacEncTranscoder, AACENC_TRANSCODER)
+C_ALLOC_MEM (_AacEncTranscoder, AACENC_TRANSCODER, 1)
+H_ALLOC_MEM (_AacEncTranscodeFrame, AACDEC_SPECTRAL_FRAME)
+C_ALLOC_MEM (_AacEncTranscodeFrame, AACDEC_SPECTRAL_FRAME, 1)
+
 
 
 
@@ -585,6 +665,7 @@ AAC_ENCODER_ERROR aacEncDefaultConfig(HANDLE_AACENC_CONFIG hAacConfig,
     config->userPns         = hAacConfig->usePns;
     config->userIntensity   = hAacConfig->useIS;
     config->userAfterburner = hAacConfig->useRequant;
+    config->userNumThreads  = hAacConfig->nThreads;
     config->userFramelength = (UINT)-1;
 
     if (hAacConfig->syntaxFlags & AC_ER_VCB11) {
@@ -781,6 +862,7 @@ AACENC_ERROR FDKaacEnc_AdjustEncSettings(HANDLE_AACENCODER hAacEncoder,
     hAacConfig->bitrateMode     = config->userBitrateMode;
     hAacConfig->bandWidth       = config->userBandwidth;
     hAacConfig->useRequant      = config->userAfterburner;
+    hAacConfig->nThreads        = config->userNumThreads;
 
     hAacConfig->audioObjectType = config->userAOT;
     hAacConfig->anc_Rate        = config->userAncDataRate;
@@ -1211,20 +1293,98 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
 }
 
 
+/* Derive the encoder modules and maximal channels of an instance from the aacEncOpen() arguments. */
+static AACENC_ERROR aacEncGetMaxConfig(
+        const UINT                encModules,
+        const UINT                maxChannels,
+        UINT                     *pEncoderModis,
+        INT                      *pMaxAacChannels,
+        INT                      *pMaxSbrChannels
+        )
+{
+    /* Specify encoder modules to be allocated. */
+    if (encModules==0) {
+        *pEncoderModis = ENC_MODE_FLAG_AAC;
+        *pEncoderModis |= ENC_MODE_FLAG_SBR;
+        *pEncoderModis |= ENC_MODE_FLAG_PS;
+        *pEncoderModis |= ENC_MODE_FLAG_META;
+    }
+    else {
+       /* consider SAC and PS module */
+        *pEncoderModis = encModules;
+    }
+
+    /* Determine max channel configuration. */
+    if (maxChannels==0) {
+        *pMaxAacChannels = (8);
+        *pMaxSbrChannels = (8);
+    }
+    else {
+        *pMaxAacChannels = (maxChannels&0x00FF);
+        *pMaxSbrChannels = 0;
+        if ( (*pEncoderModis&ENC_MODE_FLAG_SBR) ) {
+            *pMaxSbrChannels = (maxChannels&0xFF00) ? (maxChannels>>8) : *pMaxAacChannels;
+        }
+
+        if ( (*pMaxAacChannels>(8)) || (*pMaxSbrChannels>(8)) ) {
+            return AACENC_INVALID_CONFIG;
+        }
+    } /* maxChannels==0 */
+
+    return AACENC_OK;
+}
+
+/* Size of the scratch memory shared by aacEncSetScratch(), laid out as AAC dynamic RAM followed by SBR dynamic RAM. */
+static UINT aacEncGetScratchLayout(
+        const UINT                encoderModis,
+        const INT                 nMaxAacChannels,
+        const INT                 nMaxSbrChannels,
+        const UINT                nMaxSubFrames,
+        UINT                     *pSbrOffset
+        )
+{
+    UINT size = ALIGN_SIZE(FDKaacEnc_GetDynamicRamSize(nMaxAacChannels, nMaxSubFrames));
+
+    if (pSbrOffset != NULL) {
+        *pSbrOffset = size;
+    }
+    if (encoderModis&ENC_MODE_FLAG_SBR) {
+        size += sbrEncoder_GetDynamicRamSize(nMaxSbrChannels, (encoderModis&ENC_MODE_FLAG_PS) ? 1 : 0);
+    }
+
+    /* Slack to align the start of the memory. */
+    return ALIGNMENT_DEFAULT + size;
+}
+
 AACENC_ERROR aacEncOpen(
         HANDLE_AACENCODER        *phAacEncoder,
         const UINT                encModules,
         const UINT                maxChannels
         )
+{
+    return aacEncOpenWithAllocator(phAacEncoder, encModules, maxChannels, NULL);
+}
+
+AACENC_ERROR aacEncOpenWithAllocator(
+        HANDLE_AACENCODER        *phAacEncoder,
+        const UINT                encModules,
+        const UINT                maxChannels,
+        const FDK_ALLOCATOR      *pAllocator
+        )
 {
     AACENC_ERROR err = AACENC_OK;
     HANDLE_AACENCODER  hAacEncoder = NULL;
+    const FDK_ALLOCATOR *prevAllocator;
 
     if (phAacEncoder == NULL) {
-        err = AACENC_INVALID_HANDLE;
-        goto bail;
+        return AACENC_INVALID_HANDLE;
     }
 
+    /* Select the kernel implementations for the host CPU. */
+    FDK_initCpuFeatures();
+
+    prevAllocator = FDKsetAllocator(pAllocator);
+
     /* allocate memory */
     hAacEncoder = Get_AacEncoder();
 
@@ -1235,34 +1395,20 @@ AACENC_ERROR aacEncOpen(
 
     FDKmemclear(hAacEncoder, sizeof(AACENCODER));
 
-    /* Specify encoder modules to be allocated. */
-    if (encModules==0) {
-        hAacEncoder->encoder_modis = ENC_MODE_FLAG_AAC;
-        hAacEncoder->encoder_modis |= ENC_MODE_FLAG_SBR;
-        hAacEncoder->encoder_modis |= ENC_MODE_FLAG_PS;
-        hAacEncoder->encoder_modis |= ENC_MODE_FLAG_META;
-    }
-    else {
-       /* consider SAC and PS module */
-        hAacEncoder->encoder_modis = encModules;
+    /* Keep a copy of the allocator for the allocations following in later calls. */
+    if (pAllocator != NULL) {
+        hAacEncoder->allocator = *pAllocator;
     }
 
-    /* Determine max channel configuration. */
-    if (maxChannels==0) {
-        hAacEncoder->nMaxAacChannels = (8);
-        hAacEncoder->nMaxSbrChannels = (8);
+    /* Specify encoder modules and max channel configuration. */
+    err = aacEncGetMaxConfig(encModules,
+                             maxChannels,
+                            &hAacEncoder->encoder_modis,
+                            &hAacEncoder->nMaxAacChannels,
+                            &hAacEncoder->nMaxSbrChannels);
+    if (err != AACENC_OK) {
+        goto bail;
     }
-    else {
-        hAacEncoder->nMaxAacChannels = (maxChannels&0x00FF);
-        if ( (hAacEncoder->encoder_modis&ENC_MODE_FLAG_SBR) ) {
-            hAacEncoder->nMaxSbrChannels = (maxChannels&0xFF00) ? (maxChannels>>8) : hAacEncoder->nMaxAacChannels;
-        }
-
-        if ( (hAacEncoder->nMaxAacChannels>(8)) || (hAacEncoder->nMaxSbrChannels>(8)) ) {
-            err = AACENC_INVALID_CONFIG;
-            goto bail;
-        }
-    } /* maxChannels==0 */
 
     /* Max number of elements could be tuned any more. */
     hAacEncoder->nMaxAacElements = fixMin((8), hAacEncoder->nMaxAacChannels);
@@ -1302,11 +1448,15 @@ AACENC_ERROR aacEncOpen(
       for (ld_M=1; (UINT)(1<<ld_M) < (hAacEncoder->nMaxSubFrames*hAacEncoder->nMaxAacChannels*6144)>>3; ld_M++) ;
       hAacEncoder->outBufferInBytes = (1<<ld_M);  /* buffer has to be 2^n */
     }
-    hAacEncoder->outBuffer = GetRam_bsOutbuffer();
     if (OUTPUTBUFFER_SIZE < hAacEncoder->outBufferInBytes ) {
       err = AACENC_MEMORY_ERROR;
       goto bail;
     }
+    hAacEncoder->outBuffer = GetRam_bsOutbuffer(hAacEncoder->outBufferInBytes);
+    if (hAacEncoder->outBuffer == NULL) {
+      err = AACENC_MEMORY_ERROR;
+      goto bail;
+    }
 
     /* Open Meta Data Encoder */
     if (hAacEncoder->encoder_modis&ENC_MODE_FLAG_META) {
@@ -1351,16 +1501,118 @@ AACENC_ERROR aacEncOpen(
     /* Return encoder instance */
     *phAacEncoder = hAacEncoder;
 
+    FDKsetAllocator(prevAllocator);
+
     return err;
 
 bail:
     aacEncClose(&hAacEncoder);
 
+    FDKsetAllocator(prevAllocator);
+
     return err;
 }
 
 
 
+UINT aacEncGetRequiredMemory(
+        const UINT                encModules,
+        const UINT                maxChannels
+        )
+{
+    FDK_ARENA measure;
+    HANDLE_AACENCODER hAacEncoder = NULL;
+
+    /* All memory is allocated in aacEncOpen(), measure the allocations of a new instance. */
+    FDKarenaInit(&measure, NULL, 0);
+    if (aacEncOpenWithAllocator(&hAacEncoder, encModules, maxChannels, &measure.allocator) != AACENC_OK) {
+        return 0;
+    }
+    aacEncClose(&hAacEncoder);
+
+    return FDKarenaGetOverhead() + measure.used;
+}
+
+AACENC_ERROR aacEncOpenWithMemory(
+        HANDLE_AACENCODER        *phAacEncoder,
+        const UINT                encModules,
+        const UINT                maxChannels,
+        void                     *pMemory,
+        const UINT                memorySize
+        )
+{
+    FDK_ARENA *pArena;
+
+    if (phAacEncoder == NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    pArena = FDKarenaCreate(pMemory, memorySize);
+    if (pArena == NULL) {
+        return AACENC_MEMORY_ERROR;
+    }
+
+    return aacEncOpenWithAllocator(phAacEncoder, encModules, maxChannels, &pArena->allocator);
+}
+
+UINT aacEncGetScratchSize(
+        const UINT                encModules,
+        const UINT                maxChannels
+        )
+{
+    UINT encoderModis;
+    INT nMaxAacChannels, nMaxSbrChannels;
+
+    if (aacEncGetMaxConfig(encModules, maxChannels, &encoderModis, &nMaxAacChannels, &nMaxSbrChannels) != AACENC_OK) {
+        return 0;
+    }
+
+    return aacEncGetScratchLayout(encoderModis, nMaxAacChannels, nMaxSbrChannels, (1), NULL);
+}
+
+AACENC_ERROR aacEncSetScratch(
+        const HANDLE_AACENCODER   hAacEncoder,
+        void                     *pScratch,
+        const UINT                scratchSize
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    const FDK_ALLOCATOR *prevAllocator;
+    UCHAR *pAacRam = NULL, *pSbrRam = NULL;
+
+    if (hAacEncoder == NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    if (pScratch != NULL) {
+        UINT sbrOffset;
+        UINT size = aacEncGetScratchLayout(hAacEncoder->encoder_modis,
+                                           hAacEncoder->nMaxAacChannels,
+                                           hAacEncoder->nMaxSbrChannels,
+                                           hAacEncoder->nMaxSubFrames,
+                                          &sbrOffset);
+        if (scratchSize < size) {
+            return AACENC_MEMORY_ERROR;
+        }
+        pAacRam = ALIGN_PTR(pScratch);
+        pSbrRam = pAacRam + sbrOffset;
+    }
+
+    /* Unbinding allocates the dynamic RAM of the instance again. */
+    prevAllocator = FDKsetAllocator(&hAacEncoder->allocator);
+
+    if ( (hAacEncoder->hEnvEnc != NULL) && sbrEncoder_SetDynamicRam(hAacEncoder->hEnvEnc, pSbrRam) ) {
+        err = AACENC_MEMORY_ERROR;
+    }
+    else if (FDKaacEnc_SetDynamicRam(hAacEncoder->hAacEnc, (FIXP_DBL*)pAacRam) != AAC_ENC_OK) {
+        err = AACENC_MEMORY_ERROR;
+    }
+
+    FDKsetAllocator(prevAllocator);
+
+    return err;
+}
+
 AACENC_ERROR aacEncClose(HANDLE_AACENCODER *phAacEncoder)
 {
     AACENC_ERROR err = AACENC_OK;
@@ -1403,6 +1655,28 @@ bail:
     return err;
 }
 
+/*
+ * \brief  Account the stage times of the encoded frame to the profiling counters.
+ */
+static void aacEncProfileFrame(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const FDK_PROFILE_TICKS   frameStart,
+        const FDK_PROFILE_TICKS   sbrTicks
+        )
+{
+    FDK_PROFILE_TICKS *ticks = hAacEncoder->hAacEnc->profileTicks;
+    int stage;
+
+    FDKprofileStop(frameStart, &ticks[AACENC_PROF_FRAME]);
+    ticks[AACENC_PROF_SBR] = sbrTicks;
+
+    for (stage = 0; stage < AACENC_PROFILE_STAGES; stage++) {
+        if (ticks[stage] > 0) {
+            FDKprofileAdd(&hAacEncoder->profile[stage], ticks[stage]);
+        }
+    }
+}
+
 AACENC_ERROR aacEncEncode(
         const HANDLE_AACENCODER   hAacEncoder,
         const AACENC_BufDesc     *inBufDesc,
@@ -1416,6 +1690,7 @@ AACENC_ERROR aacEncEncode(
     INT  outBytes[(1)];
     int  nExtensions = 0;
     int  ancDataExtIdx = -1;
+    FDK_PROFILE_TICKS profileStart, sbrTicks = 0;
 
     /* deal with valid encoder handle */
     if (hAacEncoder==NULL) {
@@ -1428,11 +1703,14 @@ AACENC_ERROR aacEncEncode(
      * Adjust user settings and trigger reinitialization.
      */
     if (hAacEncoder->InitFlags!=0) {
+        const FDK_ALLOCATOR *prevAllocator = FDKsetAllocator(&hAacEncoder->allocator);
 
         err = aacEncInit(hAacEncoder,
                          hAacEncoder->InitFlags,
                         &hAacEncoder->extParam);
 
+        FDKsetAllocator(prevAllocator);
+
         if (err!=AACENC_OK) {
             /* keep init flags alive! */
             goto bail;
@@ -1492,6 +1770,11 @@ AACENC_ERROR aacEncEncode(
         outargs->numInSamples = newSamples;
     }
 
+    /* A transcoder delivers the spectra of the next frame instead of audio samples. */
+    if (hAacEncoder->hAacEnc->psyFrontEndMode == PSY_FRONTEND_SPECTRUM) {
+        hAacEncoder->nSamplesRead = hAacEncoder->nSamplesToRead;
+    }
+
     /* input buffer completely filled ? */
     if (hAacEncoder->nSamplesRead < hAacEncoder->nSamplesToRead)
     {
@@ -1523,6 +1806,8 @@ AACENC_ERROR aacEncEncode(
         }
     }
 
+    profileStart = FDKprofileStart();
+
     /* init payload */
     FDKmemclear(hAacEncoder->extPayload, sizeof(AACENC_EXT_PAYLOAD) * MAX_TOTAL_EXT_PAYLOADS);
     for (i = 0; i < MAX_TOTAL_EXT_PAYLOADS; i++) {
@@ -1576,11 +1861,13 @@ AACENC_ERROR aacEncEncode(
     if ( isSbrActive(&hAacEncoder->aacConfig) ) {
 
         INT nPayload = 0;
+        INT sbrError;
+        FDK_PROFILE_TICKS sbrStart = FDKprofileStart();
 
         /*
          * Encode SBR data.
          */
-        if (sbrEncoder_EncodeFrame(hAacEncoder->hEnvEnc,
+        sbrError = sbrEncoder_EncodeFrame(hAacEncoder->hEnvEnc,
                                    hAacEncoder->inputBuffer,
                                    hAacEncoder->extParam.nChannels,
                                    hAacEncoder->extPayloadSize[nPayload],
@@ -1588,7 +1875,10 @@ AACENC_ERROR aacEncEncode(
 #if defined(EVAL_PACKAGE_SILENCE) || defined(EVAL_PACKAGE_SBR_SILENCE)
                                   ,hAacEncoder->hAacEnc->clearOutput
 #endif
-                                  ))
+                                  );
+        FDKprofileStop(sbrStart, &sbrTicks);
+
+        if (sbrError)
         {
             err = AACENC_ENCODE_ERROR;
             goto bail;
@@ -1676,6 +1966,8 @@ AACENC_ERROR aacEncEncode(
         }
     }
 
+    aacEncProfileFrame(hAacEncoder, profileStart, sbrTicks);
+
 bail:
     if (err == AACENC_ENCODE_ERROR) {
         /* All encoder modules have to be initialized */
@@ -1685,89 +1977,1015 @@ bail:
     return err;
 }
 
-static
-AAC_ENCODER_ERROR aacEncGetConf(HANDLE_AACENCODER  hAacEncoder,
-                                UINT              *size,
-                                UCHAR             *confBuffer)
+/*
+ * \brief  Check whether all renditions of a ladder are able to share the block switching and transform.
+ *
+ * Pending reinitializations are applied first. The renditions must encode the same core input signal, i.e.
+ * same AOT, sample rate, frame length and channel configuration without SBR. Renditions which ran out of
+ * lockstep, e.g. after an encoding error, are not touched.
+ *
+ * \param hLadder               A valid encoder ladder handle.
+ *
+ * \return - AACENC_OK, all renditions can be encoded with a shared front end.
+ *         - AACENC_INVALID_CONFIG, if the renditions are not compatible.
+ *         - AACENC_ENCODE_ERROR, if the input buffers of the renditions are not in lockstep.
+ *         - AACENC_INIT_ERROR, on failure of a pending reinitialization.
+ */
+static AACENC_ERROR aacEncLadderCheck(
+        const HANDLE_AACENC_LADDER  hLadder
+        )
 {
-    FDK_BITSTREAM tmpConf;
-    UINT confType;
-    UCHAR buf[64];
-    int err;
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENCODER hRef = hLadder->hEncoder[0];
+    INT inLockstep = 1;
+    UINT r;
 
-    /* Init bit buffer */
-    FDKinitBitStream(&tmpConf, buf, 64, 0, BS_WRITER);
+    for (r=0; r<hLadder->nRenditions; r++) {
+        HANDLE_AACENCODER hEnc = hLadder->hEncoder[r];
 
-    /* write conf in tmp buffer */
-    err = transportEnc_GetConf(hAacEncoder->hTpEnc, &hAacEncoder->coderConfig, &tmpConf, &confType);
+        /* apply pending reinitialization */
+        if ( (err = aacEncEncode(hEnc, NULL, NULL, NULL, NULL)) != AACENC_OK ) {
+            goto bail;
+        }
 
-    /* copy data to outbuffer: length in bytes */
-    FDKbyteAlign(&tmpConf, 0);
+        if ( isSbrActive(&hEnc->aacConfig)
+          || (hEnc->aacConfig.audioObjectType != hRef->aacConfig.audioObjectType)
+          || (hEnc->aacConfig.sampleRate != hRef->aacConfig.sampleRate)
+          || (hEnc->aacConfig.framelength != hRef->aacConfig.framelength)
+          || (hEnc->aacConfig.channelMode != hRef->aacConfig.channelMode)
+          || (hEnc->aacConfig.channelOrder != hRef->aacConfig.channelOrder)
+          || (hEnc->extParam.userMetaDataMode != hRef->extParam.userMetaDataMode)
+          || (hEnc->nSamplesToRead != hRef->nSamplesToRead)
+          || (hEnc->nDelay != hRef->nDelay) )
+        {
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
 
-    /* Check buffer size */
-    if (FDKgetValidBits(&tmpConf) > ((*size)<<3))
-      return AAC_ENC_UNKNOWN;
+        if ( (hEnc->nSamplesRead != hRef->nSamplesRead)
+          || (hEnc->nZerosAppended != hRef->nZerosAppended) )
+        {
+            inLockstep = 0;
+        }
+    }
 
-    FDKfetchBuffer(&tmpConf, confBuffer, size);
+    if (!inLockstep) {
+        /* the caller decides whether to restart the renditions */
+        err = AACENC_ENCODE_ERROR;
+    }
 
-    if (err != 0)
-      return AAC_ENC_UNKNOWN;
-    else
-      return AAC_ENC_OK;
+bail:
+    return err;
 }
 
-
-AACENC_ERROR aacEncGetLibInfo(LIB_INFO *info)
+AACENC_ERROR aacEncLadderOpen(
+        HANDLE_AACENC_LADDER     *phLadder,
+        const HANDLE_AACENCODER  *phEncoders,
+        const UINT                nRenditions
+        )
 {
-  int i = 0;
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENC_LADDER hLadder = NULL;
+    UINT r;
 
-  if (info == NULL) {
-    return AACENC_INVALID_HANDLE;
-  }
+    if ( (phLadder == NULL) || (phEncoders == NULL) ) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
 
-  FDK_toolsGetLibInfo( info );
-  transportEnc_GetLibInfo( info );
+    *phLadder = NULL;
 
-  sbrEncoder_GetLibInfo( info );
+    if ( (nRenditions < 1) || (nRenditions > AACENC_LADDER_MAX_RENDITIONS) ) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
 
-  /* search for next free tab */
-  for (i = 0; i < FDK_MODULE_LAST; i++) {
-    if (info[i].module_id == FDK_NONE) break;
-  }
-  if (i == FDK_MODULE_LAST) {
-    return AACENC_INIT_ERROR;
-  }
+    for (r=0; r<nRenditions; r++) {
+        if ( (phEncoders[r] == NULL) || (phEncoders[r]->hAacEnc == NULL) ) {
+            err = AACENC_INVALID_HANDLE;
+            goto bail;
+        }
+    }
 
-  info[i].module_id = FDK_AACENC;
-  info[i].build_date = (char*)AACENCODER_LIB_BUILD_DATE;
-  info[i].build_time = (char*)AACENCODER_LIB_BUILD_TIME;
-  info[i].title = (char*)AACENCODER_LIB_TITLE;
-  info[i].version = LIB_VERSION(AACENCODER_LIB_VL0, AACENCODER_LIB_VL1, AACENCODER_LIB_VL2);;
-  LIB_VERSION_STRING(&info[i]);
+    /* allocate memory */
+    hLadder = Get_AacEncLadder();
 
-  /* Capability flags */
-  info[i].flags = 0
-    | CAPF_AAC_1024 | CAPF_AAC_LC
-    | CAPF_AAC_512
-    | CAPF_AAC_480
-    | CAPF_AAC_DRC
-      ;
-  /* End of flags */
+    if (hLadder == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
 
-  return AACENC_OK;
-}
+    FDKmemclear(hLadder, sizeof(AACENC_LADDER));
 
-AACENC_ERROR aacEncoder_SetParam(
-        const HANDLE_AACENCODER   hAacEncoder,
-        const AACENC_PARAM        param,
-        const UINT                value
-        )
-{
-    AACENC_ERROR err = AACENC_OK;
-    USER_PARAM *settings = &hAacEncoder->extParam;
+    hLadder->psyFrontEnd = GetRam_aacEnc_PsyFrontEnd();
 
-    /* check encoder handle */
-    if (hAacEncoder == NULL) {
+    if (hLadder->psyFrontEnd == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    for (r=0; r<nRenditions; r++) {
+        hLadder->hEncoder[r] = phEncoders[r];
+    }
+    hLadder->nRenditions = nRenditions;
+
+    if ( (err = aacEncLadderCheck(hLadder)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    /* An encoder instance can be part of only one ladder and only once. */
+    for (r=0; r<nRenditions; r++) {
+        if (hLadder->hEncoder[r]->hAacEnc->psyFrontEndMode != PSY_FRONTEND_OWN) {
+            for (; r>0; r--) {
+                FDKaacEnc_SetPsyFrontEnd(hLadder->hEncoder[r-1]->hAacEnc, PSY_FRONTEND_OWN, NULL);
+            }
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
+        FDKaacEnc_SetPsyFrontEnd(hLadder->hEncoder[r]->hAacEnc,
+                                 (r==0) ? PSY_FRONTEND_EXPORT : PSY_FRONTEND_IMPORT,
+                                 hLadder->psyFrontEnd);
+    }
+
+    *phLadder = hLadder;
+
+    return err;
+
+bail:
+    if (hLadder != NULL) {
+        hLadder->nRenditions = 0; /* the encoder instances are not attached yet */
+        aacEncLadderClose(&hLadder);
+    }
+    return err;
+}
+
+AACENC_ERROR aacEncLadderEncode(
+        const HANDLE_AACENC_LADDER   hLadder,
+        const AACENC_BufDesc        *inBufDesc,
+        const AACENC_BufDesc *const *outBufDesc,
+        const AACENC_InArgs         *inargs,
+        AACENC_OutArgs              *outargs
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    UINT r;
+
+    if ( (hLadder == NULL) || (outBufDesc == NULL) || (inargs == NULL) || (outargs == NULL) ) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    if ( (err = aacEncLadderCheck(hLadder)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    /* The first rendition computes block switching and transform, the others take them over. */
+    for (r=0; r<hLadder->nRenditions; r++) {
+        AACENC_ERROR errRendition = aacEncEncode(hLadder->hEncoder[r], inBufDesc, outBufDesc[r], inargs, &outargs[r]);
+
+        if (errRendition != AACENC_OK) {
+            if (err == AACENC_OK) {
+                err = errRendition;
+            }
+            if (r == 0) {
+                break; /* no front end for the remaining renditions */
+            }
+        }
+    }
+
+bail:
+    return err;
+}
+
+AACENC_ERROR aacEncLadderClose(
+        HANDLE_AACENC_LADDER     *phLadder
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+
+    if (phLadder == NULL) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    if (*phLadder != NULL) {
+        HANDLE_AACENC_LADDER hLadder = *phLadder;
+        UINT r;
+
+        for (r=0; r<hLadder->nRenditions; r++) {
+            FDKaacEnc_SetPsyFrontEnd(hLadder->hEncoder[r]->hAacEnc, PSY_FRONTEND_OWN, NULL);
+        }
+
+        if (hLadder->psyFrontEnd != NULL) {
+            FreeRam_aacEnc_PsyFrontEnd(&hLadder->psyFrontEnd);
+        }
+
+        Free_AacEncLadder(phLadder);
+    }
+
+bail:
+    return err;
+}
+
+/*
+ * \brief  Set up the encoder for the stream configuration found by the decoder of a transcoder.
+ *
+ * \param hTc                   A valid transcoder handle.
+ *
+ * \return - AACENC_OK, on success.
+ *         - AACENC_INVALID_CONFIG, if the stream cannot be transcoded.
+ *         - AACENC_INIT_ERROR, ..., if the encoder failed to initialize.
+ */
+static AACENC_ERROR aacEncTranscodeConfigure(
+        const HANDLE_AACENC_TRANSCODER  hTc
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    CStreamInfo *pInfo = aacDecoder_GetStreamInfo(hTc->hDecoder);
+    const AACDEC_SPECTRAL_FRAME *pFrame = hTc->pSpectralFrame;
+    CHANNEL_MAPPING *cm;
+    INT el;
+
+    if ( (pInfo == NULL)
+      || (pInfo->aot != AOT_AAC_LC)
+      || (pInfo->flags & (AC_SBR_PRESENT|AC_PS_PRESENT))
+      || (pInfo->aacSamplesPerFrame != 1024)
+      || (pInfo->channelConfig < 1) || (pInfo->channelConfig > 7) )
+    {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+
+    if ( (pInfo->aacSampleRate != hTc->sampleRate) || (pInfo->channelConfig != hTc->channelConfig) )
+    {
+        if ( ((err = aacEncoder_SetParam(hTc->hEncoder, AACENC_AOT, AOT_AAC_LC)) != AACENC_OK)
+          || ((err = aacEncoder_SetParam(hTc->hEncoder, AACENC_SAMPLERATE, pInfo->aacSampleRate)) != AACENC_OK)
+          || ((err = aacEncoder_SetParam(hTc->hEncoder, AACENC_CHANNELMODE, pInfo->channelConfig)) != AACENC_OK)
+          || ((err = aacEncoder_SetParam(hTc->hEncoder, AACENC_GRANULE_LENGTH, 1024)) != AACENC_OK)
+          || ((err = aacEncoder_SetParam(hTc->hEncoder, AACENC_METADATA_MODE, 0)) != AACENC_OK) )
+        {
+            goto bail;
+        }
+        hTc->sampleRate    = pInfo->aacSampleRate;
+        hTc->channelConfig = pInfo->channelConfig;
+    }
+
+    /* apply pending reinitialization */
+    if ( (err = aacEncEncode(hTc->hEncoder, NULL, NULL, NULL, NULL)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    /* The encoder writes the channel elements in the order of the decoded ones. */
+    cm = &hTc->hEncoder->hAacEnc->channelMapping;
+
+    if (cm->nElements != pFrame->numElements) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+    for (el=0; el<cm->nElements; el++) {
+        if (cm->elInfo[el].elType != pFrame->elementType[el]) {
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
+    }
+
+bail:
+    return err;
+}
+
+/*
+ * \brief  Get the smallest exponent which keeps TRANSCODE_HEADROOM bits of headroom in all windows of a
+ *         decoded channel.
+ */
+static INT aacEncTranscodeExponent(
+        const AACDEC_SPECTRAL_CHANNEL  *pChannel
+        )
+{
+    INT nWindows = (pChannel->windowSequence == SHORT_WINDOW) ? TRANS_FAC : 1;
+    INT windowLength = (1024) / nWindows;
+    INT specScale = 0;
+    INT w;
+
+    for (w=0; w<nWindows; w++) {
+        INT headroom = getScalefactor(&pChannel->spectrum[w*windowLength], windowLength);
+        INT windowScale = pChannel->specScale[w] - headroom + TRANSCODE_HEADROOM;
+
+        specScale = (w == 0) ? windowScale : fixMax(specScale, windowScale);
+    }
+
+    return specScale;
+}
+
+/*
+ * \brief  Convert the decoded spectrum of one channel into the input of the encoder psychoacoustic.
+ *
+ * All windows are scaled to the given exponent, which has to be common to the channels of an element
+ * for the stereo processing of the encoder. More than MAX_NO_OF_GROUPS window groups are merged with
+ * their shortest neighbour, and the TNS filters are taken over unchanged.
+ */
+static void aacEncTranscodeChannel(
+        const AACDEC_SPECTRAL_CHANNEL  *pChannel,
+        PSY_FRONTEND_CHANNEL           *pFrontEnd,
+        const INT                       specScale
+        )
+{
+    BLOCK_SWITCHING_CONTROL *pBsc = &pFrontEnd->blockSwitchingControl;
+    TNS_INFO *pTnsInfo = &pFrontEnd->tnsInfo;
+    INT nWindows = (pChannel->windowSequence == SHORT_WINDOW) ? TRANS_FAC : 1;
+    INT windowLength = (1024) / nWindows;
+    INT w, f, g, i;
+
+    for (w=0; w<nWindows; w++) {
+        INT shift = fixMax(pChannel->specScale[w] - specScale, -(DFRACT_BITS-1));
+
+        scaleValues(&pFrontEnd->mdctSpectrum[w*windowLength], &pChannel->spectrum[w*windowLength], windowLength, shift);
+    }
+    pFrontEnd->mdctScale = specScale + TRANSCODE_SCALE_OFFSET;
+
+    /* window decisions */
+    FDKmemclear(pBsc, sizeof(BLOCK_SWITCHING_CONTROL));
+    pBsc->lastWindowSequence = pChannel->windowSequence;
+    pBsc->windowShape        = pChannel->windowShape;
+    pBsc->lastWindowShape    = pChannel->windowShape;
+
+    if (pChannel->windowSequence == SHORT_WINDOW) {
+        INT groupLen[TRANS_FAC];
+        INT nGroups = pChannel->windowGroups;
+
+        for (g=0; g<nGroups; g++) {
+            groupLen[g] = pChannel->windowGroupLength[g];
+        }
+        while (nGroups > MAX_NO_OF_GROUPS) {
+            /* merge the shortest pair of neighbouring groups */
+            INT best = 0;
+            for (g=1; g<nGroups-1; g++) {
+                if (groupLen[g]+groupLen[g+1] < groupLen[best]+groupLen[best+1]) {
+                    best = g;
+                }
+            }
+            groupLen[best] += groupLen[best+1];
+            for (g=best+1; g<nGroups-1; g++) {
+                groupLen[g] = groupLen[g+1];
+            }
+            nGroups--;
+        }
+        pBsc->noOfGroups = nGroups;
+        for (g=0; g<nGroups; g++) {
+            pBsc->groupLen[g] = groupLen[g];
+        }
+    }
+    else {
+        pBsc->noOfGroups  = 1;
+        pBsc->groupLen[0] = 1;
+    }
+
+    /* TNS filters of the residual */
+    FDKmemclear(pTnsInfo, sizeof(TNS_INFO));
+    if (pChannel->tnsActive) {
+        for (w=0; w<nWindows; w++) {
+            pTnsInfo->numOfFilters[w] = pChannel->tnsNumFilters[w];
+            pTnsInfo->coefRes[w]      = pChannel->tnsCoefRes[w];
+            for (f=0; f<pChannel->tnsNumFilters[w]; f++) {
+                pTnsInfo->length[w][f]    = pChannel->tnsLength[w][f];
+                pTnsInfo->order[w][f]     = pChannel->tnsOrder[w][f];
+                pTnsInfo->direction[w][f] = pChannel->tnsDirection[w][f];
+                for (i=0; i<pChannel->tnsOrder[w][f]; i++) {
+                    pTnsInfo->coef[w][f][i] = pChannel->tnsCoef[w][f][i];
+                }
+            }
+        }
+    }
+}
+
+AACENC_ERROR aacEncTranscodeOpen(
+        HANDLE_AACENC_TRANSCODER *phTranscoder,
+        const HANDLE_AACENCODER   hEncoder,
+        const TRANSPORT_TYPE      inputFormat,
+        UCHAR                    *conf,
+        const UINT                confSize
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENC_TRANSCODER hTc = NULL;
+
+    if ( (phTranscoder == NULL) || (hEncoder == NULL) || (hEncoder->hAacEnc == NULL) ) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    *phTranscoder = NULL;
+
+    /* An encoder instance can not be part of a ladder and a transcoder at the same time. */
+    if (hEncoder->hAacEnc->psyFrontEndMode != PSY_FRONTEND_OWN) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+
+    /* allocate memory */
+    hTc = Get_AacEncTranscoder();
+
+    if (hTc == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    FDKmemclear(hTc, sizeof(AACENC_TRANSCODER));
+
+    hTc->pSpectralFrame = Get_AacEncTranscodeFrame();
+    hTc->psyFrontEnd    = GetRam_aacEnc_PsyFrontEnd();
+
+    if ( (hTc->pSpectralFrame == NULL) || (hTc->psyFrontEnd == NULL) ) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    /* filters which the encoder cannot signal are applied by the decoder */
+    hTc->pSpectralFrame->tnsMaxFilters = MAX_NUM_OF_FILTERS;
+    hTc->pSpectralFrame->tnsMaxOrder   = TNS_MAX_ORDER;
+
+    hTc->hDecoder = aacDecoder_Open(inputFormat, 1);
+
+    if (hTc->hDecoder == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    if (conf != NULL) {
+        UINT length = confSize;
+        if (aacDecoder_ConfigRaw(hTc->hDecoder, &conf, &length) != AAC_DEC_OK) {
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
+    }
+
+    hTc->hEncoder = hEncoder;
+    FDKaacEnc_SetPsyFrontEnd(hEncoder->hAacEnc, PSY_FRONTEND_SPECTRUM, hTc->psyFrontEnd);
+
+    *phTranscoder = hTc;
+
+    return err;
+
+bail:
+    if (hTc != NULL) {
+        aacEncTranscodeClose(&hTc);
+    }
+    return err;
+}
+
+AACENC_ERROR aacEncTranscode(
+        const HANDLE_AACENC_TRANSCODER  hTranscoder,
+        UCHAR                          *pBuffer,
+        const UINT                      bufferSize,
+        UINT                           *pBytesValid,
+        const AACENC_BufDesc           *outBufDesc,
+        AACENC_OutArgs                 *outargs
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    AAC_DECODER_ERROR decErr;
+    AACENC_BufDesc inBufDesc;
+    AACENC_InArgs inargs;
+    const AACDEC_SPECTRAL_FRAME *pFrame;
+    CHANNEL_MAPPING *cm;
+    INT el, ch, chIn, specScale;
+
+    if ( (hTranscoder == NULL) || (outBufDesc == NULL) || (outargs == NULL) ) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    FDKmemclear(outargs, sizeof(AACENC_OutArgs));
+
+    if (pBuffer != NULL) {
+        UINT size = bufferSize;
+
+        if ( (pBytesValid == NULL)
+          || (aacDecoder_Fill(hTranscoder->hDecoder, &pBuffer, &size, pBytesValid) != AAC_DEC_OK) )
+        {
+            err = AACENC_ENCODE_ERROR;
+            goto bail;
+        }
+    }
+
+    decErr = aacDecoder_DecodeSpectralFrame(hTranscoder->hDecoder, hTranscoder->pSpectralFrame, 0);
+
+    if (decErr == AAC_DEC_NOT_ENOUGH_BITS) {
+        goto bail; /* wait for more input */
+    }
+    if ( ! IS_OUTPUT_VALID(decErr) ) {
+        err = AACENC_ENCODE_ERROR;
+        goto bail;
+    }
+
+    if ( (err = aacEncTranscodeConfigure(hTranscoder)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    /* hand the spectra over to the channels of the encoder */
+    pFrame = hTranscoder->pSpectralFrame;
+    cm = &hTranscoder->hEncoder->hAacEnc->channelMapping;
+
+    for (el=0, chIn=0; el<cm->nElements; el++) {
+        const ELEMENT_INFO *pElInfo = &cm->elInfo[el];
+
+        if (pElInfo->nChannelsInEl == 2) {
+            /* the encoder supports common windows only */
+            const AACDEC_SPECTRAL_CHANNEL *pL = &pFrame->channel[chIn];
+            const AACDEC_SPECTRAL_CHANNEL *pR = &pFrame->channel[chIn+1];
+
+            if ( (pL->windowSequence != pR->windowSequence)
+              || (pL->windowGroups != pR->windowGroups)
+              || FDKmemcmp(pL->windowGroupLength, pR->windowGroupLength, pL->windowGroups*sizeof(UCHAR)) )
+            {
+                err = AACENC_INVALID_CONFIG;
+                goto bail;
+            }
+        }
+
+        specScale = -TRANSCODE_SCALE_OFFSET; /* the psychoacoustic does not expect a left shifted transform output */
+        for (ch=0; ch<pElInfo->nChannelsInEl; ch++) {
+            specScale = fixMax(specScale, aacEncTranscodeExponent(&pFrame->channel[chIn+ch]));
+        }
+        for (ch=0; ch<pElInfo->nChannelsInEl; ch++) {
+            aacEncTranscodeChannel(&pFrame->channel[chIn+ch], &hTranscoder->psyFrontEnd[pElInfo->ChannelIndex[ch]], specScale);
+        }
+        chIn += pElInfo->nChannelsInEl;
+    }
+
+    /* encode one frame without input samples */
+    FDKmemclear(&inBufDesc, sizeof(AACENC_BufDesc));
+    FDKmemclear(&inargs, sizeof(AACENC_InArgs));
+
+    err = aacEncEncode(hTranscoder->hEncoder, &inBufDesc, outBufDesc, &inargs, outargs);
+
+bail:
+    return err;
+}
+
+AACENC_ERROR aacEncTranscodeClose(
+        HANDLE_AACENC_TRANSCODER *phTranscoder
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+
+    if (phTranscoder == NULL) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    if (*phTranscoder != NULL) {
+        HANDLE_AACENC_TRANSCODER hTc = *phTranscoder;
+
+        if (hTc->hEncoder != NULL) {
+            /* the filterbank states of the encoder are outdated */
+            FDKaacEnc_SetPsyFrontEnd(hTc->hEncoder->hAacEnc, PSY_FRONTEND_OWN, NULL);
+            hTc->hEncoder->InitFlags |= AACENC_INIT_ALL;
+        }
+
+        if (hTc->hDecoder != NULL) {
+            aacDecoder_Close(hTc->hDecoder);
+        }
+
+        if (hTc->psyFrontEnd != NULL) {
+            FreeRam_aacEnc_PsyFrontEnd(&hTc->psyFrontEnd);
+        }
+
+        if (hTc->pSpectralFrame != NULL) {
+            Free_AacEncTranscodeFrame(&hTc->pSpectralFrame);
+        }
+
+        Free_AacEncTranscoder(phTranscoder);
+    }
+
+bail:
+    return err;
+}
+
+/*
+ * \brief  Check whether the encoder instances of a segment encoder are interchangeable.
+ *
+ * Pending reinitializations are applied first. All instances must have the same user parameters, and the
+ * access units of the transport format must be self-delimiting to be concatenated, i.e. ADTS or LOAS with
+ * one sub frame per transport frame.
+ *
+ * \param hSegments             A valid segment encoder handle.
+ *
+ * \return - AACENC_OK, the encoder instances can encode the segments of one stream.
+ *         - AACENC_INVALID_CONFIG, AACENC_INIT_ERROR, on failure.
+ */
+static AACENC_ERROR aacEncSegmentsCheck(
+        const HANDLE_AACENC_SEGMENTS  hSegments
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENCODER hRef = hSegments->hEncoder[0];
+    UINT n;
+
+    for (n=0; n<hSegments->nEncoders; n++) {
+        HANDLE_AACENCODER hEnc = hSegments->hEncoder[n];
+
+        /* apply pending reinitialization */
+        if ( (err = aacEncEncode(hEnc, NULL, NULL, NULL, NULL)) != AACENC_OK ) {
+            goto bail;
+        }
+
+        if ( (FDKmemcmp(&hEnc->extParam, &hRef->extParam, sizeof(USER_PARAM)) != 0)
+          || ( (hEnc->extParam.userTpType != TT_MP4_ADTS) && (hEnc->extParam.userTpType != TT_MP4_LOAS) )
+          || (hEnc->coderConfig.nSubFrames != 1)
+          || (hEnc->hAacEnc->psyFrontEndMode != PSY_FRONTEND_OWN) )
+        {
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
+    }
+
+bail:
+    return err;
+}
+
+/*
+ * \brief  Encode one frame of a segment into the next access unit.
+ */
+static AACENC_ERROR aacEncSegmentEncodeFrame(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const INT_PCM            *pSamples,
+        const INT                 numSamples,
+        UCHAR                    *pOutput,
+        const INT                 outputSize,
+        INT                      *pNumInSamples,
+        INT                      *pNumOutBytes
+        )
+{
+    AACENC_BufDesc inBufDesc, outBufDesc;
+    AACENC_InArgs  inargs;
+    AACENC_OutArgs outargs;
+    INT inIdentifier = IN_AUDIO_DATA, inSize = numSamples*sizeof(INT_PCM), inElSize = sizeof(INT_PCM);
+    INT outIdentifier = OUT_BITSTREAM_DATA, outSize = outputSize, outElSize = sizeof(UCHAR);
+    void *pIn = (void*)pSamples, *pOut = (void*)pOutput;
+    AACENC_ERROR err;
+
+    FDKmemclear(&outargs, sizeof(AACENC_OutArgs));
+
+    inBufDesc.numBufs           = 1;
+    inBufDesc.bufs              = &pIn;
+    inBufDesc.bufferIdentifiers = &inIdentifier;
+    inBufDesc.bufSizes          = &inSize;
+    inBufDesc.bufElSizes        = &inElSize;
+
+    outBufDesc.numBufs           = 1;
+    outBufDesc.bufs              = &pOut;
+    outBufDesc.bufferIdentifiers = &outIdentifier;
+    outBufDesc.bufSizes          = &outSize;
+    outBufDesc.bufElSizes        = &outElSize;
+
+    inargs.numInSamples = numSamples;
+    inargs.numAncBytes  = 0;
+
+    err = aacEncEncode(hAacEncoder, &inBufDesc, &outBufDesc, &inargs, &outargs);
+
+    *pNumInSamples = outargs.numInSamples;
+    *pNumOutBytes  = outargs.numOutBytes;
+
+    return err;
+}
+
+static void aacEncSegmentJob(void *pJobData, INT jobIndex, INT workerIndex)
+{
+    AACENC_SEGMENT_JOB *job      = &((AACENC_SEGMENT_JOB*)pJobData)[jobIndex];
+    HANDLE_AACENCODER   hEnc     = job->hEncoder;
+    const INT           frameLen = hEnc->nSamplesToRead;  /* samples of all channels */
+    const INT_PCM      *pIn      = job->pSamples - job->nPreRollFrames*frameLen;
+    INT                 remaining = job->numSamples;
+    INT                 n, numIn, nBytes;
+    AACENC_ERROR        err = AACENC_OK;
+
+    job->outputBytes = 0;
+
+    if (job->reset) {
+        hEnc->nSamplesRead = 0;
+        hEnc->InitFlags = AACENC_INIT_ALL;
+    }
+
+    /* The pre-roll converges filterbank, block switching and bit reservoir, its access units are dropped. */
+    for (n=0; (n<job->nPreRollFrames) && (err==AACENC_OK); n++) {
+        err = aacEncSegmentEncodeFrame(hEnc, pIn, frameLen, job->pOutput, fixMin(job->outputSize, hEnc->outBufferInBytes), &numIn, &nBytes);
+        pIn += numIn;
+    }
+
+    while ( (err == AACENC_OK) && ((remaining > 0) || job->flush) ) {
+        UCHAR *pOut = job->pOutput + job->outputBytes;
+
+        err = aacEncSegmentEncodeFrame(hEnc,
+                                       pIn,
+                                       (remaining > 0) ? fixMin(remaining, frameLen) : -1,
+                                       pOut,
+                                       fixMin(job->outputSize - job->outputBytes, hEnc->outBufferInBytes),
+                                      &numIn,
+                                      &nBytes);
+        if (err == AACENC_ENCODE_EOF) {
+            err = AACENC_OK;
+            break;
+        }
+        pIn += numIn;
+        remaining -= numIn;
+        job->outputBytes += nBytes;
+    }
+
+    job->err = err;
+}
+
+AACENC_ERROR aacEncSegmentsOpen(
+        HANDLE_AACENC_SEGMENTS   *phSegments,
+        const HANDLE_AACENCODER  *phEncoders,
+        const UINT                nEncoders,
+        const UINT                preRollFrames
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENC_SEGMENTS hSegments = NULL;
+    UINT n;
+
+    if ( (phSegments == NULL) || (phEncoders == NULL) ) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    *phSegments = NULL;
+
+    if ( (nEncoders < 1) || (nEncoders > AACENC_SEGMENTS_MAX_ENCODERS) ) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+
+    for (n=0; n<nEncoders; n++) {
+        if ( (phEncoders[n] == NULL) || (phEncoders[n]->hAacEnc == NULL) ) {
+            err = AACENC_INVALID_HANDLE;
+            goto bail;
+        }
+    }
+
+    /* allocate memory */
+    hSegments = Get_AacEncSegments();
+
+    if (hSegments == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    FDKmemclear(hSegments, sizeof(AACENC_SEGMENTS));
+
+    for (n=0; n<nEncoders; n++) {
+        hSegments->hEncoder[n] = phEncoders[n];
+    }
+    hSegments->nEncoders = nEncoders;
+
+    if ( (err = aacEncSegmentsCheck(hSegments)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    /* The pre-roll has to cover at least the encoder delay and the overlap of the transform. */
+    hSegments->nPreRollFrames = fixMax((INT)preRollFrames,
+                                       (phEncoders[0]->nDelay + phEncoders[0]->nSamplesToRead - 1)/phEncoders[0]->nSamplesToRead + 1);
+    hSegments->restart = 1;
+
+    if (nEncoders > 1) {
+        if (FDKworkerPoolOpen(&hSegments->hPool, (INT)nEncoders) != 0) {
+            err = AACENC_MEMORY_ERROR;
+            goto bail;
+        }
+    }
+
+    *phSegments = hSegments;
+
+    return err;
+
+bail:
+    aacEncSegmentsClose(&hSegments);
+    return err;
+}
+
+UINT aacEncSegmentsGetOutBufferSize(
+        const HANDLE_AACENC_SEGMENTS  hSegments,
+        const UINT                    numSamples,
+        const INT                     flush
+        )
+{
+    HANDLE_AACENCODER hEnc;
+    UINT nFrames;
+
+    if (hSegments == NULL) {
+        return 0;
+    }
+    hEnc = hSegments->hEncoder[0];
+
+    /* one access unit per frame, flushing adds the frames of the encoder delay */
+    nFrames = (numSamples + hEnc->nSamplesToRead - 1)/hEnc->nSamplesToRead;
+    if (flush) {
+        nFrames += hEnc->nDelay/hEnc->nSamplesToRead + 2;
+    }
+
+    return nFrames * hEnc->outBufferInBytes;
+}
+
+AACENC_ERROR aacEncSegmentsEncode(
+        const HANDLE_AACENC_SEGMENTS  hSegments,
+        const INT_PCM                *pSamples,
+        const UINT                    numSamples,
+        const INT                     flush,
+        UCHAR                        *pOutput,
+        const UINT                    outputSize,
+        UINT                         *pOutputBytes
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    INT frameLen, nFrames, nSegments, segFrames, offset, k;
+
+    if ( (hSegments == NULL) || ((pSamples == NULL) && (numSamples > 0)) || (pOutput == NULL) || (pOutputBytes == NULL) ) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    *pOutputBytes = 0;
+
+    if ( (err = aacEncSegmentsCheck(hSegments)) != AACENC_OK ) {
+        goto bail;
+    }
+
+    frameLen = hSegments->hEncoder[0]->nSamplesToRead;
+    nFrames  = (INT)numSamples / frameLen;
+
+    /* Only the end of the stream may hold an incomplete frame. */
+    if ( !flush && ((INT)numSamples != nFrames*frameLen) ) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+    if (outputSize < aacEncSegmentsGetOutBufferSize(hSegments, numSamples, flush)) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    /* Each segment but the first takes its pre-roll from the preceding segment. */
+    nSegments = fixMax(1, fixMin((INT)hSegments->nEncoders, nFrames/hSegments->nPreRollFrames));
+    segFrames = (nFrames + nSegments - 1)/nSegments;
+    if (segFrames > 0) {
+        nSegments = (nFrames + segFrames - 1)/segFrames;
+    }
+
+    for (k=0, offset=0; k<nSegments; k++) {
+        AACENC_SEGMENT_JOB *job = &hSegments->job[k];
+        INT first = k*segFrames;
+        INT last  = (k == nSegments-1) ? nFrames : fixMin(nFrames, first+segFrames);
+        INT numSegSamples = (k == nSegments-1) ? ((INT)numSamples - first*frameLen) : ((last-first)*frameLen);
+
+        job->hEncoder       = hSegments->hEncoder[(hSegments->current + k) % hSegments->nEncoders];
+        /* The first segment continues the stream of the previous call. */
+        job->reset          = (k > 0) || hSegments->restart;
+        job->nPreRollFrames = (k > 0) ? hSegments->nPreRollFrames : 0;
+        job->pSamples       = pSamples + first*frameLen;
+        job->numSamples     = numSegSamples;
+        job->flush          = flush && (k == nSegments-1);
+        job->pOutput        = pOutput + offset;
+        job->outputSize     = (INT)aacEncSegmentsGetOutBufferSize(hSegments, numSegSamples, job->flush);
+        job->outputBytes    = 0;
+        job->err            = AACENC_OK;
+
+        offset += job->outputSize;
+    }
+
+    FDKworkerPoolRun(hSegments->hPool, aacEncSegmentJob, (void*)hSegments->job, nSegments);
+
+    /* Concatenate the access units of all segments. */
+    for (k=0, offset=0; k<nSegments; k++) {
+        AACENC_SEGMENT_JOB *job = &hSegments->job[k];
+
+        if ( (job->err != AACENC_OK) && (err == AACENC_OK) ) {
+            err = job->err;
+        }
+        if (pOutput+offset != job->pOutput) {
+            FDKmemmove(pOutput+offset, job->pOutput, job->outputBytes);
+        }
+        offset += job->outputBytes;
+    }
+
+    if (err != AACENC_OK) {
+        goto bail;
+    }
+
+    *pOutputBytes = (UINT)offset;
+
+    hSegments->current = (hSegments->current + nSegments - 1) % hSegments->nEncoders;
+    hSegments->restart = flush;
+
+    return err;
+
+bail:
+    /* The encoder states do not continue the stream any more. */
+    hSegments->restart = 1;
+    return err;
+}
+
+AACENC_ERROR aacEncSegmentsClose(
+        HANDLE_AACENC_SEGMENTS   *phSegments
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+
+    if (phSegments == NULL) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    if (*phSegments != NULL) {
+        FDKworkerPoolClose(&(*phSegments)->hPool);
+        Free_AacEncSegments(phSegments);
+    }
+
+bail:
+    return err;
+}
+
+static
+AAC_ENCODER_ERROR aacEncGetConf(HANDLE_AACENCODER  hAacEncoder,
+                                UINT              *size,
+                                UCHAR             *confBuffer)
+{
+    FDK_BITSTREAM tmpConf;
+    UINT confType;
+    UCHAR buf[64];
+    int err;
+
+    /* Init bit buffer */
+    FDKinitBitStream(&tmpConf, buf, 64, 0, BS_WRITER);
+
+    /* write conf in tmp buffer */
+    err = transportEnc_GetConf(hAacEncoder->hTpEnc, &hAacEncoder->coderConfig, &tmpConf, &confType);
+
+    /* copy data to outbuffer: length in bytes */
+    FDKbyteAlign(&tmpConf, 0);
+
+    /* Check buffer size */
+    if (FDKgetValidBits(&tmpConf) > ((*size)<<3))
+      return AAC_ENC_UNKNOWN;
+
+    FDKfetchBuffer(&tmpConf, confBuffer, size);
+
+    if (err != 0)
+      return AAC_ENC_UNKNOWN;
+    else
+      return AAC_ENC_OK;
+}
+
+
+AACENC_ERROR aacEncGetLibInfo(LIB_INFO *info)
+{
+  int i = 0;
+
+  if (info == NULL) {
+    return AACENC_INVALID_HANDLE;
+  }
+
+  FDK_toolsGetLibInfo( info );
+  transportEnc_GetLibInfo( info );
+
+  sbrEncoder_GetLibInfo( info );
+
+  /* search for next free tab */
+  for (i = 0; i < FDK_MODULE_LAST; i++) {
+    if (info[i].module_id == FDK_NONE) break;
+  }
+  if (i == FDK_MODULE_LAST) {
+    return AACENC_INIT_ERROR;
+  }
+
+  info[i].module_id = FDK_AACENC;
+  info[i].build_date = (char*)AACENCODER_LIB_BUILD_DATE;
+  info[i].build_time = (char*)AACENCODER_LIB_BUILD_TIME;
+  info[i].title = (char*)AACENCODER_LIB_TITLE;
+  info[i].version = LIB_VERSION(AACENCODER_LIB_VL0, AACENCODER_LIB_VL1, AACENCODER_LIB_VL2);;
+  LIB_VERSION_STRING(&info[i]);
+
+  /* Capability flags */
+  info[i].flags = 0
+    | CAPF_AAC_1024 | CAPF_AAC_LC
+    | CAPF_AAC_512
+    | CAPF_AAC_480
+    | CAPF_AAC_DRC
+      ;
+  /* End of flags */
+
+  return AACENC_OK;
+}
+
+AACENC_ERROR aacEncoder_SetParam(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const AACENC_PARAM        param,
+        const UINT                value
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    USER_PARAM *settings = &hAacEncoder->extParam;
+
+    /* check encoder handle */
+    if (hAacEncoder == NULL) {
         err = AACENC_INVALID_HANDLE;
         goto bail;
     }
@@ -2006,6 +3224,16 @@ AACENC_ERROR aacEncoder_SetParam(
             hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
         }
         break;
+    case AACENC_NUM_THREADS:
+        if (settings->userNumThreads != value) {
+            if (value > (8)) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userNumThreads = value;
+            hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
+        }
+        break;
     default:
       err = AACENC_UNSUPPORTED_PARAMETER;
       break;
@@ -2088,6 +3316,9 @@ UINT aacEncoder_GetParam(
     case AACENC_METADATA_MODE:
         value = (hAacEncoder->metaDataAllowed==0) ? 0 : (UINT)settings->userMetaDataMode;
         break;
+    case AACENC_NUM_THREADS:
+        value = (UINT)settings->userNumThreads;
+        break;
     default:
       //err = MPS_INVALID_PARAMETER;
       break;
@@ -2123,3 +3354,36 @@ bail:
     return err;
 }
 
+AACENC_ERROR aacEncGetProfile(
+        const HANDLE_AACENCODER   hAacEncoder,
+        AACENC_PROFILE           *pProfile,
+        const INT                 reset
+        )
+{
+#ifdef FDK_PROFILE
+    FDK_PROFILE_COUNTER sbrProfile[SBRENC_PROFILE_STAGES];
+
+    if ( (hAacEncoder==NULL) || (pProfile==NULL) ) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    FDKmemcpy(pProfile->stage, hAacEncoder->profile, sizeof(hAacEncoder->profile));
+    if (reset) {
+        FDKmemclear(hAacEncoder->profile, sizeof(hAacEncoder->profile));
+    }
+
+    /* The SBR sub stages are counted by the SBR encoder. */
+    if ( (hAacEncoder->hEnvEnc!=NULL) && (sbrEncoder_GetProfile(hAacEncoder->hEnvEnc, sbrProfile, reset)==0) ) {
+        pProfile->stage[AACENC_PROF_SBR_QMF] = sbrProfile[SBRENC_PROF_QMF];
+        pProfile->stage[AACENC_PROF_SBR_PS]  = sbrProfile[SBRENC_PROF_PS];
+    }
+
+    return AACENC_OK;
+#else
+    if ( (hAacEncoder==NULL) || (pProfile==NULL) ) {
+        return AACENC_INVALID_HANDLE;
+    }
+    return AACENC_UNSUPPORTED_PARAMETER;
+#endif
+}
+
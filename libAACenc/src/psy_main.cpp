@@ -429,62 +429,36 @@ void FDKaacEnc_deinterleaveInputBuffer(INT_PCM *pOutputSamples,
 
 /*****************************************************************************
 
-    functionname: FDKaacEnc_psyMain
-    description:  psychoacoustic
+    functionname: FDKaacEnc_psyMainTransform
+    description:  block switching and MDCT of one channel element
     returns:      an error code
 
         This function assumes that enough input data is in the modulo buffer.
+        The spectrum and its exponent are returned in psyOutElement, the
+        window sequence in the block switching control of psyElement.
 
 *****************************************************************************/
 
-AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
-                                    PSY_ELEMENT        *psyElement,
-                                    PSY_DYNAMIC        *psyDynamic,
-                                    PSY_CONFIGURATION  *psyConf,
-                                    PSY_OUT_ELEMENT    *RESTRICT psyOutElement,
-                                    INT_PCM             *pInput,
-                                    INT                 *chIdx,
-                                    INT                  totalChannels
-                                   )
+AAC_ENCODER_ERROR FDKaacEnc_psyMainTransform(INT                 channels,
+                                             PSY_ELEMENT        *psyElement,
+                                             PSY_CONFIGURATION  *psyConf,
+                                             PSY_OUT_ELEMENT    *RESTRICT psyOutElement,
+                                             INT_PCM            *pInput,
+                                             INT                *chIdx,
+                                             INT                 totalChannels
+                                            )
 {
     INT commonWindow = 1;
-    INT maxSfbPerGroup[(2)];
     INT mdctSpectrum_e;
     INT ch;   /* counts through channels          */
     INT w;    /* counts through windows           */
-    INT sfb;  /* counts through scalefactor bands */
-    INT line; /* counts through lines             */
 
     PSY_CONFIGURATION *RESTRICT hPsyConfLong  = &psyConf[0];
-    PSY_CONFIGURATION *RESTRICT hPsyConfShort = &psyConf[1];
     PSY_OUT_CHANNEL  **RESTRICT psyOutChannel = psyOutElement->psyOutChannel;
-    FIXP_SGL sfbTonality[(2)][MAX_SFB_LONG];
-
-    PSY_STATIC        **RESTRICT psyStatic = psyElement->psyStatic;
-
-    PSY_DATA           *RESTRICT psyData[(2)];
-    TNS_DATA           *RESTRICT tnsData[(2)];
-    PNS_DATA           *RESTRICT pnsData[(2)];
-
-    INT zeroSpec = TRUE; /* means all spectral lines are zero */
+    PSY_STATIC       **RESTRICT psyStatic     = psyElement->psyStatic;
 
     INT blockSwitchingOffset;
 
-    PSY_CONFIGURATION *RESTRICT hThisPsyConf[(2)];
-    INT windowLength[(2)];
-    INT nWindows[(2)];
-    INT wOffset;
-
-    INT       maxSfb[(2)];
-    INT      *pSfbMaxScaleSpec[(2)];
-    FIXP_DBL *pSfbEnergy[(2)];
-    FIXP_DBL *pSfbSpreadEnergy[(2)];
-    FIXP_DBL *pSfbEnergyLdData[(2)];
-    FIXP_DBL *pSfbEnergyMS[(2)];
-    FIXP_DBL *pSfbThreshold[(2)];
-
-    INT isShortWindow[(2)];
-
 
     if (hPsyConfLong->filterbank == FB_LC) {
       blockSwitchingOffset = psyConf->granuleLength + (9*psyConf->granuleLength/(2*TRANS_FAC));
@@ -492,15 +466,6 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
       blockSwitchingOffset = psyConf->granuleLength;
     }
 
-    for(ch = 0; ch < channels; ch++)
-    {
-        psyData[ch] = &psyDynamic->psyData[ch];
-        tnsData[ch] = &psyDynamic->tnsData[ch];
-        pnsData[ch] = &psyDynamic->pnsData[ch];
-
-        psyData[ch]->mdctSpectrum = psyOutChannel[ch]->mdctSpectrum;
-    }
-
     /* block switching */
     if (hPsyConfLong->filterbank != FB_ELD)
     {
@@ -554,6 +519,170 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
       }
     }
 
+    /* Transform and get mdctScaling for all channels and windows. */
+    for(ch = 0; ch < channels; ch++)
+    {
+        INT isShortWindow = (psyStatic[ch]->blockSwitchingControl.lastWindowSequence == SHORT_WINDOW);
+        INT windowLength  = (isShortWindow) ? psyConf->granuleLength/TRANS_FAC : psyConf->granuleLength;
+        INT nWindows      = (isShortWindow) ? TRANS_FAC : 1;
+
+        for(w = 0; w < nWindows; w++) {
+          FDKaacEnc_Transform_Real( psyStatic[ch]->psyInputBuffer + w*windowLength,
+                                    psyOutChannel[ch]->mdctSpectrum + w*windowLength,
+                                    psyStatic[ch]->blockSwitchingControl.lastWindowSequence,
+                                    psyStatic[ch]->blockSwitchingControl.windowShape,
+                                   &psyStatic[ch]->blockSwitchingControl.lastWindowShape,
+                                    psyConf->granuleLength,
+                                   &mdctSpectrum_e,
+                                    psyConf[isShortWindow].filterbank
+                                   ,psyStatic[ch]->overlapAddBuffer
+                                   );
+        }
+
+        psyOutChannel[ch]->mdctScale = mdctSpectrum_e;
+
+        /* rotate internal time samples */
+        FDKmemmove(psyStatic[ch]->psyInputBuffer,
+                   psyStatic[ch]->psyInputBuffer+psyConf->granuleLength,
+                   psyConf->granuleLength*sizeof(INT_PCM));
+
+
+        /* ... and get remaining samples from input buffer */
+        FDKaacEnc_deinterleaveInputBuffer( psyStatic[ch]->psyInputBuffer+psyConf->granuleLength,
+                                          &pInput[ (2*psyConf->granuleLength-blockSwitchingOffset)*totalChannels + chIdx[ch] ],
+                                           blockSwitchingOffset-psyConf->granuleLength,
+                                           totalChannels);
+
+    } /* ch */
+
+    return AAC_ENC_OK;
+}
+
+
+/*****************************************************************************
+
+    functionname: FDKaacEnc_psyExportTransform
+    description:  save the result of FDKaacEnc_psyMainTransform() of one
+                  channel element for other encoder instances
+
+*****************************************************************************/
+
+void FDKaacEnc_psyExportTransform(INT                   channels,
+                                  PSY_ELEMENT          *psyElement,
+                                  PSY_OUT_ELEMENT      *psyOutElement,
+                                  INT                  *chIdx,
+                                  PSY_FRONTEND_CHANNEL *psyFrontEnd
+                                 )
+{
+    INT ch;
+
+    for(ch = 0; ch < channels; ch++) {
+        PSY_FRONTEND_CHANNEL *pFrontEnd = &psyFrontEnd[chIdx[ch]];
+
+        pFrontEnd->blockSwitchingControl = psyElement->psyStatic[ch]->blockSwitchingControl;
+        pFrontEnd->mdctScale             = psyOutElement->psyOutChannel[ch]->mdctScale;
+        FDKmemcpy(pFrontEnd->mdctSpectrum, psyOutElement->psyOutChannel[ch]->mdctSpectrum, (1024)*sizeof(FIXP_DBL));
+    }
+}
+
+
+/*****************************************************************************
+
+    functionname: FDKaacEnc_psyImportTransform
+    description:  take over the result of FDKaacEnc_psyMainTransform() of one
+                  channel element from another encoder instance, or the
+                  TNS residual and filters of a transcoder if importTns is set
+
+*****************************************************************************/
+
+void FDKaacEnc_psyImportTransform(INT                   channels,
+                                  PSY_ELEMENT          *psyElement,
+                                  PSY_OUT_ELEMENT      *psyOutElement,
+                                  INT                  *chIdx,
+                                  PSY_FRONTEND_CHANNEL *psyFrontEnd,
+                                  INT                   importTns
+                                 )
+{
+    INT ch;
+
+    for(ch = 0; ch < channels; ch++) {
+        PSY_FRONTEND_CHANNEL *pFrontEnd = &psyFrontEnd[chIdx[ch]];
+
+        psyElement->psyStatic[ch]->blockSwitchingControl = pFrontEnd->blockSwitchingControl;
+        psyOutElement->psyOutChannel[ch]->mdctScale      = pFrontEnd->mdctScale;
+        FDKmemcpy(psyOutElement->psyOutChannel[ch]->mdctSpectrum, pFrontEnd->mdctSpectrum, (1024)*sizeof(FIXP_DBL));
+        if (importTns) {
+            psyOutElement->psyOutChannel[ch]->tnsInfo = pFrontEnd->tnsInfo;
+        }
+    }
+}
+
+
+/*****************************************************************************
+
+    functionname: FDKaacEnc_psyMain
+    description:  psychoacoustic
+    returns:      an error code
+
+        This function assumes that the spectrum has been computed by
+        FDKaacEnc_psyMainTransform(). If tnsImported is set, the spectrum
+        is a TNS residual and psyOutChannel->tnsInfo holds its filters.
+
+*****************************************************************************/
+
+AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
+                                    PSY_ELEMENT        *psyElement,
+                                    PSY_DYNAMIC        *psyDynamic,
+                                    PSY_CONFIGURATION  *psyConf,
+                                    PSY_OUT_ELEMENT    *RESTRICT psyOutElement,
+                                    INT                 tnsImported
+                                   )
+{
+    INT commonWindow = 1;
+    INT maxSfbPerGroup[(2)];
+    INT ch;   /* counts through channels          */
+    INT w;    /* counts through windows           */
+    INT sfb;  /* counts through scalefactor bands */
+    INT line; /* counts through lines             */
+
+    PSY_CONFIGURATION *RESTRICT hPsyConfLong  = &psyConf[0];
+    PSY_CONFIGURATION *RESTRICT hPsyConfShort = &psyConf[1];
+    PSY_OUT_CHANNEL  **RESTRICT psyOutChannel = psyOutElement->psyOutChannel;
+    FIXP_SGL sfbTonality[(2)][MAX_SFB_LONG];
+
+    PSY_STATIC        **RESTRICT psyStatic = psyElement->psyStatic;
+
+    PSY_DATA           *RESTRICT psyData[(2)];
+    TNS_DATA           *RESTRICT tnsData[(2)];
+    PNS_DATA           *RESTRICT pnsData[(2)];
+
+    INT zeroSpec = TRUE; /* means all spectral lines are zero */
+
+    PSY_CONFIGURATION *RESTRICT hThisPsyConf[(2)];
+    INT windowLength[(2)];
+    INT nWindows[(2)];
+    INT wOffset;
+
+    INT       maxSfb[(2)];
+    INT      *pSfbMaxScaleSpec[(2)];
+    FIXP_DBL *pSfbEnergy[(2)];
+    FIXP_DBL *pSfbSpreadEnergy[(2)];
+    FIXP_DBL *pSfbEnergyLdData[(2)];
+    FIXP_DBL *pSfbEnergyMS[(2)];
+    FIXP_DBL *pSfbThreshold[(2)];
+
+    INT isShortWindow[(2)];
+
+
+    for(ch = 0; ch < channels; ch++)
+    {
+        psyData[ch] = &psyDynamic->psyData[ch];
+        tnsData[ch] = &psyDynamic->tnsData[ch];
+        pnsData[ch] = &psyDynamic->pnsData[ch];
+
+        psyData[ch]->mdctSpectrum = psyOutChannel[ch]->mdctSpectrum;
+    }
+
     for(ch = 0; ch < channels; ch++)
       isShortWindow[ch]=(psyStatic[ch]->blockSwitchingControl.lastWindowSequence == SHORT_WINDOW);
 
@@ -589,7 +718,7 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
         }
     }
 
-    /* Transform and get mdctScaling for all channels and windows. */
+    /* Low pass and check for zero spectrum for all channels and windows. */
     for(ch = 0; ch < channels; ch++)
     {
         /* update number of active bands */
@@ -606,17 +735,6 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
 
           wOffset = w*windowLength[ch];
 
-          FDKaacEnc_Transform_Real( psyStatic[ch]->psyInputBuffer + wOffset,
-                                    psyData[ch]->mdctSpectrum+wOffset,
-                                    psyStatic[ch]->blockSwitchingControl.lastWindowSequence,
-                                    psyStatic[ch]->blockSwitchingControl.windowShape,
-                                   &psyStatic[ch]->blockSwitchingControl.lastWindowShape,
-                                    psyConf->granuleLength,
-                                   &mdctSpectrum_e,
-                                    hThisPsyConf[ch]->filterbank
-                                   ,psyStatic[ch]->overlapAddBuffer
-                                   );
-
           /* Low pass / highest sfb */
           FDKmemclear(&psyData[ch]->mdctSpectrum[psyData[ch]->lowpassLine+wOffset],
                       (windowLength[ch]-psyData[ch]->lowpassLine)*sizeof(FIXP_DBL));
@@ -639,19 +757,7 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
 
         } /* w loop */
 
-        psyData[ch]->mdctScale = mdctSpectrum_e;
-
-        /* rotate internal time samples */
-        FDKmemmove(psyStatic[ch]->psyInputBuffer,
-                   psyStatic[ch]->psyInputBuffer+psyConf->granuleLength,
-                   psyConf->granuleLength*sizeof(INT_PCM));
-
-
-        /* ... and get remaining samples from input buffer */
-        FDKaacEnc_deinterleaveInputBuffer( psyStatic[ch]->psyInputBuffer+psyConf->granuleLength,
-                                          &pInput[ (2*psyConf->granuleLength-blockSwitchingOffset)*totalChannels + chIdx[ch] ],
-                                           blockSwitchingOffset-psyConf->granuleLength,
-                                           totalChannels);
+        psyData[ch]->mdctScale = psyOutChannel[ch]->mdctScale;
 
     } /* ch */
 
@@ -781,7 +887,22 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
             }
         }
 
-        if (hPsyConfLong->tnsConf.tnsActive || hPsyConfShort->tnsConf.tnsActive) {
+        if (tnsImported) {
+            /* TNS filters are given, the spectrum is already filtered. */
+            for(ch = 0; ch < channels; ch++) {
+                if (isShortWindow[ch]) {
+                    for(w = 0; w < nWindows[ch]; w++) {
+                        tnsData[ch]->dataRaw.Short.subBlockInfo[w].tnsActive = (psyOutChannel[ch]->tnsInfo.numOfFilters[w] > 0);
+                        tnsData[ch]->dataRaw.Short.subBlockInfo[w].predictionGain = 0;
+                    }
+                }
+                else {
+                    tnsData[ch]->dataRaw.Long.subBlockInfo.tnsActive = (psyOutChannel[ch]->tnsInfo.numOfFilters[0] > 0);
+                    tnsData[ch]->dataRaw.Long.subBlockInfo.predictionGain = 0;
+                }
+            }
+        }
+        else if (hPsyConfLong->tnsConf.tnsActive || hPsyConfShort->tnsConf.tnsActive) {
             INT tnsActive[TRANS_FAC];
             INT nrgScaling[2] = {0,0};
             INT tnsSpecShift = 0;
@@ -124,6 +124,19 @@ typedef struct  {
 
 }PSY_INTERNAL;
 
+/*
+  result of block switching and transform of one channel, shared among
+  encoder instances which encode the same input signal
+*/
+typedef struct PSY_FRONTEND_CHANNEL {
+
+  BLOCK_SWITCHING_CONTROL  blockSwitchingControl;
+  INT                      mdctScale;
+  FIXP_DBL                 mdctSpectrum[(1024)];
+  TNS_INFO                 tnsInfo;     /* TNS filters of the residual in mdctSpectrum, PSY_FRONTEND_SPECTRUM only */
+
+}PSY_FRONTEND_CHANNEL;
+
 
 AAC_ENCODER_ERROR FDKaacEnc_PsyNew(PSY_INTERNAL  **phpsy,
                                    const INT       nElements,
@@ -158,14 +171,36 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMainInit(PSY_INTERNAL *hPsy,
                                         UINT syntaxFlags,
                                         ULONG initFlags);
 
+AAC_ENCODER_ERROR FDKaacEnc_psyMainTransform(INT                 channels,
+                                             PSY_ELEMENT        *psyElement,
+                                             PSY_CONFIGURATION  *psyConf,
+                                             PSY_OUT_ELEMENT    *psyOutElement,
+                                             INT_PCM            *pInput,
+                                             INT                *chIdx,
+                                             INT                 totalChannels
+                                            );
+
+void FDKaacEnc_psyExportTransform(INT                   channels,
+                                  PSY_ELEMENT          *psyElement,
+                                  PSY_OUT_ELEMENT      *psyOutElement,
+                                  INT                  *chIdx,
+                                  PSY_FRONTEND_CHANNEL *psyFrontEnd
+                                 );
+
+void FDKaacEnc_psyImportTransform(INT                   channels,
+                                  PSY_ELEMENT          *psyElement,
+                                  PSY_OUT_ELEMENT      *psyOutElement,
+                                  INT                  *chIdx,
+                                  PSY_FRONTEND_CHANNEL *psyFrontEnd,
+                                  INT                   importTns
+                                 );
+
 AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
                                     PSY_ELEMENT         *psyElement,
                                     PSY_DYNAMIC         *psyDynamic,
                                     PSY_CONFIGURATION   *psyConf,
                                     PSY_OUT_ELEMENT     *psyOutElement,
-                                    INT_PCM             *pInput,
-                                    INT                 *chIdx,
-                                    INT                  totalChannels
+                                    INT                  tnsImported
                                    );
 
 void FDKaacEnc_PsyClose(PSY_INTERNAL   **phPsyInternal,
@@ -791,7 +791,30 @@ static AAC_ENCODER_ERROR FDKaacEnc_BitResRedistribution(
 }
 
 
+/* Scalefactor estimation of the channel elements, executed by the workers of the pool */
+typedef struct {
+  PSY_OUT_ELEMENT**  psyOutElement;
+  QC_OUT_ELEMENT**   qcElement;
+  CHANNEL_MAPPING*   cm;
+  INT                invQuant;
+  INT                nJobs;
+  INT                element[(8)];   /* channel element index of each job */
+} QC_SCF_JOBS;
+
+static void FDKaacEnc_estimateScaleFactorsJob(void *pJobData, INT jobIndex, INT workerIndex)
+{
+  QC_SCF_JOBS *jobs = (QC_SCF_JOBS*)pJobData;
+  INT i = jobs->element[jobIndex];
+
+  /* Turn thresholds into scalefactors, optimize bit consumption and verify conformance */
+  FDKaacEnc_EstimateScaleFactors(jobs->psyOutElement[i]->psyOutChannel,
+                                 jobs->qcElement[i]->qcOutChannel,
+                                 jobs->invQuant,
+                                 jobs->cm->elInfo[i].nChannelsInEl);
+}
+
 AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
+                                   HANDLE_FDK_WORKER_POOL     hWorkerPool,
                                    PSY_OUT**                  psyOut,
                                    QC_OUT**                   qcOut,
                                    INT                        avgTotalBits,
@@ -907,6 +930,26 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
       /* for ( all sub frames ) ... */
       for (c = 0 ; c < nSubFrames ; c++ )
       {
+          /* the scalefactors of the channel elements are estimated independently of each other */
+          QC_SCF_JOBS scfJobs;
+
+          scfJobs.psyOutElement = psyOut[c]->psyOutElement;
+          scfJobs.qcElement     = qcElement[c];
+          scfJobs.cm            = cm;
+          scfJobs.invQuant      = hQC->invQuant;
+          scfJobs.nJobs         = 0;
+
+          for (i=0; i<cm->nElements; i++)
+          {
+              if ((cm->elInfo[i].elType == ID_SCE) || (cm->elInfo[i].elType == ID_CPE) ||
+                  (cm->elInfo[i].elType == ID_LFE))
+              {
+                  scfJobs.element[scfJobs.nJobs++] = i;
+              }
+          }
+
+          FDKworkerPoolRun(hWorkerPool, FDKaacEnc_estimateScaleFactorsJob, &scfJobs, scfJobs.nJobs);
+
           for (i=0; i<cm->nElements; i++)
           {
               ELEMENT_INFO elInfo = cm->elInfo[i];
@@ -915,12 +958,6 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
               if ((elInfo.elType == ID_SCE) || (elInfo.elType == ID_CPE) ||
                   (elInfo.elType == ID_LFE))
               {
-                      /* Turn thresholds into scalefactors, optimize bit consumption and verify conformance */
-                      FDKaacEnc_EstimateScaleFactors(psyOut[c]->psyOutElement[i]->psyOutChannel,
-                                            qcElement[c][i]->qcOutChannel,
-                                            hQC->invQuant,
-                                            cm->elInfo[i].nChannelsInEl);
-
 
                       /*-------------------------------------------- */
                       constraintsFulfilled[c][i] = 1;
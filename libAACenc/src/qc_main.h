@@ -96,6 +96,7 @@ amm-info@iis.fraunhofer.de
 #include "interface.h"
 #include "psy_main.h"
 #include "tpenc_lib.h"
+#include "FDK_threads.h"
 
 /* Quantizing & coding stage */
 
@@ -129,6 +130,7 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMainPrepare(
 
 
 AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
+                                   HANDLE_FDK_WORKER_POOL     hWorkerPool,
                                    PSY_OUT**                  psyOut,
                                    QC_OUT**                   qcOut,
                                    INT                        avgTotalBits,
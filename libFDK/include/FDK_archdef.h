@@ -103,6 +103,11 @@ amm-info@iis.fraunhofer.de
 #define __x86__
 #endif
 
+/* Select SIMD kernels for x86 at runtime according to the host CPU features (see FDK_cpu.h). */
+#if defined(__x86__) && (defined(__GNUC__) || defined(_MSC_VER)) && !defined(FDK_DISABLE_X86_SIMD)
+#define FDK_X86_SIMD
+#endif
+
 #if (defined(_M_ARM) || defined(__CC_ARM)) && !defined(__arm__) || defined(__TI_TMS470_V5__) && !defined(__arm__)
 #define __arm__
 #endif
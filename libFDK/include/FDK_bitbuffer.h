@@ -134,6 +134,8 @@ INT  FDK_get             (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits)
 
 INT  FDK_get32           (HANDLE_FDK_BITBUF hBitBuffer) ;
 
+UINT64 FDK_get64         (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits) ;
+
 void FDK_put             (HANDLE_FDK_BITBUF hBitBuffer, UINT value, const UINT numberOfBits) ;
 
 INT  FDK_getBwd          (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits);
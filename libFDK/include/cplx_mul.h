@@ -99,6 +99,9 @@ amm-info@iis.fraunhofer.de
 #elif defined(__GNUC__) && defined(__mips__) && __mips_isa_rev < 6
 #include "mips/cplx_mul.h"
 
+#elif defined(__x86__)
+#include "x86/cplx_mul_x86.h"
+
 #endif /* #if defined all cores: bfin, arm, etc. */
 
 /* ############################################################################# */
@@ -263,6 +266,42 @@ inline void cplxMult( FIXP_DBL *c_Re,
 }
 #endif
 
+#if !defined(FUNCTION_cplxMultVec_32x16)
+#define FUNCTION_cplxMultVec_32x16
+/**
+ * \brief Elementwise complex multiplication c = a * b of len values.
+ *        c and a may point to the same buffers.
+ */
+inline void cplxMultVec( FIXP_DBL *c_Re,
+                         FIXP_DBL *c_Im,
+                         const FIXP_DBL *a_Re,
+                         const FIXP_DBL *a_Im,
+                         const FIXP_SGL *b_Re,
+                         const FIXP_SGL *b_Im,
+                         INT len )
+{
+  for (INT i = 0; i < len; i++) {
+    cplxMult(&c_Re[i], &c_Im[i], a_Re[i], a_Im[i], b_Re[i], b_Im[i]);
+  }
+}
+#endif
+
+#if !defined(FUNCTION_cplxMultVec_32x32)
+#define FUNCTION_cplxMultVec_32x32
+inline void cplxMultVec( FIXP_DBL *c_Re,
+                         FIXP_DBL *c_Im,
+                         const FIXP_DBL *a_Re,
+                         const FIXP_DBL *a_Im,
+                         const FIXP_DBL *b_Re,
+                         const FIXP_DBL *b_Im,
+                         INT len )
+{
+  for (INT i = 0; i < len; i++) {
+    cplxMult(&c_Re[i], &c_Im[i], a_Re[i], a_Im[i], b_Re[i], b_Im[i]);
+  }
+}
+#endif
+
 /* ############################################################################# */
 
 #endif /* __CPLX_Mult_H__ */
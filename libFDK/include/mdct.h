@@ -106,6 +106,8 @@ amm-info@iis.fraunhofer.de
 #define IMDCT_SCALE(x) (INT_PCM)SATURATE_RIGHT_SHIFT(x, MDCT_OUTPUT_SCALE, SAMPLE_BITS)
 #endif
 #define IMDCT_SCALE_DBL(x) (FIXP_DBL)(x)
+/* Scale to a 32 bit output sample of the same level as IMDCT_SCALE() */
+#define IMDCT_SCALE_32(x) (FIXP_DBL)SATURATE_LEFT_SHIFT(x, MDCT_OUT_HEADROOM, DFRACT_BITS)
 
 /**
  * \brief MDCT persistent data
@@ -239,5 +241,32 @@ INT  imdct_block(
         const INT fr,
         FIXP_DBL gain );
 
+/**
+ * \brief Advance the state of an inverse MDCT as imdct_block() would do without computing
+ *        any output. The content of the overlap buffer becomes invalid. Running imdct_block()
+ *        on the spectrum of the skipped block starting from the state ahead of it restores
+ *        the complete state.
+ *
+ * \param hMdct handle of an allocated MDCT handle.
+ * \param nSpec number of MDCT spectrums.
+ * \param noOutSamples desired number of output samples.
+ * \param tl transform length.
+ * \param wls pointer to the left side overlap window coefficients.
+ * \param fl left overlap window side length.
+ * \param wrs pointer to the right side overlap window coefficients of all individual IMDCTs.
+ * \param fr right overlap window side length of all individual IMDCTs.
+ * \return number of output samples imdct_block() would have returned.
+ */
+INT  imdct_skip_block(
+        H_MDCT hMdct,
+        const INT nSpec,
+        const INT noOutSamples,
+        const INT tl,
+        const FIXP_WTP *wls,
+        INT fl,
+        const FIXP_WTP *wrs,
+        const INT fr
+        );
+
 
 #endif /* __MDCT_H__ */
@@ -139,6 +139,16 @@ amm-info@iis.fraunhofer.de
 #define QMF_FLAG_MPSLDFB_OPTIMIZE_MODULATION  32
 /* Flag to indicate HE-AAC down-sampled SBR mode (decoder) -> adapt analysis post twiddling */
 #define QMF_FLAG_DOWNSAMPLED  64
+/* Analysis filter states hold the upper and the lower bits of a 32 bit time signal. This flag is set internally
+   by the FIXP_DBL variant of qmfAnalysisFiltering() and kept across a re-initialization with QMF_FLAG_KEEP_STATES. */
+#define QMF_FLAG_TIME_DBL    128
+
+/* Maximum number of slots processed in one pass by qmfAnalysisFilteringBlock() */
+#define QMF_ANA_BLOCK_SLOTS   8
+/* Maximum number of channels of an analysis filter bank */
+#define QMF_ANA_MAX_CHANNELS  64
+/* Maximum number of channels of a synthesis filter bank */
+#define QMF_SYN_MAX_CHANNELS  64
 
 
 typedef struct
@@ -154,7 +164,7 @@ struct QMF_FILTER_BANK
   const FIXP_PFT *p_filter;     /*!< Pointer to filter coefficients */
 
   void *FilterStates;           /*!< Pointer to buffer of filter states
-                                     FIXP_PCM in analyse and
+                                     FIXP_PCM in analyse (twice as many if QMF_FLAG_TIME_DBL) and
                                      FIXP_DBL in synthesis filter */
   int FilterSize;               /*!< Size of prototype filter. */
   const FIXP_QTW *t_cos;        /*!< Modulation tables. */
@@ -182,8 +192,18 @@ qmfAnalysisFiltering( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysi
                       FIXP_QMF **qmfImag,             /*!< Pointer to imag subband slots */
                       QMF_SCALE_FACTOR *scaleFactor,  /*!< Scale factors of QMF data     */
                       const INT_PCM *timeIn,          /*!< Time signal */
-                      const int  stride,              /*!< Stride factor of audio data   */
-                      FIXP_QMF  *pWorkBuffer          /*!< pointer to temporal working buffer */
+                      const int  stride               /*!< Stride factor of audio data   */
+                      );
+
+/* Variant for a 32 bit time signal. The analysis filter states must provide
+   space for (2*QMF_NO_POLY-1)*no_channels FIXP_DBL values. */
+void
+qmfAnalysisFiltering( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank   */
+                      FIXP_QMF **qmfReal,             /*!< Pointer to real subband slots */
+                      FIXP_QMF **qmfImag,             /*!< Pointer to imag subband slots */
+                      QMF_SCALE_FACTOR *scaleFactor,  /*!< Scale factors of QMF data     */
+                      const FIXP_DBL *timeIn,         /*!< Time signal */
+                      const int  stride               /*!< Stride factor of audio data   */
                       );
 
 void
@@ -197,6 +217,18 @@ qmfSynthesisFiltering( HANDLE_QMF_FILTER_BANK synQmf,       /*!< Handle of Qmf S
                        FIXP_QMF   *pWorkBuffer              /*!< pointer to temporal working buffer */
                        );
 
+/* Variant for a 32 bit time signal. */
+void
+qmfSynthesisFiltering( HANDLE_QMF_FILTER_BANK synQmf,       /*!< Handle of Qmf Synthesis Bank  */
+                       FIXP_QMF  **QmfBufferReal,           /*!< Pointer to real subband slots */
+                       FIXP_QMF  **QmfBufferImag,           /*!< Pointer to imag subband slots */
+                       const QMF_SCALE_FACTOR *scaleFactor, /*!< Scale factors of QMF data     */
+                       const int   ov_len,                  /*!< Length of band overlap        */
+                       FIXP_DBL   *timeOut,                 /*!< Time signal */
+                       const int   stride,                  /*!< Stride factor of audio data   */
+                       FIXP_QMF   *pWorkBuffer              /*!< pointer to temporal working buffer */
+                       );
+
 int
 qmfInitAnalysisFilterBank( HANDLE_QMF_FILTER_BANK h_Qmf, /*!< QMF Handle */
                            FIXP_QAS *pFilterStates,      /*!< Pointer to filter state buffer */
@@ -215,6 +247,15 @@ qmfAnalysisFilteringSlot( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Syn
                           FIXP_QMF      *pWorkBuffer      /*!< pointer to temporal working buffer */
                          );
 
+void
+qmfAnalysisFilteringBlock( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank */
+                           FIXP_QMF **qmfReal,             /*!< Pointer to real subband slots */
+                           FIXP_QMF **qmfImag,             /*!< Pointer to imag subband slots (unused for QMF_FLAG_LP) */
+                           const INT_PCM *timeIn,          /*!< Time signal */
+                           const int  stride,              /*!< Stride factor of audio data */
+                           const int  nSlots               /*!< Number of slots */
+                          );
+
 int
 qmfInitSynthesisFilterBank( HANDLE_QMF_FILTER_BANK h_Qmf, /*!< QMF Handle */
                             FIXP_QSS *pFilterStates,      /*!< Pointer to filter state buffer */
@@ -233,6 +274,16 @@ void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
                                 const int       stride,
                                 FIXP_QMF       *pWorkBuffer);
 
+/* Variant for a 32 bit time signal. */
+void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
+                                const FIXP_QMF *realSlot,
+                                const FIXP_QMF *imagSlot,
+                                const int       scaleFactorLowBand,
+                                const int       scaleFactorHighBand,
+                                FIXP_DBL       *timeOut,
+                                const int       stride,
+                                FIXP_QMF       *pWorkBuffer);
+
 void
 qmfChangeOutScalefactor (HANDLE_QMF_FILTER_BANK synQmf,     /*!< Handle of Qmf Synthesis Bank */
                          int outScalefactor                 /*!< New scaling factor for output data */
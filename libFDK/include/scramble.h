@@ -99,6 +99,9 @@ amm-info@iis.fraunhofer.de
 #elif defined(__mips__) && defined(__mips_dsp)	/* cppp replaced: elif */
 #include "mips/scramble.h"
 
+#elif defined(__x86__)
+#include "x86/scramble_x86.h"
+
 #endif
 
 /*****************************************************************************
@@ -211,6 +211,48 @@ INT FDK_get32 (HANDLE_FDK_BITBUF hBitBuf)
   }
 }
 
+/* Load 8 bytes in big endian order from an arbitrary address. */
+static inline UINT64 FDK_loadBE64 (const UCHAR *p)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  UINT64 x;
+  __builtin_memcpy(&x, p, sizeof(x));
+  return __builtin_bswap64(x);
+#else
+  return ((UINT64)p[0] << 56) | ((UINT64)p[1] << 48) | ((UINT64)p[2] << 40) | ((UINT64)p[3] << 32) |
+         ((UINT64)p[4] << 24) | ((UINT64)p[5] << 16) | ((UINT64)p[6] <<  8) |  (UINT64)p[7];
+#endif
+}
+
+/* Read 1 to 57 bits. */
+UINT64 FDK_get64 (HANDLE_FDK_BITBUF hBitBuf, const UINT numberOfBits)
+{
+  UINT byteOffset = hBitBuf->BitNdx >> 3 ;
+
+  if (byteOffset + 8 <= hBitBuf->bufSize)
+  {
+    UINT bitOffset = hBitBuf->BitNdx & 0x07 ;
+
+    hBitBuf->BitNdx     = (hBitBuf->BitNdx + numberOfBits) & (hBitBuf->bufBits - 1) ;
+    hBitBuf->BitCnt    +=  numberOfBits ;
+    hBitBuf->ValidBits -=  numberOfBits ;
+
+    return (FDK_loadBE64(&hBitBuf->Buffer[byteOffset]) << bitOffset) >> (64 - numberOfBits) ;
+  }
+  else
+  {
+    /* exotic path, used only near the end of the buffer, when wrapping around */
+    UINT64 cache = 0;
+    UINT nBits = numberOfBits;
+
+    if (nBits > 32) {
+      cache = (UINT64)(UINT)FDK_get (hBitBuf, nBits-32) << 32;
+      nBits = 32;
+    }
+    return cache | (UINT)FDK_get (hBitBuf, nBits);
+  }
+}
+
 INT FDK_getBwd (HANDLE_FDK_BITBUF hBitBuf, const UINT numberOfBits)
 {
   UINT byteOffset = hBitBuf->BitNdx >> 3 ;
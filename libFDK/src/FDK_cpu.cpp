@@ -0,0 +1,223 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: CPU feature detection and kernel dispatch
+
+******************************************************************************/
+
+#include "FDK_cpu.h"
+
+#include "common_fix.h"
+
+#if defined(FDK_X86_SIMD)
+#include "x86/dispatch_x86.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif /* FDK_X86_SIMD */
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+
+static UINT cpuFeaturesDetected = 0;
+static UINT cpuFeaturesActive = 0;
+
+/* The detection runs exactly once, also if several instances are opened concurrently. */
+#if defined(_WIN32)
+static INIT_ONCE cpuFeaturesOnce = INIT_ONCE_STATIC_INIT;
+#else
+static pthread_once_t cpuFeaturesOnce = PTHREAD_ONCE_INIT;
+#endif
+
+#if defined(FDK_X86_SIMD)
+
+static void cpuid(UINT leaf, UINT subleaf, UINT regs[4])
+{
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, (int)leaf, (int)subleaf);
+  regs[0] = r[0]; regs[1] = r[1]; regs[2] = r[2]; regs[3] = r[3];
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static UINT xgetbv0(void)
+{
+#if defined(_MSC_VER)
+  return (UINT)_xgetbv(0);
+#else
+  UINT eax, edx;
+  __asm__ __volatile__ ( ".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0) );
+  return eax;
+#endif
+}
+
+static UINT detectCpuFeatures(void)
+{
+  UINT regs[4];
+  UINT maxLeaf;
+  UINT features = 0;
+
+  cpuid(0, 0, regs);
+  maxLeaf = regs[0];
+  if (maxLeaf < 1) {
+    return 0;
+  }
+
+  cpuid(1, 0, regs);
+  if (regs[3] & (1<<26)) features |= FDK_CPU_SSE2;
+  if ((features & FDK_CPU_SSE2) && (regs[2] & (1<<19))) features |= FDK_CPU_SSE41;
+
+  /* AVX2 requires OS support for saving the YMM registers (OSXSAVE, XCR0 bits 1 and 2). */
+  if ( (features & FDK_CPU_SSE41) && (regs[2] & (1<<27)) && (regs[2] & (1<<28)) && (maxLeaf >= 7) ) {
+    if ((xgetbv0() & 0x6) == 0x6) {
+      cpuid(7, 0, regs);
+      if (regs[1] & (1<<5)) features |= FDK_CPU_AVX2;
+    }
+  }
+
+  return features;
+}
+
+#else
+
+static UINT detectCpuFeatures(void)
+{
+  return 0;
+}
+
+#endif /* FDK_X86_SIMD */
+
+static void selectKernels(UINT features)
+{
+  cpuFeaturesActive = features;
+#if defined(FDK_X86_SIMD)
+  FDK_x86InitKernels(features);
+#endif
+}
+
+static void initCpuFeatures(void)
+{
+  cpuFeaturesDetected = detectCpuFeatures();
+  selectKernels(cpuFeaturesDetected);
+}
+
+#if defined(_WIN32)
+static BOOL CALLBACK initCpuFeaturesOnce(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+  initCpuFeatures();
+  return TRUE;
+}
+#endif
+
+void FDK_initCpuFeatures(void)
+{
+#if defined(_WIN32)
+  InitOnceExecuteOnce(&cpuFeaturesOnce, initCpuFeaturesOnce, NULL, NULL);
+#else
+  pthread_once(&cpuFeaturesOnce, initCpuFeatures);
+#endif
+}
+
+void FDK_setCpuFeatures(UINT features)
+{
+  FDK_initCpuFeatures();
+
+  selectKernels(features & cpuFeaturesDetected);
+}
+
+UINT FDK_getCpuFeatures(void)
+{
+  return cpuFeaturesActive;
+}
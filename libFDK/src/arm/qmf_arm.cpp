@@ -533,19 +533,16 @@ INT qmfSynPrototypeFirSlot2(
                              HANDLE_QMF_FILTER_BANK qmf,
                              FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
                              FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
-                             INT_PCM  *RESTRICT timeOut,             /*!< Time domain data */
-                             INT       stride                        /*!< Time output buffer stride factor*/
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
                             )
 {
   FIXP_QSS *RESTRICT sta = (FIXP_QSS*)qmf->FilterStates;
   int no_channels = qmf->no_channels;
-  int scale = ((DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor);
 
   /* We map an arry of 16-bit values upon an array of 2*16-bit values to read 2 values in one shot */
   const FIXP_DBL *RESTRICT p_flt  = (FIXP_DBL *) qmf->p_filter;           /* low=[0],   high=[1]   */
   const FIXP_DBL *RESTRICT p_fltm = (FIXP_DBL *) qmf->p_filter + 155;     /* low=[310], high=[311] */
 
-  FDK_ASSERT(SAMPLE_BITS-1-qmf->outScalefactor >= 0); //   (DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor >= 0);
   FDK_ASSERT(qmf->p_stride==2 && qmf->no_channels == 32);
 
   FDK_ASSERT((no_channels&3) == 0);  /* should be a multiple of 4 */
@@ -553,8 +550,7 @@ INT qmfSynPrototypeFirSlot2(
   realSlot += no_channels-1;    // ~~"~~
   imagSlot += no_channels-1;    // no_channels-1 .. 0
 
-  FIXP_DBL MyTimeOut[32];
-  FIXP_DBL *pMyTimeOut = &MyTimeOut[0];
+  FIXP_DBL *pMyTimeOut = &pFirOut[no_channels];
 
   for (no_channels = no_channels; no_channels--;)
   {
@@ -580,137 +576,12 @@ INT qmfSynPrototypeFirSlot2(
      *sta++ = SMLAWB( sta[1], real, A );  /* index=314...........4  */
      *sta++ =         SMULWB( imag, B );  /* index=10..........320  */
 
-     *pMyTimeOut++ = result;
+     *--pMyTimeOut = result;
 
      p_fltm   -= 5;
      p_flt    += 5;
   }
 
-  pMyTimeOut = &MyTimeOut[0];
-#if (SAMPLE_BITS == 16)      
-  const FIXP_DBL max_pos = (FIXP_DBL) 0x00007FFF << scale;
-  const FIXP_DBL max_neg = (FIXP_DBL) 0xFFFF8001 << scale;
-#else
-  scale = -scale;
-  const FIXP_DBL max_pos = (FIXP_DBL) 0x7FFFFFFF >> scale;
-  const FIXP_DBL max_neg = (FIXP_DBL) 0x80000001 >> scale;  
-#endif
-  const FIXP_DBL add_neg = (1 << scale) - 1;
-
-  no_channels = qmf->no_channels;
-
-  timeOut += no_channels*stride;
-
-  FDK_ASSERT(scale >= 0);
-
-  if (qmf->outGain != 0x80000000)
-  {
-    FIXP_DBL gain = qmf->outGain;
-    for (no_channels>>=2; no_channels--;)
-    {
-      FIXP_DBL result1, result2;
-
-      result1 = *pMyTimeOut++;
-      result2 = *pMyTimeOut++;
-
-      result1 = fMult(result1,gain);
-      timeOut -= stride;
-      if (result1 < 0)        result1 += add_neg;
-      if (result1 < max_neg)  result1 = max_neg;
-      if (result1 > max_pos)  result1 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result1 >> scale;
-#else
-      timeOut[0] = result1 << scale;
-#endif
-
-      result2 = fMult(result2,gain);
-      timeOut -= stride;
-      if (result2 < 0)        result2 += add_neg;
-      if (result2 < max_neg)  result2 = max_neg;
-      if (result2 > max_pos)  result2 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result2 >> scale;
-#else
-      timeOut[0] = result2 << scale;
-#endif
-
-      result1 = *pMyTimeOut++;
-      result2 = *pMyTimeOut++;
-
-      result1 = fMult(result1,gain);
-      timeOut -= stride;
-      if (result1 < 0)        result1 += add_neg;
-      if (result1 < max_neg)  result1 = max_neg;
-      if (result1 > max_pos)  result1 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result1 >> scale;
-#else
-      timeOut[0] = result1 << scale;
-#endif
-
-      result2 = fMult(result2,gain);
-      timeOut -= stride;
-      if (result2 < 0)        result2 += add_neg;
-      if (result2 < max_neg)  result2 = max_neg;
-      if (result2 > max_pos)  result2 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result2 >> scale;
-#else
-      timeOut[0] = result2 << scale;
-#endif
-    }
-  }
-  else
-  {
-    for (no_channels>>=2; no_channels--;)
-    {
-      FIXP_DBL result1, result2;
-      result1 = *pMyTimeOut++;
-      result2 = *pMyTimeOut++;
-      timeOut -= stride;
-      if (result1 < 0)        result1 += add_neg;
-      if (result1 < max_neg)  result1 = max_neg;
-      if (result1 > max_pos)  result1 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result1 >> scale;
-#else
-      timeOut[0] = result1 << scale;
-#endif
-      
-      timeOut -= stride;
-      if (result2 < 0)        result2 += add_neg;
-      if (result2 < max_neg)  result2 = max_neg;
-      if (result2 > max_pos)  result2 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result2 >> scale;
-#else
-      timeOut[0] = result2 << scale;
-#endif
-      
-      result1 = *pMyTimeOut++;
-      result2 = *pMyTimeOut++;
-      timeOut -= stride;
-      if (result1 < 0)        result1 += add_neg;
-      if (result1 < max_neg)  result1 = max_neg;
-      if (result1 > max_pos)  result1 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result1 >> scale;
-#else
-      timeOut[0] = result1 << scale;
-#endif
-      
-      timeOut -= stride;
-      if (result2 < 0)        result2 += add_neg;
-      if (result2 < max_neg)  result2 = max_neg;
-      if (result2 > max_pos)  result2 = max_pos;
-#if (SAMPLE_BITS == 16)
-      timeOut[0] = result2 >> scale;
-#else
-      timeOut[0] = result2 << scale;
-#endif
-    }
-  }
   return 0;
 }
 
@@ -718,30 +589,28 @@ static
 void qmfSynPrototypeFirSlot_fallback( HANDLE_QMF_FILTER_BANK qmf,
                              FIXP_DBL *realSlot,      /*!< Input: Pointer to real Slot */
                              FIXP_DBL *imagSlot,      /*!< Input: Pointer to imag Slot */
-                             INT_PCM  *timeOut,             /*!< Time domain data */
-                             const int       stride
+                             FIXP_DBL *pFirOut        /*!< Filter output */
                             );
 
 /*!
   \brief Perform Synthesis Prototype Filtering on a single slot of input data.
 
   The filter takes 2 * #MAX_SYNTHESIS_CHANNELS of input data and
-  generates #MAX_SYNTHESIS_CHANNELS time domain output samples.
+  generates #MAX_SYNTHESIS_CHANNELS filter output values.
 */
 
 static
 void qmfSynPrototypeFirSlot( HANDLE_QMF_FILTER_BANK qmf,
                              FIXP_DBL *realSlot,      /*!< Input: Pointer to real Slot */
                              FIXP_DBL *imagSlot,      /*!< Input: Pointer to imag Slot */
-                             INT_PCM  *timeOut,             /*!< Time domain data */
-                             const int       stride
+                             FIXP_DBL *pFirOut        /*!< Filter output */
                             )
 {
     INT err = -1;
 
     switch (qmf->p_stride) {
     case 2:
-      err = qmfSynPrototypeFirSlot2(qmf, realSlot, imagSlot, timeOut, stride);
+      err = qmfSynPrototypeFirSlot2(qmf, realSlot, imagSlot, pFirOut);
       break;
     default:
       err = -1;
@@ -749,7 +618,7 @@ void qmfSynPrototypeFirSlot( HANDLE_QMF_FILTER_BANK qmf,
 
     /* fallback if configuration not available or failed */
     if(err!=0) {
-        qmfSynPrototypeFirSlot_fallback(qmf, realSlot, imagSlot, timeOut, stride);
+        qmfSynPrototypeFirSlot_fallback(qmf, realSlot, imagSlot, pFirOut);
     }
 }
 #endif /* FUNCTION_qmfSynPrototypeFirSlot */
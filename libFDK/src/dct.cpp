@@ -106,6 +106,8 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/dct_arm.cpp"
+#elif defined(__x86__)
+#include "x86/dct_x86.cpp"
 #endif
 
 
@@ -383,3 +383,51 @@ INT  imdct_block(
   return nrSamples;
 }
 
+INT  imdct_skip_block(
+        H_MDCT hMdct,
+        const INT nSpec,
+        const INT noOutSamples,
+        const INT tl,
+        const FIXP_WTP *wls,
+        INT fl,
+        const FIXP_WTP *wrs,
+        const INT fr
+        )
+{
+  INT nl, nr;
+  int w, nrSamples = 0;
+
+  /* Same parameter handling as in imdct_block() */
+  nr = (tl - fr)>>1;
+  nl = (tl - fl)>>1;
+
+  if (hMdct->prev_fr != fl) {
+    imdct_adapt_parameters(hMdct, &fl, &nl, tl, wls, noOutSamples);
+  }
+
+  if ( noOutSamples > nrSamples ) {
+    nrSamples = hMdct->ov_offset;
+    hMdct->ov_offset = 0;
+  }
+
+  for (w=0; w<nSpec; w++)
+  {
+    if ( noOutSamples <= nrSamples ) {
+      hMdct->ov_offset += hMdct->prev_nr + fl/2;
+    } else {
+      nrSamples += hMdct->prev_nr + fl/2;
+    }
+    if ( noOutSamples <= nrSamples ) {
+      hMdct->ov_offset += fl/2 + nl;
+    } else {
+      nrSamples += fl/2 + nl;
+    }
+
+    hMdct->prev_nr = nr;
+    hMdct->prev_fr = fr;
+    hMdct->prev_tl = tl;
+    hMdct->prev_wrs = wrs;
+  }
+
+  return nrSamples;
+}
@@ -136,6 +136,9 @@ amm-info@iis.fraunhofer.de
 #if defined(__arm__)
 #include "arm/qmf_arm.cpp"
 
+#elif defined(__x86__)
+#include "x86/qmf_x86.cpp"
+
 #endif
 
 /*!
@@ -161,12 +164,21 @@ amm-info@iis.fraunhofer.de
  */
 #define ALGORITHMIC_SCALING_IN_SYNTHESIS_FILTERBANK 1
 
+#if (QAS_BITS < DFRACT_BITS)
+/*!
+ * \brief Number of lower bits of a 32 bit time signal which are kept in
+ *        separate analysis filter states, see qmfAnaFeedStates().
+ */
+#define QMF_ANA_LO_BITS (DFRACT_BITS-QAS_BITS-1)
+#endif
+
 
 /*!
   \brief Perform Synthesis Prototype Filtering on a single slot of input data.
 
   The filter takes 2 * qmf->no_channels of input data and
-  generates qmf->no_channels time domain output samples.
+  generates qmf->no_channels filter output values in pFirOut. They are
+  converted to the time signal by qmfSynStoreSlot().
 */
 static
 #ifndef FUNCTION_qmfSynPrototypeFirSlot
@@ -177,8 +189,7 @@ void qmfSynPrototypeFirSlot_fallback(
                              HANDLE_QMF_FILTER_BANK qmf,
                              FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
                              FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
-                             INT_PCM  *RESTRICT timeOut,             /*!< Time domain data */
-                             int       stride
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
                             )
 {
   FIXP_QSS* FilterStates = (FIXP_QSS*)qmf->FilterStates;
@@ -188,34 +199,15 @@ void qmfSynPrototypeFirSlot_fallback(
   int j;
   FIXP_QSS *RESTRICT sta = FilterStates;
   const FIXP_PFT *RESTRICT p_flt, *RESTRICT p_fltm;
-  int scale = ((DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor);
 
   p_flt  = p_Filter+p_stride*QMF_NO_POLY;          /*                     5-ter von 330 */
   p_fltm = p_Filter+(qmf->FilterSize/2)-p_stride*QMF_NO_POLY;  /* 5 + (320 - 2*5) = 315-ter von 330 */
 
-  FDK_ASSERT(SAMPLE_BITS-1-qmf->outScalefactor >= 0); //   (DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor >= 0);
-
   for (j = no_channels-1; j >= 0; j--) {  /* ---- luft ueber alle Linien eines Slots ---- */
     FIXP_QMF imag  =  imagSlot[j];  // no_channels-1 .. 0
     FIXP_QMF real  =  realSlot[j];  // ~~"~~
-    {
-      INT_PCM tmp;
-      FIXP_DBL Are = FX_QSS2FX_DBL(sta[0]) + fMultDiv2( p_fltm[0] , real);
 
-      if (qmf->outGain!=(FIXP_DBL)0x80000000) {
-        Are = fMult(Are,qmf->outGain);
-      }
-
-  #if SAMPLE_BITS > 16
-      tmp = (INT_PCM)(SATURATE_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
-  #else
-      tmp = (INT_PCM)(SATURATE_RIGHT_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
-  #endif
-      if (Are < (FIXP_QMF)0) {
-        tmp = -tmp;
-      }
-      timeOut[ (j)*stride ] = tmp;
-    }
+    pFirOut[j] = FX_QSS2FX_DBL(sta[0]) + fMultDiv2( p_fltm[0] , real);
 
     sta[0] = sta[1] + FX_DBL2FX_QSS(fMultDiv2( p_flt [4] , imag ));
     sta[1] = sta[2] + FX_DBL2FX_QSS(fMultDiv2( p_fltm[1] , real ));
@@ -233,20 +225,22 @@ void qmfSynPrototypeFirSlot_fallback(
   }
 }
 
-#ifndef FUNCTION_qmfSynPrototypeFirSlot_NonSymmetric
 /*!
   \brief Perform Synthesis Prototype Filtering on a single slot of input data.
 
   The filter takes 2 * qmf->no_channels of input data and
-  generates qmf->no_channels time domain output samples.
+  generates qmf->no_channels filter output values in pFirOut.
 */
 static
+#ifndef FUNCTION_qmfSynPrototypeFirSlot_NonSymmetric
 void qmfSynPrototypeFirSlot_NonSymmetric(
+#else
+void qmfSynPrototypeFirSlot_NonSymmetric_fallback(
+#endif
                              HANDLE_QMF_FILTER_BANK qmf,
                              FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
                              FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
-                             INT_PCM  *RESTRICT timeOut,             /*!< Time domain data */
-                             int       stride
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
                             )
 {
   FIXP_QSS* FilterStates = (FIXP_QSS*)qmf->FilterStates;
@@ -256,31 +250,16 @@ void qmfSynPrototypeFirSlot_NonSymmetric(
   int j;
   FIXP_QSS *RESTRICT sta = FilterStates;
   const FIXP_PFT *RESTRICT p_flt, *RESTRICT p_fltm;
-  int scale = ((DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor);
 
   p_flt  = p_Filter;                           /*!< Pointer to first half of filter coefficients */
   p_fltm = &p_flt[qmf->FilterSize/2];  /* at index 320, overall 640 coefficients */
 
-  FDK_ASSERT(SAMPLE_BITS-1-qmf->outScalefactor >= 0); //   (DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor >= 0);
-
   for (j = no_channels-1; j >= 0; j--) {  /* ---- luft ueber alle Linien eines Slots ---- */
 
     FIXP_QMF imag  =  imagSlot[j];  // no_channels-1 .. 0
     FIXP_QMF real  =  realSlot[j];  // ~~"~~
-    {
-      INT_PCM tmp;
-      FIXP_QMF Are = sta[0] + FX_DBL2FX_QSS(fMultDiv2( p_fltm[4] , real ));
 
-  #if SAMPLE_BITS > 16
-      tmp = (INT_PCM)(SATURATE_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
-  #else
-      tmp = (INT_PCM)(SATURATE_RIGHT_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
-  #endif
-      if (Are < (FIXP_QMF)0) {
-        tmp = -tmp;
-      }
-      timeOut[j*stride] = tmp;
-    }
+    pFirOut[j] = sta[0] + FX_DBL2FX_QSS(fMultDiv2( p_fltm[4] , real ));
 
     sta[0] = sta[1] + FX_DBL2FX_QSS(fMultDiv2( p_flt [4] , imag ));
     sta[1] = sta[2] + FX_DBL2FX_QSS(fMultDiv2( p_fltm[3] , real ));
@@ -300,7 +279,70 @@ void qmfSynPrototypeFirSlot_NonSymmetric(
   }
 
 }
-#endif /* FUNCTION_qmfSynPrototypeFirSlot_NonSymmetric */
+
+/*!
+  \brief Store one slot of synthesis prototype filter output as time signal.
+*/
+static
+void qmfSynStoreSlot( HANDLE_QMF_FILTER_BANK qmf,
+                      const FIXP_DBL *RESTRICT pFirOut,      /*!< Filter output */
+                      INT_PCM  *RESTRICT timeOut,            /*!< Time domain data */
+                      int       stride
+                     )
+{
+  int j;
+  int scale = ((DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor);
+
+  FDK_ASSERT(SAMPLE_BITS-1-qmf->outScalefactor >= 0); //   (DFRACT_BITS-SAMPLE_BITS)-1-qmf->outScalefactor >= 0);
+
+  for (j = 0; j < qmf->no_channels; j++) {
+    INT_PCM tmp;
+    FIXP_DBL Are = pFirOut[j];
+
+    if (qmf->outGain!=(FIXP_DBL)0x80000000) {
+      Are = fMult(Are,qmf->outGain);
+    }
+
+  #if SAMPLE_BITS > 16
+    tmp = (INT_PCM)(SATURATE_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
+  #else
+    tmp = (INT_PCM)(SATURATE_RIGHT_SHIFT(fAbs(Are), scale, SAMPLE_BITS));
+  #endif
+    if (Are < (FIXP_DBL)0) {
+      tmp = -tmp;
+    }
+    timeOut[j*stride] = tmp;
+  }
+}
+
+/*!
+  \brief Store one slot of synthesis prototype filter output as 32 bit time signal.
+*/
+static
+void qmfSynStoreSlot( HANDLE_QMF_FILTER_BANK qmf,
+                      const FIXP_DBL *RESTRICT pFirOut,      /*!< Filter output */
+                      FIXP_DBL *RESTRICT timeOut,            /*!< Time domain data */
+                      int       stride
+                     )
+{
+  int j;
+  int scale = (-1-qmf->outScalefactor);
+
+  for (j = 0; j < qmf->no_channels; j++) {
+    FIXP_DBL tmp;
+    FIXP_DBL Are = pFirOut[j];
+
+    if (qmf->outGain!=(FIXP_DBL)0x80000000) {
+      Are = fMult(Are,qmf->outGain);
+    }
+
+    tmp = (FIXP_DBL)(SATURATE_SHIFT(fAbs(Are), scale, DFRACT_BITS));
+    if (Are < (FIXP_DBL)0) {
+      tmp = -tmp;
+    }
+    timeOut[j*stride] = tmp;
+  }
+}
 
 #ifndef FUNCTION_qmfAnaPrototypeFirSlot
 /*!
@@ -469,28 +511,22 @@ qmfForwardModulationLP_odd( HANDLE_QMF_FILTER_BANK anaQmf, /*!< Handle of Qmf An
 
 
 
+#if !defined(FUNCTION_qmfForwardModulationHQ_butterfly)
 /*!
  *
- * \brief Perform complex-valued forward modulation of the time domain
- *        data of timeIn and stores the real part of the subband
- *        samples in rSubband, and the imaginary part in iSubband
- *
- *        Only the lower bands are obtained (upto anaQmf->lsb). For
- *        a full bandwidth analysis it is required to set both anaQmf->lsb
- *        and anaQmf->usb to the amount of QMF bands.
+ * \brief Butterfly of the time domain data of timeIn preceding the
+ *        DCT-IV and DST-IV of qmfForwardModulationHQ()
  *
  */
-static void
-qmfForwardModulationHQ( HANDLE_QMF_FILTER_BANK anaQmf,     /*!< Handle of Qmf Analysis Bank  */
-                        const FIXP_QMF *RESTRICT timeIn,   /*!< Time Signal */
-                        FIXP_QMF *RESTRICT rSubband,       /*!< Real Output */
-                        FIXP_QMF *RESTRICT iSubband        /*!< Imaginary Output */
-                       )
+static inline void
+qmfForwardModulationHQ_butterfly( const FIXP_QMF *RESTRICT timeIn,   /*!< Time Signal */
+                                  FIXP_QMF *RESTRICT rSubband,       /*!< Real Output */
+                                  FIXP_QMF *RESTRICT iSubband,       /*!< Imaginary Output */
+                                  int L                              /*!< Number of channels */
+                                 )
 {
   int i;
-  int L = anaQmf->no_channels;
   int L2 = L<<1;
-  int shift = 0;
 
   for (i = 0; i < L; i+=2) {
     FIXP_QMF x0, x1, y0, y1;
@@ -505,6 +541,31 @@ qmfForwardModulationHQ( HANDLE_QMF_FILTER_BANK anaQmf,     /*!< Handle of Qmf An
     iSubband[i] = x0 + y0;
     iSubband[i+1] = x1 + y1;
   }
+}
+#endif /* !defined(FUNCTION_qmfForwardModulationHQ_butterfly) */
+
+/*!
+ *
+ * \brief Perform complex-valued forward modulation of the time domain
+ *        data of timeIn and stores the real part of the subband
+ *        samples in rSubband, and the imaginary part in iSubband
+ *
+ *        Only the lower bands are obtained (upto anaQmf->lsb). For
+ *        a full bandwidth analysis it is required to set both anaQmf->lsb
+ *        and anaQmf->usb to the amount of QMF bands.
+ *
+ */
+static void
+qmfForwardModulationHQ( HANDLE_QMF_FILTER_BANK anaQmf,     /*!< Handle of Qmf Analysis Bank  */
+                        const FIXP_QMF *RESTRICT timeIn,   /*!< Time Signal */
+                        FIXP_QMF *RESTRICT rSubband,       /*!< Real Output */
+                        FIXP_QMF *RESTRICT iSubband        /*!< Imaginary Output */
+                       )
+{
+  int L = anaQmf->no_channels;
+  int shift = 0;
+
+  qmfForwardModulationHQ_butterfly( timeIn, rSubband, iSubband, L );
 
   dct_IV(rSubband, L, &shift);
   dst_IV(iSubband, L, &shift);
@@ -516,13 +577,170 @@ qmfForwardModulationHQ( HANDLE_QMF_FILTER_BANK anaQmf,     /*!< Handle of Qmf An
       sbr_t_cos = anaQmf->t_cos;
       sbr_t_sin = anaQmf->t_sin;
 
-      for (i = 0; i < anaQmf->lsb; i++) {
-        cplxMult(&iSubband[i], &rSubband[i], iSubband[i], rSubband[i], sbr_t_cos[i], sbr_t_sin[i]);
-      }
+      cplxMultVec(iSubband, rSubband, iSubband, rSubband, sbr_t_cos, sbr_t_sin, anaQmf->lsb);
+    }
+  }
+}
+
+/*!
+ *
+ * \brief Feed one slot of time signal into the newest no_channels filter states
+ *
+ */
+static void
+qmfAnaFeedStates( FIXP_QAS *RESTRICT pFilterStates, /*!< Newest filter states */
+                  const INT_PCM *RESTRICT timeIn,   /*!< Pointer to input */
+                  const int      stride,            /*!< stride factor of input */
+                  const int      no_channels )      /*!< Number of samples */
+{
+  int i;
+
+  for(i=no_channels>>1; i!=0; i--) {
+    /* Place INT_PCM value left aligned in scaledTimeIn */
+#if (QAS_BITS==SAMPLE_BITS)
+    *pFilterStates++ = (FIXP_QAS)*timeIn; timeIn += stride;
+    *pFilterStates++ = (FIXP_QAS)*timeIn; timeIn += stride;
+#elif (QAS_BITS>SAMPLE_BITS)
+    *pFilterStates++ = (FIXP_QAS)((*timeIn)<<(QAS_BITS-SAMPLE_BITS)); timeIn += stride;
+    *pFilterStates++ = (FIXP_QAS)((*timeIn)<<(QAS_BITS-SAMPLE_BITS)); timeIn += stride;
+#else
+    *pFilterStates++ = (FIXP_QAS)((*timeIn)>>(SAMPLE_BITS-QAS_BITS)); timeIn += stride;
+    *pFilterStates++ = (FIXP_QAS)((*timeIn)>>(SAMPLE_BITS-QAS_BITS)); timeIn += stride;
+#endif
+  }
+}
+
+/*!
+ *
+ * \brief Feed one slot of a 32 bit time signal into the newest no_channels filter states
+ *
+ * The upper QAS_BITS of each sample are placed in pStatesHi. If the filter
+ * states are narrower than the time signal, the next QMF_ANA_LO_BITS bits
+ * are placed right aligned in pStatesLo.
+ *
+ */
+static void
+qmfAnaFeedStates( FIXP_QAS *RESTRICT pStatesHi,     /*!< Newest filter states, upper bits */
+                  FIXP_QAS *RESTRICT pStatesLo,     /*!< Newest filter states, lower bits */
+                  const FIXP_DBL *RESTRICT timeIn,  /*!< Pointer to input */
+                  const int      stride,            /*!< stride factor of input */
+                  const int      no_channels )      /*!< Number of samples */
+{
+  int i;
+
+  for(i=no_channels; i!=0; i--) {
+#if (QAS_BITS < DFRACT_BITS)
+    *pStatesHi++ = (FIXP_QAS)((*timeIn)>>(DFRACT_BITS-QAS_BITS));
+    *pStatesLo++ = (FIXP_QAS)(((*timeIn)>>1) & ((1<<QMF_ANA_LO_BITS)-1));
+#else
+    *pStatesHi++ = (FIXP_QAS)*timeIn;
+#endif
+    timeIn += stride;
+  }
+}
+
+/*!
+  \brief Convert the analysis filter states in place between the formats of a
+         16 bit and a 32 bit time signal if the width of the time signal differs
+         from the one of the last call.
+
+  For a 32 bit time signal the second half of the state buffer holds the lower
+  bits of the time signal, see qmfAnaFeedStates().
+*/
+static void
+qmfAnaAdaptStateFormat( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank */
+                        int timeDbl                     /*!< Nonzero for a 32 bit time signal */
+                       )
+{
+  if ( (timeDbl != 0) == ((anaQmf->flags & QMF_FLAG_TIME_DBL) != 0) ) {
+    return;
+  }
+
+  if (timeDbl) {
+#if (QAS_BITS < DFRACT_BITS)
+    int n = anaQmf->no_channels*(QMF_NO_POLY*2-1);
+    FDKmemclear((FIXP_QAS*)anaQmf->FilterStates+n, n*sizeof(FIXP_QAS));
+#endif
+    anaQmf->flags |= QMF_FLAG_TIME_DBL;
+  } else {
+    anaQmf->flags &= ~QMF_FLAG_TIME_DBL;
+  }
+}
+
+/*!
+  \brief Perform Analysis Prototype Filtering on a block of consecutive slots.
+
+  The filter states of slot i start at pFilterStates + i*no_channels, the
+  filter output of slot i is stored at analysisBuffer + i*2*no_channels.
+*/
+static
+#ifndef FUNCTION_qmfAnaPrototypeFirBlock
+void qmfAnaPrototypeFirBlock(
+#else
+void qmfAnaPrototypeFirBlock_fallback(
+#endif
+                              HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank */
+                              FIXP_QMF *analysisBuffer,       /*!< Filter output of all slots */
+                              FIXP_QAS *pFilterStates,        /*!< Filter states of the first slot */
+                              int       nSlots                /*!< Number of slots */
+                             )
+{
+  int i;
+  int no_channels = anaQmf->no_channels;
+
+  for (i = 0; i < nSlots; i++) {
+    if (anaQmf->flags & QMF_FLAG_NONSYMMETRIC) {
+      qmfAnaPrototypeFirSlot_NonSymmetric(
+                              analysisBuffer,
+                              no_channels,
+                              anaQmf->p_filter,
+                              anaQmf->p_stride,
+                              pFilterStates
+                            );
+    } else {
+      qmfAnaPrototypeFirSlot( analysisBuffer,
+                              no_channels,
+                              anaQmf->p_filter,
+                              anaQmf->p_stride,
+                              pFilterStates
+                            );
     }
+    analysisBuffer += 2*no_channels;
+    pFilterStates  += no_channels;
   }
 }
 
+/*!
+ *
+ * \brief Perform the forward modulation of one slot of prototype filter output
+ *
+ */
+static void
+qmfForwardModulation( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank  */
+                      FIXP_QMF      *timeIn,          /*!< Prototype filter output, destroyed */
+                      FIXP_QMF      *qmfReal,         /*!< Low and High band, real */
+                      FIXP_QMF      *qmfImag          /*!< Low and High band, imag */
+                     )
+{
+    if (anaQmf->flags & QMF_FLAG_LP) {
+      if (anaQmf->flags & QMF_FLAG_CLDFB)
+        qmfForwardModulationLP_odd( anaQmf,
+                                    timeIn,
+                                    qmfReal );
+      else
+        qmfForwardModulationLP_even( anaQmf,
+                                     timeIn,
+                                     qmfReal );
+
+    } else {
+      qmfForwardModulationHQ( anaQmf,
+                              timeIn,
+                              qmfReal,
+                              qmfImag
+                             );
+    }
+}
+
 /*
  * \brief Perform one QMF slot analysis of the time domain data of timeIn
  *        with specified stride and stores the real part of the subband
@@ -541,29 +759,14 @@ qmfAnalysisFilteringSlot( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Syn
                           FIXP_QMF      *pWorkBuffer      /*!< pointer to temporal working buffer */
                          )
 {
-    int i;
     int offset = anaQmf->no_channels*(QMF_NO_POLY*2-1);
+
+    qmfAnaAdaptStateFormat( anaQmf, 0 );
+
     /*
       Feed time signal into oldest anaQmf->no_channels states
     */
-    {
-      FIXP_QAS *RESTRICT FilterStatesAnaTmp = ((FIXP_QAS*)anaQmf->FilterStates)+offset;
-
-      /* Feed and scale actual time in slot */
-      for(i=anaQmf->no_channels>>1; i!=0; i--) {
-        /* Place INT_PCM value left aligned in scaledTimeIn */
-#if (QAS_BITS==SAMPLE_BITS)
-        *FilterStatesAnaTmp++ = (FIXP_QAS)*timeIn; timeIn += stride;
-        *FilterStatesAnaTmp++ = (FIXP_QAS)*timeIn; timeIn += stride;
-#elif (QAS_BITS>SAMPLE_BITS)
-        *FilterStatesAnaTmp++ = (FIXP_QAS)((*timeIn)<<(QAS_BITS-SAMPLE_BITS)); timeIn += stride;
-        *FilterStatesAnaTmp++ = (FIXP_QAS)((*timeIn)<<(QAS_BITS-SAMPLE_BITS)); timeIn += stride;
-#else
-        *FilterStatesAnaTmp++ = (FIXP_QAS)((*timeIn)>>(SAMPLE_BITS-QAS_BITS)); timeIn += stride;
-        *FilterStatesAnaTmp++ = (FIXP_QAS)((*timeIn)>>(SAMPLE_BITS-QAS_BITS)); timeIn += stride;
-#endif
-      }
-    }
+    qmfAnaFeedStates( ((FIXP_QAS*)anaQmf->FilterStates)+offset, timeIn, stride, anaQmf->no_channels );
 
     if (anaQmf->flags & QMF_FLAG_NONSYMMETRIC) {
       qmfAnaPrototypeFirSlot_NonSymmetric(
@@ -582,23 +785,8 @@ qmfAnalysisFilteringSlot( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Syn
                             );
     }
 
-    if (anaQmf->flags & QMF_FLAG_LP) {
-      if (anaQmf->flags & QMF_FLAG_CLDFB)
-        qmfForwardModulationLP_odd( anaQmf,
-                                    pWorkBuffer,
-                                    qmfReal );
-      else
-        qmfForwardModulationLP_even( anaQmf,
-                                     pWorkBuffer,
-                                     qmfReal );
+    qmfForwardModulation( anaQmf, pWorkBuffer, qmfReal, qmfImag );
 
-    } else {
-      qmfForwardModulationHQ( anaQmf,
-                              pWorkBuffer,
-                              qmfReal,
-                              qmfImag
-                             );
-    }
     /*
       Shift filter states
 
@@ -607,6 +795,61 @@ qmfAnalysisFilteringSlot( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Syn
     FDKmemmove ((FIXP_QAS*)anaQmf->FilterStates, (FIXP_QAS*)anaQmf->FilterStates+anaQmf->no_channels, offset*sizeof(FIXP_QAS));
 }
 
+/*
+ * \brief Perform the QMF analysis of nSlots consecutive slots of the time
+ *        domain data of timeIn.
+ *
+ *        The slots are processed in blocks of up to QMF_ANA_BLOCK_SLOTS. The
+ *        filter states of a block are lined up in one buffer, so that the
+ *        states are moved once per block instead of once per slot and the
+ *        prototype filter can run over all slots of the block in one pass.
+ */
+void
+qmfAnalysisFilteringBlock( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank */
+                           FIXP_QMF **qmfReal,             /*!< Pointer to real subband slots */
+                           FIXP_QMF **qmfImag,             /*!< Pointer to imag subband slots */
+                           const INT_PCM *timeIn,          /*!< Time signal */
+                           const int  stride,              /*!< Stride factor of audio data */
+                           const int  nSlots               /*!< Number of slots */
+                          )
+{
+  int i, slot, nBlock;
+  int no_channels = anaQmf->no_channels;
+  int offset = no_channels*(QMF_NO_POLY*2-1);
+  C_AALLOC_SCRATCH_START(pStates, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_START(pFirOut, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+
+  FDK_ASSERT(no_channels <= QMF_ANA_MAX_CHANNELS);
+
+  qmfAnaAdaptStateFormat( anaQmf, 0 );
+
+  for (slot = 0; slot < nSlots; slot += nBlock)
+  {
+    nBlock = fixMin(nSlots - slot, QMF_ANA_BLOCK_SLOTS);
+
+    FDKmemcpy(pStates, anaQmf->FilterStates, offset*sizeof(FIXP_QAS));
+
+    for (i = 0; i < nBlock; i++) {
+      qmfAnaFeedStates( pStates+offset+i*no_channels, timeIn, stride, no_channels );
+      timeIn += no_channels*stride;
+    }
+
+    qmfAnaPrototypeFirBlock( anaQmf, pFirOut, pStates, nBlock );
+
+    for (i = 0; i < nBlock; i++) {
+      qmfForwardModulation( anaQmf,
+                            pFirOut + i*2*no_channels,
+                            qmfReal[slot+i],
+                            (anaQmf->flags & QMF_FLAG_LP) ? NULL : qmfImag[slot+i] );
+    }
+
+    FDKmemcpy(anaQmf->FilterStates, pStates+nBlock*no_channels, offset*sizeof(FIXP_QAS));
+  }
+
+  C_AALLOC_SCRATCH_END(pFirOut, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_END(pStates, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
+}
+
 
 /*!
  *
@@ -630,29 +873,101 @@ qmfAnalysisFiltering( HANDLE_QMF_FILTER_BANK anaQmf,    /*!< Handle of Qmf Analy
                       FIXP_QMF **qmfImag,               /*!< Pointer to imag subband slots */
                       QMF_SCALE_FACTOR *scaleFactor,
                       const INT_PCM *timeIn,            /*!< Time signal */
-                      const int  stride,
-                      FIXP_QMF  *pWorkBuffer            /*!< pointer to temporal working buffer */
+                      const int  stride
                       )
 {
-  int i;
+  scaleFactor->lb_scale = -ALGORITHMIC_SCALING_IN_ANALYSIS_FILTERBANK;
+  scaleFactor->lb_scale -= anaQmf->filterScale;
+
+  qmfAnalysisFilteringBlock( anaQmf, qmfReal, qmfImag, timeIn, stride, anaQmf->no_col );
+}
+
+/*!
+ *
+ * \brief Perform complex-valued subband filtering of a 32 bit time signal.
+ *
+ * The slots are processed in blocks like in qmfAnalysisFilteringBlock(). If
+ * the filter states are narrower than the time signal, the upper and the lower
+ * bits of the time signal run through the prototype filter separately and the
+ * two filter outputs are added before the modulation.
+ */
+void
+qmfAnalysisFiltering( HANDLE_QMF_FILTER_BANK anaQmf,    /*!< Handle of Qmf Analysis Bank */
+                      FIXP_QMF **qmfReal,               /*!< Pointer to real subband slots */
+                      FIXP_QMF **qmfImag,               /*!< Pointer to imag subband slots */
+                      QMF_SCALE_FACTOR *scaleFactor,
+                      const FIXP_DBL *timeIn,           /*!< Time signal */
+                      const int  stride
+                      )
+{
+  int i, slot, nBlock;
   int no_channels = anaQmf->no_channels;
+  int offset = no_channels*(QMF_NO_POLY*2-1);
+  FIXP_QAS *pStatesHi = (FIXP_QAS*)anaQmf->FilterStates;
+  C_AALLOC_SCRATCH_START(pStates, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_START(pFirOut, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+#if (QAS_BITS < DFRACT_BITS)
+  FIXP_QAS *pStatesLo = (FIXP_QAS*)anaQmf->FilterStates + offset;
+  C_AALLOC_SCRATCH_START(pStatesL, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_START(pFirOutL, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+#endif
+
+  FDK_ASSERT(no_channels <= QMF_ANA_MAX_CHANNELS);
 
   scaleFactor->lb_scale = -ALGORITHMIC_SCALING_IN_ANALYSIS_FILTERBANK;
   scaleFactor->lb_scale -= anaQmf->filterScale;
 
-  for (i = 0; i < anaQmf->no_col; i++)
-  {
-      FIXP_QMF *qmfImagSlot = NULL;
+  qmfAnaAdaptStateFormat( anaQmf, 1 );
 
-      if (!(anaQmf->flags & QMF_FLAG_LP)) {
-        qmfImagSlot = qmfImag[i];
-      }
+  for (slot = 0; slot < anaQmf->no_col; slot += nBlock)
+  {
+    nBlock = fixMin(anaQmf->no_col - slot, QMF_ANA_BLOCK_SLOTS);
 
-      qmfAnalysisFilteringSlot( anaQmf, qmfReal[i], qmfImagSlot, timeIn , stride, pWorkBuffer );
+    FDKmemcpy(pStates, pStatesHi, offset*sizeof(FIXP_QAS));
+#if (QAS_BITS < DFRACT_BITS)
+    FDKmemcpy(pStatesL, pStatesLo, offset*sizeof(FIXP_QAS));
+#endif
 
+    for (i = 0; i < nBlock; i++) {
+      qmfAnaFeedStates( pStates+offset+i*no_channels,
+#if (QAS_BITS < DFRACT_BITS)
+                        pStatesL+offset+i*no_channels,
+#else
+                        NULL,
+#endif
+                        timeIn, stride, no_channels );
       timeIn += no_channels*stride;
+    }
 
-  } /* no_col loop  i  */
+    qmfAnaPrototypeFirBlock( anaQmf, pFirOut, pStates, nBlock );
+
+#if (QAS_BITS < DFRACT_BITS)
+    qmfAnaPrototypeFirBlock( anaQmf, pFirOutL, pStatesL, nBlock );
+
+    for (i = 0; i < nBlock*2*no_channels; i++) {
+      pFirOut[i] += pFirOutL[i] >> QMF_ANA_LO_BITS;
+    }
+#endif
+
+    for (i = 0; i < nBlock; i++) {
+      qmfForwardModulation( anaQmf,
+                            pFirOut + i*2*no_channels,
+                            qmfReal[slot+i],
+                            (anaQmf->flags & QMF_FLAG_LP) ? NULL : qmfImag[slot+i] );
+    }
+
+    FDKmemcpy(pStatesHi, pStates+nBlock*no_channels, offset*sizeof(FIXP_QAS));
+#if (QAS_BITS < DFRACT_BITS)
+    FDKmemcpy(pStatesLo, pStatesL+nBlock*no_channels, offset*sizeof(FIXP_QAS));
+#endif
+  }
+
+#if (QAS_BITS < DFRACT_BITS)
+  C_AALLOC_SCRATCH_END(pFirOutL, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_END(pStatesL, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
+#endif
+  C_AALLOC_SCRATCH_END(pFirOut, FIXP_QMF, QMF_ANA_BLOCK_SLOTS*2*QMF_ANA_MAX_CHANNELS)
+  C_AALLOC_SCRATCH_END(pStates, FIXP_QAS, (QMF_NO_POLY*2-1+QMF_ANA_BLOCK_SLOTS)*QMF_ANA_MAX_CHANNELS)
 }
 
 /*!
@@ -829,14 +1144,18 @@ qmfInverseModulationHQ( HANDLE_QMF_FILTER_BANK synQmf,  /*!< Handle of Qmf Synth
   }
 }
 
-void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
-                                const FIXP_QMF  *realSlot,
-                                const FIXP_QMF  *imagSlot,
-                                const int        scaleFactorLowBand,
-                                const int        scaleFactorHighBand,
-                                INT_PCM         *timeOut,
-                                const int        stride,
-                                FIXP_QMF        *pWorkBuffer)
+/*!
+ *
+ * \brief Perform the inverse modulation of one slot of subband samples
+ *
+ */
+static void
+qmfInverseModulation( HANDLE_QMF_FILTER_BANK  synQmf,
+                      const FIXP_QMF  *realSlot,
+                      const FIXP_QMF  *imagSlot,
+                      const int        scaleFactorLowBand,
+                      const int        scaleFactorHighBand,
+                      FIXP_QMF        *pWorkBuffer)
 {
     if (!(synQmf->flags & QMF_FLAG_LP))
       qmfInverseModulationHQ ( synQmf,
@@ -864,23 +1183,67 @@ void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
                                );
       }
     }
+}
+
+void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
+                                const FIXP_QMF  *realSlot,
+                                const FIXP_QMF  *imagSlot,
+                                const int        scaleFactorLowBand,
+                                const int        scaleFactorHighBand,
+                                INT_PCM         *timeOut,
+                                const int        stride,
+                                FIXP_QMF        *pWorkBuffer)
+{
+    C_AALLOC_SCRATCH_START(pFirOut, FIXP_DBL, QMF_SYN_MAX_CHANNELS)
+
+    FDK_ASSERT(synQmf->no_channels <= QMF_SYN_MAX_CHANNELS);
+
+    qmfInverseModulation( synQmf, realSlot, imagSlot, scaleFactorLowBand, scaleFactorHighBand, pWorkBuffer );
 
     if (synQmf->flags & QMF_FLAG_NONSYMMETRIC) {
         qmfSynPrototypeFirSlot_NonSymmetric (
                                  synQmf,
                                  pWorkBuffer,
                                  pWorkBuffer+synQmf->no_channels,
-                                 timeOut,
-                                 stride
+                                 pFirOut
                                );
     } else {
         qmfSynPrototypeFirSlot ( synQmf,
                                  pWorkBuffer,
                                  pWorkBuffer+synQmf->no_channels,
-                                 timeOut,
-                                 stride
+                                 pFirOut
                                );
     }
+
+    qmfSynStoreSlot( synQmf, pFirOut, timeOut, stride );
+
+    C_AALLOC_SCRATCH_END(pFirOut, FIXP_DBL, QMF_SYN_MAX_CHANNELS)
+}
+
+void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
+                                const FIXP_QMF  *realSlot,
+                                const FIXP_QMF  *imagSlot,
+                                const int        scaleFactorLowBand,
+                                const int        scaleFactorHighBand,
+                                FIXP_DBL        *timeOut,
+                                const int        stride,
+                                FIXP_QMF        *pWorkBuffer)
+{
+    C_AALLOC_SCRATCH_START(pFirOut, FIXP_DBL, QMF_SYN_MAX_CHANNELS)
+
+    FDK_ASSERT(synQmf->no_channels <= QMF_SYN_MAX_CHANNELS);
+
+    qmfInverseModulation( synQmf, realSlot, imagSlot, scaleFactorLowBand, scaleFactorHighBand, pWorkBuffer );
+
+    if (synQmf->flags & QMF_FLAG_NONSYMMETRIC) {
+        qmfSynPrototypeFirSlot_NonSymmetric ( synQmf, pWorkBuffer, pWorkBuffer+synQmf->no_channels, pFirOut );
+    } else {
+        qmfSynPrototypeFirSlot ( synQmf, pWorkBuffer, pWorkBuffer+synQmf->no_channels, pFirOut );
+    }
+
+    qmfSynStoreSlot( synQmf, pFirOut, timeOut, stride );
+
+    C_AALLOC_SCRATCH_END(pFirOut, FIXP_DBL, QMF_SYN_MAX_CHANNELS)
 }
 
 
@@ -956,6 +1319,46 @@ qmfSynthesisFiltering( HANDLE_QMF_FILTER_BANK synQmf,       /*!< Handle of Qmf S
 
 }
 
+/*!
+ *
+ * \brief Perform complex-valued subband synthesis of the low band and the
+ *        high band and store a 32 bit time signal in timeOut
+ *
+ */
+void
+qmfSynthesisFiltering( HANDLE_QMF_FILTER_BANK synQmf,       /*!< Handle of Qmf Synthesis Bank  */
+                       FIXP_QMF  **QmfBufferReal,           /*!< Low and High band, real */
+                       FIXP_QMF  **QmfBufferImag,           /*!< Low and High band, imag */
+                       const QMF_SCALE_FACTOR *scaleFactor,
+                       const INT   ov_len,                  /*!< split Slot of overlap and actual slots */
+                       FIXP_DBL   *timeOut,                 /*!< Pointer to output */
+                       const INT   stride,                  /*!< stride factor of output */
+                       FIXP_QMF   *pWorkBuffer              /*!< pointer to temporal working buffer */
+                      )
+{
+  int i;
+  int L = synQmf->no_channels;
+  SCHAR scaleFactorHighBand;
+  SCHAR scaleFactorLowBand_ov, scaleFactorLowBand_no_ov;
+
+  /* adapt scaling */
+  scaleFactorHighBand = -ALGORITHMIC_SCALING_IN_ANALYSIS_FILTERBANK - scaleFactor->hb_scale;
+  scaleFactorLowBand_ov = - ALGORITHMIC_SCALING_IN_ANALYSIS_FILTERBANK - scaleFactor->ov_lb_scale;
+  scaleFactorLowBand_no_ov = - ALGORITHMIC_SCALING_IN_ANALYSIS_FILTERBANK - scaleFactor->lb_scale;
+
+  for (i = 0; i < synQmf->no_col; i++)
+  {
+    qmfSynthesisFilteringSlot(  synQmf,
+                                QmfBufferReal[i],
+                                (synQmf->flags & QMF_FLAG_LP) ? NULL : QmfBufferImag[i],
+                                (i<ov_len) ? scaleFactorLowBand_ov : scaleFactorLowBand_no_ov,
+                                scaleFactorHighBand,
+                                timeOut+(i*L*stride),
+                                stride,
+                                pWorkBuffer);
+  }
+}
+
 
 /*!
  *
@@ -1092,9 +1495,13 @@ qmfInitAnalysisFilterBank (HANDLE_QMF_FILTER_BANK h_Qmf,   /*!< Returns handle *
                            int no_channels,                /*!< Number of channels (bands) */
                            int flags)                      /*!< Low Power flag */
 {
+  UINT timeDbl = h_Qmf->flags & QMF_FLAG_TIME_DBL;
   int err = qmfInitFilterBank(h_Qmf, pFilterStates, noCols, lsb, usb, no_channels, flags);
   if ( !(flags & QMF_FLAG_KEEP_STATES) && (h_Qmf->FilterStates != NULL) ) {
     FDKmemclear(h_Qmf->FilterStates, (2*QMF_NO_POLY-1)*h_Qmf->no_channels*sizeof(FIXP_QAS));
+  } else {
+    /* The kept states are still in the format of the last time signal */
+    h_Qmf->flags |= timeDbl;
   }
 
   return err;
@@ -105,6 +105,9 @@ amm-info@iis.fraunhofer.de
 #elif defined(__arm__)
 #include "arm/scale_arm.cpp"
 
+#elif defined(__x86__)
+#include "x86/scale_x86.cpp"
+
 #endif
 
 #ifndef FUNCTION_scaleValues_SGL
@@ -0,0 +1,960 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: SSE2, SSE4.1 and AVX2 implementations of vector kernels,
+                selected at runtime
+
+******************************************************************************/
+
+#include "common_fix.h"
+
+#if defined(FDK_X86_SIMD)
+
+#include "x86/dispatch_x86.h"
+#include "FDK_cpu.h"
+#include "genericStds.h"
+
+#include <immintrin.h>
+
+
+/*****************************************************************************
+   Plain C implementations. These must not call the dispatched functions of
+   scale.h, scramble.h and cplx_mul.h since these would end up here again.
+*****************************************************************************/
+
+static void scaleValues_SGL_C(FIXP_SGL *vector, INT len, INT scalefactor)
+{
+  INT i;
+
+  if (scalefactor > 0) {
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] <<= scalefactor;
+    }
+  } else if (scalefactor < 0) {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] >>= negScalefactor;
+    }
+  }
+}
+
+static void scaleValues_DBL_C(FIXP_DBL *vector, INT len, INT scalefactor)
+{
+  INT i;
+
+  if (scalefactor > 0) {
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] <<= scalefactor;
+    }
+  } else if (scalefactor < 0) {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] >>= negScalefactor;
+    }
+  }
+}
+
+static void scaleValues_DBLDBL_C(FIXP_DBL *dst, const FIXP_DBL *src, INT len, INT scalefactor)
+{
+  INT i;
+
+  if (scalefactor == 0) {
+    if (dst != src)
+      FDKmemmove(dst, src, len*sizeof(FIXP_DBL));
+  } else if (scalefactor > 0) {
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      dst[i] = src[i] << scalefactor;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      dst[i] = src[i] >> negScalefactor;
+    }
+  }
+}
+
+static void scaleValuesWithFactor_DBL_C(FIXP_DBL *vector, FIXP_DBL factor, INT len, INT scalefactor)
+{
+  INT i;
+
+  /* Compensate fMultDiv2 */
+  scalefactor++;
+
+  if (scalefactor > 0) {
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] = fMultDiv2(vector[i], factor) << scalefactor;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    for (i = 0; i < len; i++) {
+      vector[i] = fMultDiv2(vector[i], factor) >> negScalefactor;
+    }
+  }
+}
+
+static INT getScalefactor_DBL_C(const FIXP_DBL *vector, INT len)
+{
+  INT i;
+  FIXP_DBL temp, maxVal = (FIXP_DBL)0;
+
+  for (i = 0; i < len; i++) {
+    temp = vector[i];
+    maxVal |= (FIXP_DBL)((LONG)temp^(LONG)(temp>>(DFRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(maxVal) - 1));
+}
+
+static INT getScalefactor_SGL_C(const FIXP_SGL *vector, INT len)
+{
+  INT i;
+  SHORT temp, maxVal = (FIXP_SGL)0;
+
+  for (i = 0; i < len; i++) {
+    temp = (SHORT)vector[i];
+    maxVal |= (temp^(temp>>(FRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(FX_SGL2FX_DBL((FIXP_SGL)maxVal)) - 1));
+}
+
+static void scramble_C(FIXP_DBL *x, INT n)
+{
+  INT m,k,j;
+
+  for (m=1,j=0; m<n-1; m++)
+  {
+    {for(k=n>>1; (!((j^=k)&k)); k>>=1);}
+
+    if (j>m)
+    {
+      FIXP_DBL tmp;
+      tmp=x[2*m];
+      x[2*m]=x[2*j];
+      x[2*j]=tmp;
+
+      tmp=x[2*m+1];
+      x[2*m+1]=x[2*j+1];
+      x[2*j+1]=tmp;
+    }
+  }
+}
+
+static void cplxMultVec_32x16_C(FIXP_DBL *c_Re, FIXP_DBL *c_Im,
+                                const FIXP_DBL *a_Re, const FIXP_DBL *a_Im,
+                                const FIXP_SGL *b_Re, const FIXP_SGL *b_Im,
+                                INT len)
+{
+  INT i;
+
+  for (i = 0; i < len; i++) {
+    FIXP_DBL re = a_Re[i], im = a_Im[i];
+    c_Re[i] = fMult(re,b_Re[i]) - fMult(im,b_Im[i]);
+    c_Im[i] = fMult(re,b_Im[i]) + fMult(im,b_Re[i]);
+  }
+}
+
+static void dctIV_preTwiddle_range(FIXP_DBL *pDat, const FIXP_SPK *twiddle, INT L, INT dst, INT i)
+{
+  FIXP_DBL *pDat_0 = &pDat[i];
+  FIXP_DBL *pDat_1 = &pDat[L - 2 - i];
+  INT M = L >> 1;
+
+  for (; i < M-1; i+=2,pDat_0+=2,pDat_1-=2)
+  {
+    FIXP_DBL accu1,accu2,accu3,accu4;
+
+    accu1 = pDat_1[1]; accu2 = pDat_0[0];
+    accu3 = pDat_0[1]; accu4 = pDat_1[0];
+    if (dst) {
+      accu2 = -accu2;
+      accu4 = -accu4;
+    }
+
+    cplxMultDiv2(&accu1, &accu2, accu1, accu2, twiddle[i]);
+    cplxMultDiv2(&accu3, &accu4, accu4, accu3, twiddle[i+1]);
+
+    pDat_0[0] = accu2; pDat_0[1] = accu1;
+    pDat_1[0] = accu4; pDat_1[1] = -accu3;
+  }
+}
+
+/* Pre-twiddle of dct_IV() and dst_IV() for M = L/2 being a multiple of 4. */
+static void dctIV_preTwiddle_C(FIXP_DBL *pDat, const FIXP_SPK *twiddle, INT L, INT dst)
+{
+  dctIV_preTwiddle_range(pDat, twiddle, L, dst, 0);
+}
+
+static void qmfForwardModulationHQ_butterfly_C(const FIXP_DBL *timeIn, FIXP_DBL *rSubband, FIXP_DBL *iSubband, INT L)
+{
+  INT i;
+
+  for (i = 0; i < L; i++) {
+    FIXP_DBL x = timeIn[i] >> 1;
+    FIXP_DBL y = timeIn[2*L - 1 - i] >> 1;
+    rSubband[i] = x - y;
+    iSubband[i] = x + y;
+  }
+}
+
+/* Elementwise operation on overlapping buffers is only safe if dst does not run ahead of src. */
+static inline int isForwardSafe(const FIXP_DBL *dst, const FIXP_DBL *src, INT len)
+{
+  return (dst <= src) || (dst >= src + len);
+}
+
+
+/*****************************************************************************
+   SSE2
+*****************************************************************************/
+
+FDK_X86_TARGET("sse2")
+static void scaleValues_SGL_SSE2(FIXP_SGL *vector, INT len, INT scalefactor)
+{
+  INT i = 0;
+
+  if (scalefactor > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sll_epi16(v, sh));
+    }
+  } else if (scalefactor < 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sra_epi16(v, sh));
+    }
+  }
+  scaleValues_SGL_C(vector+i, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("sse2")
+static void scaleValues_DBL_SSE2(FIXP_DBL *vector, INT len, INT scalefactor)
+{
+  INT i = 0;
+
+  if (scalefactor > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sll_epi32(v, sh));
+    }
+  } else if (scalefactor < 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sra_epi32(v, sh));
+    }
+  }
+  scaleValues_DBL_C(vector+i, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("sse2")
+static void scaleValues_DBLDBL_SSE2(FIXP_DBL *dst, const FIXP_DBL *src, INT len, INT scalefactor)
+{
+  INT i = 0;
+
+  if ( (scalefactor == 0) || !isForwardSafe(dst, src, len) ) {
+    scaleValues_DBLDBL_C(dst, src, len, scalefactor);
+    return;
+  }
+
+  if (scalefactor > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&src[i]);
+      _mm_storeu_si128((__m128i*)&dst[i], _mm_sll_epi32(v, sh));
+    }
+  } else {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&src[i]);
+      _mm_storeu_si128((__m128i*)&dst[i], _mm_sra_epi32(v, sh));
+    }
+  }
+  scaleValues_DBLDBL_C(dst+i, src+i, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("sse2")
+static INT getScalefactor_DBL_SSE2(const FIXP_DBL *vector, INT len)
+{
+  INT i = 0;
+  __m128i acc = _mm_setzero_si128();
+  FIXP_DBL temp, maxVal;
+
+  for (; i <= len-4; i += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    acc = _mm_or_si128(acc, _mm_xor_si128(v, _mm_srai_epi32(v, DFRACT_BITS-1)));
+  }
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1,0,3,2)));
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2,3,0,1)));
+  maxVal = (FIXP_DBL)_mm_cvtsi128_si32(acc);
+
+  for (; i < len; i++) {
+    temp = vector[i];
+    maxVal |= (FIXP_DBL)((LONG)temp^(LONG)(temp>>(DFRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(maxVal) - 1));
+}
+
+FDK_X86_TARGET("sse2")
+static INT getScalefactor_SGL_SSE2(const FIXP_SGL *vector, INT len)
+{
+  INT i = 0;
+  __m128i acc = _mm_setzero_si128();
+  SHORT temp, maxVal;
+
+  for (; i <= len-8; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    acc = _mm_or_si128(acc, _mm_xor_si128(v, _mm_srai_epi16(v, FRACT_BITS-1)));
+  }
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1,0,3,2)));
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2,3,0,1)));
+  acc = _mm_or_si128(acc, _mm_srli_epi32(acc, 16));
+  maxVal = (SHORT)_mm_cvtsi128_si32(acc);
+
+  for (; i < len; i++) {
+    temp = (SHORT)vector[i];
+    maxVal |= (temp^(temp>>(FRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(FX_SGL2FX_DBL((FIXP_SGL)maxVal)) - 1));
+}
+
+/* Swap the complex values as a whole with 64 bit moves. */
+FDK_X86_TARGET("sse2")
+static void scramble_SSE2(FIXP_DBL *x, INT n)
+{
+  INT m,k,j;
+
+  for (m=1,j=0; m<n-1; m++)
+  {
+    {for(k=n>>1; (!((j^=k)&k)); k>>=1);}
+
+    if (j>m)
+    {
+      __m128i a = _mm_loadl_epi64((const __m128i*)&x[2*m]);
+      __m128i b = _mm_loadl_epi64((const __m128i*)&x[2*j]);
+      _mm_storel_epi64((__m128i*)&x[2*m], b);
+      _mm_storel_epi64((__m128i*)&x[2*j], a);
+    }
+  }
+}
+
+/* Convert 4 FIXP_SGL values into FIXP_DBL (FX_SGL2FX_DBL). */
+FDK_X86_TARGET("sse2")
+static inline __m128i loadSgl4(const FIXP_SGL *p)
+{
+  return _mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i*)p));
+}
+
+
+FDK_X86_TARGET("sse2")
+static void qmfForwardModulationHQ_butterfly_SSE2(const FIXP_DBL *timeIn, FIXP_DBL *rSubband, FIXP_DBL *iSubband, INT L)
+{
+  INT i;
+
+  for (i = 0; i + 4 <= L; i += 4) {
+    __m128i x = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)&timeIn[i]), 1);
+    __m128i y = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)&timeIn[2*L - 4 - i]), 1);
+    y = _mm_shuffle_epi32(y, _MM_SHUFFLE(0,1,2,3));
+    _mm_storeu_si128((__m128i*)&rSubband[i], _mm_sub_epi32(x, y));
+    _mm_storeu_si128((__m128i*)&iSubband[i], _mm_add_epi32(x, y));
+  }
+  for (; i < L; i++) {
+    FIXP_DBL x = timeIn[i] >> 1;
+    FIXP_DBL y = timeIn[2*L - 1 - i] >> 1;
+    rSubband[i] = x - y;
+    iSubband[i] = x + y;
+  }
+}
+
+/*
+  One half of the analysis prototype FIR of one slot, n being a multiple of 8:
+  out[-t] = 2 * sum_p c_t[p] * sta[t + p*staStep], p = 0..4.
+  The coefficients of output t are packed pairwise into coef[t] = {c_t[0], c_t[1]},
+  coef[n+t] = {c_t[2], c_t[3]} and coef[2*n+t] = {c_t[4], 0}. All products are
+  exact 16x16 bit products, so pmaddwd yields the same result as the C code.
+*/
+FDK_X86_TARGET("sse2")
+static void qmfAnaPrototypeFirPart_SSE2(FIXP_DBL *out, const SHORT *sta, INT staStep, const INT *coef, INT n)
+{
+  INT t;
+  __m128i zero = _mm_setzero_si128();
+
+  for (t = 0; t < n; t += 8) {
+    const SHORT *s = sta + t;
+    __m128i s0 = _mm_loadu_si128((const __m128i*)(s));
+    __m128i s1 = _mm_loadu_si128((const __m128i*)(s + staStep));
+    __m128i s2 = _mm_loadu_si128((const __m128i*)(s + 2*staStep));
+    __m128i s3 = _mm_loadu_si128((const __m128i*)(s + 3*staStep));
+    __m128i s4 = _mm_loadu_si128((const __m128i*)(s + 4*staStep));
+    __m128i lo, hi;
+
+    lo = _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), _mm_loadu_si128((const __m128i*)&coef[t]));
+    hi = _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), _mm_loadu_si128((const __m128i*)&coef[t+4]));
+    lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s2, s3), _mm_loadu_si128((const __m128i*)&coef[n+t])));
+    hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s2, s3), _mm_loadu_si128((const __m128i*)&coef[n+t+4])));
+    lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s4, zero), _mm_loadu_si128((const __m128i*)&coef[2*n+t])));
+    hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s4, zero), _mm_loadu_si128((const __m128i*)&coef[2*n+t+4])));
+
+    lo = _mm_shuffle_epi32(_mm_slli_epi32(lo, 1), _MM_SHUFFLE(0,1,2,3));
+    hi = _mm_shuffle_epi32(_mm_slli_epi32(hi, 1), _MM_SHUFFLE(0,1,2,3));
+    _mm_storeu_si128((__m128i*)(out - t - 3), lo);
+    _mm_storeu_si128((__m128i*)(out - t - 7), hi);
+  }
+}
+
+
+/*****************************************************************************
+   SSE4.1
+*****************************************************************************/
+
+/* Upper 32 bit of the signed 64 bit products, i.e. fixmuldiv2_DD() for 4 values. */
+FDK_X86_TARGET("sse4.1")
+static inline __m128i mulhi_epi32_SSE41(__m128i a, __m128i b)
+{
+  __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+  __m128i odd  = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_blend_epi16(even, odd, 0xCC);
+}
+
+FDK_X86_TARGET("sse4.1")
+static void scaleValuesWithFactor_DBL_SSE41(FIXP_DBL *vector, FIXP_DBL factor, INT len, INT scalefactor)
+{
+  INT i = 0;
+  __m128i f = _mm_set1_epi32(factor);
+  INT sf = scalefactor + 1;
+
+  if (sf > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(sf,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sll_epi32(mulhi_epi32_SSE41(v, f), sh));
+    }
+  } else {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-sf,(INT)DFRACT_BITS-1));
+    for (; i <= len-4; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+      _mm_storeu_si128((__m128i*)&vector[i], _mm_sra_epi32(mulhi_epi32_SSE41(v, f), sh));
+    }
+  }
+  scaleValuesWithFactor_DBL_C(vector+i, factor, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("sse4.1")
+static void cplxMultVec_32x16_SSE41(FIXP_DBL *c_Re, FIXP_DBL *c_Im,
+                                    const FIXP_DBL *a_Re, const FIXP_DBL *a_Im,
+                                    const FIXP_SGL *b_Re, const FIXP_SGL *b_Im,
+                                    INT len)
+{
+  INT i = 0;
+
+  for (; i <= len-4; i += 4) {
+    __m128i re = _mm_loadu_si128((const __m128i*)&a_Re[i]);
+    __m128i im = _mm_loadu_si128((const __m128i*)&a_Im[i]);
+    __m128i wr = loadSgl4(&b_Re[i]);
+    __m128i wi = loadSgl4(&b_Im[i]);
+    __m128i r = _mm_sub_epi32(_mm_slli_epi32(mulhi_epi32_SSE41(re, wr), 1),
+                              _mm_slli_epi32(mulhi_epi32_SSE41(im, wi), 1));
+    __m128i j = _mm_add_epi32(_mm_slli_epi32(mulhi_epi32_SSE41(re, wi), 1),
+                              _mm_slli_epi32(mulhi_epi32_SSE41(im, wr), 1));
+    _mm_storeu_si128((__m128i*)&c_Re[i], r);
+    _mm_storeu_si128((__m128i*)&c_Im[i], j);
+  }
+  cplxMultVec_32x16_C(c_Re+i, c_Im+i, a_Re+i, a_Im+i, b_Re+i, b_Im+i, len-i);
+}
+
+/* FIXP_SPK values as FIXP_DBL: real part and imaginary part. */
+FDK_X86_TARGET("sse4.1")
+static inline __m128i spkRe(__m128i w)
+{
+  return _mm_slli_epi32(w, 16);
+}
+
+FDK_X86_TARGET("sse4.1")
+static inline __m128i spkIm(__m128i w)
+{
+  return _mm_and_si128(w, _mm_set1_epi32((INT)0xFFFF0000));
+}
+
+/*
+  Four iterations of the pre-twiddle loop at once. The front values are
+  deinterleaved into a[n], b[n], the mirrored back values into c[n], d[n].
+*/
+FDK_X86_TARGET("sse4.1")
+static void dctIV_preTwiddle_SSE41(FIXP_DBL *pDat, const FIXP_SPK *twiddle, INT L, INT dst)
+{
+  INT i;
+  INT M = L >> 1;
+  __m128i zero = _mm_setzero_si128();
+
+  for (i = 0; i+8 <= M; i += 8) {
+    FIXP_DBL *pB = &pDat[L - 8 - i];
+    __m128 f0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&pDat[i]));
+    __m128 f1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&pDat[i+4]));
+    __m128 b1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&pB[0]));
+    __m128 b0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&pB[4]));
+    __m128 t0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&twiddle[i]));
+    __m128 t1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)&twiddle[i+4]));
+
+    __m128i a  = _mm_castps_si128(_mm_shuffle_ps(f0, f1, _MM_SHUFFLE(2,0,2,0)));
+    __m128i b  = _mm_castps_si128(_mm_shuffle_ps(f0, f1, _MM_SHUFFLE(3,1,3,1)));
+    __m128i c  = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(0,2,0,2)));
+    __m128i d  = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(1,3,1,3)));
+    __m128i te = _mm_castps_si128(_mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2,0,2,0)));
+    __m128i to = _mm_castps_si128(_mm_shuffle_ps(t0, t1, _MM_SHUFFLE(3,1,3,1)));
+    __m128i reE = spkRe(te), imE = spkIm(te);
+    __m128i reO = spkRe(to), imO = spkIm(to);
+    __m128i fe, fo, bc, bd;
+
+    if (dst) {
+      a = _mm_sub_epi32(zero, a);
+      c = _mm_sub_epi32(zero, c);
+    }
+
+    fe = _mm_add_epi32(mulhi_epi32_SSE41(d, imE), mulhi_epi32_SSE41(a, reE));
+    fo = _mm_sub_epi32(mulhi_epi32_SSE41(d, reE), mulhi_epi32_SSE41(a, imE));
+    bc = _mm_add_epi32(mulhi_epi32_SSE41(c, imO), mulhi_epi32_SSE41(b, reO));
+    bd = _mm_sub_epi32(mulhi_epi32_SSE41(b, imO), mulhi_epi32_SSE41(c, reO));
+
+    _mm_storeu_si128((__m128i*)&pDat[i],   _mm_unpacklo_epi32(fe, fo));
+    _mm_storeu_si128((__m128i*)&pDat[i+4], _mm_unpackhi_epi32(fe, fo));
+    _mm_storeu_si128((__m128i*)&pB[4], _mm_shuffle_epi32(_mm_unpacklo_epi32(bc, bd), _MM_SHUFFLE(1,0,3,2)));
+    _mm_storeu_si128((__m128i*)&pB[0], _mm_shuffle_epi32(_mm_unpackhi_epi32(bc, bd), _MM_SHUFFLE(1,0,3,2)));
+  }
+  dctIV_preTwiddle_range(pDat, twiddle, L, dst, i);
+}
+
+/*
+  State update of the synthesis prototype FIR for all channels of one slot.
+  The 8 states sta[0..7] of a channel are updated with one vector operation,
+  the coefficient vector is {p_flt[4], p_fltm[1], p_flt[3], p_fltm[2], ...}
+  applied to {imag, real, imag, real, ...}.
+*/
+FDK_X86_TARGET("sse4.1")
+static void qmfSynPrototypeFirStates_SSE41(FIXP_DBL *sta,
+                                           const FIXP_DBL *realSlot, const FIXP_DBL *imagSlot,
+                                           const FIXP_SGL *p_flt, const FIXP_SGL *p_fltm,
+                                           INT fltStep, INT fltmStep, INT no_channels, INT nonSymmetric)
+{
+  INT j;
+  __m128i zero = _mm_setzero_si128();
+
+  for (j = no_channels-1; j >= 0; j--) {
+    FIXP_DBL imag = imagSlot[j];
+    FIXP_DBL real = realSlot[j];
+    __m128i f, m, c, x, s0, s1;
+
+    f = _mm_shufflelo_epi16(_mm_loadl_epi64((const __m128i*)&p_flt[1]), _MM_SHUFFLE(0,1,2,3));
+    if (nonSymmetric) {
+      m = _mm_shufflelo_epi16(_mm_loadl_epi64((const __m128i*)&p_fltm[0]), _MM_SHUFFLE(0,1,2,3));
+    } else {
+      m = _mm_loadl_epi64((const __m128i*)&p_fltm[1]);
+    }
+    c = _mm_unpacklo_epi16(f, m);
+    x = _mm_set_epi32(real, imag, real, imag);
+
+    s0 = _mm_loadu_si128((const __m128i*)&sta[1]);
+    s1 = _mm_loadu_si128((const __m128i*)&sta[5]);
+    s0 = _mm_add_epi32(s0, mulhi_epi32_SSE41(_mm_unpacklo_epi16(zero, c), x));
+    s1 = _mm_add_epi32(s1, mulhi_epi32_SSE41(_mm_unpackhi_epi16(zero, c), x));
+    _mm_storeu_si128((__m128i*)&sta[0], s0);
+    _mm_storeu_si128((__m128i*)&sta[4], s1);
+    sta[8] = fMultDiv2(p_flt[0], imag);
+
+    p_flt  += fltStep;
+    p_fltm += fltmStep;
+    sta    += 9;
+  }
+}
+
+
+/*****************************************************************************
+   AVX2
+*****************************************************************************/
+
+FDK_X86_TARGET("avx2")
+static inline __m256i mulhi_epi32_AVX2(__m256i a, __m256i b)
+{
+  __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+  __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+  return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+/* Convert 8 FIXP_SGL values into FIXP_DBL (FX_SGL2FX_DBL). */
+FDK_X86_TARGET("avx2")
+static inline __m256i loadSgl8(const FIXP_SGL *p)
+{
+  return _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)p)), 16);
+}
+
+FDK_X86_TARGET("avx2")
+static void scaleValues_DBL_AVX2(FIXP_DBL *vector, INT len, INT scalefactor)
+{
+  INT i = 0;
+
+  if (scalefactor > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      _mm256_storeu_si256((__m256i*)&vector[i], _mm256_sll_epi32(v, sh));
+    }
+  } else if (scalefactor < 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      _mm256_storeu_si256((__m256i*)&vector[i], _mm256_sra_epi32(v, sh));
+    }
+  }
+  scaleValues_DBL_C(vector+i, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("avx2")
+static void scaleValues_DBLDBL_AVX2(FIXP_DBL *dst, const FIXP_DBL *src, INT len, INT scalefactor)
+{
+  INT i = 0;
+
+  if ( (scalefactor == 0) || !isForwardSafe(dst, src, len) ) {
+    scaleValues_DBLDBL_C(dst, src, len, scalefactor);
+    return;
+  }
+
+  if (scalefactor > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&src[i]);
+      _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sll_epi32(v, sh));
+    }
+  } else {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-scalefactor,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&src[i]);
+      _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sra_epi32(v, sh));
+    }
+  }
+  scaleValues_DBLDBL_C(dst+i, src+i, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("avx2")
+static INT getScalefactor_DBL_AVX2(const FIXP_DBL *vector, INT len)
+{
+  INT i = 0;
+  __m256i acc = _mm256_setzero_si256();
+  __m128i acc4;
+  FIXP_DBL temp, maxVal;
+
+  for (; i <= len-8; i += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)&vector[i]);
+    acc = _mm256_or_si256(acc, _mm256_xor_si256(v, _mm256_srai_epi32(v, DFRACT_BITS-1)));
+  }
+  acc4 = _mm_or_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+  acc4 = _mm_or_si128(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(1,0,3,2)));
+  acc4 = _mm_or_si128(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(2,3,0,1)));
+  maxVal = (FIXP_DBL)_mm_cvtsi128_si32(acc4);
+
+  for (; i < len; i++) {
+    temp = vector[i];
+    maxVal |= (FIXP_DBL)((LONG)temp^(LONG)(temp>>(DFRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(maxVal) - 1));
+}
+
+FDK_X86_TARGET("avx2")
+static void scaleValuesWithFactor_DBL_AVX2(FIXP_DBL *vector, FIXP_DBL factor, INT len, INT scalefactor)
+{
+  INT i = 0;
+  __m256i f = _mm256_set1_epi32(factor);
+  INT sf = scalefactor + 1;
+
+  if (sf > 0) {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(sf,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      _mm256_storeu_si256((__m256i*)&vector[i], _mm256_sll_epi32(mulhi_epi32_AVX2(v, f), sh));
+    }
+  } else {
+    __m128i sh = _mm_cvtsi32_si128(fixmin_I(-sf,(INT)DFRACT_BITS-1));
+    for (; i <= len-8; i += 8) {
+      __m256i v = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      _mm256_storeu_si256((__m256i*)&vector[i], _mm256_sra_epi32(mulhi_epi32_AVX2(v, f), sh));
+    }
+  }
+  scaleValuesWithFactor_DBL_C(vector+i, factor, len-i, scalefactor);
+}
+
+FDK_X86_TARGET("avx2")
+static void cplxMultVec_32x16_AVX2(FIXP_DBL *c_Re, FIXP_DBL *c_Im,
+                                   const FIXP_DBL *a_Re, const FIXP_DBL *a_Im,
+                                   const FIXP_SGL *b_Re, const FIXP_SGL *b_Im,
+                                   INT len)
+{
+  INT i = 0;
+
+  for (; i <= len-8; i += 8) {
+    __m256i re = _mm256_loadu_si256((const __m256i*)&a_Re[i]);
+    __m256i im = _mm256_loadu_si256((const __m256i*)&a_Im[i]);
+    __m256i wr = loadSgl8(&b_Re[i]);
+    __m256i wi = loadSgl8(&b_Im[i]);
+    __m256i r = _mm256_sub_epi32(_mm256_slli_epi32(mulhi_epi32_AVX2(re, wr), 1),
+                                 _mm256_slli_epi32(mulhi_epi32_AVX2(im, wi), 1));
+    __m256i j = _mm256_add_epi32(_mm256_slli_epi32(mulhi_epi32_AVX2(re, wi), 1),
+                                 _mm256_slli_epi32(mulhi_epi32_AVX2(im, wr), 1));
+    _mm256_storeu_si256((__m256i*)&c_Re[i], r);
+    _mm256_storeu_si256((__m256i*)&c_Im[i], j);
+  }
+  cplxMultVec_32x16_C(c_Re+i, c_Im+i, a_Re+i, a_Im+i, b_Re+i, b_Im+i, len-i);
+}
+
+FDK_X86_TARGET("avx2")
+static void qmfSynPrototypeFirStates_AVX2(FIXP_DBL *sta,
+                                          const FIXP_DBL *realSlot, const FIXP_DBL *imagSlot,
+                                          const FIXP_SGL *p_flt, const FIXP_SGL *p_fltm,
+                                          INT fltStep, INT fltmStep, INT no_channels, INT nonSymmetric)
+{
+  INT j;
+
+  for (j = no_channels-1; j >= 0; j--) {
+    FIXP_DBL imag = imagSlot[j];
+    FIXP_DBL real = realSlot[j];
+    __m128i f, m;
+    __m256i c, x, s;
+
+    f = _mm_shufflelo_epi16(_mm_loadl_epi64((const __m128i*)&p_flt[1]), _MM_SHUFFLE(0,1,2,3));
+    if (nonSymmetric) {
+      m = _mm_shufflelo_epi16(_mm_loadl_epi64((const __m128i*)&p_fltm[0]), _MM_SHUFFLE(0,1,2,3));
+    } else {
+      m = _mm_loadl_epi64((const __m128i*)&p_fltm[1]);
+    }
+    c = _mm256_slli_epi32(_mm256_cvtepi16_epi32(_mm_unpacklo_epi16(f, m)), 16);
+    x = _mm256_set_epi32(real, imag, real, imag, real, imag, real, imag);
+
+    s = _mm256_loadu_si256((const __m256i*)&sta[1]);
+    _mm256_storeu_si256((__m256i*)&sta[0], _mm256_add_epi32(s, mulhi_epi32_AVX2(c, x)));
+    sta[8] = fMultDiv2(p_flt[0], imag);
+
+    p_flt  += fltStep;
+    p_fltm += fltmStep;
+    sta    += 9;
+  }
+}
+
+/*
+  Inverse quantization of n spectral lines, n being a multiple of 8, see InverseQuantizeBand() of
+  the AAC decoder: x = sign(x) * |x|^(4/3) * 2^(lsb/4) for quantized values |x| < 2^14. The
+  exponent of |x| is taken from the float conversion, which is exact in that range. The interpolation
+  points and the per exponent factors are gathered, so the result is identical to the C code.
+*/
+FDK_X86_TARGET("avx2")
+static void inverseQuantizeBand_AVX2(FIXP_DBL *spectrum, INT n,
+                                     const FIXP_DBL *invQuantTable,
+                                     const FIXP_DBL *mantissaTable,
+                                     const SCHAR *exponentTable,
+                                     INT scale)
+{
+  INT i;
+  INT shiftTable[14];
+  const __m256i biasExp = _mm256_set1_epi32(127 - 1);
+  const __m256i shift33 = _mm256_set1_epi32(33);
+  const __m256i mask4   = _mm256_set1_epi32(0x0F);
+  const __m256i one     = _mm256_set1_epi32(1);
+  const __m256i zero    = _mm256_setzero_si256();
+
+  /* + 1 compensates fMultDiv2() */
+  for (i = 0; i < 14; i++) {
+    shiftTable[i] = scale + exponentTable[i] + 1;
+  }
+
+  for (i = 0; i < n; i += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)&spectrum[i]);
+    __m256i a = _mm256_abs_epi32(v);
+    __m256i e, x, t, f, r0, r1, m, sh, val;
+
+    /* exponent = 32 - clz(a), 0 for a == 0 */
+    e = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(a)), 23), biasExp);
+    e = _mm256_andnot_si256(_mm256_cmpeq_epi32(a, zero), e);
+
+    /* Normalize and drop the leading one bit */
+    x = _mm256_sllv_epi32(a, _mm256_sub_epi32(shift33, e));
+    t = _mm256_srli_epi32(x, 24);
+    f = _mm256_and_si256(_mm256_srli_epi32(x, 20), mask4);
+
+    r0 = _mm256_i32gather_epi32((const int*)invQuantTable, t, 4);
+    r1 = _mm256_i32gather_epi32((const int*)invQuantTable, _mm256_add_epi32(t, one), 4);
+    x  = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(r1, r0), f), _mm256_slli_epi32(r0, 4));
+
+    m   = _mm256_i32gather_epi32((const int*)mantissaTable, e, 4);
+    sh  = _mm256_i32gather_epi32((const int*)shiftTable, e, 4);
+    val = mulhi_epi32_AVX2(x, m);
+
+    /* scaleValueInPlace() */
+    val = _mm256_sllv_epi32(val, _mm256_max_epi32(sh, zero));
+    val = _mm256_srav_epi32(val, _mm256_max_epi32(_mm256_sub_epi32(zero, sh), zero));
+
+    /* Apply the sign, zero lines stay zero */
+    _mm256_storeu_si256((__m256i*)&spectrum[i], _mm256_sign_epi32(val, v));
+  }
+}
+
+
+/*****************************************************************************
+   Kernel selection
+*****************************************************************************/
+
+FDK_X86_KERNELS FDK_x86Kernels =
+{
+  scaleValues_SGL_C,
+  scaleValues_DBL_C,
+  scaleValues_DBLDBL_C,
+  scaleValuesWithFactor_DBL_C,
+  getScalefactor_DBL_C,
+  getScalefactor_SGL_C,
+  scramble_C,
+  cplxMultVec_32x16_C,
+  dctIV_preTwiddle_C,
+  qmfForwardModulationHQ_butterfly_C,
+  NULL,
+  NULL,
+  NULL
+};
+
+void FDK_x86InitKernels(UINT cpuFeatures)
+{
+  FDK_X86_KERNELS k;
+
+  k.scaleValues_SGL           = scaleValues_SGL_C;
+  k.scaleValues_DBL           = scaleValues_DBL_C;
+  k.scaleValues_DBLDBL        = scaleValues_DBLDBL_C;
+  k.scaleValuesWithFactor_DBL = scaleValuesWithFactor_DBL_C;
+  k.getScalefactor_DBL        = getScalefactor_DBL_C;
+  k.getScalefactor_SGL        = getScalefactor_SGL_C;
+  k.scramble                  = scramble_C;
+  k.cplxMultVec_32x16         = cplxMultVec_32x16_C;
+  k.dctIV_preTwiddle          = dctIV_preTwiddle_C;
+  k.qmfForwardModulationHQ_butterfly = qmfForwardModulationHQ_butterfly_C;
+  k.qmfSynPrototypeFirStates  = NULL;
+  k.qmfAnaPrototypeFirPart    = NULL;
+  k.inverseQuantizeBand       = NULL;
+
+  if (cpuFeatures & FDK_CPU_SSE2) {
+    k.scaleValues_SGL           = scaleValues_SGL_SSE2;
+    k.scaleValues_DBL           = scaleValues_DBL_SSE2;
+    k.scaleValues_DBLDBL        = scaleValues_DBLDBL_SSE2;
+    k.getScalefactor_DBL        = getScalefactor_DBL_SSE2;
+    k.getScalefactor_SGL        = getScalefactor_SGL_SSE2;
+    k.scramble                  = scramble_SSE2;
+    k.qmfForwardModulationHQ_butterfly = qmfForwardModulationHQ_butterfly_SSE2;
+    k.qmfAnaPrototypeFirPart    = qmfAnaPrototypeFirPart_SSE2;
+  }
+
+  if (cpuFeatures & FDK_CPU_SSE41) {
+    k.scaleValuesWithFactor_DBL = scaleValuesWithFactor_DBL_SSE41;
+    k.cplxMultVec_32x16         = cplxMultVec_32x16_SSE41;
+    k.dctIV_preTwiddle          = dctIV_preTwiddle_SSE41;
+    k.qmfSynPrototypeFirStates  = qmfSynPrototypeFirStates_SSE41;
+  }
+
+  if (cpuFeatures & FDK_CPU_AVX2) {
+    k.scaleValues_DBL           = scaleValues_DBL_AVX2;
+    k.scaleValues_DBLDBL        = scaleValues_DBLDBL_AVX2;
+    k.getScalefactor_DBL        = getScalefactor_DBL_AVX2;
+    k.scaleValuesWithFactor_DBL = scaleValuesWithFactor_DBL_AVX2;
+    k.cplxMultVec_32x16         = cplxMultVec_32x16_AVX2;
+    k.qmfSynPrototypeFirStates  = qmfSynPrototypeFirStates_AVX2;
+    k.inverseQuantizeBand       = inverseQuantizeBand_AVX2;
+  }
+
+  FDK_x86Kernels = k;
+}
+
+#endif /* FDK_X86_SIMD */
@@ -0,0 +1,297 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: QMF analysis and synthesis prototype filter for x86, dispatched at runtime
+
+   Only the prototype filters and the butterfly of the complex forward
+   modulation have vector kernels. The modulation itself is still mostly
+   scalar: of the DCT-IV/DST-IV only the pre-twiddle is vectorized (see
+   dct_x86.cpp), while the FFT and the post-twiddle run the generic code.
+   The real valued (low power) modulation with dct_II() and dct_III() has
+   no x86 path at all.
+
+******************************************************************************/
+
+#if defined(FDK_X86_SIMD) && defined(QMF_COEFF_16BIT) && !defined(QMF_DATA_16BIT) && !defined(QMFSYN_STATES_16BIT)
+
+#include "x86/dispatch_x86.h"
+
+#define FUNCTION_qmfSynPrototypeFirSlot
+#define FUNCTION_qmfSynPrototypeFirSlot_NonSymmetric
+#define FUNCTION_qmfForwardModulationHQ_butterfly
+
+#if (SAMPLE_BITS == 16)
+#define FUNCTION_qmfAnaPrototypeFirBlock
+
+static
+void qmfAnaPrototypeFirBlock_fallback( HANDLE_QMF_FILTER_BANK anaQmf,
+                              FIXP_QMF *analysisBuffer,
+                              FIXP_QAS *pFilterStates,
+                              int       nSlots
+                             );
+#endif
+
+static
+void qmfSynPrototypeFirSlot_fallback( HANDLE_QMF_FILTER_BANK qmf,
+                             FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
+                             FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
+                            );
+
+static
+void qmfSynPrototypeFirSlot_NonSymmetric_fallback( HANDLE_QMF_FILTER_BANK qmf,
+                             FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
+                             FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
+                            );
+
+/*!
+  \brief Perform Synthesis Prototype Filtering on a single slot of input data.
+
+  The filter output only depends on the first filter state of each channel.
+  It is calculated for all channels first, the update of the remaining
+  filter states is done by the vector kernel afterwards.
+*/
+static
+void qmfSynPrototypeFirSlot( HANDLE_QMF_FILTER_BANK qmf,
+                             FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
+                             FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
+                            )
+{
+  FIXP_QSS *FilterStates = (FIXP_QSS*)qmf->FilterStates;
+  int       no_channels = qmf->no_channels;
+  int       pfltStep = qmf->p_stride*QMF_NO_POLY;
+  const FIXP_PFT *p_fltm;
+  FIXP_QSS *RESTRICT sta = FilterStates;
+  int j;
+
+  if (FDK_x86Kernels.qmfSynPrototypeFirStates == NULL) {
+    qmfSynPrototypeFirSlot_fallback(qmf, realSlot, imagSlot, pFirOut);
+    return;
+  }
+
+  p_fltm = qmf->p_filter+(qmf->FilterSize/2)-pfltStep;
+
+  for (j = no_channels-1; j >= 0; j--) {
+    pFirOut[j] = sta[0] + fMultDiv2( p_fltm[0] , realSlot[j]);
+
+    p_fltm -= pfltStep;
+    sta    += 9;
+  }
+
+  FDK_x86Kernels.qmfSynPrototypeFirStates( FilterStates, realSlot, imagSlot,
+                                           qmf->p_filter+pfltStep, qmf->p_filter+(qmf->FilterSize/2)-pfltStep,
+                                           pfltStep, -pfltStep, no_channels, 0 );
+}
+
+/*!
+  \brief Perform Synthesis Prototype Filtering on a single slot of input data
+         for the non symmetric filter prototypes.
+*/
+static
+void qmfSynPrototypeFirSlot_NonSymmetric( HANDLE_QMF_FILTER_BANK qmf,
+                             FIXP_QMF *RESTRICT realSlot,            /*!< Input: Pointer to real Slot */
+                             FIXP_QMF *RESTRICT imagSlot,            /*!< Input: Pointer to imag Slot */
+                             FIXP_DBL *RESTRICT pFirOut              /*!< Filter output */
+                            )
+{
+  FIXP_QSS *FilterStates = (FIXP_QSS*)qmf->FilterStates;
+  int       no_channels = qmf->no_channels;
+  int       pfltStep = qmf->p_stride*QMF_NO_POLY;
+  const FIXP_PFT *p_fltm;
+  FIXP_QSS *RESTRICT sta = FilterStates;
+  int j;
+
+  if (FDK_x86Kernels.qmfSynPrototypeFirStates == NULL) {
+    qmfSynPrototypeFirSlot_NonSymmetric_fallback(qmf, realSlot, imagSlot, pFirOut);
+    return;
+  }
+
+  p_fltm = &qmf->p_filter[qmf->FilterSize/2];
+
+  for (j = no_channels-1; j >= 0; j--) {
+    pFirOut[j] = sta[0] + fMultDiv2( p_fltm[4] , realSlot[j] );
+
+    p_fltm += pfltStep;
+    sta    += 9;
+  }
+
+  FDK_x86Kernels.qmfSynPrototypeFirStates( FilterStates, realSlot, imagSlot,
+                                           qmf->p_filter, &qmf->p_filter[qmf->FilterSize/2],
+                                           pfltStep, pfltStep, no_channels, 1 );
+}
+
+/*!
+  \brief Butterfly of the time domain data preceding the DCT-IV and DST-IV
+         of the complex forward modulation.
+*/
+static inline void
+qmfForwardModulationHQ_butterfly( const FIXP_QMF *RESTRICT timeIn,   /*!< Time Signal */
+                                  FIXP_QMF *RESTRICT rSubband,       /*!< Real Output */
+                                  FIXP_QMF *RESTRICT iSubband,       /*!< Imaginary Output */
+                                  int L                              /*!< Number of channels */
+                                 )
+{
+  FDK_x86Kernels.qmfForwardModulationHQ_butterfly(timeIn, rSubband, iSubband, L);
+}
+
+#if defined(FUNCTION_qmfAnaPrototypeFirBlock)
+
+/*!
+  \brief Pack the 5 coefficients of n prototype filter rows pairwise for
+         the analysis FIR kernel. Row t starts at p_flt + t*fltStep.
+*/
+static
+void qmfAnaPackCoefficients( INT *coef,
+                             const FIXP_PFT *p_flt,
+                             int fltStep,
+                             int n
+                            )
+{
+  int t;
+
+  for (t = 0; t < n; t++) {
+    coef[t]     = (INT)( (UINT)(USHORT)p_flt[0] | ((UINT)(USHORT)p_flt[1] << 16) );
+    coef[n+t]   = (INT)( (UINT)(USHORT)p_flt[2] | ((UINT)(USHORT)p_flt[3] << 16) );
+    coef[2*n+t] = (INT)( (UINT)(USHORT)p_flt[4] );
+    p_flt += fltStep;
+  }
+}
+
+/*!
+  \brief Perform Analysis Prototype Filtering on a block of consecutive slots.
+
+  The filter coefficients are rearranged once per block, so that the FIR
+  kernel can compute 8 neighbouring outputs of a slot with vector operations.
+*/
+static
+void qmfAnaPrototypeFirBlock( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Analysis Bank */
+                              FIXP_QMF *analysisBuffer,       /*!< Filter output of all slots */
+                              FIXP_QAS *pFilterStates,        /*!< Filter states of the first slot */
+                              int       nSlots                /*!< Number of slots */
+                             )
+{
+  int i;
+  int no_channels = anaQmf->no_channels;
+  int pfltStep = QMF_NO_POLY * anaQmf->p_stride;
+  INT coef[3*2*QMF_ANA_MAX_CHANNELS];
+
+  if ( (FDK_x86Kernels.qmfAnaPrototypeFirPart == NULL) || (no_channels & 7) ) {
+    qmfAnaPrototypeFirBlock_fallback(anaQmf, analysisBuffer, pFilterStates, nSlots);
+    return;
+  }
+
+  if (anaQmf->flags & QMF_FLAG_NONSYMMETRIC) {
+    /* Outputs 2*no_channels-1..0 use rows 0..2*no_channels-1 */
+    qmfAnaPackCoefficients(coef, anaQmf->p_filter + pfltStep - QMF_NO_POLY, pfltStep, 2*no_channels);
+
+    for (i = 0; i < nSlots; i++) {
+      FDK_x86Kernels.qmfAnaPrototypeFirPart(analysisBuffer + 2*no_channels - 1, pFilterStates,
+                                            2*no_channels, coef, 2*no_channels);
+      analysisBuffer += 2*no_channels;
+      pFilterStates  += no_channels;
+    }
+  } else {
+    /* Outputs 2*no_channels-1..no_channels use rows 1..no_channels,
+       outputs no_channels-1..0 use rows no_channels-1..0 on the mirrored states */
+    qmfAnaPackCoefficients(coef, anaQmf->p_filter + pfltStep, pfltStep, no_channels);
+    qmfAnaPackCoefficients(coef + 3*no_channels, anaQmf->p_filter + (no_channels-1)*pfltStep, -pfltStep, no_channels);
+
+    for (i = 0; i < nSlots; i++) {
+      FDK_x86Kernels.qmfAnaPrototypeFirPart(analysisBuffer + 2*no_channels - 1, pFilterStates,
+                                            2*no_channels, coef, no_channels);
+      FDK_x86Kernels.qmfAnaPrototypeFirPart(analysisBuffer + no_channels - 1, pFilterStates + 9*no_channels,
+                                            -2*no_channels, coef + 3*no_channels, no_channels);
+      analysisBuffer += 2*no_channels;
+      pFilterStates  += no_channels;
+    }
+  }
+}
+
+#endif /* FUNCTION_qmfAnaPrototypeFirBlock */
+
+#endif /* FDK_X86_SIMD */
@@ -142,7 +142,8 @@ typedef enum {
   TPDEC_PARAM_IGNORE_BUFFERFULLNESS,     /** Ignore buffer fullness. */
   TPDEC_PARAM_SET_BITRATE,               /** Set average bit rate for bit stream interruption frame misses estimation. */
   TPDEC_PARAM_RESET,                     /** Reset transport decoder instance status. */
-  TPDEC_PARAM_BURST_PERIOD               /** Set data reception burst period in mili seconds. */
+  TPDEC_PARAM_BURST_PERIOD,              /** Set data reception burst period in mili seconds. */
+  TPDEC_PARAM_FLUSH                      /** Discard all buffered stream data, but keep the configuration found so far. */
 } TPDEC_PARAM;
 
 /* ISO/IEC 14496-3 4.4.1.1 Table 4.2 Program config element */
@@ -482,6 +483,33 @@ TRANSPORTDEC_ERROR transportDec_SetParam ( const HANDLE_TRANSPORTDEC hTp,
  */
 UINT transportDec_GetNrOfSubFrames(HANDLE_TRANSPORTDEC hTp);
 
+/**
+ * \brief                  Get position and size of the ADTS or LOAS frame which carries the current
+ *                         access unit. Valid after transportDec_ReadAccessUnit() returned TRANSPORTDEC_OK
+ *                         and until the next call of transportDec_FillData().
+ * \param hTp              Transport Handle.
+ * \param pFrameStart      Amount of valid bits in the bit buffer counted from the first bit of the
+ *                         sync word of the current frame.
+ * \param pFrameLength     Length of the current frame in bytes including the header.
+ * \param pNumAccessUnits  Number of access units contained in the current frame.
+ * \param pConfigPresent   1 if the current frame carries the complete configuration (ADTS header or
+ *                         LOAS StreamMuxConfig), else 0.
+ * \return                 Error code. TRANSPORTDEC_UNSUPPORTED_FORMAT for formats without sync layer.
+ */
+TRANSPORTDEC_ERROR transportDec_GetFrameInfo( const HANDLE_TRANSPORTDEC hTp,
+                                              UINT                     *pFrameStart,
+                                              UINT                     *pFrameLength,
+                                              UINT                     *pNumAccessUnits,
+                                              UINT                     *pConfigPresent );
+
+/**
+ * \brief      Skip all remaining access units of the current ADTS or LOAS frame without parsing them.
+ *             The next call of transportDec_ReadAccessUnit() starts with the following frame.
+ * \param hTp  Transport Handle.
+ * \return     Error code.
+ */
+TRANSPORTDEC_ERROR transportDec_SkipFrame( const HANDLE_TRANSPORTDEC hTp );
+
 
 /**
  * \brief       Get info structure of transport decoder library.
@@ -205,6 +205,13 @@ TRANSPORTDEC_ERROR adtsRead_DecodeHeader(
   bs.num_raw_blocks  = FDKreadBits(hBs, Adts_Length_NumberOfRawDataBlocksInFrame);
   bs.num_pce_bits    = 0;
 
+  /* The header has to be complete. Otherwise stale buffer content would be taken for the configuration,
+     and the decoder would be reinitialized in the middle of the stream. */
+  if ( valBits < (ADTS_HEADERLENGTH - ADTS_SYNCLENGTH) + ((bs.protection_absent) ? 0 : bs.num_raw_blocks*16 + Adts_Length_CrcCheck) ) {
+    FDKpushBack(hBs, ADTS_HEADERLENGTH - ADTS_SYNCLENGTH);
+    return TRANSPORTDEC_NOT_ENOUGH_BITS;
+  }
+
   adtsHeaderLength = ADTS_HEADERLENGTH;
 
   if (!bs.protection_absent) {
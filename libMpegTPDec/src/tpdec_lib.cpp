@@ -1197,6 +1197,7 @@ TRANSPORTDEC_ERROR transportDec_SetParam ( const HANDLE_TRANSPORTDEC hTp,
       hTp->burstPeriod = value;
       break;
     case TPDEC_PARAM_RESET:
+    case TPDEC_PARAM_FLUSH:
       {
         int i;
 
@@ -1206,7 +1207,7 @@ TRANSPORTDEC_ERROR transportDec_SetParam ( const HANDLE_TRANSPORTDEC hTp,
           hTp->accessUnitAnchor[i] = 0;
         }
         hTp->flags &= ~(TPDEC_SYNCOK|TPDEC_LOST_FRAMES_PENDING);
-        if (hTp->transportFmt != TT_MP4_ADIF) {
+        if (hTp->transportFmt != TT_MP4_ADIF && param == TPDEC_PARAM_RESET) {
           hTp->flags &= ~TPDEC_CONFIG_FOUND;
         }
         hTp->remainder = 0;
@@ -1237,6 +1238,65 @@ UINT transportDec_GetNrOfSubFrames(HANDLE_TRANSPORTDEC hTp)
   return nSubFrames;
 }
 
+TRANSPORTDEC_ERROR transportDec_GetFrameInfo( const HANDLE_TRANSPORTDEC hTp,
+                                              UINT                     *pFrameStart,
+                                              UINT                     *pFrameLength,
+                                              UINT                     *pNumAccessUnits,
+                                              UINT                     *pConfigPresent )
+{
+  if (hTp == NULL) {
+    return TRANSPORTDEC_INVALID_PARAMETER;
+  }
+
+  switch (hTp->transportFmt) {
+    case TT_MP4_ADTS:
+      /* globalFramePos is taken right after the sync word. */
+      *pFrameStart     = hTp->globalFramePos + ADTS_SYNCLENGTH;
+      *pFrameLength    = hTp->parser.adts.bs.frame_length;
+      *pNumAccessUnits = hTp->parser.adts.bs.num_raw_blocks + 1;
+      *pConfigPresent  = 1;
+      break;
+    case TT_MP4_LOAS:
+      /* globalFramePos is taken after the 11 bit sync word and the 13 bit length field. */
+      *pFrameStart     = hTp->globalFramePos + 11 + 13;
+      *pFrameLength    = hTp->parser.latm.m_audioMuxLengthBytes + 3;
+      *pNumAccessUnits = CLatmDemux_GetNrOfSubFrames(&hTp->parser.latm);
+      *pConfigPresent  = !hTp->parser.latm.m_useSameStreamMux;
+      break;
+    default:
+      return TRANSPORTDEC_UNSUPPORTED_FORMAT;
+  }
+
+  return TRANSPORTDEC_OK;
+}
+
+TRANSPORTDEC_ERROR transportDec_SkipFrame( const HANDLE_TRANSPORTDEC hTp )
+{
+  HANDLE_FDK_BITSTREAM hBs;
+  UINT frameStart, frameLength, numAccessUnits, configPresent;
+  INT  bits;
+  TRANSPORTDEC_ERROR err;
+
+  err = transportDec_GetFrameInfo(hTp, &frameStart, &frameLength, &numAccessUnits, &configPresent);
+  if (err != TRANSPORTDEC_OK) {
+    return err;
+  }
+
+  hBs = &hTp->bitStream[0];
+
+  /* Distance from the current position to the end of the frame. */
+  bits = (INT)FDKgetValidBits(hBs) - ((INT)frameStart - (INT)(frameLength<<3));
+  if (bits < 0) {
+    return TRANSPORTDEC_PARSE_ERROR;
+  }
+  FDKpushFor(hBs, bits);
+
+  hTp->numberOfRawDataBlocks = 0;
+  hTp->accessUnitAnchor[0] = 0;
+
+  return TRANSPORTDEC_OK;
+}
+
 void transportDec_Close(HANDLE_TRANSPORTDEC *phTp)
 {
   if (phTp != NULL)
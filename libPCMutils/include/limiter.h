@@ -98,6 +98,7 @@ amm-info@iis.fraunhofer.de
 #define TDL_RELEASE_DEFAULT_MS     (50)              /* default release time in ms */
 
 #define TDL_GAIN_SCALING           (15)              /* scaling of gain value. */
+#define TDL_DBL_GAIN_SCALING       (8)               /* headroom for the gain applied to FIXP_DBL samples. */
 
 
 #ifdef __cplusplus
@@ -167,7 +168,11 @@ TDLIMITER_ERROR destroyLimiter(TDLimiterPtr limiter);
 *             gain_delay <= nSamples                                          *
 * samples:    input/output buffer containing interleaved samples              *
 *             precision of output will be DFRACT_BITS-TDL_GAIN_SCALING bits   *
+*             for INT_PCM and DFRACT_BITS-TDL_DBL_GAIN_SCALING bits for       *
+*             FIXP_DBL samples                                                *
 * nSamples:   number of samples per channel                                   *
+* sampleBits: width of the samples, SAMPLE_BITS for INT_PCM or DFRACT_BITS    *
+*             for FIXP_DBL samples                                            *
 * returns:    error code                                                      *
 ******************************************************************************/
 TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
@@ -176,7 +181,8 @@ TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
                  const INT*   gain_scale,
                  const UINT   gain_size,
                  const UINT   gain_delay,
-                 const UINT   nSamples);
+                 const UINT   nSamples,
+                 const INT    sampleBits);
 
 /******************************************************************************
 * getLimiterDelay                                                             *
@@ -193,6 +199,26 @@ unsigned int getLimiterDelay(TDLimiterPtr limiter);
 ******************************************************************************/
 TDLIMITER_ERROR setLimiterNChannels(TDLimiterPtr limiter, unsigned int nChannels);
 
+/******************************************************************************
+* setLimiterMaxChannels                                                       *
+* limiter:     limiter handle                                                 *
+* maxChannels: new maximum number of channels. The delay buffer is grown if   *
+*              it exceeds maxChannels specified on create, it never shrinks.  *
+* returns:     error code                                                     *
+******************************************************************************/
+TDLIMITER_ERROR setLimiterMaxChannels(TDLimiterPtr limiter, unsigned int maxChannels);
+
+/******************************************************************************
+* getLimiterDelayBufferSize                                                   *
+* maxAttackMs:   maximum attack time as specified on create                   *
+* maxChannels:   maximum number of channels                                   *
+* maxSampleRate: maximum sampling rate as specified on create                 *
+* returns:       size of the delay buffer in bytes                            *
+******************************************************************************/
+unsigned int getLimiterDelayBufferSize(unsigned int maxAttackMs,
+                                       unsigned int maxChannels,
+                                       unsigned int maxSampleRate);
+
 /******************************************************************************
 * setLimiterSampleRate                                                        *
 * limiter:    limiter handle                                                  *
@@ -289,6 +289,8 @@ PCMDMX_ERROR pcmDmx_Reset (
  *                amount of output channels is written to.
  * \param [in]    Flag which indicates if output time data is writtern interleaved or as
  *                subsequent blocks.
+ * \param [in]    Width of the time data samples: SAMPLE_BITS for INT_PCM or DFRACT_BITS for
+ *                FIXP_DBL samples.
  * \param [inout] Array were the corresponding channel type for each output audio channel is
  *                stored into.
  * \param [inout] Array were the corresponding channel type index for each output audio channel
@@ -306,12 +308,50 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
     UINT                    frameSize,
     INT                    *nChannels,
     int                     fInterleaved,
+    int                     sampleBits,
     AUDIO_CHANNEL_TYPE      channelType[],
     UCHAR                   channelIndices[],
     const UCHAR             channelMapping[][8],
     INT                    *pDmxOutScale
   );
 
+/** Get the downmix matrix of the current frame instead of mixing a time signal. The matrix is the
+ *  same that pcmDmx_ApplyFrame() would apply and allows to mix any linear representation of the
+ *  signal, e.g. spectral data, before it is transformed into time domain. Only a plain downmix
+ *  (the number of input channels exceeds MAX_NUMBER_OF_OUTPUT_CHANNELS and no dual channel
+ *  processing is requested) can be described. The function can be called any number of times
+ *  with fUpdate set to 0 to check the matrix. For the frame that is finally mixed with the matrix
+ *  it has to be called with fUpdate set to 1 instead of calling pcmDmx_ApplyFrame(). This advances
+ *  the meta data delay line. On failure the module and all arguments stay untouched.
+ *
+ * \param [in]    Handle of PCM downmix module instance.
+ * \param [inout] Pointer to buffer that holds the number of input channels and where the
+ *                amount of output channels is written to.
+ * \param [inout] Array were the corresponding channel type for each output audio channel is
+ *                stored into.
+ * \param [inout] Array were the corresponding channel type index for each output audio channel
+ *                is stored into.
+ * \param [in]    Array containing the output channel mapping to be used (from MPEG PCE ordering
+ *                to whatever is required).
+ * \param [out]   Downmix matrix. The element [o][i] holds the factor of the input channel i
+ *                for the output channel o. Both indices are buffer channel indices.
+ * \param [out]   Pointer on a field receiving the scale factor that has to be applied on all
+ *                mixed values: out = (sum of factor*in) * 2^scale.
+ * \param [in]    Flag to advance the meta data delay line as pcmDmx_ApplyFrame() does.
+ * @returns       Returns PCMDMX_OK if the matrix was created, PCMDMX_INVALID_MODE if the current
+ *                settings require no plain downmix or the matrix is not conform to any standard.
+ **/
+PCMDMX_ERROR pcmDmx_GetMixMatrix (
+    HANDLE_PCM_DOWNMIX      self,
+    INT                    *nChannels,
+    AUDIO_CHANNEL_TYPE      channelType[],
+    UCHAR                   channelIndices[],
+    const UCHAR             channelMapping[][8],
+    FIXP_DBL                mixMatrix[][8],
+    INT                    *pDmxScale,
+    const int               fUpdate
+  );
+
 /** Close an instance of the PCM downmix module.
  * @param [inout] Pointer to a buffer containing the handle of the instance.
  * @returns       Returns an error code.
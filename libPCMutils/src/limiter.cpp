@@ -219,12 +219,16 @@ TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
                  const INT*   gain_scale,
                  const UINT   gain_size,
                  const UINT   gain_delay,
-                 const UINT   nSamples)
+                 const UINT   nSamples,
+                 const INT    sampleBits)
 {
   unsigned int i, j;
   FIXP_PCM tmp1, tmp2;
-  FIXP_DBL tmp, old, gain, additionalGain, additionalGainUnfiltered;
+  FIXP_DBL tmp, old, gain, additionalGain, additionalGainUnfiltered, sampleGain;
   FIXP_DBL minGain = FL2FXCONST_DBL(1.0f/(1<<1));
+  FIXP_DBL *samplesDbl = (sampleBits == DFRACT_BITS) ? (FIXP_DBL*)samples : NULL;
+  /* FIXP_DBL samples are scaled down by TDL_DBL_GAIN_SCALING bits only, to keep their precision. */
+  const INT gainScaling = (samplesDbl != NULL) ? TDL_DBL_GAIN_SCALING : TDL_GAIN_SCALING;
 
   FDK_ASSERT(gain_size == 1);
   FDK_ASSERT(gain_delay <= nSamples);
@@ -236,7 +240,7 @@ TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
     unsigned int attack         = limiter->attack;
     FIXP_DBL     attackConst    = limiter->attackConst;
     FIXP_DBL     releaseConst   = limiter->releaseConst;
-    FIXP_DBL     threshold      = FX_PCM2FX_DBL(limiter->threshold)>>TDL_GAIN_SCALING;
+    FIXP_DBL     threshold      = FX_PCM2FX_DBL(limiter->threshold)>>gainScaling;
 
     FIXP_DBL     max            = limiter->max;
     FIXP_DBL*    maxBuf         = limiter->maxBuf;
@@ -274,16 +278,28 @@ TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
       } else {
         additionalGain >>= gain_scale[0];
       }
+      sampleGain = (FIXP_DBL)SATURATE_LEFT_SHIFT(additionalGain, TDL_GAIN_SCALING-gainScaling, DFRACT_BITS);
 
       /* get maximum absolute sample value of all channels, including the additional gain. */
-      tmp1 = (FIXP_PCM)0;
-      for (j = 0; j < channels; j++) {
+      if (samplesDbl != NULL) {
+        FIXP_DBL peak = (FIXP_DBL)0;
+        for (j = 0; j < channels; j++) {
+          tmp = samplesDbl[i * channels + j];
+          if (tmp == (FIXP_DBL)MINVAL_DBL) /* protect fAbs from -1.0 value */
+            tmp = (FIXP_DBL)(MINVAL_DBL+1);
+          peak = fMax(peak, fAbs(tmp));
+        }
+        tmp = SATURATE_LEFT_SHIFT(fMultDiv2(peak, sampleGain), 1, DFRACT_BITS);
+      } else {
+        tmp1 = (FIXP_PCM)0;
+        for (j = 0; j < channels; j++) {
           tmp2 = (FIXP_PCM)samples[i * channels + j];
           if (tmp2 == (FIXP_PCM)SAMPLE_MIN) /* protect fAbs from -1.0 value */
-              tmp2 = (FIXP_PCM)(SAMPLE_MIN+1);
-        tmp1 = fMax(tmp1, fAbs(tmp2));
+            tmp2 = (FIXP_PCM)(SAMPLE_MIN+1);
+          tmp1 = fMax(tmp1, fAbs(tmp2));
+        }
+        tmp = SATURATE_LEFT_SHIFT(fMultDiv2(tmp1, sampleGain), 1, DFRACT_BITS);
       }
-      tmp = SATURATE_LEFT_SHIFT(fMultDiv2(tmp1, additionalGain), 1, DFRACT_BITS);
 
       /* set threshold as lower border to save calculations in running maximum algorithm */
       tmp = fMax(tmp, threshold);
@@ -349,13 +365,21 @@ TDLIMITER_ERROR applyLimiter(TDLimiterPtr limiter,
       for (j = 0; j < channels; j++) {
 
         tmp = delayBuf[delayBufIdx * channels + j];
-        delayBuf[delayBufIdx * channels + j] = fMult((FIXP_PCM)samples[i * channels + j], additionalGain);
+        if (samplesDbl != NULL) {
+          delayBuf[delayBufIdx * channels + j] = fMult(samplesDbl[i * channels + j], sampleGain);
+        } else {
+          delayBuf[delayBufIdx * channels + j] = fMult((FIXP_PCM)samples[i * channels + j], sampleGain);
+        }
 
         /* Apply gain to delayed signal */
         if (gain < FL2FXCONST_DBL(1.0f/(1<<1)))
           tmp = fMult(tmp,gain<<1);
 
-        samples[i * channels + j] = FX_DBL2FX_PCM((FIXP_DBL)SATURATE_LEFT_SHIFT(tmp,TDL_GAIN_SCALING,DFRACT_BITS));
+        if (samplesDbl != NULL) {
+          samplesDbl[i * channels + j] = (FIXP_DBL)SATURATE_LEFT_SHIFT(tmp,gainScaling,DFRACT_BITS);
+        } else {
+          samples[i * channels + j] = FX_DBL2FX_PCM((FIXP_DBL)SATURATE_LEFT_SHIFT(tmp,TDL_GAIN_SCALING,DFRACT_BITS));
+        }
       }
       delayBufIdx++;
       if (delayBufIdx >= attack) delayBufIdx = 0;
@@ -402,6 +426,40 @@ TDLIMITER_ERROR setLimiterNChannels(TDLimiterPtr limiter, unsigned int nChannels
   return TDLIMIT_OK;
 }
 
+/* set maximum number of channels */
+TDLIMITER_ERROR setLimiterMaxChannels(TDLimiterPtr limiter, unsigned int maxChannels)
+{
+  unsigned int maxAttack;
+  FIXP_DBL *delayBuf;
+
+  if ( limiter == NULL ) return TDLIMIT_INVALID_HANDLE;
+
+  if (maxChannels <= limiter->maxChannels) return TDLIMIT_OK;
+
+  /* The delay buffer is sized for the maximum attack time like on create. */
+  maxAttack = (unsigned int)(limiter->maxAttackMs * limiter->maxSampleRate / 1000);
+
+  delayBuf = (FIXP_DBL*)FDKcalloc(maxAttack * maxChannels, sizeof(FIXP_DBL));
+  if (delayBuf == NULL) return TDLIMIT_INVALID_PARAMETER;
+
+  /* Keep the delayed signal, the additional area was never used. */
+  FDKmemcpy(delayBuf, limiter->delayBuf, maxAttack * limiter->maxChannels * sizeof(FIXP_DBL));
+  FDKfree(limiter->delayBuf);
+
+  limiter->delayBuf    = delayBuf;
+  limiter->maxChannels = maxChannels;
+
+  return TDLIMIT_OK;
+}
+
+/* get size of delay buffer */
+unsigned int getLimiterDelayBufferSize(unsigned int maxAttackMs,
+                                       unsigned int maxChannels,
+                                       unsigned int maxSampleRate)
+{
+  return (unsigned int)(maxAttackMs * maxSampleRate / 1000) * maxChannels * sizeof(FIXP_DBL);
+}
+
 /* set sampling rate */
 TDLIMITER_ERROR setLimiterSampleRate(TDLimiterPtr limiter, unsigned int sampleRate)
 {
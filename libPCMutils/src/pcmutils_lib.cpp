@@ -1854,22 +1854,155 @@ PCMDMX_ERROR pcmDmx_SetMatrixMixdownFromPce (
 #endif  /* PCE_METADATA_ENABLE */
 
 
-/** Apply down or up mixing.
- * @param [in]    Handle of PCM downmix module instance.
- * @param [inout] Pointer to buffer that hold the time domain signal.
- * @param [in]    Pointer where the amount of output samples is returned into.
- * @param [inout] Pointer where the amount of output channels is returned into.
- * @param [in]    Flag which indicates if output time data are writtern interleaved or as subsequent blocks.
- * @param [inout] Array where the corresponding channel type for each output audio channel is stored into.
- * @param [inout] Array where the corresponding channel type index for each output audio channel is stored into.
- * @param [in]    Array containing the out channel mapping to be used (From MPEG PCE ordering to whatever is required).
- * @param [out]   Pointer on a field receiving the scale factor that has to be applied on all samples afterwards.
- *                If the handed pointer is NULL scaling is done internally.
- * @returns Returns an error code.
+/** Fetch the meta data valid for the current frame and maintain the meta data delay line.
+ * @param [in]  Handle of PCM downmix module instance.
+ * @param [out] Pointer to a structure receiving the meta data of the current frame.
  **/
-PCMDMX_ERROR pcmDmx_ApplyFrame (
+static void pcmDmx_UpdateMetaData (
+        HANDLE_PCM_DOWNMIX   self,
+        DMX_BS_META_DATA    *pMetaData
+  )
+{
+  PCM_DMX_USER_PARAMS *pParam = &self->userParams;
+  int slot;
+
+  /* Reset downmix meta data if necessary */
+  if ( (pParam->expiryFrame > 0)
+    && (++self->bsMetaData[0].expiryCount > pParam->expiryFrame) )
+  { /* The metadata read from bitstream is too old. */
+    PCMDMX_ERROR err = pcmDmx_Reset(self, PCMDMX_RESET_BS_DATA);
+    FDK_ASSERT(err == PCMDMX_OK);
+  }
+  FDKmemcpy(pMetaData, &self->bsMetaData[pParam->frameDelay], sizeof(DMX_BS_META_DATA));
+  /* Maintain delay line */
+  for (slot = pParam->frameDelay; slot > 0; slot -= 1) {
+    FDKmemcpy(&self->bsMetaData[slot], &self->bsMetaData[slot-1], sizeof(DMX_BS_META_DATA));
+  }
+}
+
+#ifdef PCM_DOWNMIX_ENABLE
+/** Set up the output channel description and create the downmix matrix for a given input
+ *  configuration. Shared by the time domain downmix and pcmDmx_GetMixMatrix().
+ * @param [in]    Pointer to structure holding all current user parameter.
+ * @param [in]    The number of input channels.
+ * @param [in]    The number of output channels.
+ * @param [in]    The (packed) channel mode of the input configuration.
+ * @param [in]    The channel offset table of the input configuration.
+ * @param [in]    Pointer to the meta data of the current frame.
+ * @param [inout] Array holding the channel type of each channel. Receives the output configuration.
+ * @param [inout] Array holding the channel type index of each channel. Receives the output configuration.
+ * @param [in]    Array containing the output channel mapping to be used.
+ * @param [out]   The downmix matrix indexed with the fixed channel labels.
+ * @param [out]   The channel offset table of the output configuration.
+ * @param [out]   The common scale factor of the downmix matrix.
+ * @returns       An error code of getMixFactors().
+ **/
+static
+PCMDMX_ERROR getDmxMatrix (
+        const PCM_DMX_USER_PARAMS  *pParam,
+        const int                   numInChannels,
+        const int                   numOutChannels,
+        const PCM_DMX_CHANNEL_MODE  inChMode,
+        const UCHAR                 inOffsetTable[PCM_DMX_MAX_CHANNELS],
+        const DMX_BS_META_DATA     *pMetaData,
+        AUDIO_CHANNEL_TYPE          channelType[],
+        UCHAR                       channelIndices[],
+        const UCHAR                 channelMapping[][8],
+        FIXP_DMX                    mixFactors[PCM_DMX_MAX_CHANNELS][PCM_DMX_MAX_CHANNELS],
+        UCHAR                       outOffsetTable[PCM_DMX_MAX_CHANNELS],
+        INT                        *pDmxScale
+  )
+{
+  PCM_DMX_CHANNEL_MODE  outChMode;
+  int  chCfg = 0;
+
+#if (PCM_DMX_MAX_IN_CHANNELS >= 7)
+  if (numInChannels > SIX_CHANNEL) {
+    AUDIO_CHANNEL_TYPE multiPurposeChType[2];
+
+    /* Get the type of the multipurpose channels */
+    multiPurposeChType[0] = channelType[inOffsetTable[LEFT_MULTIPRPS_CHANNEL]];
+    multiPurposeChType[1] = channelType[inOffsetTable[RIGHT_MULTIPRPS_CHANNEL]];
+
+    /* Check if the input configuration is one defined in the standard. */
+    switch (inChMode) {
+    case CH_MODE_5_0_2_1:  /* chCfg 7 || 14 */
+      /* Further analyse the input config to distinguish the two CH_MODE_5_0_2_1 configs. */
+      if ( (multiPurposeChType[0] == ACT_FRONT_TOP)
+        && (multiPurposeChType[1] == ACT_FRONT_TOP) ) {
+        chCfg = 14;
+      } else {
+        chCfg = 7;
+      }
+      break;
+    case CH_MODE_3_0_3_1:  /* chCfg 11 */
+      chCfg = 11;
+      break;
+    case CH_MODE_3_0_4_1:  /* chCfg 12 */
+      chCfg = 12;
+      break;
+    default:
+      chCfg = 0;  /* Not a known config */
+      break;
+    }
+  }
+#endif
+
+  /* Set the output channel mode: */
+  outChMode = outChModeTable[numOutChannels];
+
+  /* Get channel description and channel mapping for the desired output configuration. */
+  getChannelDescription(
+          outChMode,
+          channelMapping,
+          channelType,
+          channelIndices,
+          outOffsetTable
+         );
+
+  /* Create the DMX matrix */
+  return getMixFactors (
+                     (chCfg>0) ? 1 : 0,
+                     (chCfg>0) ? (PCM_DMX_CHANNEL_MODE)chCfg : inChMode,
+                     outChMode,
+                     pParam,
+                     pMetaData,
+                     mixFactors,
+                     pDmxScale
+                   );
+}
+#endif /* PCM_DOWNMIX_ENABLE */
+
+/* Sample access for the INT_PCM and the 32 bit (FIXP_DBL) time signal in pcmDmx_ApplyFrameT(). */
+static inline FIXP_DBL pcmDmxMultSample(const INT_PCM x, const FIXP_DMX f)
+{
+  return fMult((FIXP_PCM)x, f);
+}
+
+static inline FIXP_DBL pcmDmxMultSample(const FIXP_DBL x, const FIXP_DMX f)
+{
+  return fMult(x, f);
+}
+
+static inline void pcmDmxStoreSample(INT_PCM *pOut, const FIXP_DBL x, const int scale)
+{
+#if (SAMPLE_BITS == DFRACT_BITS)
+  *pOut = (INT_PCM)SATURATE_LEFT_SHIFT(x, scale, SAMPLE_BITS);
+#else
+  *pOut = (INT_PCM)SATURATE_RIGHT_SHIFT(x, DFRACT_BITS-SAMPLE_BITS-scale, SAMPLE_BITS);
+#endif
+}
+
+static inline void pcmDmxStoreSample(FIXP_DBL *pOut, const FIXP_DBL x, const int scale)
+{
+  *pOut = (FIXP_DBL)SATURATE_LEFT_SHIFT(x, scale, DFRACT_BITS);
+}
+
+/* Down or up mixing of a time signal of INT_PCM or FIXP_DBL samples, see pcmDmx_ApplyFrame(). */
+template <class PCM>
+static PCMDMX_ERROR pcmDmx_ApplyFrameT (
         HANDLE_PCM_DOWNMIX      self,
-        INT_PCM                *pPcmBuf,
+        PCM                    *pPcmBuf,
         UINT                    frameSize,
         INT                    *nChannels,
         int                     fInterleaved,
@@ -1888,7 +2021,7 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
   int   numOutChannels, numInChannels;
   int   inStride, outStride, offset;
   int   dmxMaxScale, dmxScale;
-  int   ch, slot;
+  int   ch;
   UCHAR inOffsetTable[PCM_DMX_MAX_CHANNELS];
 
   DMX_BS_META_DATA  bsMetaData;
@@ -1975,87 +2108,41 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
     offset = frameSize;        /* Channel specific offset factor */
   }
 
-  /* Reset downmix meta data if necessary */
-  if ( (pParam->expiryFrame > 0)
-    && (++self->bsMetaData[0].expiryCount > pParam->expiryFrame) )
-  { /* The metadata read from bitstream is too old. */
-    PCMDMX_ERROR err = pcmDmx_Reset(self, PCMDMX_RESET_BS_DATA);
-    FDK_ASSERT(err == PCMDMX_OK);
-  }
-  FDKmemcpy(&bsMetaData, &self->bsMetaData[pParam->frameDelay], sizeof(DMX_BS_META_DATA));
-  /* Maintain delay line */
-  for (slot = pParam->frameDelay; slot > 0; slot -= 1) {
-    FDKmemcpy(&self->bsMetaData[slot], &self->bsMetaData[slot-1], sizeof(DMX_BS_META_DATA));
-  }
+  /* Get the meta data for this frame */
+  pcmDmx_UpdateMetaData(self, &bsMetaData);
 
   /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 #ifdef PCM_DOWNMIX_ENABLE
   if ( numInChannels > numOutChannels )
   { /* Apply downmix */
-    INT_PCM  *pInPcm[PCM_DMX_MAX_IN_CHANNELS] = { NULL };
-    INT_PCM  *pOutPcm[PCM_DMX_MAX_OUT_CHANNELS] = { NULL };
+    PCM      *pInPcm[PCM_DMX_MAX_IN_CHANNELS] = { NULL };
+    PCM      *pOutPcm[PCM_DMX_MAX_OUT_CHANNELS] = { NULL };
     FIXP_DMX  mixFactors[PCM_DMX_MAX_CHANNELS][PCM_DMX_MAX_CHANNELS];
     UCHAR     outOffsetTable[PCM_DMX_MAX_CHANNELS];
     UINT      sample;
-    int       chCfg = 0;
     int       bypScale = 0;
 
-#if (PCM_DMX_MAX_IN_CHANNELS >= 7)
-    if (numInChannels > SIX_CHANNEL) {
-      AUDIO_CHANNEL_TYPE multiPurposeChType[2];
-
-      /* Get the type of the multipurpose channels */
-      multiPurposeChType[0] = channelType[inOffsetTable[LEFT_MULTIPRPS_CHANNEL]];
-      multiPurposeChType[1] = channelType[inOffsetTable[RIGHT_MULTIPRPS_CHANNEL]];
-
-      /* Check if the input configuration is one defined in the standard. */
-      switch (inChMode) {
-      case CH_MODE_5_0_2_1:  /* chCfg 7 || 14 */
-        /* Further analyse the input config to distinguish the two CH_MODE_5_0_2_1 configs. */
-        if ( (multiPurposeChType[0] == ACT_FRONT_TOP)
-          && (multiPurposeChType[1] == ACT_FRONT_TOP) ) {
-          chCfg = 14;
-        } else {
-          chCfg = 7;
-        }
-        break;
-      case CH_MODE_3_0_3_1:  /* chCfg 11 */
-        chCfg = 11;
-        break;
-      case CH_MODE_3_0_4_1:  /* chCfg 12 */
-        chCfg = 12;
-        break;
-      default:
-        chCfg = 0;  /* Not a known config */
-        break;
-      }
-    }
-#endif
-
-    /* Set this stages output stride and channel mode: */
+    /* Set this stages output stride: */
     outStride = (fInterleaved) ? numOutChannels : 1;
-    outChMode = outChModeTable[numOutChannels];
-
-    /* Get channel description and channel mapping for the desired output configuration. */
-    getChannelDescription(
-            outChMode,
-            channelMapping,
-            channelType,
-            channelIndices,
-            outOffsetTable
-           );
-    /* Now there is no way back because we modified the channel configuration! */
 
-    /* Create the DMX matrix */
-    errorStatus = getMixFactors (
-                       (chCfg>0) ? 1 : 0,
-                       (chCfg>0) ? (PCM_DMX_CHANNEL_MODE)chCfg : inChMode,
-                       outChMode,
+    /* Get channel description and channel mapping for the desired output configuration
+       and create the DMX matrix. */
+    errorStatus = getDmxMatrix (
                        pParam,
+                       numInChannels,
+                       numOutChannels,
+                       inChMode,
+                       inOffsetTable,
                       &bsMetaData,
+                       channelType,
+                       channelIndices,
+                       channelMapping,
                        mixFactors,
+                       outOffsetTable,
                       &dmxScale
                      );
+    /* Now there is no way back because we modified the channel configuration! */
+
     /* No fatal errors can occur here. The function is designed to always return a valid matrix.
        The error code is used to signal configurations and matrices that are not conform to any standard. */
 
@@ -2106,26 +2193,22 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
     /* Sample processing loop */
     for (sample = 0; sample < frameSize; sample++)
     {
-      FIXP_PCM tIn[PCM_DMX_MAX_IN_CHANNELS];
+      PCM      tIn[PCM_DMX_MAX_IN_CHANNELS];
       FIXP_DBL tOut[PCM_DMX_MAX_OUT_CHANNELS] = { (FIXP_DBL)0 };
       int inCh, outCh;
 
       /* Preload all input samples */
       for (inCh=0; inCh < numInChannels; inCh+=1) {
-        tIn[inCh] = (FIXP_PCM)*pInPcm[inCh];
+        tIn[inCh] = *pInPcm[inCh];
         pInPcm[inCh] += inStride;
       }
       /* Apply downmix coefficients to input samples and accumulate for output */
       for (outCh=0; outCh < numOutChannels; outCh+=1) {
         for (inCh=0; inCh < numInChannels; inCh+=1) {
-          tOut[outCh] += fMult(tIn[inCh], mixFactors[outCh][inCh]);
+          tOut[outCh] += pcmDmxMultSample(tIn[inCh], mixFactors[outCh][inCh]);
         }
         /* Write sample */
-#if (SAMPLE_BITS == DFRACT_BITS)
-        *pOutPcm[outCh] = (INT_PCM)SATURATE_LEFT_SHIFT(tOut[outCh], dmxScale, SAMPLE_BITS);
-#else
-        *pOutPcm[outCh] = (INT_PCM)SATURATE_RIGHT_SHIFT(tOut[outCh], DFRACT_BITS-SAMPLE_BITS-dmxScale, SAMPLE_BITS);
-#endif
+        pcmDmxStoreSample(pOutPcm[outCh], tOut[outCh], dmxScale);
         pOutPcm[outCh] += outStride;
       }
     }
@@ -2147,8 +2230,8 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
          Create a stereo/dual channel signal */
     if (numInChannels == ONE_CHANNEL)
     {
-      INT_PCM  *pInPcm[PCM_DMX_MAX_CHANNELS];
-      INT_PCM  *pOutLF, *pOutRF;
+      PCM      *pInPcm[PCM_DMX_MAX_CHANNELS];
+      PCM      *pOutLF, *pOutRF;
 
       /* Set this stages output stride and channel mode: */
       outStride = (fInterleaved) ? TWO_CHANNEL : 1;
@@ -2193,8 +2276,8 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
          Extend with zero channels to achieved the desired number of output channels. */
     if (numOutChannels > TWO_CHANNEL)
     {
-      INT_PCM *pIn[PCM_DMX_MAX_CHANNELS]  = { NULL };
-      INT_PCM *pOut[PCM_DMX_MAX_CHANNELS] = { NULL };
+      PCM     *pIn[PCM_DMX_MAX_CHANNELS]  = { NULL };
+      PCM     *pOut[PCM_DMX_MAX_CHANNELS] = { NULL };
       AUDIO_CHANNEL_TYPE  inChTypes[PCM_DMX_MAX_CHANNELS];
       UCHAR    inChIndices[PCM_DMX_MAX_CHANNELS];
       UCHAR    numChPerGrp[2][PCM_DMX_MAX_CHANNEL_GROUPS];
@@ -2312,7 +2395,7 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
 
       /* First copy the channels that have signal */
       for (sample = 0; sample < frameSize; sample+=1) {
-        INT_PCM tIn[PCM_DMX_MAX_CHANNELS];
+        PCM     tIn[PCM_DMX_MAX_CHANNELS];
         /* Read all channel samples */
         for (ch = 0; ch < nContentCh; ch+=1) {
           tIn[ch] = *pIn[ch];
@@ -2328,7 +2411,7 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
       /* Clear all the other channels */
       for (sample = 0; sample < frameSize; sample++) {
         for (ch = nContentCh; ch < numOutChannels; ch+=1) {
-          *pOut[ch] = (INT_PCM)0;
+          *pOut[ch] = (PCM)0;
           pOut[ch] -= outStride;
         }
       }
@@ -2348,8 +2431,8 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
     {
     case 2:
       { /* Set up channel pointer */
-        INT_PCM  *pInPcm[PCM_DMX_MAX_CHANNELS];
-        INT_PCM  *pOutL, *pOutR;
+        PCM      *pInPcm[PCM_DMX_MAX_CHANNELS];
+        PCM      *pOutL, *pOutR;
         FIXP_DMX  flev;
 
         UINT sample;
@@ -2380,8 +2463,8 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
         {
         case CH1_MODE:  /* L' = 0.707 * Ch1;  R' = 0.707 * Ch1 */
           for (sample = 0; sample < frameSize; sample++) {
-            *pOutL = *pOutR =
-              (INT_PCM)SATURATE_RIGHT_SHIFT(fMult((FIXP_PCM)*pInPcm[LEFT_FRONT_CHANNEL], flev), DFRACT_BITS-SAMPLE_BITS, SAMPLE_BITS);
+            pcmDmxStoreSample(pOutL, pcmDmxMultSample(*pInPcm[LEFT_FRONT_CHANNEL], flev), 0);
+            *pOutR = *pOutL;
 
             pInPcm[LEFT_FRONT_CHANNEL] += inStride;
             pOutL += outStride; pOutR += outStride;
@@ -2389,8 +2472,8 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
           break;
         case CH2_MODE:  /* L' = 0.707 * Ch2;  R' = 0.707 * Ch2 */
           for (sample = 0; sample < frameSize; sample++) {
-            *pOutL = *pOutR =
-              (INT_PCM)SATURATE_RIGHT_SHIFT(fMult((FIXP_PCM)*pInPcm[RIGHT_FRONT_CHANNEL], flev), DFRACT_BITS-SAMPLE_BITS, SAMPLE_BITS);
+            pcmDmxStoreSample(pOutL, pcmDmxMultSample(*pInPcm[RIGHT_FRONT_CHANNEL], flev), 0);
+            *pOutR = *pOutL;
 
             pInPcm[RIGHT_FRONT_CHANNEL] += inStride;
             pOutL += outStride; pOutR += outStride;
@@ -2422,6 +2505,167 @@ PCMDMX_ERROR pcmDmx_ApplyFrame (
 }
 
 
+/** Apply down or up mixing.
+ * @param [in]    Handle of PCM downmix module instance.
+ * @param [inout] Pointer to buffer that hold the time domain signal.
+ * @param [in]    Pointer where the amount of output samples is returned into.
+ * @param [inout] Pointer where the amount of output channels is returned into.
+ * @param [in]    Flag which indicates if output time data are writtern interleaved or as subsequent blocks.
+ * @param [in]    Width of the time data samples: SAMPLE_BITS for INT_PCM or DFRACT_BITS for FIXP_DBL samples.
+ * @param [inout] Array where the corresponding channel type for each output audio channel is stored into.
+ * @param [inout] Array where the corresponding channel type index for each output audio channel is stored into.
+ * @param [in]    Array containing the out channel mapping to be used (From MPEG PCE ordering to whatever is required).
+ * @param [out]   Pointer on a field receiving the scale factor that has to be applied on all samples afterwards.
+ *                If the handed pointer is NULL scaling is done internally.
+ * @returns Returns an error code.
+ **/
+PCMDMX_ERROR pcmDmx_ApplyFrame (
+        HANDLE_PCM_DOWNMIX      self,
+        INT_PCM                *pPcmBuf,
+        UINT                    frameSize,
+        INT                    *nChannels,
+        int                     fInterleaved,
+        int                     sampleBits,
+        AUDIO_CHANNEL_TYPE      channelType[],
+        UCHAR                   channelIndices[],
+        const UCHAR             channelMapping[][8],
+        INT                    *pDmxOutScale
+  )
+{
+  if (sampleBits == DFRACT_BITS) {
+    return pcmDmx_ApplyFrameT(self, (FIXP_DBL*)pPcmBuf, frameSize, nChannels, fInterleaved,
+                              channelType, channelIndices, channelMapping, pDmxOutScale);
+  }
+  return pcmDmx_ApplyFrameT(self, pPcmBuf, frameSize, nChannels, fInterleaved,
+                            channelType, channelIndices, channelMapping, pDmxOutScale);
+}
+
+
+/** Get the downmix matrix for the current frame instead of mixing a time signal.
+ * @param [in]    Handle of PCM downmix module instance.
+ * @param [inout] Pointer to buffer that holds the number of input channels and where the
+ *                amount of output channels is written to.
+ * @param [inout] Array where the corresponding channel type for each output audio channel is stored into.
+ * @param [inout] Array where the corresponding channel type index for each output audio channel is stored into.
+ * @param [in]    Array containing the out channel mapping to be used (From MPEG PCE ordering to whatever is required).
+ * @param [out]   Downmix matrix indexed with the output and the input buffer channel index.
+ * @param [out]   Pointer on a field receiving the scale factor of the matrix.
+ * @param [in]    Flag to advance the meta data as pcmDmx_ApplyFrame() does. If 0 the module stays untouched.
+ * @returns Returns an error code.
+ **/
+PCMDMX_ERROR pcmDmx_GetMixMatrix (
+        HANDLE_PCM_DOWNMIX      self,
+        INT                    *nChannels,
+        AUDIO_CHANNEL_TYPE      channelType[],
+        UCHAR                   channelIndices[],
+        const UCHAR             channelMapping[][8],
+        FIXP_DBL                mixMatrix[][8],
+        INT                    *pDmxScale,
+        const int               fUpdate
+  )
+{
+#ifdef PCM_DOWNMIX_ENABLE
+  PCM_DMX_USER_PARAMS  *pParam;
+  PCMDMX_ERROR  errorStatus;
+  PCM_DMX_CHANNEL_MODE  inChMode;
+  DMX_BS_META_DATA  bsMetaData;
+  DMX_BS_META_DATA  bsMetaDataBackup[PCM_DMX_MAX_DELAY_FRAMES+1];
+  AUDIO_CHANNEL_TYPE  outChannelType[PCM_DMX_MAX_CHANNELS];
+  UCHAR  outChannelIndices[PCM_DMX_MAX_CHANNELS];
+  FIXP_DMX  mixFactors[PCM_DMX_MAX_CHANNELS][PCM_DMX_MAX_CHANNELS];
+  UCHAR  inOffsetTable[PCM_DMX_MAX_CHANNELS];
+  UCHAR  outOffsetTable[PCM_DMX_MAX_CHANNELS];
+  INT  dmxScale = 0;
+  int  numInChannels, numOutChannels;
+  int  inCh, outCh;
+
+  if ( (self           == NULL)
+    || (nChannels      == NULL)
+    || (channelType    == NULL)
+    || (channelIndices == NULL)
+    || (channelMapping == NULL)
+    || (mixMatrix      == NULL)
+    || (pDmxScale      == NULL) ) {
+    return (PCMDMX_INVALID_HANDLE);
+  }
+
+  pParam = &self->userParams;
+  numInChannels = *nChannels;
+
+  if ( (numInChannels == 0)
+    || (numInChannels > PCM_DMX_MAX_IN_CHANNELS) )
+                           { return (PCMDMX_INVALID_ARGUMENT); }
+
+  /* Only a plain downmix can be described with a matrix. */
+  if ( (self->applyProcessing != 0)
+    || (pParam->numOutChannelsMax <= 0)
+    || (pParam->numOutChannelsMax >= numInChannels) ) {
+    return (PCMDMX_INVALID_MODE);
+  }
+  numOutChannels = pParam->numOutChannelsMax;
+
+  errorStatus = getChannelMode(
+                   numInChannels,
+                   channelType,
+                   channelIndices,
+                   inOffsetTable,
+                  &inChMode
+                 );
+  if ( PCMDMX_IS_FATAL_ERROR(errorStatus)
+    || (inChMode == CH_MODE_UNDEFINED) ) {
+    return (PCMDMX_INVALID_CH_CONFIG);
+  }
+
+  /* Work on copies to be able to leave the module untouched if requested or if the matrix does not conform. */
+  FDKmemcpy(bsMetaDataBackup, self->bsMetaData, sizeof(bsMetaDataBackup));
+  FDKmemcpy(outChannelType, channelType, PCM_DMX_MAX_CHANNELS*sizeof(AUDIO_CHANNEL_TYPE));
+  FDKmemcpy(outChannelIndices, channelIndices, PCM_DMX_MAX_CHANNELS*sizeof(UCHAR));
+
+  pcmDmx_UpdateMetaData(self, &bsMetaData);
+
+  errorStatus = getDmxMatrix (
+                     pParam,
+                     numInChannels,
+                     numOutChannels,
+                     inChMode,
+                     inOffsetTable,
+                    &bsMetaData,
+                     outChannelType,
+                     outChannelIndices,
+                     channelMapping,
+                     mixFactors,
+                     outOffsetTable,
+                    &dmxScale
+                   );
+  if ( (errorStatus != PCMDMX_OK) || !fUpdate ) {
+    FDKmemcpy(self->bsMetaData, bsMetaDataBackup, sizeof(bsMetaDataBackup));
+  }
+  if (errorStatus != PCMDMX_OK) {
+    return (errorStatus);
+  }
+
+  /* Translate the matrix from channel labels into buffer channel indices. */
+  FDKmemclear(mixMatrix, PCM_DMX_MAX_CHANNELS*sizeof(mixMatrix[0]));
+  for (outCh=0; outCh < PCM_DMX_MAX_CHANNELS; outCh+=1) {
+    if (outOffsetTable[outCh] == 255) continue;
+    for (inCh=0; inCh < PCM_DMX_MAX_CHANNELS; inCh+=1) {
+      if (inOffsetTable[inCh] == 255) continue;
+      mixMatrix[outOffsetTable[outCh]][inOffsetTable[inCh]] = FX_DMX2FX_DBL(mixFactors[outCh][inCh]);
+    }
+  }
+
+  FDKmemcpy(channelType, outChannelType, PCM_DMX_MAX_CHANNELS*sizeof(AUDIO_CHANNEL_TYPE));
+  FDKmemcpy(channelIndices, outChannelIndices, PCM_DMX_MAX_CHANNELS*sizeof(UCHAR));
+  *nChannels = numOutChannels;
+  *pDmxScale = dmxScale;
+
+  return (PCMDMX_OK);
+#else
+  return (PCMDMX_INVALID_MODE);
+#endif /* PCM_DOWNMIX_ENABLE */
+}
+
+
 /** Close an instance of the PCM downmix module.
  * @param [inout] Pointer to a buffer containing the handle of the instance.
  * @returns Returns an error code.
@@ -150,6 +150,15 @@ typedef enum
   SBR_BS_INTERRUPTION                  /*!< Signal bit stream interruption. Value is ignored. */
 } SBRDEC_PARAM;
 
+/** Processing stages of the SBR decoder measured by the stage profiling, see sbrDecoder_GetProfile(). */
+typedef enum
+{
+  SBRDEC_PROF_LPP = 0,                 /*!< High frequency generation in lppTransposer(). */
+  SBRDEC_PROF_ENV,                     /*!< Envelope adjustment in calculateSbrEnvelope(). */
+  SBRDEC_PROF_PS,                      /*!< Parametric stereo processing and the stereo QMF synthesis. */
+  SBRDEC_PROFILE_STAGES                /*!< Number of profiled stages. */
+} SBRDEC_PROFILE_STAGE;
+
 typedef struct SBR_DECODER_INSTANCE *HANDLE_SBRDECODER;
 
 
@@ -301,6 +310,7 @@ SBR_ERROR sbrDecoder_Parse (
  * \param sampleRate      Output samplerate.
  * \param channelMapping  Channel mapping indices.
  * \param interleaved     Flag indicating if time data is stored interleaved (1: Interleaved time data, 0: non-interleaved timedata).
+ * \param sampleBits      Width of the time data samples: SAMPLE_BITS for INT_PCM or DFRACT_BITS for FIXP_DBL samples.
  * \param coreDecodedOk   Flag indicating if the core decoder did not find any error (0: core decoder found errors, 1: no errors).
  * \param psDecoded       Pointer to a buffer holding a flag. Input: PS is possible, Output: PS has been rendered.
  *
@@ -312,9 +322,43 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER    self,
                              int                 *sampleRate,
                              const UCHAR          channelMapping[(8)],
                              const int            interleaved,
+                             const int            sampleBits,
                              const int            coreDecodedOk,
                              UCHAR               *psDecoded );
 
+/**
+ * \brief  Process the parsed SBR data of one frame like sbrDecoder_Apply(), but without any time signal.
+ *
+ * The header handling, the envelope and PS parameter decoding and the noise generators of the envelope
+ * adjustment advance exactly as in sbrDecoder_Apply(). The filter banks are not run. This keeps the state
+ * of a parse-only decoding in step with a regular decoding, apart from the signal history.
+ *
+ * \param self            Handle of an open SBR decoder instance.
+ * \param numChannels     Number of core channels.
+ * \param coreDecodedOk   Flag indicating if the core decoder did not find any error (0: core decoder found errors, 1: no errors).
+ * \param psDecoded       Pointer to a buffer holding a flag. Input: PS is possible, Output: PS has been decoded.
+ *
+ * \return  Error code.
+ */
+SBR_ERROR sbrDecoder_Skip ( HANDLE_SBRDECODER    self,
+                            int                  numChannels,
+                            const int            coreDecodedOk,
+                            UCHAR               *psDecoded );
+
+/**
+ * \brief  Get the stage profiling counters of the SBR decoder. The stages of a frame are accounted
+ *         at the end of each sbrDecoder_Apply() call that processed a time signal.
+ *
+ * \param self      Handle of an open SBR decoder instance.
+ * \param pCounter  Array of SBRDEC_PROFILE_STAGES counters receiving the counters in ::SBRDEC_PROFILE_STAGE order.
+ * \param reset     If not 0, the counters of the instance are cleared after they have been copied.
+ *
+ * \return  Error code.
+ */
+SBR_ERROR sbrDecoder_GetProfile ( HANDLE_SBRDECODER    self,
+                                  FDK_PROFILE_COUNTER *pCounter,
+                                  const int            reset );
+
 
 /**
  * \brief       Close SBR decoder instance and free memory.
@@ -338,6 +382,24 @@ INT sbrDecoder_GetLibInfo( LIB_INFO *info );
  */
 UINT sbrDecoder_GetDelay( const HANDLE_SBRDECODER self );
 
+/**
+ * \brief              Get the properties of the SBR data parsed so far without applying SBR.
+ * \param self         SBR decoder handle.
+ * \param pSampleRate  Returns the output sample rate, 0 if no SBR element has been initialized.
+ * \param pPsData      Returns 1 if the last parsed frame carried parametric stereo data which
+ *                     would be rendered, otherwise 0.
+ * \return             Error Code.
+ */
+SBR_ERROR sbrDecoder_GetParseInfo( const HANDLE_SBRDECODER self, INT *pSampleRate, INT *pPsData );
+
+/**
+ * \brief              Get the memory of the SBR elements, channels and the parametric stereo decoder,
+ *                     which are allocated when SBR data of a stream is initialized.
+ * \param maxChannels  Maximum number of core channels of the stream.
+ * \return             Arena memory in bytes, see FDKarenaGetBlockSize().
+ */
+UINT sbrDecoder_GetRequiredMemory( const INT maxChannels );
+
 
 #ifdef __cplusplus
 }
@@ -1096,6 +1096,47 @@ calculateSbrEnvelope (QMF_SCALE_FACTOR  *sbrScaleFactor,           /*!< Scaling
 }
 
 
+/*!
+  \brief  Skip the envelope adjustment of one frame
+
+  Updates the state which calculateSbrEnvelope() carries over to the
+  next frame without touching any subband samples: the random noise
+  index and the phase of the synthetic sines advance by the number of
+  QMF slots of the frame, and the missing harmonics flags and the
+  transient position are passed on. Used for parse-only decoding, so
+  that a later regular decoding continues with the same noise sequence.
+*/
+void
+skipSbrEnvelope (HANDLE_SBR_CALCULATE_ENVELOPE h_sbr_cal_env, /*!< Handle to struct filled by the create-function */
+                 HANDLE_SBR_HEADER_DATA hHeaderData,          /*!< Static control data */
+                 HANDLE_SBR_FRAME_DATA  hFrameData)           /*!< Control data of current frame */
+{
+  UCHAR*   borders = hFrameData->frameInfo.borders;
+  HANDLE_FREQ_BAND_DATA hFreq = &hHeaderData->freqBandData;
+
+  int noSubbands = hFreq->highSubband - hFreq->lowSubband;
+  int noSlots    = hHeaderData->timeStep * (borders[hFrameData->frameInfo.nEnvelopes] - borders[0]);
+
+  SCHAR  sineMapped[MAX_FREQ_COEFFS];
+
+  mapSineFlags(hFreq->freqBandTable[1],
+               hFreq->nSfb[1],
+               hFrameData->addHarmonics,
+               h_sbr_cal_env->harmFlagsPrev,
+               hFrameData->frameInfo.tranEnv,
+               sineMapped);
+
+  /* adjustTimeSlotHQ() and adjustTimeSlotLC() advance per slot by noSubbands and 1. */
+  h_sbr_cal_env->phaseIndex = (h_sbr_cal_env->phaseIndex + noSlots*noSubbands) & (SBR_NF_NO_RANDOM_VAL - 1);
+  h_sbr_cal_env->harmIndex  = (UCHAR)((h_sbr_cal_env->harmIndex + noSlots) & 3);
+
+  if(hFrameData->frameInfo.tranEnv == hFrameData->frameInfo.nEnvelopes)
+    h_sbr_cal_env->prevTranEnv = 0;
+  else
+    h_sbr_cal_env->prevTranEnv = -1;
+}
+
+
 /*!
   \brief   Create envelope instance
 
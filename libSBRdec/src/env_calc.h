@@ -128,6 +128,11 @@ calculateSbrEnvelope (QMF_SCALE_FACTOR  *sbrScaleFactor,
                       const int frameErrorFlag
                       );
 
+void
+skipSbrEnvelope (HANDLE_SBR_CALCULATE_ENVELOPE h_sbr_cal_env,
+                 HANDLE_SBR_HEADER_DATA hHeaderData,
+                 HANDLE_SBR_FRAME_DATA hFrameData);
+
 SBR_ERROR
 createSbrEnvelopeCalc (HANDLE_SBR_CALCULATE_ENVELOPE hSbrCalculateEnvelope,
                        HANDLE_SBR_HEADER_DATA hHeaderData,
@@ -182,6 +182,8 @@ typedef FREQ_BAND_DATA *HANDLE_FREQ_BAND_DATA;
 #define SBRDEC_DOWNSAMPLE   8192  /* Flag indicating that the downsampling mode is used. */
 #define SBRDEC_FLUSH       16384  /* Flag is used to flush all elements in use. */
 #define SBRDEC_FORCE_RESET 32768  /* Flag is used to force a reset of all elements in use. */
+#define SBRDEC_TIME_DBL    65536  /* Flag indicating that the time signal consists of FIXP_DBL samples instead of INT_PCM. */
+#define SBRDEC_SKIP_SIGNAL 131072  /* Flag indicating that only the state carried over to the next frame is updated, without any signal processing. */
 
 #define SBRDEC_HDR_STAT_RESET  1
 #define SBRDEC_HDR_STAT_UPDATE 2
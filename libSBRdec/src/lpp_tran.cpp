@@ -748,6 +748,30 @@ void lppTransposer (HANDLE_SBR_LPP_TRANS hLppTrans,    /*!< Handle of lpp transp
 
 }
 
+/*!
+ *
+ * \brief Update the filtering levels of a frame which is not transposed
+ *
+ * Keeps the smoothed bandwidth expansion factors in step with lppTransposer()
+ * without processing any subband samples.
+ *
+ */
+void lppTransposerSkip (HANDLE_SBR_LPP_TRANS hLppTrans,    /*!< Handle of lpp transposer  */
+                        const int nInvfBands,              /*!< Number of bands for inverse filtering */
+                        INVF_MODE *sbr_invf_mode,          /*!< Current inverse filtering modes */
+                        INVF_MODE *sbr_invf_mode_prev      /*!< Previous inverse filtering modes */
+                        )
+{
+  FIXP_DBL  bwVector[MAX_NUM_PATCHES];       /*!< pole moving factors */
+  int i;
+
+  inverseFilteringLevelEmphasis(hLppTrans, nInvfBands, sbr_invf_mode, sbr_invf_mode_prev, bwVector);
+
+  for (i = 0; i < nInvfBands; i++ ) {
+    hLppTrans->bwVectorOld[i] = bwVector[i];
+  }
+}
+
 /*!
  *
  * \brief Initialize one low power transposer instance
@@ -773,6 +797,11 @@ createLppTransposer (HANDLE_SBR_LPP_TRANS hs, /*!< Handle of low power transpose
   /* FB inverse filtering settings */
   hs->pSettings = pSettings;
 
+  /* Start without filter history, like a newly allocated channel. */
+  FDKmemclear(hs->bwVectorOld, sizeof(hs->bwVectorOld));
+  FDKmemclear(hs->lpcFilterStatesReal, sizeof(hs->lpcFilterStatesReal));
+  FDKmemclear(hs->lpcFilterStatesImag, sizeof(hs->lpcFilterStatesImag));
+
   pSettings->nCols = nCols;
   pSettings->overlap = overlap;
 
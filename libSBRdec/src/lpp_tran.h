@@ -210,6 +210,13 @@ void lppTransposer (HANDLE_SBR_LPP_TRANS hLppTrans,
                     );
 
 
+void lppTransposerSkip (HANDLE_SBR_LPP_TRANS hLppTrans,
+                        const int nInvfBands,
+                        INVF_MODE *sbr_invf_mode,
+                        INVF_MODE *sbr_invf_mode_prev
+                        );
+
+
 SBR_ERROR
 createLppTransposer (HANDLE_SBR_LPP_TRANS hLppTrans,
                      TRANSPOSER_SETTINGS *pSettings,
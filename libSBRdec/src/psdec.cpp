@@ -150,8 +150,10 @@ CreatePsDec( HANDLE_PS_DEC *h_PS_DEC,   /*!< pointer to the module state */
       goto bail;
     }
   } else {
-    /* Reset an open instance */
+    /* Reset an open instance. Clear all signal history like for a new instance, the
+       delay line pointers are reassigned by ResetPsDec(). */
     h_ps_d = *h_PS_DEC;
+    FDKmemclear(h_ps_d, sizeof(struct PS_DEC));
   }
 
    /* initialisation */
@@ -227,7 +227,7 @@ static void changeQmfType( HANDLE_SBR_DEC hSbrDec,                     /*!< hand
   if (resetAnaQmf) {
     int qmfErr = qmfInitAnalysisFilterBank (
            &hSbrDec->AnalysiscQMF,
-            hSbrDec->anaQmfStates,
+            (FIXP_QAS*)hSbrDec->anaQmfStates,
             hSbrDec->AnalysiscQMF.no_col,
             hSbrDec->AnalysiscQMF.lsb,
             hSbrDec->AnalysiscQMF.usb,
@@ -257,6 +257,24 @@ static void changeQmfType( HANDLE_SBR_DEC hSbrDec,                     /*!< hand
 }
 
 
+/*!
+  \brief  Keep the control data of the current frame which the next frame refers to
+*/
+static void
+sbrDecUpdatePrevFrameData ( HANDLE_SBR_HEADER_DATA hHeaderData,
+                            HANDLE_SBR_FRAME_DATA hFrameData,
+                            HANDLE_SBR_PREV_FRAME_DATA hPrevFrameData )
+{
+  int i;
+
+  for (i=0; i<hHeaderData->freqBandData.nInvfBands; i++) {
+    hPrevFrameData->sbr_invf_mode[i] = hFrameData->sbr_invf_mode[i];
+  }
+  hPrevFrameData->coupling = hFrameData->coupling;
+  hPrevFrameData->stopPos = hFrameData->frameInfo.borders[hFrameData->frameInfo.nEnvelopes];
+  hPrevFrameData->ampRes = hFrameData->ampResolutionCurrentFrame;
+}
+
 /*!
   \brief      SBR decoder core function for one channel
 
@@ -310,10 +328,10 @@ static void changeQmfType( HANDLE_SBR_DEC hSbrDec,                     /*!< hand
 
 void
 sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
-          INT_PCM *timeIn,                   /*!< pointer to input time signal */
-          INT_PCM *timeOut,                  /*!< pointer to output time signal */
+          void *timeIn,                      /*!< pointer to input time signal (FIXP_DBL if SBRDEC_TIME_DBL, else INT_PCM) */
+          void *timeOut,                     /*!< pointer to output time signal */
           HANDLE_SBR_DEC hSbrDecRight,       /*!< handle to Decoder channel right */
-          INT_PCM *timeOutRight,             /*!< pointer to output time signal */
+          void *timeOutRight,                /*!< pointer to output time signal */
           const int strideIn,                /*!< Time data traversal strideIn */
           const int strideOut,               /*!< Time data traversal strideOut */
           HANDLE_SBR_HEADER_DATA hHeaderData,/*!< Static control data */
@@ -321,9 +339,11 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
           HANDLE_SBR_PREV_FRAME_DATA hPrevFrameData,  /*!< Some control data of last frame */
           const int applyProcessing,         /*!< Flag for SBR operation */
           HANDLE_PS_DEC h_ps_d,
-          const UINT flags
+          const UINT flags,
+          FDK_PROFILE_TICKS *pProfileTicks   /*!< Stage times of the current frame, indexed by SBRDEC_PROFILE_STAGE */
          )
 {
+  FDK_PROFILE_TICKS profileStart;
   int i, slot, reserve;
   int saveLbScale;
   int ov_len;
@@ -350,23 +370,48 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
     changeQmfType( hSbrDec, (flags & SBRDEC_LD_MPS_QMF) ? 1 : 0 );
   }
 
+  if (flags & SBRDEC_SKIP_SIGNAL) {
+    /*
+      Parse only: advance the inverse filtering levels and the noise generator and
+      pass on the control data to the next frame, but leave the filter banks and the time signal alone.
+    */
+    if (applyProcessing) {
+      lppTransposerSkip ( &hSbrDec->LppTrans,
+                          hHeaderData->freqBandData.nInvfBands,
+                          hFrameData->sbr_invf_mode,
+                          hPrevFrameData->sbr_invf_mode );
+
+      skipSbrEnvelope (&hSbrDec->SbrCalculateEnvelope,
+                        hHeaderData,
+                        hFrameData);
+
+      sbrDecUpdatePrevFrameData(hHeaderData, hFrameData, hPrevFrameData);
+    }
+    return;
+  }
+
   /*
     low band codec signal subband filtering
    */
 
   {
-    C_AALLOC_SCRATCH_START(qmfTemp, FIXP_DBL, 2*(64));
-
-    qmfAnalysisFiltering( &hSbrDec->AnalysiscQMF,
-                           QmfBufferReal + ov_len,
-                           QmfBufferImag + ov_len,
-                          &hSbrDec->sbrScaleFactor,
-                           timeIn,
-                           strideIn,
-                           qmfTemp
-                         );
-
-    C_AALLOC_SCRATCH_END(qmfTemp, FIXP_DBL, 2*(64));
+    if (flags & SBRDEC_TIME_DBL) {
+      qmfAnalysisFiltering( &hSbrDec->AnalysiscQMF,
+                             QmfBufferReal + ov_len,
+                             QmfBufferImag + ov_len,
+                            &hSbrDec->sbrScaleFactor,
+                             (FIXP_DBL*)timeIn,
+                             strideIn
+                           );
+    } else {
+      qmfAnalysisFiltering( &hSbrDec->AnalysiscQMF,
+                             QmfBufferReal + ov_len,
+                             QmfBufferImag + ov_len,
+                            &hSbrDec->sbrScaleFactor,
+                             (INT_PCM*)timeIn,
+                             strideIn
+                           );
+    }
   }
 
   /*
@@ -434,6 +479,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
       Inverse filtering of lowband and transposition into the SBR-frequency range
     */
 
+    profileStart = FDKprofileStart();
     lppTransposer ( &hSbrDec->LppTrans,
                     &hSbrDec->sbrScaleFactor,
                     QmfBufferReal,
@@ -446,7 +492,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                     hHeaderData->freqBandData.nInvfBands,
                     hFrameData->sbr_invf_mode,
                     hPrevFrameData->sbr_invf_mode );
-
+    FDKprofileStop(profileStart, &pProfileTicks[SBRDEC_PROF_LPP]);
 
 
 
@@ -455,6 +501,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
       Adjust envelope of current frame.
     */
 
+    profileStart = FDKprofileStart();
     calculateSbrEnvelope (&hSbrDec->sbrScaleFactor,
                           &hSbrDec->SbrCalculateEnvelope,
                           hHeaderData,
@@ -466,17 +513,13 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                           degreeAlias,
                           flags,
                           (hHeaderData->frameErrorFlag || hPrevFrameData->frameErrorFlag));
+    FDKprofileStop(profileStart, &pProfileTicks[SBRDEC_PROF_ENV]);
 
 
     /*
       Update hPrevFrameData (to be used in the next frame)
     */
-    for (i=0; i<hHeaderData->freqBandData.nInvfBands; i++) {
-      hPrevFrameData->sbr_invf_mode[i] = hFrameData->sbr_invf_mode[i];
-    }
-    hPrevFrameData->coupling = hFrameData->coupling;
-    hPrevFrameData->stopPos = borders[hFrameData->frameInfo.nEnvelopes];
-    hPrevFrameData->ampRes = hFrameData->ampResolutionCurrentFrame;
+    sbrDecUpdatePrevFrameData(hHeaderData, hFrameData, hPrevFrameData);
   }
   else {
     /* Reset hb_scale if no highband is present, because hb_scale is considered in the QMF-synthesis */
@@ -523,14 +566,25 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
       {
         C_AALLOC_SCRATCH_START(qmfTemp, FIXP_DBL, 2*(64));
 
-        qmfSynthesisFiltering( &hSbrDec->SynthesisQMF,
-                                QmfBufferReal,
-                                (flags & SBRDEC_LOW_POWER) ? NULL : QmfBufferImag,
-                               &hSbrDec->sbrScaleFactor,
-                                hSbrDec->LppTrans.pSettings->overlap,
-                                timeOut,
-                                strideOut,
-                                qmfTemp);
+        if (flags & SBRDEC_TIME_DBL) {
+          qmfSynthesisFiltering( &hSbrDec->SynthesisQMF,
+                                  QmfBufferReal,
+                                  (flags & SBRDEC_LOW_POWER) ? NULL : QmfBufferImag,
+                                 &hSbrDec->sbrScaleFactor,
+                                  hSbrDec->LppTrans.pSettings->overlap,
+                                  (FIXP_DBL*)timeOut,
+                                  strideOut,
+                                  qmfTemp);
+        } else {
+          qmfSynthesisFiltering( &hSbrDec->SynthesisQMF,
+                                  QmfBufferReal,
+                                  (flags & SBRDEC_LOW_POWER) ? NULL : QmfBufferImag,
+                                 &hSbrDec->sbrScaleFactor,
+                                  hSbrDec->LppTrans.pSettings->overlap,
+                                  (INT_PCM*)timeOut,
+                                  strideOut,
+                                  qmfTemp);
+        }
 
         C_AALLOC_SCRATCH_END(qmfTemp, FIXP_DBL, 2*(64));
       }
@@ -544,6 +598,8 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
     HANDLE_QMF_FILTER_BANK synQmf      = &hSbrDec->SynthesisQMF;
     HANDLE_QMF_FILTER_BANK synQmfRight = &hSbrDecRight->SynthesisQMF;
 
+    profileStart = FDKprofileStart();
+
     /* adapt scaling */
     sdiff = hSbrDec->sbrScaleFactor.lb_scale - reserve;                  /* Scaling difference         */
     scaleFactorHighBand   = sdiff - hSbrDec->sbrScaleFactor.hb_scale;    /* Scale of current high band */
@@ -654,14 +710,34 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
         qmfChangeOutScalefactor( synQmf, outScalefactorL );
         qmfChangeOutScalefactor( synQmfRight, outScalefactorR );
 
-        {
+        if (flags & SBRDEC_TIME_DBL) {
+
+          qmfSynthesisFilteringSlot( synQmfRight,
+                                     rQmfReal,                /* QMF real buffer */
+                                     rQmfImag,                /* QMF imag buffer */
+                                     scaleFactorLowBand,
+                                     scaleFactorHighBand,
+                                     (FIXP_DBL*)timeOutRight+(i*synQmf->no_channels*strideOut),
+                                     strideOut,
+                                     pWorkBuffer);
+
+          qmfSynthesisFilteringSlot( synQmf,
+                                   *(QmfBufferReal + i),      /* QMF real buffer */
+                                   *(QmfBufferImag + i),      /* QMF imag buffer */
+                                     scaleFactorLowBand,
+                                     scaleFactorHighBand,
+                                     (FIXP_DBL*)timeOut+(i*synQmf->no_channels*strideOut),
+                                     strideOut,
+                                     pWorkBuffer);
+
+        } else {
 
           qmfSynthesisFilteringSlot( synQmfRight,
                                      rQmfReal,                /* QMF real buffer */
                                      rQmfImag,                /* QMF imag buffer */
                                      scaleFactorLowBand,
                                      scaleFactorHighBand,
-                                     timeOutRight+(i*synQmf->no_channels*strideOut),
+                                     (INT_PCM*)timeOutRight+(i*synQmf->no_channels*strideOut),
                                      strideOut,
                                      pWorkBuffer);
 
@@ -670,7 +746,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                                    *(QmfBufferImag + i),      /* QMF imag buffer */
                                      scaleFactorLowBand,
                                      scaleFactorHighBand,
-                                     timeOut+(i*synQmf->no_channels*strideOut),
+                                     (INT_PCM*)timeOut+(i*synQmf->no_channels*strideOut),
                                      strideOut,
                                      pWorkBuffer);
 
@@ -686,6 +762,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
 
       C_AALLOC_SCRATCH_END(pWorkBuffer, FIXP_DBL, 2*(64));
     }
+    FDKprofileStop(profileStart, &pProfileTicks[SBRDEC_PROF_PS]);
   }
 
   sbrDecoder_drcUpdateChannel( &hSbrDec->sbrDrcChannel );
@@ -739,9 +816,8 @@ createSbrDec (SBR_CHANNEL * hSbrChannel,
   HANDLE_SBR_DEC hs = &(hSbrChannel->SbrDec);
 
   /* Initialize scale factors */
-  hs->sbrScaleFactor.ov_lb_scale  = 0;
-  hs->sbrScaleFactor.ov_hb_scale  = 0;
-  hs->sbrScaleFactor.hb_scale     = 0;
+  FDKmemclear(&hs->sbrScaleFactor, sizeof(QMF_SCALE_FACTOR));
+  FDKmemclear(&hs->sbrScaleFactorRight, sizeof(QMF_SCALE_FACTOR));
 
 
   /*
@@ -765,7 +841,7 @@ createSbrDec (SBR_CHANNEL * hSbrChannel,
 
     qmfErr = qmfInitAnalysisFilterBank (
                     &hs->AnalysiscQMF,
-                     hs->anaQmfStates,
+                     (FIXP_QAS*)hs->anaQmfStates,
                      noCols,
                      hHeaderData->freqBandData.lowSubband,
                      hHeaderData->freqBandData.highSubband,
@@ -94,6 +94,7 @@ amm-info@iis.fraunhofer.de
 #include "qmf.h"
 #include "env_calc.h"
 #include "FDK_audio.h"
+#include "FDK_profile.h"
 
 
 #include "sbrdec_drc.h"
@@ -119,7 +120,7 @@ typedef struct
   FIXP_DBL * WorkBuffer2;
 
   /* QMF filter states */
-  FIXP_QAS   anaQmfStates[(320)];
+  FIXP_DBL   anaQmfStates[(320)];     /*!< FIXP_QAS states, twice as many for a 32 bit time signal */
   FIXP_QSS * pSynQmfStates;
 
   /* Reference pointer arrays for QMF time slots,
@@ -171,10 +172,10 @@ SbrConstructTimeOutput (HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decode
 
 void
 sbr_dec (HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
-         INT_PCM *timeIn,                   /*!< pointer to input time signal */
-         INT_PCM *timeOut,                  /*!< pointer to output time signal */
+         void *timeIn,                      /*!< pointer to input time signal (FIXP_DBL if SBRDEC_TIME_DBL, else INT_PCM) */
+         void *timeOut,                     /*!< pointer to output time signal */
          HANDLE_SBR_DEC hSbrDecRight,       /*!< handle to Decoder channel right */
-         INT_PCM *timeOutRight,             /*!< pointer to output time signal */
+         void *timeOutRight,                /*!< pointer to output time signal */
          const int strideIn,                /*!< Time data traversal strideIn */
          const int strideOut,               /*!< Time data traversal strideOut */
          HANDLE_SBR_HEADER_DATA hHeaderData,/*!< Static control data */
@@ -182,7 +183,8 @@ sbr_dec (HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
          HANDLE_SBR_PREV_FRAME_DATA hPrevFrameData,  /*!< Some control data of last frame */
          const int applyProcessing,         /*!< Flag for SBR operation */
          HANDLE_PS_DEC h_ps_d,
-         const UINT flags
+         const UINT flags,
+         FDK_PROFILE_TICKS *pProfileTicks   /*!< Stage times of the current frame, indexed by SBRDEC_PROFILE_STAGE */
         );
 
 
@@ -113,6 +113,7 @@ typedef struct
   UCHAR useFrameSlot;          /* Index which defines which slot will be decoded/filled next (used with additional delay) */
   UCHAR useHeaderSlot[(1)+1];   /* Index array that provides the link between header and frame data
                                                        (important when processing with additional delay). */
+  UCHAR forceReset;            /* Reset the element at its next initialization (SBR_CLEAR_HISTORY). */
 } SBR_DECODER_ELEMENT;
 
 
@@ -138,6 +139,9 @@ struct SBR_DECODER_INSTANCE
 
   UINT flags;
 
+  FDK_PROFILE_TICKS   profileTicks[SBRDEC_PROFILE_STAGES];  /* Stage times of the current frame */
+  FDK_PROFILE_COUNTER profile[SBRDEC_PROFILE_STAGES];       /* Stage profiling counters */
+
 };
 
 H_ALLOC_MEM(Ram_SbrDecElement, SBR_DECODER_ELEMENT)
@@ -447,6 +447,7 @@ SBR_ERROR sbrDecoder_InitElement (
      && self->pSbrElement[elementIndex] != NULL
      && self->pSbrElement[elementIndex]->elementID == elementID
      && !(self->flags & SBRDEC_FORCE_RESET)
+     && !self->pSbrElement[elementIndex]->forceReset
      )
   {
      /* Nothing to do */
@@ -534,6 +535,7 @@ SBR_ERROR sbrDecoder_InitElement (
 
   /* clear error flags for all delay slots */
   FDKmemclear(self->pSbrElement[elementIndex]->frameErrorFlag, ((1)+1)*sizeof(UCHAR));
+  self->pSbrElement[elementIndex]->forceReset = 0;
 
   /* Initialize this instance */
   sbrError = sbrDecoder_ResetElement(
@@ -746,7 +748,15 @@ SBR_ERROR sbrDecoder_SetParam (HANDLE_SBRDECODER   self,
       if (self == NULL) {
         errorStatus = SBRDEC_NOT_INITIALIZED;
       } else {
+        int elementIndex;
+
         self->flags |= SBRDEC_FORCE_RESET;
+        /* The flag is cleared by the first element initialized, mark all others too. */
+        for (elementIndex = 0; elementIndex < (8); elementIndex++) {
+          if (self->pSbrElement[elementIndex] != NULL) {
+            self->pSbrElement[elementIndex]->forceReset = 1;
+          }
+        }
       }
     }
     break;
@@ -1082,6 +1092,8 @@ SBR_ERROR sbrDecoder_Parse(
         /* update slot index for PS bitstream parsing */
         self->hParametricStereoDec->bsLastSlot = self->hParametricStereoDec->bsReadSlot;
         self->hParametricStereoDec->bsReadSlot = hSbrElement->useFrameSlot;
+        /* The slot has already been processed, drop its PS flag until new PS data is read. */
+        self->hParametricStereoDec->bPsDataAvail[hSbrElement->useFrameSlot] = ppt_none;
       }
       sbrFrameOk = sbrGetSingleChannelElement(hSbrHeader,
                                               hFrameDataLeft,
@@ -1200,6 +1212,7 @@ sbrDecoder_DecodeElement (
         HANDLE_SBRDECODER    self,
         INT_PCM             *timeData,
         const int            interleaved,
+        const int            sampleSize,
         const UCHAR         *channelMapping,
         const int            elementIndex,
         const int            numInChannels,
@@ -1340,10 +1353,10 @@ sbrDecoder_DecodeElement (
   /* Process left channel */
 //FDKprintf("self->codecFrameSize %d\t%d\n",self->codecFrameSize,self->sampleRateIn);
   sbr_dec (&pSbrChannel[0]->SbrDec,
-            timeData + offset0,
-            timeData + offset0,
+            (UCHAR*)timeData + offset0*sampleSize,
+            (UCHAR*)timeData + offset0*sampleSize,
            &pSbrChannel[1]->SbrDec,
-            timeData + offset1,
+            (UCHAR*)timeData + offset1*sampleSize,
             strideIn,
             strideOut,
             hSbrHeader,
@@ -1351,14 +1364,15 @@ sbrDecoder_DecodeElement (
            &pSbrChannel[0]->prevFrameData,
             (hSbrHeader->syncState == SBR_ACTIVE),
             h_ps_d,
-            self->flags
+            self->flags,
+            self->profileTicks
           );
 
   if (stereo) {
     /* Process right channel */
     sbr_dec (&pSbrChannel[1]->SbrDec,
-              timeData + offset1,
-              timeData + offset1,
+              (UCHAR*)timeData + offset1*sampleSize,
+              (UCHAR*)timeData + offset1*sampleSize,
               NULL,
               NULL,
               strideIn,
@@ -1368,7 +1382,8 @@ sbrDecoder_DecodeElement (
              &pSbrChannel[1]->prevFrameData,
               (hSbrHeader->syncState == SBR_ACTIVE),
               NULL,
-              self->flags
+              self->flags,
+              self->profileTicks
             );
   }
 
@@ -1381,10 +1396,22 @@ sbrDecoder_DecodeElement (
     )
   {
     FDK_ASSERT(strideOut > 1);
-    if ( !(self->flags & SBRDEC_PS_DECODED) ) {
+    if ( !(self->flags & (SBRDEC_PS_DECODED|SBRDEC_SKIP_SIGNAL)) ) {
       /* A decoder which is able to decode PS has to produce a stereo output even if no PS data is availble. */
       /* So copy left channel to right channel.                                                              */
-      if (interleaved) {
+      if (interleaved && (self->flags & SBRDEC_TIME_DBL)) {
+        FIXP_DBL *ptr;
+        INT i;
+        FDK_ASSERT(strideOut == 2);
+
+        ptr = (FIXP_DBL*)timeData;
+        for (i = codecFrameSize; i--; )
+        {
+          FIXP_DBL tmp;
+          tmp = *ptr++; *ptr++ = tmp;
+          tmp = *ptr++; *ptr++ = tmp;
+        }
+      } else if (interleaved) {
         INT_PCM *ptr;
         INT i;
         FDK_ASSERT(strideOut == 2);
@@ -1397,7 +1424,7 @@ sbrDecoder_DecodeElement (
           tmp = *ptr++; *ptr++ = tmp;
         }
       } else {
-        FDKmemcpy( timeData+2*codecFrameSize, timeData, 2*codecFrameSize*sizeof(INT_PCM) );
+        FDKmemcpy( (UCHAR*)timeData+2*codecFrameSize*sampleSize, timeData, 2*codecFrameSize*sampleSize );
       }
     }
     *numOutChannels = 2;  /* Output minimum two channels when PS is enabled. */
@@ -1413,12 +1440,14 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
                              int                *sampleRate,
                              const UCHAR         channelMapping[(8)],
                              const int           interleaved,
+                             const int           sampleBits,
                              const int           coreDecodedOk,
                              UCHAR              *psDecoded )
 {
   SBR_ERROR errorStatus = SBRDEC_OK;
 
   int   psPossible = 0;
+  int   sampleSize = (sampleBits == DFRACT_BITS) ? sizeof(FIXP_DBL) : sizeof(INT_PCM);
   int   sbrElementNum;
   int   numCoreChannels = *numChannels;
   int   numSbrChannels  = 0;
@@ -1441,6 +1470,14 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
     psPossible = 0;
   }
 
+  FDKmemclear(self->profileTicks, sizeof(self->profileTicks));
+
+  if (sampleBits == DFRACT_BITS) {
+    self->flags |= SBRDEC_TIME_DBL;
+  } else {
+    self->flags &= ~SBRDEC_TIME_DBL;
+  }
+
 
   /* In case of non-interleaved time domain data and upsampling, make room for bigger SBR output. */
   if (self->synDownsampleFac == 1 && interleaved == 0) {
@@ -1451,7 +1488,7 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
             * self->pSbrElement[0]->pSbrChannel[0]->SbrDec.SynthesisQMF.no_col;
 
     for (c=numCoreChannels-1; c>0; c--) {
-      FDKmemmove(timeData + c*outputFrameSize, timeData + c*self->codecFrameSize , self->codecFrameSize*sizeof(INT_PCM));
+      FDKmemmove((UCHAR*)timeData + c*outputFrameSize*sampleSize, (UCHAR*)timeData + c*self->codecFrameSize*sampleSize, self->codecFrameSize*sampleSize);
     }
   }
 
@@ -1482,6 +1519,7 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
                                  self,
                                  timeData,
                                  interleaved,
+                                 sampleSize,
                                  channelMapping,
                                  sbrElementNum,
                                  numCoreChannels,
@@ -1508,6 +1546,15 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
 
 
 
+  if ( !(self->flags & SBRDEC_SKIP_SIGNAL) ) {
+    int stage;
+    for (stage = 0; stage < SBRDEC_PROFILE_STAGES; stage++) {
+      if (self->profileTicks[stage] > 0) {
+        FDKprofileAdd(&self->profile[stage], self->profileTicks[stage]);
+      }
+    }
+  }
+
   /* Clear reset and flush flag because everything seems to be done successfully. */
   self->flags &= ~SBRDEC_FORCE_RESET;
   self->flags &= ~SBRDEC_FLUSH;
@@ -1518,6 +1565,55 @@ bail:
 }
 
 
+SBR_ERROR sbrDecoder_Skip ( HANDLE_SBRDECODER  self,
+                            int                numChannels,
+                            const int          coreDecodedOk,
+                            UCHAR             *psDecoded )
+{
+  SBR_ERROR errorStatus;
+  UCHAR channelMapping[(8)];
+  int   sampleRate = 0;
+
+  if (self == NULL) {
+    return SBRDEC_NOT_INITIALIZED;
+  }
+
+  /* No time signal is touched, all channels are mapped onto the start of the (missing) buffer. */
+  FDKmemclear(channelMapping, sizeof(channelMapping));
+
+  self->flags |= SBRDEC_SKIP_SIGNAL;
+  errorStatus = sbrDecoder_Apply( self,
+                                  NULL,
+                                 &numChannels,
+                                 &sampleRate,
+                                  channelMapping,
+                                  1,
+                                  SAMPLE_BITS,
+                                  coreDecodedOk,
+                                  psDecoded );
+  self->flags &= ~SBRDEC_SKIP_SIGNAL;
+
+  return errorStatus;
+}
+
+
+SBR_ERROR sbrDecoder_GetProfile ( HANDLE_SBRDECODER    self,
+                                  FDK_PROFILE_COUNTER *pCounter,
+                                  const int            reset )
+{
+  if (self == NULL) {
+    return SBRDEC_NOT_INITIALIZED;
+  }
+
+  FDKmemcpy(pCounter, self->profile, sizeof(self->profile));
+  if (reset) {
+    FDKmemclear(self->profile, sizeof(self->profile));
+  }
+
+  return SBRDEC_OK;
+}
+
+
 SBR_ERROR sbrDecoder_Close ( HANDLE_SBRDECODER *pSelf )
 {
   HANDLE_SBRDECODER self = *pSelf;
@@ -1615,3 +1711,41 @@ UINT sbrDecoder_GetDelay( const HANDLE_SBRDECODER self )
 
   return (outputDelay);
 }
+
+SBR_ERROR sbrDecoder_GetParseInfo( const HANDLE_SBRDECODER self, INT *pSampleRate, INT *pPsData )
+{
+  HANDLE_PS_DEC h_ps_d;
+
+  if ( (self == NULL) || (pSampleRate == NULL) || (pPsData == NULL) ) {
+    return SBRDEC_NOT_INITIALIZED;
+  }
+
+  *pSampleRate = (self->numSbrElements > 0) ? self->sampleRateOut : 0;
+  *pPsData = 0;
+
+  /* PS is rendered only for a single SCE, see sbrDecoder_Apply(). */
+  h_ps_d = self->hParametricStereoDec;
+  if ( (h_ps_d != NULL)
+    && (self->numSbrElements == 1)
+    && (self->pSbrElement[0] != NULL)
+    && (self->pSbrElement[0]->elementID == ID_SCE) )
+  {
+    *pPsData = (h_ps_d->bPsDataAvail[h_ps_d->bsReadSlot] == ppt_mpeg) ? 1 : 0;
+  }
+
+  return SBRDEC_OK;
+}
+
+UINT sbrDecoder_GetRequiredMemory( const INT maxChannels )
+{
+  INT nElements = fixMin(maxChannels, (8));
+  /* A mono element with parametric stereo uses a second SBR channel. */
+  INT nChannels = fixMin(maxChannels + 1, (8)+1);
+
+  /* GetRequiredMem*() report the memory of all elements or channels. */
+  return nElements * FDKarenaGetBlockSize(GetRequiredMemRam_SbrDecElement() / (8))
+       + nChannels * ( FDKarenaGetBlockSize(GetRequiredMemRam_SbrDecChannel() / ((8)+1))
+                     + FDKarenaGetBlockSize(GetRequiredMemRam_sbr_QmfStatesSynthesis() / ((8)+1))
+                     + FDKarenaGetBlockSize(GetRequiredMemRam_sbr_OverlapBuffer() / ((8)+1)) )
+       + FDKarenaGetBlockSize(GetRequiredMemRam_ps_dec());
+}
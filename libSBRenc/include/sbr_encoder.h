@@ -260,6 +260,14 @@ typedef struct {
   UCHAR ChannelIndex[2];
 } SBR_ELEMENT_INFO;
 
+/** Processing stages of the SBR encoder measured by the stage profiling, see sbrEncoder_GetProfile(). */
+typedef enum
+{
+  SBRENC_PROF_QMF = 0,     /*!< QMF analysis of the channels without parametric stereo. */
+  SBRENC_PROF_PS,          /*!< Parametric stereo processing including its QMF and hybrid filter banks. */
+  SBRENC_PROFILE_STAGES    /*!< Number of profiled stages. */
+} SBRENC_PROFILE_STAGE;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -281,6 +289,25 @@ INT sbrEncoder_Open(
         INT                  supportPS
         );
 
+/**
+ * \brief              Get the size of the dynamic (overlay) RAM of an SBR encoder instance.
+ * \param nChannels    Number of maximal channels as passed to sbrEncoder_Open().
+ * \param supportPS    Parametric stereo support as passed to sbrEncoder_Open().
+ * \return             Size in bytes.
+ */
+UINT sbrEncoder_GetDynamicRamSize(INT nChannels, INT supportPS);
+
+/**
+ * \brief              Move the dynamic (overlay) RAM of an SBR encoder instance. The content
+ *                     of the overlay is not preserved across frames, so it may be shared by
+ *                     instances which are never encoding at the same time.
+ * \param hSbrEncoder  SBR encoder handle.
+ * \param dynamicRam   Memory of at least sbrEncoder_GetDynamicRamSize() bytes, owned by the
+ *                     caller. NULL allocates an own overlay again.
+ * \return             0 on success, and non-zero if failed.
+ */
+INT sbrEncoder_SetDynamicRam(HANDLE_SBR_ENCODER hSbrEncoder, UCHAR *dynamicRam);
+
 /**
  * \brief                 Get closest working bitrate to specified desired
  *                        bitrate for a single SBR element.
@@ -401,6 +428,17 @@ INT sbrEncoder_GetEstimateBitrate(HANDLE_SBR_ENCODER hSbrEncoder);
  */
 INT sbrEncoder_GetInputDataDelay(HANDLE_SBR_ENCODER hSbrEncoder);
 
+/**
+ * \brief              Get the stage profiling counters, accounted at the end of each sbrEncoder_EncodeFrame() call.
+ * \param hSbrEncoder  SBR encoder handle.
+ * \param pCounter     Array of SBRENC_PROFILE_STAGES counters receiving the counters in ::SBRENC_PROFILE_STAGE order.
+ * \param reset        If not 0, the counters are cleared after they have been copied.
+ * \return             0 on success, and non-zero if failed.
+ */
+INT sbrEncoder_GetProfile(HANDLE_SBR_ENCODER   hSbrEncoder,
+                          FDK_PROFILE_COUNTER *pCounter,
+                          const INT            reset);
+
 /**
  * \brief       Get decoder library version info.
  * \param info  Pointer to an allocated LIB_INFO struct, where library info is written to.
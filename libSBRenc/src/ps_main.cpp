@@ -475,29 +475,39 @@ FDK_PSENC_ERROR FDKsbrEnc_PSEnc_ParametricStereoProcessing(
 {
   FDK_PSENC_ERROR error = PSENC_OK;
   INT psQmfScale[MAX_PS_CHANNELS] = {0};
-  int psCh, i;
-  C_AALLOC_SCRATCH_START(pWorkBuffer, FIXP_QMF, 4*QMF_CHANNELS)
+  int psCh, i, j, nBlock;
+  FIXP_QMF *pQmfReal[QMF_ANA_BLOCK_SLOTS], *pQmfImag[QMF_ANA_BLOCK_SLOTS];
+  C_AALLOC_SCRATCH_START(pWorkBuffer, FIXP_QMF, 2*QMF_ANA_BLOCK_SLOTS*QMF_CHANNELS)
+
+  for (j = 0; j < QMF_ANA_BLOCK_SLOTS; j++) {
+    pQmfReal[j] = &pWorkBuffer[(2*j+0)*QMF_CHANNELS];
+    pQmfImag[j] = &pWorkBuffer[(2*j+1)*QMF_CHANNELS];
+  }
 
   for (psCh = 0; psCh<MAX_PS_CHANNELS; psCh ++) {
 
-    for (i = 0; i < hQmfAnalysis[psCh]->no_col; i++) {
+    for (i = 0; i < hQmfAnalysis[psCh]->no_col; i += nBlock) {
+
+      nBlock = fixMin(hQmfAnalysis[psCh]->no_col - i, QMF_ANA_BLOCK_SLOTS);
 
-      qmfAnalysisFilteringSlot(
+      qmfAnalysisFilteringBlock(
           hQmfAnalysis[psCh],
-         &pWorkBuffer[2*QMF_CHANNELS], /* qmfReal[QMF_CHANNELS] */
-         &pWorkBuffer[3*QMF_CHANNELS], /* qmfImag[QMF_CHANNELS] */
+          pQmfReal,
+          pQmfImag,
           samples[psCh]+i*(hQmfAnalysis[psCh]->no_channels*timeInStride),
           timeInStride,
-         &pWorkBuffer[0*QMF_CHANNELS]  /* qmf workbuffer 2*QMF_CHANNELS */
+          nBlock
           );
 
-      FDKhybridAnalysisApply(
-         &hParametricStereo->fdkHybAnaFilter[psCh],
-         &pWorkBuffer[2*QMF_CHANNELS],  /* qmfReal[QMF_CHANNELS] */
-         &pWorkBuffer[3*QMF_CHANNELS],  /* qmfImag[QMF_CHANNELS] */
-          hParametricStereo->pHybridData[i+HYBRID_READ_OFFSET][psCh][0],
-          hParametricStereo->pHybridData[i+HYBRID_READ_OFFSET][psCh][1]
-          );
+      for (j = 0; j < nBlock; j++) {
+        FDKhybridAnalysisApply(
+           &hParametricStereo->fdkHybAnaFilter[psCh],
+            pQmfReal[j],
+            pQmfImag[j],
+            hParametricStereo->pHybridData[i+j+HYBRID_READ_OFFSET][psCh][0],
+            hParametricStereo->pHybridData[i+j+HYBRID_READ_OFFSET][psCh][1]
+            );
+      }
 
     } /* no_col loop  i  */
 
@@ -505,7 +515,7 @@ FDK_PSENC_ERROR FDKsbrEnc_PSEnc_ParametricStereoProcessing(
 
   } /* for psCh */
 
-  C_AALLOC_SCRATCH_END(pWorkBuffer, FIXP_QMF, 4*QMF_CHANNELS)
+  C_AALLOC_SCRATCH_END(pWorkBuffer, FIXP_QMF, 2*QMF_ANA_BLOCK_SLOTS*QMF_CHANNELS)
 
   /* find best scaling in new QMF and Hybrid data */
   psFindBestScaling( hParametricStereo,
@@ -101,6 +101,8 @@ amm-info@iis.fraunhofer.de
 
 #include "ton_corr.h"
 
+#include "FDK_profile.h"
+
 
 /* SBR bitstream delay */
   #define DELAY_FRAMES 2
@@ -159,6 +161,9 @@ typedef struct SBR_ENCODER
   INT                  maxChannels;
   INT                  supportPS;
 
+  FDK_PROFILE_TICKS    profileTicks[SBRENC_PROFILE_STAGES];  /* Stage times of the current frame */
+  FDK_PROFILE_COUNTER  profile[SBRENC_PROFILE_STAGES];       /* Stage profiling counters */
+
 
 } SBR_ENCODER;
 
@@ -679,7 +679,7 @@ void sbrEncoder_Close (HANDLE_SBR_ENCODER *phSbrEncoder)
     if (hSbrEncoder->qmfSynthesisPS.FilterStates)
       FreeRam_PsQmfStatesSynthesis((FIXP_DBL**)&hSbrEncoder->qmfSynthesisPS.FilterStates);
 
-    /* Release Overlay */
+    /* Release Overlay, unless bound to memory of the application */
     FreeRam_SbrDynamic_RAM((FIXP_DBL**)&hSbrEncoder->pSBRdynamic_RAM);
 
 
@@ -992,7 +992,7 @@ FDKsbrEnc_EnvEncodeFrame(HANDLE_SBR_ENCODER   hEnvEncoder,
       {
         QMF_SCALE_FACTOR tmpScale;
         FIXP_DBL **pQmfReal, **pQmfImag;
-        C_AALLOC_SCRATCH_START(qmfWorkBuffer, FIXP_DBL, QMF_CHANNELS*2)
+        FDK_PROFILE_TICKS profileStart = FDKprofileStart();
 
 
         /* Obtain pointers to QMF buffers. */
@@ -1004,13 +1004,12 @@ FDKsbrEnc_EnvEncodeFrame(HANDLE_SBR_ENCODER   hEnvEncoder,
                                pQmfImag,
                               &tmpScale,
                                samples + hSbrElement->elInfo.ChannelIndex[ch],
-                               timeInStride,
-                               qmfWorkBuffer );
+                               timeInStride );
 
         h_envChan->qmfScale = tmpScale.lb_scale + 7;
 
 
-        C_AALLOC_SCRATCH_END(qmfWorkBuffer, FIXP_DBL, QMF_CHANNELS*2)
+        FDKprofileStop(profileStart, &hEnvEncoder->profileTicks[SBRENC_PROF_QMF]);
 
       } /* fParametricStereo == 0 */
 
@@ -1021,6 +1020,7 @@ FDKsbrEnc_EnvEncodeFrame(HANDLE_SBR_ENCODER   hEnvEncoder,
       if (hSbrElement->elInfo.fParametricStereo)
       {
         INT error = noError;
+        FDK_PROFILE_TICKS profileStart = FDKprofileStart();
 
 
         /* Limit Parametric Stereo to one instance */
@@ -1057,6 +1057,7 @@ FDKsbrEnc_EnvEncodeFrame(HANDLE_SBR_ENCODER   hEnvEncoder,
           }
           h_envChan->qmfScale = (int)qmfScale;
         }
+        FDKprofileStop(profileStart, &hEnvEncoder->profileTicks[SBRENC_PROF_PS]);
 
 
       } /* if (hEnvEncoder->hParametricStereo) */
@@ -1399,8 +1400,16 @@ INT sbrEncoder_Open(
   }
   FDKmemclear(hSbrEncoder, sizeof(SBR_ENCODER));
 
-      hSbrEncoder->pSBRdynamic_RAM = (UCHAR*)GetRam_SbrDynamic_RAM();
+      hSbrEncoder->maxElements = nElements;
+      hSbrEncoder->maxChannels = nChannels;
+      hSbrEncoder->supportPS   = supportPS;
+
+      /* A single channel encoder needs the energy buffer of one channel only. */
+      hSbrEncoder->pSBRdynamic_RAM = (UCHAR*)GetRam_SbrDynamic_RAM( ((nChannels > 1) || supportPS) ? MAX_NUM_CHANNELS : 1 );
       hSbrEncoder->dynamicRam = hSbrEncoder->pSBRdynamic_RAM;
+      if (hSbrEncoder->pSBRdynamic_RAM == NULL) {
+        goto bail;
+      }
 
   for (i=0; i<nElements; i++) {
     hSbrEncoder->sbrElement[i] = GetRam_SbrElement(i);
@@ -1465,6 +1474,76 @@ bail:
   return errorStatus;
 }
 
+UINT sbrEncoder_GetDynamicRamSize(INT nChannels, INT supportPS)
+{
+  return SBR_ENC_DYN_RAM_SIZE( ((nChannels > 1) || supportPS) ? MAX_NUM_CHANNELS : 1 );
+}
+
+/* Move a pointer into the old overlay to the same offset of the new one. */
+static FIXP_DBL *rebaseDynamicRam(FIXP_DBL *p, const UCHAR *pOld, UCHAR *pNew, const UINT size)
+{
+  if ( ((UCHAR*)p >= pOld) && ((UCHAR*)p < pOld+size) ) {
+    return (FIXP_DBL*)(pNew + ((UCHAR*)p - pOld));
+  }
+  return p;
+}
+
+INT sbrEncoder_SetDynamicRam(HANDLE_SBR_ENCODER hSbrEncoder, UCHAR *dynamicRam)
+{
+  INT ch, i, j;
+  UCHAR *pOld, *pNew;
+  UINT size;
+
+  if (hSbrEncoder == NULL) {
+    return 1;
+  }
+
+  if ( (dynamicRam == NULL) && (hSbrEncoder->pSBRdynamic_RAM != NULL) ) {
+    return 0; /* already using the own overlay */
+  }
+
+  size = sbrEncoder_GetDynamicRamSize(hSbrEncoder->maxChannels, hSbrEncoder->supportPS);
+  pOld = hSbrEncoder->dynamicRam;
+  pNew = dynamicRam;
+
+  if (pNew == NULL) {
+    pNew = (UCHAR*)GetRam_SbrDynamic_RAM( ((hSbrEncoder->maxChannels > 1) || hSbrEncoder->supportPS) ? MAX_NUM_CHANNELS : 1 );
+    if (pNew == NULL) {
+      return 1;
+    }
+  }
+
+  /* The envelope extractors and the hybrid analysis keep pointers into the overlay. */
+  for (ch=0; ch<(8); ch++) {
+    if (hSbrEncoder->pSbrChannel[ch] != NULL) {
+      SBR_EXTRACT_ENVELOPE *sbrExtrEnv = &hSbrEncoder->pSbrChannel[ch]->hEnvChannel.sbrExtractEnvelope;
+      for (i=0; i<QMF_MAX_TIME_SLOTS; i++) {
+        sbrExtrEnv->rBuffer[i] = rebaseDynamicRam(sbrExtrEnv->rBuffer[i], pOld, pNew, size);
+        sbrExtrEnv->iBuffer[i] = rebaseDynamicRam(sbrExtrEnv->iBuffer[i], pOld, pNew, size);
+        sbrExtrEnv->YBuffer[i] = rebaseDynamicRam(sbrExtrEnv->YBuffer[i], pOld, pNew, size);
+      }
+    }
+  }
+  if (hSbrEncoder->hParametricStereo != NULL) {
+    for (i=0; i<HYBRID_READ_OFFSET+HYBRID_FRAMESIZE; i++) {
+      for (ch=0; ch<MAX_PS_CHANNELS; ch++) {
+        for (j=0; j<2; j++) {
+          hSbrEncoder->hParametricStereo->pHybridData[i][ch][j] =
+              rebaseDynamicRam(hSbrEncoder->hParametricStereo->pHybridData[i][ch][j], pOld, pNew, size);
+        }
+      }
+    }
+  }
+
+  FreeRam_SbrDynamic_RAM((FIXP_DBL**)&hSbrEncoder->pSBRdynamic_RAM);
+  if (dynamicRam == NULL) {
+    hSbrEncoder->pSBRdynamic_RAM = pNew;
+  }
+  hSbrEncoder->dynamicRam = pNew;
+
+  return 0;
+}
+
 static
 INT FDKsbrEnc_Reallocate(
                     HANDLE_SBR_ENCODER   hSbrEncoder,
@@ -2216,7 +2295,9 @@ sbrEncoder_EncodeFrame(  HANDLE_SBR_ENCODER   hSbrEncoder,
                         )
 {
   INT error;
-  int el;
+  int el, stage;
+
+  FDKmemclear(hSbrEncoder->profileTicks, sizeof(hSbrEncoder->profileTicks));
 
   for (el=0; el<hSbrEncoder->noElements; el++)
   {
@@ -2251,6 +2332,12 @@ sbrEncoder_EncodeFrame(  HANDLE_SBR_ENCODER   hSbrEncoder,
 
   }
 
+  for (stage = 0; stage < SBRENC_PROFILE_STAGES; stage++) {
+    if (hSbrEncoder->profileTicks[stage] > 0) {
+      FDKprofileAdd(&hSbrEncoder->profile[stage], hSbrEncoder->profileTicks[stage]);
+    }
+  }
+
   return 0;
 }
 
@@ -2311,6 +2398,22 @@ INT sbrEncoder_GetInputDataDelay(HANDLE_SBR_ENCODER hSbrEncoder)
   return delay;
 }
 
+INT sbrEncoder_GetProfile(HANDLE_SBR_ENCODER   hSbrEncoder,
+                          FDK_PROFILE_COUNTER *pCounter,
+                          const INT            reset)
+{
+  if (hSbrEncoder == NULL) {
+    return -1;
+  }
+
+  FDKmemcpy(pCounter, hSbrEncoder->profile, sizeof(hSbrEncoder->profile));
+  if (reset) {
+    FDKmemclear(hSbrEncoder->profile, sizeof(hSbrEncoder->profile));
+  }
+
+  return 0;
+}
+
 
 INT sbrEncoder_GetLibInfo( LIB_INFO *info )
 {
@@ -93,7 +93,9 @@ amm-info@iis.fraunhofer.de
 #include "sbr.h"
 #include "genericStds.h"
 
-C_ALLOC_MEM (Ram_SbrDynamic_RAM, FIXP_DBL, ((SBR_ENC_DYN_RAM_SIZE)/sizeof(FIXP_DBL)))
+/*! Shareable memory region, nChannels is the maximum number of channels of one element. */
+FIXP_DBL* GetRam_SbrDynamic_RAM(int nChannels) { FDK_ASSERT((nChannels) <= MAX_NUM_CHANNELS); return ((FIXP_DBL*)FDKcalloc(SBR_ENC_DYN_RAM_SIZE(nChannels), 1)); }
+void FreeRam_SbrDynamic_RAM(FIXP_DBL** p) { if (p != NULL) { FDKfree(*p); *p=NULL; } }
 
 /*!
   \name StaticSbrData
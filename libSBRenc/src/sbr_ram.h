@@ -130,8 +130,9 @@ amm-info@iis.fraunhofer.de
   #define BUF_NRG_SIZE   ( (MAX_NUM_CHANNELS * Y_2_BUF_BYTE) )
   #define BUF_QMF_SIZE  (ENV_R_BUFF_BYTE + ENV_I_BUFF_BYTE)
 
-  /* Size of the shareable memory region than can be reused */
-  #define SBR_ENC_DYN_RAM_SIZE  ( BUF_QMF_SIZE + BUF_NRG_SIZE )
+  /* Size of the shareable memory region than can be reused, for up to nChannels channels per element.
+     Parametric stereo uses the QMF buffers of two channels, they overlap the energy buffers. */
+  #define SBR_ENC_DYN_RAM_SIZE(nChannels)  ( BUF_QMF_SIZE + (nChannels) * Y_2_BUF_BYTE )
 
   #define OFFSET_QMF         ( 0 )
   #define OFFSET_NRG         ( OFFSET_QMF + BUF_QMF_SIZE )
@@ -141,7 +142,7 @@ amm-info@iis.fraunhofer.de
  *****************************************************************************************************
  */
 
-  H_ALLOC_MEM(Ram_SbrDynamic_RAM, FIXP_DBL)
+  FIXP_DBL* GetRam_SbrDynamic_RAM(int nChannels); void FreeRam_SbrDynamic_RAM(FIXP_DBL** p);
 
   H_ALLOC_MEM(Ram_SbrEncoder, SBR_ENCODER)
   H_ALLOC_MEM(Ram_SbrChannel, SBR_CHANNEL)
@@ -610,6 +610,24 @@ static inline INT FDKlibInfo_lookup( const LIB_INFO* info, FDK_MODULE_ID module_
 }
 
 
+/*
+ * ##############################################################################################
+ * Profiling
+ * ##############################################################################################
+ */
+
+/**
+ *  Execution time counter of one codec stage, see aacDecoder_GetProfile() and aacEncGetProfile().
+ *  Times are given in ticks of the processor time stamp counter where available, else of a monotonic system clock.
+ */
+typedef struct FDK_PROFILE_COUNTER
+{
+  UINT    calls;      /*!< Number of frames the stage has been executed in. */
+  UINT64  cycles;     /*!< Accumulated execution time of the stage. */
+  UINT64  maxCycles;  /*!< Maximum execution time of the stage in one frame. */
+} FDK_PROFILE_COUNTER;
+
+
 /*
  * ##############################################################################################
  * Buffer description
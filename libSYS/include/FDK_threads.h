@@ -0,0 +1,173 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+   Description: Worker thread pool
+
+******************************************************************************/
+
+/** \file   FDK_threads.h
+ *  \brief  Pool of worker threads which process a set of independent jobs.
+ *
+ *  A job set is run by FDKworkerPoolRun(). The calling thread takes part in
+ *  the processing as worker 0 and the call returns after all jobs have been
+ *  completed. Jobs must not depend on each other and must not depend on the
+ *  order or the worker they are processed by, except for using per worker
+ *  scratch memory selected by the worker index.
+ */
+
+#ifndef FDK_THREADS_H
+#define FDK_THREADS_H
+
+#include "machine_type.h"
+
+/** Maximum number of workers of one pool, including the calling thread. */
+#define FDK_MAX_WORKERS  (64)
+
+typedef struct FDK_WORKER_POOL *HANDLE_FDK_WORKER_POOL;
+
+/**
+ * \brief Job function.
+ * \param pJobData     Pointer given to FDKworkerPoolRun().
+ * \param jobIndex     Index of the job, 0 to nJobs-1.
+ * \param workerIndex  Index of the worker processing the job, 0 to nWorkers-1.
+ */
+typedef void (*FDK_WORKER_JOB)(void *pJobData, INT jobIndex, INT workerIndex);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Create a worker pool.
+ * \param phPool    Pointer to the pool handle.
+ * \param nWorkers  Number of workers including the calling thread, 1 to FDK_MAX_WORKERS.
+ *                  For nWorkers equal to 1 no thread is created.
+ * \return 0 on success, -1 if the threads could not be created.
+ */
+INT  FDKworkerPoolOpen(HANDLE_FDK_WORKER_POOL *phPool, INT nWorkers);
+
+/**
+ * \brief Process nJobs jobs and wait for their completion. A NULL pool processes
+ *        all jobs in the calling thread as worker 0.
+ */
+void FDKworkerPoolRun(HANDLE_FDK_WORKER_POOL hPool, FDK_WORKER_JOB job, void *pJobData, INT nJobs);
+
+/**
+ * \brief Process nJobs jobs like FDKworkerPoolRun(), but queue each job to a preferred worker.
+ *        Each worker has its own queue with its own lock. It processes the jobs of its queue
+ *        in order and then steals jobs from the end of the queues of the other workers.
+ *        Preferring the worker which processed the data of a job before keeps the data in
+ *        the cache of that worker.
+ * \param pHomeWorker  Preferred worker of each job. Jobs with a value outside of 0 to
+ *                     nWorkers-1 are distributed round robin. NULL is equivalent to
+ *                     FDKworkerPoolRun().
+ */
+void FDKworkerPoolRunAffine(HANDLE_FDK_WORKER_POOL hPool, FDK_WORKER_JOB job, void *pJobData, INT nJobs, const INT *pHomeWorker);
+
+/**
+ * \brief Bind each worker thread of the pool to one CPU core of the cores the process may run on.
+ *        The cores are handed out round robin by a counter shared by all pools, so the threads of
+ *        several pools use different cores as long as there are enough of them. The calling
+ *        thread, worker 0, is not bound and keeps its affinity.
+ * \return 0 on success, -1 if not supported on the platform.
+ */
+INT  FDKworkerPoolBindThreads(HANDLE_FDK_WORKER_POOL hPool);
+
+/**
+ * \brief Get the number of workers of a pool, 1 for a NULL pool.
+ */
+INT  FDKworkerPoolGetNumWorkers(HANDLE_FDK_WORKER_POOL hPool);
+
+/**
+ * \brief Stop all threads and free the pool.
+ */
+void FDKworkerPoolClose(HANDLE_FDK_WORKER_POOL *phPool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FDK_THREADS_H */
@@ -255,6 +255,83 @@ char *FDKstrncpy(char *dest, const char *src, const UINT n);
 
 #define FDK_MAX_OVERLAYS 8   /**< Maximum number of memory overlays. */
 
+/**
+ * Memory allocator of a codec instance. All heap memory of an instance opened with an allocator
+ * is obtained from alloc() and returned to free(), both called with the given context.
+ */
+typedef struct FDK_ALLOCATOR
+{
+  void *(*alloc)(void *context, UINT size, UINT alignment); /*!< Return size bytes aligned to alignment bytes or NULL. The memory does not need to be cleared. */
+  void  (*free)(void *context, void *ptr);                  /*!< Release a memory area returned by alloc(). */
+  void   *context;                                          /*!< User data passed to alloc() and free(), e.g. an arena or a NUMA node pool. */
+} FDK_ALLOCATOR;
+
+/**
+ *  Select the allocator used by FDKcalloc(), FDKmalloc() and FDKaalloc() in the calling thread.
+ *  Memory is always released to the allocator it was obtained from, independent of the allocator
+ *  selected at the time FDKfree() is called.
+ *
+ * \param pAllocator  Allocator to be used. NULL or an allocator without alloc() function selects
+ *                    the C library heap.
+ * \return            Allocator selected before, to be restored by the caller.
+ */
+const FDK_ALLOCATOR *FDKsetAllocator(const FDK_ALLOCATOR *pAllocator);
+
+/**
+ *  Select a counter of the memory held by an instance in the calling thread. FDKcalloc(), FDKmalloc() and
+ *  FDKaalloc() add the size of each memory area including its management data, FDKfree() and FDKafree()
+ *  subtract it again.
+ *
+ * \param pCounter  Counter to be updated, NULL to stop counting.
+ * \return          Counter selected before, to be restored by the caller.
+ */
+UINT *FDKsetAllocCounter(UINT *pCounter);
+
+#define FDK_ARENA_ALIGNMENT 64   /**< Alignment of the arena memory and granularity of the blocks carved from it. The memory handed
+                                      out follows a block header and is only guaranteed to be aligned to 16 bytes. */
+
+/**
+ * Allocator which carves all memory blocks of a codec instance from one contiguous memory area.
+ * Released blocks are kept in a list and reused by later allocations of the same or a smaller size.
+ */
+typedef struct
+{
+  FDK_ALLOCATOR  allocator;  /*!< Allocator interface of the arena, its context points to the arena. */
+  UCHAR         *pBase;      /*!< Start of the memory area, NULL for an arena which only measures. */
+  UINT           size;       /*!< Size of the memory area in bytes. */
+  UINT           used;       /*!< Bytes carved from the memory area so far. */
+  void          *pFreeList;  /*!< Released blocks. */
+} FDK_ARENA;
+
+/**
+ *  Initialize an arena.
+ *
+ * \param pArena   Arena to be initialized.
+ * \param pMemory  Memory area aligned to ::FDK_ARENA_ALIGNMENT bytes. NULL sets up an arena which serves all
+ *                 requests from the C library heap and only accounts the size an arena would need.
+ * \param size     Size of the memory area in bytes.
+ * \return         0 on success, -1 if pMemory is not aligned.
+ */
+INT FDKarenaInit(FDK_ARENA *pArena, void *pMemory, const UINT size);
+
+/**
+ *  Set up an arena in a memory area and place the FDK_ARENA structure at its start.
+ *
+ * \param pMemory  Memory area aligned to ::FDK_ARENA_ALIGNMENT bytes.
+ * \param size     Size of the memory area in bytes, including FDKarenaGetOverhead() bytes for the arena structure.
+ * \return         The arena, or NULL if pMemory is not aligned or too small.
+ */
+FDK_ARENA *FDKarenaCreate(void *pMemory, const UINT size);
+
+/**
+ *  Get the memory occupied by the FDK_ARENA structure in a memory area set up with FDKarenaCreate().
+ */
+UINT FDKarenaGetOverhead(void);
+
+/**
+ *  Get the arena memory needed by FDKcalloc(), FDKmalloc() or FDKaalloc() for a request of size bytes.
+ */
+UINT FDKarenaGetBlockSize(const UINT size);
 
 void *FDKcalloc (const UINT n, const UINT size);
 void *FDKmalloc (const UINT size);
@@ -0,0 +1,501 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+   Description: Worker thread pool
+
+******************************************************************************/
+
+#include "FDK_threads.h"
+
+#include "genericStds.h"
+
+#if defined(_WIN32)
+  #include <windows.h>
+  #include <process.h>
+
+  typedef HANDLE             FDK_THREAD;
+  typedef CRITICAL_SECTION   FDK_MUTEX;
+  typedef CONDITION_VARIABLE FDK_COND;
+
+  #define FDK_THREAD_RETURN  unsigned __stdcall
+  #define mutexInit(m)       InitializeCriticalSection(m)
+  #define mutexDestroy(m)    DeleteCriticalSection(m)
+  #define mutexLock(m)       EnterCriticalSection(m)
+  #define mutexUnlock(m)     LeaveCriticalSection(m)
+  #define condInit(c)        InitializeConditionVariable(c)
+  #define condDestroy(c)
+  #define condWait(c,m)      SleepConditionVariableCS(c, m, INFINITE)
+  #define condSignal(c)      WakeConditionVariable(c)
+  #define condBroadcast(c)   WakeAllConditionVariable(c)
+
+  typedef LONG               FDK_ATOMIC;
+  #define atomicDecrement(p) InterlockedDecrement(p)
+  #define atomicFetchAdd(p,n) InterlockedExchangeAdd(p, n)
+#else
+  #include <pthread.h>
+  #if defined(__linux__) && !defined(__ANDROID__) && defined(_GNU_SOURCE)
+    #include <sched.h>
+    #include <unistd.h>
+    #define FDK_THREAD_AFFINITY
+  #endif
+
+  typedef pthread_t          FDK_THREAD;
+  typedef pthread_mutex_t    FDK_MUTEX;
+  typedef pthread_cond_t     FDK_COND;
+
+  #define FDK_THREAD_RETURN  void *
+  #define mutexInit(m)       pthread_mutex_init(m, NULL)
+  #define mutexDestroy(m)    pthread_mutex_destroy(m)
+  #define mutexLock(m)       pthread_mutex_lock(m)
+  #define mutexUnlock(m)     pthread_mutex_unlock(m)
+  #define condInit(c)        pthread_cond_init(c, NULL)
+  #define condDestroy(c)     pthread_cond_destroy(c)
+  #define condWait(c,m)      pthread_cond_wait(c, m)
+  #define condSignal(c)      pthread_cond_signal(c)
+  #define condBroadcast(c)   pthread_cond_broadcast(c)
+
+  typedef INT                FDK_ATOMIC;
+  #define atomicDecrement(p) __sync_sub_and_fetch(p, 1)
+  #define atomicFetchAdd(p,n) __sync_fetch_and_add(p, n)
+#endif
+
+typedef struct
+{
+  struct FDK_WORKER_POOL *hPool;
+  INT                     workerIndex;
+  FDK_THREAD              thread;
+} FDK_WORKER;
+
+struct FDK_WORKER_POOL
+{
+  INT             nWorkers;         /*!< Number of workers including the calling thread. */
+  INT             nThreads;         /*!< Number of threads successfully started. */
+  FDK_WORKER      worker[FDK_MAX_WORKERS];
+
+  FDK_MUTEX       lock;             /*!< Protects the job set state below except for the queues. */
+  FDK_COND        jobsAvailable;    /*!< Signaled when a new job set is started or on shutdown. */
+  FDK_COND        jobsDone;         /*!< Signaled when the last job is completed or the last worker got idle. */
+
+  FDK_WORKER_JOB  job;
+  void           *pJobData;
+  INT             nBusy;            /*!< Number of worker threads processing the current job set. */
+  UINT            jobSet;           /*!< Counter of job sets started so far. */
+  INT             quit;
+  volatile FDK_ATOMIC nPending;     /*!< Number of jobs not completed yet. */
+
+  INT            *queue;            /*!< Job indices sorted by preferred worker. */
+  INT             queueSize;        /*!< Allocated length of queue. */
+  FDK_MUTEX       queueLock[FDK_MAX_WORKERS]; /*!< One lock per queue, taken by the owner and by thieves. */
+  INT             queueHead[FDK_MAX_WORKERS]; /*!< Next job in the queue of each worker. */
+  INT             queueTail[FDK_MAX_WORKERS]; /*!< End of the queue of each worker. */
+};
+
+/* Get the next job for a worker, -1 if none is left. */
+static INT fetchJob(struct FDK_WORKER_POOL *hPool, INT workerIndex)
+{
+  INT jobIndex = -1, i;
+
+  /* own queue first, in order */
+  mutexLock(&hPool->queueLock[workerIndex]);
+  if (hPool->queueHead[workerIndex] < hPool->queueTail[workerIndex]) {
+    jobIndex = hPool->queue[hPool->queueHead[workerIndex]++];
+  }
+  mutexUnlock(&hPool->queueLock[workerIndex]);
+
+  /* steal from the end of the queues of the other workers, starting with the next one */
+  for (i = 1; (jobIndex < 0) && (i < hPool->nWorkers); i++) {
+    INT victim = (workerIndex + i) % hPool->nWorkers;
+
+    mutexLock(&hPool->queueLock[victim]);
+    if (hPool->queueHead[victim] < hPool->queueTail[victim]) {
+      jobIndex = hPool->queue[--hPool->queueTail[victim]];
+    }
+    mutexUnlock(&hPool->queueLock[victim]);
+  }
+
+  return jobIndex;
+}
+
+/* Process jobs of the current job set until none is left. Must be called without the pool lock. */
+static void processJobs(struct FDK_WORKER_POOL *hPool, INT workerIndex)
+{
+  INT jobIndex;
+
+  while ((jobIndex = fetchJob(hPool, workerIndex)) >= 0) {
+    hPool->job(hPool->pJobData, jobIndex, workerIndex);
+
+    if (atomicDecrement(&hPool->nPending) == 0) {
+      mutexLock(&hPool->lock);
+      condSignal(&hPool->jobsDone);
+      mutexUnlock(&hPool->lock);
+    }
+  }
+}
+
+static FDK_THREAD_RETURN workerThread(void *arg)
+{
+  FDK_WORKER *pWorker = (FDK_WORKER*)arg;
+  struct FDK_WORKER_POOL *hPool = pWorker->hPool;
+  UINT jobSet = 0;
+
+  mutexLock(&hPool->lock);
+  for (;;) {
+    while (!hPool->quit && (hPool->jobSet == jobSet)) {
+      condWait(&hPool->jobsAvailable, &hPool->lock);
+    }
+    if (hPool->quit) {
+      break;
+    }
+    jobSet = hPool->jobSet;
+    hPool->nBusy++;
+    mutexUnlock(&hPool->lock);
+
+    processJobs(hPool, pWorker->workerIndex);
+
+    mutexLock(&hPool->lock);
+    if (--hPool->nBusy == 0) {
+      condSignal(&hPool->jobsDone);
+    }
+  }
+  mutexUnlock(&hPool->lock);
+
+  return 0;
+}
+
+static INT startThread(FDK_WORKER *pWorker)
+{
+#if defined(_WIN32)
+  pWorker->thread = (HANDLE)_beginthreadex(NULL, 0, workerThread, pWorker, 0, NULL);
+  return (pWorker->thread != 0) ? 0 : -1;
+#else
+  return (pthread_create(&pWorker->thread, NULL, workerThread, pWorker) == 0) ? 0 : -1;
+#endif
+}
+
+static void joinThread(FDK_WORKER *pWorker)
+{
+#if defined(_WIN32)
+  WaitForSingleObject(pWorker->thread, INFINITE);
+  CloseHandle(pWorker->thread);
+#else
+  pthread_join(pWorker->thread, NULL);
+#endif
+}
+
+INT FDKworkerPoolOpen(HANDLE_FDK_WORKER_POOL *phPool, INT nWorkers)
+{
+  struct FDK_WORKER_POOL *hPool;
+  INT i;
+
+  if ( (phPool == NULL) || (nWorkers < 1) || (nWorkers > FDK_MAX_WORKERS) ) {
+    return -1;
+  }
+
+  hPool = (struct FDK_WORKER_POOL*)FDKcalloc(1, sizeof(struct FDK_WORKER_POOL));
+  if (hPool == NULL) {
+    return -1;
+  }
+
+  mutexInit(&hPool->lock);
+  condInit(&hPool->jobsAvailable);
+  condInit(&hPool->jobsDone);
+  for (i = 0; i < nWorkers; i++) {
+    mutexInit(&hPool->queueLock[i]);
+  }
+
+  hPool->nWorkers = nWorkers;
+
+  /* Worker 0 is the thread calling FDKworkerPoolRun(). */
+  for (i = 1; i < nWorkers; i++) {
+    hPool->worker[i].hPool = hPool;
+    hPool->worker[i].workerIndex = i;
+    if (startThread(&hPool->worker[i]) != 0) {
+      FDKworkerPoolClose(&hPool);
+      return -1;
+    }
+    hPool->nThreads = i;
+  }
+
+  *phPool = hPool;
+
+  return 0;
+}
+
+/* Sort the jobs by preferred worker keeping their order (counting sort). Jobs without a preferred
+   worker are distributed round robin. Must be called with the lock held while no worker is busy. */
+static INT setupQueues(struct FDK_WORKER_POOL *hPool, INT nJobs, const INT *pHomeWorker)
+{
+  INT i, w, pos;
+
+  if (hPool->queueSize < nJobs) {
+    if (hPool->queue != NULL) {
+      FDKfree(hPool->queue);
+    }
+    hPool->queueSize = 0;
+    hPool->queue = (INT*)FDKcalloc(nJobs, sizeof(INT));
+    if (hPool->queue == NULL) {
+      return -1;
+    }
+    hPool->queueSize = nJobs;
+  }
+
+  for (w = 0; w < hPool->nWorkers; w++) {
+    hPool->queueTail[w] = 0;
+  }
+  for (i = 0; i < nJobs; i++) {
+    w = ( (pHomeWorker != NULL) && (pHomeWorker[i] >= 0) && (pHomeWorker[i] < hPool->nWorkers) ) ? pHomeWorker[i] : (i % hPool->nWorkers);
+    hPool->queueTail[w]++;
+  }
+  for (w = 0, pos = 0; w < hPool->nWorkers; w++) {
+    hPool->queueHead[w] = pos;
+    pos += hPool->queueTail[w];
+    hPool->queueTail[w] = hPool->queueHead[w];
+  }
+  for (i = 0; i < nJobs; i++) {
+    w = ( (pHomeWorker != NULL) && (pHomeWorker[i] >= 0) && (pHomeWorker[i] < hPool->nWorkers) ) ? pHomeWorker[i] : (i % hPool->nWorkers);
+    hPool->queue[hPool->queueTail[w]++] = i;
+  }
+
+  return 0;
+}
+
+/* Start a job set, process jobs as worker 0 and wait for the completion of all jobs. */
+static INT runJobSet(struct FDK_WORKER_POOL *hPool, FDK_WORKER_JOB job, void *pJobData, INT nJobs, const INT *pHomeWorker)
+{
+  mutexLock(&hPool->lock);
+
+  /* A worker which woke up late for the previous job set may still be scanning the queues. */
+  while (hPool->nBusy > 0) {
+    condWait(&hPool->jobsDone, &hPool->lock);
+  }
+  if (setupQueues(hPool, nJobs, pHomeWorker) != 0) {
+    mutexUnlock(&hPool->lock);
+    return -1;
+  }
+  hPool->job      = job;
+  hPool->pJobData = pJobData;
+  hPool->nPending = nJobs;
+  hPool->jobSet++;
+  condBroadcast(&hPool->jobsAvailable);
+  mutexUnlock(&hPool->lock);
+
+  processJobs(hPool, 0);
+
+  mutexLock(&hPool->lock);
+  while ( (hPool->nPending > 0) || (hPool->nBusy > 0) ) {
+    condWait(&hPool->jobsDone, &hPool->lock);
+  }
+  mutexUnlock(&hPool->lock);
+
+  return 0;
+}
+
+void FDKworkerPoolRun(HANDLE_FDK_WORKER_POOL hPool, FDK_WORKER_JOB job, void *pJobData, INT nJobs)
+{
+  FDKworkerPoolRunAffine(hPool, job, pJobData, nJobs, NULL);
+}
+
+void FDKworkerPoolRunAffine(HANDLE_FDK_WORKER_POOL hPool, FDK_WORKER_JOB job, void *pJobData, INT nJobs, const INT *pHomeWorker)
+{
+  if ( (hPool == NULL) || (hPool->nWorkers < 2) || (nJobs < 2)
+    || (runJobSet(hPool, job, pJobData, nJobs, pHomeWorker) != 0) )
+  {
+    INT i;
+    for (i = 0; i < nJobs; i++) {
+      job(pJobData, i, 0);
+    }
+  }
+}
+
+/* Next core to bind a worker thread to, counted over the cores the process may run on and shared by
+   all pools, so that the threads of several pools are spread over different cores. */
+static volatile FDK_ATOMIC nextCpu = 0;
+
+INT FDKworkerPoolBindThreads(HANDLE_FDK_WORKER_POOL hPool)
+{
+  INT i, err = 0;
+
+  if (hPool == NULL) {
+    return -1;
+  }
+  if (hPool->nThreads < 1) {
+    return 0;
+  }
+
+#if defined(_WIN32)
+  {
+    DWORD_PTR processMask, systemMask;
+    INT nCpus = 0, first;
+
+    if ( (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) == 0) || (processMask == 0) ) {
+      return -1;
+    }
+    for (i = 0; i < (INT)(8*sizeof(DWORD_PTR)); i++) {
+      nCpus += (INT)((processMask >> i) & 1);
+    }
+    first = (INT)atomicFetchAdd(&nextCpu, hPool->nThreads);
+    for (i = 1; i <= hPool->nThreads; i++) {
+      INT n = (INT)((UINT)(first + i - 1) % (UINT)nCpus), cpu = -1;
+      while (n >= 0) {
+        cpu++;
+        n -= (INT)((processMask >> cpu) & 1);
+      }
+      if (SetThreadAffinityMask(hPool->worker[i].thread, (DWORD_PTR)1 << cpu) == 0) {
+        err = -1;
+      }
+    }
+  }
+#elif defined(FDK_THREAD_AFFINITY)
+  {
+    cpu_set_t processCpus;
+    INT nCpus, first;
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &processCpus) != 0) {
+      return -1;
+    }
+    nCpus = CPU_COUNT(&processCpus);
+    if (nCpus < 1) {
+      return -1;
+    }
+    first = atomicFetchAdd(&nextCpu, hPool->nThreads);
+    for (i = 1; i <= hPool->nThreads; i++) {
+      cpu_set_t cpus;
+      INT n = (INT)((UINT)(first + i - 1) % (UINT)nCpus), cpu = -1;
+      while (n >= 0) {
+        cpu++;
+        n -= CPU_ISSET(cpu, &processCpus) ? 1 : 0;
+      }
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      if (pthread_setaffinity_np(hPool->worker[i].thread, sizeof(cpu_set_t), &cpus) != 0) {
+        err = -1;
+      }
+    }
+  }
+#else
+  err = -1;
+#endif
+
+  return err;
+}
+
+INT FDKworkerPoolGetNumWorkers(HANDLE_FDK_WORKER_POOL hPool)
+{
+  return (hPool != NULL) ? hPool->nWorkers : 1;
+}
+
+void FDKworkerPoolClose(HANDLE_FDK_WORKER_POOL *phPool)
+{
+  struct FDK_WORKER_POOL *hPool;
+  INT i;
+
+  if ( (phPool == NULL) || (*phPool == NULL) ) {
+    return;
+  }
+  hPool = *phPool;
+
+  mutexLock(&hPool->lock);
+  hPool->quit = 1;
+  condBroadcast(&hPool->jobsAvailable);
+  mutexUnlock(&hPool->lock);
+
+  for (i = 1; i <= hPool->nThreads; i++) {
+    joinThread(&hPool->worker[i]);
+  }
+
+  for (i = 0; i < hPool->nWorkers; i++) {
+    mutexDestroy(&hPool->queueLock[i]);
+  }
+  condDestroy(&hPool->jobsDone);
+  condDestroy(&hPool->jobsAvailable);
+  mutexDestroy(&hPool->lock);
+
+  if (hPool->queue != NULL) {
+    FDKfree(hPool->queue);
+  }
+  FDKfree(hPool);
+  *phPool = NULL;
+}
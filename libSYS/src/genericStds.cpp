@@ -199,12 +199,83 @@ char *FDKstrncpy(char *dest, const char *src, UINT n)             { return strnc
  * DYNAMIC MEMORY management (heap)
  *************************************************************************/
 
+/* Allocations carry a header which records the allocator they were obtained from and their size.
+   Its size keeps the natural alignment of the C library heap for the memory following the header. */
+typedef union
+{
+  struct {
+    void (*free)(void *context, void *ptr);
+    void  *context;
+    UINT   size;
+  } owner;
+  double align[4];
+} FDK_ALLOC_HEADER;
+
+#if defined(_MSC_VER)
+  #define FDK_THREAD_LOCAL __declspec(thread)
+#else
+  #define FDK_THREAD_LOCAL __thread
+#endif
+
+static FDK_THREAD_LOCAL const FDK_ALLOCATOR *fdkCurrentAllocator = NULL;
+static FDK_THREAD_LOCAL UINT *fdkCurrentCounter = NULL;
+
+const FDK_ALLOCATOR *FDKsetAllocator(const FDK_ALLOCATOR *pAllocator)
+{
+  const FDK_ALLOCATOR *prev = fdkCurrentAllocator;
+
+  fdkCurrentAllocator = ( (pAllocator != NULL) && (pAllocator->alloc != NULL) ) ? pAllocator : NULL;
+
+  return prev;
+}
+
+UINT *FDKsetAllocCounter(UINT *pCounter)
+{
+  UINT *prev = fdkCurrentCounter;
+
+  fdkCurrentCounter = pCounter;
+
+  return prev;
+}
+
+static void *FDKallocWithHeader(const UINT size, const INT clear)
+{
+  const FDK_ALLOCATOR *pAllocator = fdkCurrentAllocator;
+  FDK_ALLOC_HEADER *pHeader;
+
+  if (pAllocator != NULL) {
+    pHeader = (FDK_ALLOC_HEADER*)pAllocator->alloc(pAllocator->context, size + sizeof(FDK_ALLOC_HEADER), sizeof(FDK_ALLOC_HEADER));
+    if (pHeader == NULL) {
+      return NULL;
+    }
+    if (clear) {
+      memset(pHeader + 1, 0, size);
+    }
+    pHeader->owner.free    = pAllocator->free;
+    pHeader->owner.context = pAllocator->context;
+  } else {
+    pHeader = (FDK_ALLOC_HEADER*)(clear ? calloc(1, size + sizeof(FDK_ALLOC_HEADER)) : malloc(size + sizeof(FDK_ALLOC_HEADER)));
+    if (pHeader == NULL) {
+      return NULL;
+    }
+    pHeader->owner.free    = NULL;
+    pHeader->owner.context = NULL;
+  }
+  pHeader->owner.size = size + sizeof(FDK_ALLOC_HEADER);
+
+  if (fdkCurrentCounter != NULL) {
+    *fdkCurrentCounter += pHeader->owner.size;
+  }
+
+  return (void*)(pHeader + 1);
+}
+
 #ifndef FUNCTION_FDKcalloc
 void *FDKcalloc (const UINT n, const UINT size)
 {
   void* ptr;
 
-  ptr = calloc(n, size);
+  ptr = FDKallocWithHeader(n * size, 1);
 
   return ptr;
 }
@@ -215,7 +286,7 @@ void *FDKmalloc (const UINT size)
 {
   void* ptr;
 
-  ptr = malloc(size);
+  ptr = FDKallocWithHeader(size, 0);
 
   return ptr;
 }
@@ -224,11 +295,142 @@ void *FDKmalloc (const UINT size)
 #ifndef FUNCTION_FDKfree
 void  FDKfree (void *ptr)
 {
+  FDK_ALLOC_HEADER *pHeader;
+
+  if (ptr == NULL) {
+    return;
+  }
+
   /* FDKprintf("f, heapSize: %d\n", heapSizeCurr); */
-  free((INT*)ptr);
+  pHeader = ((FDK_ALLOC_HEADER*)ptr) - 1;
+  if (fdkCurrentCounter != NULL) {
+    *fdkCurrentCounter -= pHeader->owner.size;
+  }
+  if (pHeader->owner.free != NULL) {
+    pHeader->owner.free(pHeader->owner.context, (void*)pHeader);
+  } else {
+    free((INT*)pHeader);
+  }
 }
 #endif
 
+/* Header of an arena block, keeps the block size and links released blocks. Its size is a multiple
+   of FDK_ALLOC_HEADER to keep the alignment of the memory following it. */
+typedef union FDK_ARENA_BLOCK
+{
+  struct {
+    union FDK_ARENA_BLOCK *pNext;
+    UINT                   size;
+  } block;
+  FDK_ALLOC_HEADER align;
+} FDK_ARENA_BLOCK;
+
+static UINT FDKarenaBlockSize(const UINT size)
+{
+  return (size + sizeof(FDK_ARENA_BLOCK) + (FDK_ARENA_ALIGNMENT-1)) & ~(UINT)(FDK_ARENA_ALIGNMENT-1);
+}
+
+static void *FDKarenaAlloc(void *context, UINT size, UINT alignment)
+{
+  FDK_ARENA *pArena = (FDK_ARENA*)context;
+  FDK_ARENA_BLOCK *pBlock, **ppPrev;
+  UINT blockSize = FDKarenaBlockSize(size);
+
+  if (alignment > FDK_ARENA_ALIGNMENT) {
+    return NULL;
+  }
+
+  if (pArena->pBase == NULL) {
+    /* Measure only. Released blocks are not accounted for reuse, which keeps the result an upper bound. */
+    pBlock = (FDK_ARENA_BLOCK*)malloc(blockSize);
+    if (pBlock == NULL) {
+      return NULL;
+    }
+    pBlock->block.size = blockSize;
+    pArena->used += blockSize;
+    return (void*)(pBlock + 1);
+  }
+
+  /* Reuse the first released block which is large enough. */
+  for (ppPrev = (FDK_ARENA_BLOCK**)&pArena->pFreeList; *ppPrev != NULL; ppPrev = &(*ppPrev)->block.pNext) {
+    if ((*ppPrev)->block.size >= blockSize) {
+      pBlock  = *ppPrev;
+      *ppPrev = pBlock->block.pNext;
+      return (void*)(pBlock + 1);
+    }
+  }
+
+  if (blockSize > pArena->size - pArena->used) {
+    return NULL;
+  }
+  pBlock = (FDK_ARENA_BLOCK*)(pArena->pBase + pArena->used);
+  pBlock->block.size = blockSize;
+  pArena->used += blockSize;
+
+  return (void*)(pBlock + 1);
+}
+
+static void FDKarenaFree(void *context, void *ptr)
+{
+  FDK_ARENA *pArena = (FDK_ARENA*)context;
+  FDK_ARENA_BLOCK *pBlock = ((FDK_ARENA_BLOCK*)ptr) - 1;
+
+  if (pArena->pBase == NULL) {
+    free(pBlock);
+    return;
+  }
+
+  if ((UCHAR*)pBlock + pBlock->block.size == pArena->pBase + pArena->used) {
+    /* Last block carved from the area. */
+    pArena->used -= pBlock->block.size;
+  } else {
+    pBlock->block.pNext = (FDK_ARENA_BLOCK*)pArena->pFreeList;
+    pArena->pFreeList = pBlock;
+  }
+}
+
+INT FDKarenaInit(FDK_ARENA *pArena, void *pMemory, const UINT size)
+{
+  if ( ((UINT64)pMemory & (FDK_ARENA_ALIGNMENT-1)) != 0 ) {
+    return -1;
+  }
+
+  pArena->allocator.alloc   = FDKarenaAlloc;
+  pArena->allocator.free    = FDKarenaFree;
+  pArena->allocator.context = (void*)pArena;
+  pArena->pBase     = (UCHAR*)pMemory;
+  pArena->size      = (pMemory != NULL) ? size : 0;
+  pArena->used      = 0;
+  pArena->pFreeList = NULL;
+
+  return 0;
+}
+
+UINT FDKarenaGetOverhead(void)
+{
+  return (sizeof(FDK_ARENA) + (FDK_ARENA_ALIGNMENT-1)) & ~(UINT)(FDK_ARENA_ALIGNMENT-1);
+}
+
+FDK_ARENA *FDKarenaCreate(void *pMemory, const UINT size)
+{
+  FDK_ARENA *pArena = (FDK_ARENA*)pMemory;
+  UINT overhead = FDKarenaGetOverhead();
+
+  if ( (pMemory == NULL) || (size < overhead) ) {
+    return NULL;
+  }
+  if (FDKarenaInit(pArena, (UCHAR*)pMemory + overhead, size - overhead) != 0) {
+    return NULL;
+  }
+
+  return pArena;
+}
+
+UINT FDKarenaGetBlockSize(const UINT size)
+{
+  return FDKarenaBlockSize(size + sizeof(FDK_ALLOC_HEADER));
+}
+
 #ifndef FUNCTION_FDKaalloc
 void *FDKaalloc(const UINT size, const UINT alignment)
 {
@@ -0,0 +1,113 @@
+/* ------------------------------------------------------------------
+ * Copyright (C) 2026 The fdk-aac project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ * -------------------------------------------------------------------
+ */
+
+#include "wavwriter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+struct wav_writer {
+	FILE *wav;
+	uint32_t data_length;
+
+	int sample_rate;
+	int bits_per_sample;
+	int channels;
+};
+
+static void write_string(struct wav_writer* ww, const char *str) {
+	fputc(str[0], ww->wav);
+	fputc(str[1], ww->wav);
+	fputc(str[2], ww->wav);
+	fputc(str[3], ww->wav);
+}
+
+static void write_int32(struct wav_writer* ww, uint32_t value) {
+	fputc((value >>  0) & 0xff, ww->wav);
+	fputc((value >>  8) & 0xff, ww->wav);
+	fputc((value >> 16) & 0xff, ww->wav);
+	fputc((value >> 24) & 0xff, ww->wav);
+}
+
+static void write_int16(struct wav_writer* ww, uint16_t value) {
+	fputc((value >> 0) & 0xff, ww->wav);
+	fputc((value >> 8) & 0xff, ww->wav);
+}
+
+static void write_header(struct wav_writer* ww, uint32_t data_length) {
+	int bytes_per_frame = ww->bits_per_sample/8*ww->channels;
+
+	write_string(ww, "RIFF");
+	write_int32(ww, 4 + 8 + 16 + 8 + data_length);
+	write_string(ww, "WAVE");
+
+	write_string(ww, "fmt ");
+	write_int32(ww, 16);
+	write_int16(ww, 1);                                  /* format: PCM */
+	write_int16(ww, ww->channels);
+	write_int32(ww, ww->sample_rate);
+	write_int32(ww, ww->sample_rate*bytes_per_frame);    /* byte rate */
+	write_int16(ww, bytes_per_frame);                    /* block align */
+	write_int16(ww, ww->bits_per_sample);
+
+	write_string(ww, "data");
+	write_int32(ww, data_length);
+}
+
+void* wav_write_open(const char *filename, int sample_rate, int bits_per_sample, int channels) {
+	struct wav_writer* ww = (struct wav_writer*) malloc(sizeof(*ww));
+	memset(ww, 0, sizeof(*ww));
+
+	if (!strcmp(filename, "-"))
+		ww->wav = stdout;
+	else
+		ww->wav = fopen(filename, "wb");
+	if (ww->wav == NULL) {
+		free(ww);
+		return NULL;
+	}
+
+	ww->sample_rate = sample_rate;
+	ww->bits_per_sample = bits_per_sample;
+	ww->channels = channels;
+
+	/* The lengths are patched on close if the output is seekable. */
+	write_header(ww, 0xffffffff - 36);
+	return ww;
+}
+
+void wav_write_close(void* obj) {
+	struct wav_writer* ww = (struct wav_writer*) obj;
+
+	if (ww->wav != stdout) {
+		if (fseek(ww->wav, 0, SEEK_SET) == 0)
+			write_header(ww, ww->data_length);
+		fclose(ww->wav);
+	}
+	free(ww);
+}
+
+void wav_write_data(void* obj, const unsigned char* data, int length) {
+	struct wav_writer* ww = (struct wav_writer*) obj;
+	if (ww->wav == NULL)
+		return;
+	fwrite(data, length, 1, ww->wav);
+	ww->data_length += length;
+}
+